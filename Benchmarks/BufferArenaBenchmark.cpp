@@ -0,0 +1,178 @@
+// Many small meshes drawn two ways (ColorVertex, 16-bit indices, into a 16x16 target so only submission counts):
+//   - a VAO, VBO and EBO per mesh, glBindVertexArray + glDrawElements per draw
+//   - one BufferArena for vertices and one for indices, one shared VAO, glDrawElementsBaseVertex per draw
+// Reports buffer objects, set-up time and the best CPU + GPU time of a frame that draws every mesh once.
+// Then churns a BufferArena with random allocations and frees and reports allocator speed, fragmentation and what a
+// Defragment() costs. Runs on a headless EGL context.
+//
+// Build: g++ -O2 -std=c++17 -I<deps>/include Benchmarks/BufferArenaBenchmark.cpp glad.c -o BufferArenaBenchmark -lEGL -ldl
+// Usage: BufferArenaBenchmark [meshes] [frames]
+
+#include "../my_glad.h"
+#include "../HeadlessContext.h"
+#include "../Framebuffer.h"
+#include "../Shader.h"
+#include "../VertexLayout.h"
+#include "../BufferArena.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+static const char* VERTEX_SOURCE =
+	"#version 330 core\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"layout (location = 1) in vec3 aColor;\n"
+	"out vec3 ourColor;\n"
+	"void main() { ourColor = aColor; gl_Position = vec4(aPos, 1.0); }\n";
+
+static const char* FRAGMENT_SOURCE =
+	"#version 330 core\n"
+	"in vec3 ourColor;\n"
+	"out vec4 FragColor;\n"
+	"void main() { FragColor = vec4(ourColor, 1.0); }\n";
+
+struct Mesh
+{
+	std::vector<ColorVertex> vertices;
+	std::vector<uint16_t> indices;
+};
+
+int main(int argc, char** argv)
+{
+	int meshCount = argc > 1 ? atoi(argv[1]) : 2000;
+	int frames = argc > 2 ? atoi(argv[2]) : 20;
+
+	HeadlessContext context;
+	if (!context.Init() || !gladLoadGLLoader(HeadlessContext::GetProcAddress()))
+		return -1;
+	Framebuffer framebuffer;
+	if (!framebuffer.Create(16, 16))
+		return -1;
+	framebuffer.Bind();
+	Shader shader(VERTEX_SOURCE, FRAGMENT_SOURCE, "Arena.vs", "Arena.fs");
+	shader.Use();
+
+	// Fans of 4..32 vertices around a random point
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	std::vector<Mesh> meshes(meshCount);
+	for (Mesh& mesh : meshes)
+	{
+		int count = 4 + (int)(random() % 29);
+		float x = unit(random), y = unit(random);
+		for (int i = 0; i < count; i++)
+			mesh.vertices.push_back({ { x + unit(random) * 0.05f, y + unit(random) * 0.05f, 0.0f }, { 1.0f, 0.5f, 0.25f } });
+		for (int i = 1; i + 1 < count; i++)
+			mesh.indices.insert(mesh.indices.end(), { 0, (uint16_t)i, (uint16_t)(i + 1) });
+	}
+
+	typedef std::chrono::steady_clock Clock;
+	auto Elapsed = [](Clock::time_point start) { return std::chrono::duration<double, std::milli>(Clock::now() - start).count(); };
+
+	// ---------- Buffer objects per mesh ----------
+	Clock::time_point start = Clock::now();
+	std::vector<unsigned int> VAOs(meshCount), buffers(meshCount * 2);
+	glGenVertexArrays(meshCount, VAOs.data());
+	glGenBuffers(meshCount * 2, buffers.data());
+	for (int i = 0; i < meshCount; i++)
+	{
+		glBindVertexArray(VAOs[i]);
+		glBindBuffer(GL_ARRAY_BUFFER, buffers[i * 2]);
+		glBufferData(GL_ARRAY_BUFFER, meshes[i].vertices.size() * sizeof(ColorVertex), meshes[i].vertices.data(), GL_STATIC_DRAW);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[i * 2 + 1]);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, meshes[i].indices.size() * sizeof(uint16_t), meshes[i].indices.data(), GL_STATIC_DRAW);
+		VertexLayout::Apply<ColorVertex>();
+	}
+	glFinish();
+	double separateSetupMs = Elapsed(start);
+
+	// ---------- Arena ----------
+	start = Clock::now();
+	BufferArena vertexArena, indexArena;
+	vertexArena.Create(64 * 1024);														// Small on purpose, so growing is part of the set-up time
+	indexArena.Create(16 * 1024);
+	std::vector<int> vertexIds(meshCount), indexIds(meshCount);
+	for (int i = 0; i < meshCount; i++)
+	{
+		vertexIds[i] = vertexArena.Add(meshes[i].vertices.data(), (unsigned int)(meshes[i].vertices.size() * sizeof(ColorVertex)), sizeof(ColorVertex));
+		indexIds[i] = indexArena.Add(meshes[i].indices.data(), (unsigned int)(meshes[i].indices.size() * sizeof(uint16_t)), sizeof(uint16_t));
+	}
+	std::vector<ArenaDraw> draws(meshCount);
+	for (int i = 0; i < meshCount; i++)
+		draws[i] = ArenaDraw(indexArena, indexIds[i], (int)meshes[i].indices.size(), GL_UNSIGNED_SHORT, vertexArena, vertexIds[i], sizeof(ColorVertex));
+	unsigned int sharedVAO;
+	glGenVertexArrays(1, &sharedVAO);
+	glBindVertexArray(sharedVAO);
+	glBindBuffer(GL_ARRAY_BUFFER, vertexArena.ID());
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexArena.ID());
+	VertexLayout::Apply<ColorVertex>();
+	glFinish();
+	double arenaSetupMs = Elapsed(start);
+
+	double separateMs = 1e30, arenaMs = 1e30;
+	for (int frame = -1; frame < frames; frame++)										// Frame -1 warms up
+	{
+		start = Clock::now();
+		glClear(GL_COLOR_BUFFER_BIT);
+		for (int i = 0; i < meshCount; i++)
+		{
+			glBindVertexArray(VAOs[i]);
+			glDrawElements(GL_TRIANGLES, (int)meshes[i].indices.size(), GL_UNSIGNED_SHORT, 0);
+		}
+		glFinish();
+		if (frame >= 0)
+			separateMs = std::min(separateMs, Elapsed(start));
+
+		start = Clock::now();
+		glClear(GL_COLOR_BUFFER_BIT);
+		glBindVertexArray(sharedVAO);
+		for (const ArenaDraw& draw : draws)
+			draw.Draw();
+		glFinish();
+		if (frame >= 0)
+			arenaMs = std::min(arenaMs, Elapsed(start));
+	}
+
+	printf("%d meshes, best of %d frames\n", meshCount, frames);
+	printf("%-22s %5d buffer objects %5d VAOs, set-up %7.2f ms, frame %7.3f ms\n", "buffers per mesh", meshCount * 2, meshCount, separateSetupMs, separateMs);
+	printf("%-22s %5d buffer objects %5d VAOs, set-up %7.2f ms, frame %7.3f ms\n", "arena + base vertex", 2, 1, arenaSetupMs, arenaMs);
+	vertexArena.PrintStats("vertices");
+	indexArena.PrintStats("indices");
+
+	// ---------- Allocator churn ----------
+	BufferArena churn;
+	churn.Create(4 * 1024 * 1024);
+	std::vector<int> live;
+	const int OPERATIONS = 200000;
+	start = Clock::now();
+	for (int operation = 0; operation < OPERATIONS; operation++)
+	{
+		if (!live.empty() && (live.size() > 2000 || random() % 2 == 0))
+		{
+			size_t victim = random() % live.size();
+			churn.Free(live[victim]);
+			live[victim] = live.back();
+			live.pop_back();
+		}
+		else
+			live.push_back(churn.Allocate(16 + (unsigned int)(random() % 2048), random() % 2 ? 4 : 24));
+	}
+	double churnMs = Elapsed(start);
+	printf("Churn: %d allocate/free in %.2f ms (%.0f ns each)\n", OPERATIONS, churnMs, churnMs * 1e6 / OPERATIONS);
+	churn.PrintStats("churned");
+	start = Clock::now();
+	churn.Defragment();
+	glFinish();
+	printf("Defragment: %.2f ms\n", Elapsed(start));
+	churn.PrintStats("defragmented");
+
+	glDeleteVertexArrays(meshCount, VAOs.data());
+	glDeleteBuffers(meshCount * 2, buffers.data());
+	glDeleteVertexArrays(1, &sharedVAO);
+	return 0;
+}
@@ -0,0 +1,99 @@
+// Extension lookup microbenchmark: hashed gladHasExtension() vs the old linear strcmp walk over glGetStringi()
+// Uses a stand-in GL (glGetString / glGetIntegerv / glGetStringi) that reports 400 extensions, so no context is needed.
+//
+// Build: g++ -O2 -I<deps>/include Benchmarks/ExtensionLookupBenchmark.cpp glad.c -o ExtensionLookupBenchmark -ldl
+// Usage: ExtensionLookupBenchmark [rounds]
+
+#include "../my_glad.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+const int NUM_EXTENSIONS = 400;
+
+static std::vector<std::string> extensionNames;
+
+// ---------- Stand-in GL ----------
+static const GLubyte* APIENTRY FakeGetString(GLenum name)
+{
+	return (const GLubyte*)(name == GL_VERSION ? "4.5 (Core Profile) Stand-in" : "");
+}
+
+static void APIENTRY FakeGetIntegerv(GLenum pname, GLint* data)
+{
+	*data = pname == GL_NUM_EXTENSIONS ? NUM_EXTENSIONS : 0;
+}
+
+static const GLubyte* APIENTRY FakeGetStringi(GLenum, GLuint index)
+{
+	return (const GLubyte*)extensionNames[index].c_str();
+}
+
+static void* FakeLoader(const char* name)
+{
+	if (strcmp(name, "glGetString") == 0) return (void*)FakeGetString;
+	if (strcmp(name, "glGetIntegerv") == 0) return (void*)FakeGetIntegerv;
+	if (strcmp(name, "glGetStringi") == 0) return (void*)FakeGetStringi;
+	return nullptr;
+}
+
+// What has_ext() used to do for every check on a 3.0+ context
+static int LinearHasExtension(const char* ext)
+{
+	GLint count = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for (GLint index = 0; index < count; index++)
+	{
+		if (strcmp((const char*)glGetStringi(GL_EXTENSIONS, index), ext) == 0)
+			return 1;
+	}
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	int rounds = argc > 1 ? atoi(argv[1]) : 1000;
+
+	// Real extension names share long prefixes, which is the worst case for strcmp
+	const char* vendors[] = { "GL_ARB_", "GL_EXT_", "GL_KHR_", "GL_NV_", "GL_AMD_", "GL_INTEL_", "GL_MESA_", "GL_OES_" };
+	for (int i = 0; i < NUM_EXTENSIONS; i++)
+		extensionNames.push_back(std::string(vendors[i % 8]) + "stand_in_extension_" + std::to_string(i));
+
+	// Half of the queries hit, half miss
+	std::vector<std::string> queries = extensionNames;
+	for (int i = 0; i < NUM_EXTENSIONS; i++)
+		queries.push_back(std::string(vendors[i % 8]) + "missing_extension_" + std::to_string(i));
+
+	typedef std::chrono::steady_clock Clock;
+	Clock::time_point start = Clock::now();
+	if (!gladLoadGLLoader(FakeLoader) || gladGetExtensionCount() != NUM_EXTENSIONS)
+	{
+		printf("ERROR::BENCHMARK::GLAD_LOAD_FAILED\n");
+		return -1;
+	}
+	double loadUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+	int hits = 0;
+	start = Clock::now();
+	for (int round = 0; round < rounds; round++)
+		for (const std::string& query : queries)
+			hits += gladHasExtension(query.c_str());
+	double hashedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+	start = Clock::now();
+	for (int round = 0; round < rounds; round++)
+		for (const std::string& query : queries)
+			hits -= LinearHasExtension(query.c_str());
+	double linearNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+	double lookups = (double)rounds * queries.size();
+	printf("extensions: %d, lookups: %.0f (hit/miss mismatch: %d)\n", NUM_EXTENSIONS, lookups, hits);
+	printf("gladLoadGLLoader incl. extension set: %.1f us\n", loadUs);
+	printf("hashed lookup: %8.1f ns/query\n", hashedNs / lookups);
+	printf("linear lookup: %8.1f ns/query\n", linearNs / lookups);
+	return hits != 0;
+}
@@ -0,0 +1,164 @@
+// Cold-start benchmark: eager gladLoadGLLoader() vs lazy gladLoadGLLoaderLazy()
+// Runs on a headless surfaceless EGL context (Mesa llvmpipe on CPU-only machines). Every sample is a fresh process,
+// so driver and loader state is as cold as it is at application start-up.
+//
+// Build (Linux): g++ -O2 -I<deps>/include Benchmarks/GladLoadBenchmark.cpp glad.c -o GladLoadBenchmark -lEGL -ldl
+// Usage: GladLoadBenchmark [runs]				// Spawns 'runs' processes per mode and prints medians
+//        GladLoadBenchmark --single eager|lazy	// One sample: prints "<load us> <first frame us>"
+
+#include "../my_glad.h"
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+typedef std::chrono::steady_clock Clock;
+
+static double ElapsedUs(Clock::time_point start)
+{
+	return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+static bool CreateHeadlessContext()
+{
+	PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	EGLDisplay display = eglGetPlatformDisplayEXT ? eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr) : eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	if (!eglInitialize(display, nullptr, nullptr) || !eglBindAPI(EGL_OPENGL_API))
+		return false;
+
+	const EGLint contextAttribs[] = { EGL_CONTEXT_MAJOR_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 3,
+									  EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT, EGL_NONE };
+	EGLContext context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttribs);
+	return context != EGL_NO_CONTEXT && eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+}
+
+// Same GL calls main.cpp makes before its first frame: shader, buffers, texture and one draw into an FBO
+static void RenderFirstFrame()
+{
+	const char* vsSource = "#version 330 core\nlayout (location = 0) in vec3 aPos;\nlayout (location = 1) in vec2 aTexCoord;\n"
+						   "out vec2 TexCoord;\nvoid main() { gl_Position = vec4(aPos, 1.0); TexCoord = aTexCoord; }\n";
+	const char* fsSource = "#version 330 core\nout vec4 FragColor;\nin vec2 TexCoord;\nuniform sampler2D texture1;\n"
+						   "void main() { FragColor = texture(texture1, TexCoord); }\n";
+	unsigned int vertex = glCreateShader(GL_VERTEX_SHADER);
+	glShaderSource(vertex, 1, &vsSource, nullptr);
+	glCompileShader(vertex);
+	unsigned int fragment = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(fragment, 1, &fsSource, nullptr);
+	glCompileShader(fragment);
+	unsigned int program = glCreateProgram();
+	glAttachShader(program, vertex);
+	glAttachShader(program, fragment);
+	glLinkProgram(program);
+	glDeleteShader(vertex);
+	glDeleteShader(fragment);
+
+	float vertices[] = { 0.5f, 0.5f, 0.0f, 1.0f, 1.0f,   0.5f, -0.5f, 0.0f, 1.0f, 0.0f,   -0.5f, -0.5f, 0.0f, 0.0f, 0.0f,   -0.5f, 0.5f, 0.0f, 0.0f, 1.0f };
+	unsigned int indices[] = { 0, 1, 3, 1, 2, 3 };
+	unsigned int VAO, VBO, EBO;
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(1, &VBO);
+	glGenBuffers(1, &EBO);
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
+	glEnableVertexAttribArray(1);
+
+	unsigned char pixels[4 * 4 * 4];
+	memset(pixels, 0xFF, sizeof(pixels));
+	unsigned int texture;
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 4, 4, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+	glGenerateMipmap(GL_TEXTURE_2D);
+
+	unsigned int FBO, colorBuffer;
+	glGenFramebuffers(1, &FBO);
+	glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+	glGenRenderbuffers(1, &colorBuffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, 800, 600);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+	glViewport(0, 0, 800, 600);
+
+	glUseProgram(program);
+	glUniform1i(glGetUniformLocation(program, "texture1"), 0);
+	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+	glFinish();
+}
+
+static int RunSingle(const char* mode)
+{
+	if (!CreateHeadlessContext())
+	{
+		printf("ERROR::BENCHMARK::EGL_CONTEXT_FAILED\n");
+		return -1;
+	}
+
+	bool lazy = strcmp(mode, "lazy") == 0;
+	Clock::time_point start = Clock::now();
+	int loaded = lazy ? gladLoadGLLoaderLazy((GLADloadproc)eglGetProcAddress) : gladLoadGLLoader((GLADloadproc)eglGetProcAddress);
+	double loadUs = ElapsedUs(start);
+	if (!loaded)
+	{
+		printf("ERROR::BENCHMARK::GLAD_LOAD_FAILED\n");
+		return -1;
+	}
+	RenderFirstFrame();
+	printf("%f %f\n", loadUs, ElapsedUs(start));
+	return 0;
+}
+
+static double Median(std::vector<double> values)
+{
+	std::sort(values.begin(), values.end());
+	return values.empty() ? 0.0 : values[values.size() / 2];
+}
+
+int main(int argc, char** argv)
+{
+	if (argc == 3 && strcmp(argv[1], "--single") == 0)
+		return RunSingle(argv[2]);
+
+	int runs = argc > 1 ? atoi(argv[1]) : 20;
+	const char* modes[] = { "eager", "lazy" };
+	std::vector<double> loadUs[2], frameUs[2];
+
+	// Interleave the modes so drift in machine load affects both equally
+	for (int run = 0; run < runs; run++)
+	{
+		for (int mode = 0; mode < 2; mode++)
+		{
+			char command[1024];
+			snprintf(command, sizeof(command), "\"%s\" --single %s", argv[0], modes[mode]);
+			FILE* pipe = popen(command, "r");
+			double load, frame;
+			if (pipe && fscanf(pipe, "%lf %lf", &load, &frame) == 2)
+			{
+				loadUs[mode].push_back(load);
+				frameUs[mode].push_back(frame);
+			}
+			if (pipe)
+				pclose(pipe);
+		}
+	}
+
+	printf("%-6s %8s %16s %22s\n", "mode", "samples", "load (us, p50)", "first frame (us, p50)");
+	for (int mode = 0; mode < 2; mode++)
+		printf("%-6s %8zu %16.1f %22.1f\n", modes[mode], loadUs[mode].size(), Median(loadUs[mode]), Median(frameUs[mode]));
+	return 0;
+}
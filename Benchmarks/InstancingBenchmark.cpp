@@ -0,0 +1,214 @@
+// 1 to 1M textured quads (the scene's TexturedVertex quad, 4 vertices and 6 indices) drawn three ways:
+//   - a draw per quad: three glUniform4f (offset/scale, UV rect, tint) + glDrawElements each
+//   - instanced: one QuadInstance per quad in a static buffer, one glDrawElementsInstanced
+//   - instanced + streamed: the QuadInstances rewritten every frame through a StreamBuffer (moving sprites)
+// For each count reports the best frame (CPU submit time and the whole frame including glFinish) and the cost per quad.
+// Quads are laid out on a grid in a 256x256 target, so past a few thousand they are smaller than a pixel and the
+// numbers are about submission and vertex work rather than fill. Draw per quad stops at [maxDraws]. Runs on a headless
+// EGL context.
+//
+// Build: g++ -O2 -std=c++17 -I<deps>/include Benchmarks/InstancingBenchmark.cpp glad.c -o InstancingBenchmark -lEGL -ldl
+// Usage: InstancingBenchmark [maxInstances=1000000] [frames=5] [maxDraws=100000]
+
+#include "../my_glad.h"
+#include "../HeadlessContext.h"
+#include "../Framebuffer.h"
+#include "../Shader.h"
+#include "../VertexLayout.h"
+#include "../StreamBuffer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+static const char* VERTEX_SOURCE =
+	"layout (location = 0) in vec3 aPos;\n"
+	"layout (location = 1) in vec3 aColor;\n"
+	"layout (location = 2) in vec2 aTexCoord;\n"
+	"#ifdef INSTANCED\n"
+	"layout (location = 3) in vec4 aOffsetScale;\n"
+	"layout (location = 4) in vec4 aUVRect;\n"
+	"layout (location = 5) in vec4 aTint;\n"
+	"#else\n"
+	"uniform vec4 aOffsetScale;\n"
+	"uniform vec4 aUVRect;\n"
+	"uniform vec4 aTint;\n"
+	"#endif\n"
+	"out vec2 TexCoord;\n"
+	"out vec4 Tint;\n"
+	"void main()\n"
+	"{\n"
+	"    gl_Position = vec4(aPos.xy * aOffsetScale.zw + aOffsetScale.xy, aPos.z, 1.0);\n"
+	"    TexCoord = aUVRect.xy + aTexCoord * aUVRect.zw;\n"
+	"    Tint = aTint * vec4(aColor, 1.0);\n"
+	"}\n";
+
+static const char* FRAGMENT_SOURCE =
+	"in vec2 TexCoord;\n"
+	"in vec4 Tint;\n"
+	"out vec4 FragColor;\n"
+	"uniform sampler2D texture1;\n"
+	"void main() { FragColor = texture(texture1, TexCoord) * Tint; }\n";
+
+static Shader* BuildShader(bool instanced)
+{
+	std::string header = instanced ? "#version 330 core\n#define INSTANCED\n" : "#version 330 core\n";
+	return new Shader(header + VERTEX_SOURCE, header + FRAGMENT_SOURCE, "Instancing.vs", "Instancing.fs");
+}
+
+// 'count' quads on a grid over clip space, each half the size of its cell, showing its cell of the texture. 'frame'
+// moves them, so streamed instances really change
+static void LayoutInstances(QuadInstance* instances, int count, int frame)
+{
+	int side = (int)ceil(sqrt((double)count));
+	float cell = 2.0f / side, drift = 0.25f * cell * sinf(frame * 0.5f);
+	for (int i = 0; i < count; i++)
+	{
+		int column = i % side, row = i / side;
+		instances[i].aOffsetScale = { -1.0f + cell * (column + 0.5f) + drift, 1.0f - cell * (row + 0.5f), cell * 0.5f, cell * 0.5f };
+		instances[i].aUVRect = { (float)column / side, 1.0f - (float)(row + 1) / side, 1.0f / side, 1.0f / side };
+		instances[i].aTint = { 255, (uint8_t)(255 - row * 128 / side), (uint8_t)(255 - column * 128 / side), 255 };
+	}
+}
+
+int main(int argc, char** argv)
+{
+	int maxInstances = argc > 1 ? atoi(argv[1]) : 1000000;
+	int frames = argc > 2 ? atoi(argv[2]) : 5;
+	int maxDraws = argc > 3 ? atoi(argv[3]) : 100000;
+
+	HeadlessContext context;
+	if (!context.Init() || !gladLoadGLLoader(HeadlessContext::GetProcAddress()))
+		return -1;
+	ProgramCache::Get().enabled = false;
+	Framebuffer framebuffer;
+	if (!framebuffer.Create(256, 256))
+		return -1;
+	framebuffer.Bind();
+
+	Shader* perDraw = BuildShader(false);
+	Shader* instanced = BuildShader(true);
+	VertexLayout::Validate<TexturedVertex, QuadInstance>(instanced->ID);
+	int offsetScale = glGetUniformLocation(perDraw->ID, "aOffsetScale");
+	int uvRect = glGetUniformLocation(perDraw->ID, "aUVRect");
+	int tint = glGetUniformLocation(perDraw->ID, "aTint");
+
+	// Checkerboard texture on unit 0
+	unsigned char pixels[64 * 64 * 3];
+	for (int i = 0; i < 64 * 64; i++)
+	{
+		unsigned char value = ((i % 64) / 8 + (i / 64) / 8) % 2 ? 255 : 64;
+		pixels[i * 3] = pixels[i * 3 + 1] = pixels[i * 3 + 2] = value;
+	}
+	unsigned int texture;
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 64, 64, 0, GL_RGB, GL_UNSIGNED_BYTE, pixels);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+	// The base mesh, shared by every method
+	const TexturedVertex quad[] = { { {  0.5f,  0.5f, 0.0f }, { 1.0f, 1.0f, 1.0f }, { 1.0f, 1.0f } },
+									{ {  0.5f, -0.5f, 0.0f }, { 1.0f, 1.0f, 1.0f }, { 1.0f, 0.0f } },
+									{ { -0.5f, -0.5f, 0.0f }, { 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f } },
+									{ { -0.5f,  0.5f, 0.0f }, { 1.0f, 1.0f, 1.0f }, { 0.0f, 1.0f } } };
+	const unsigned short indices[] = { 0, 1, 3, 1, 2, 3 };
+	unsigned int VAO, buffers[3];
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(3, buffers);
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+	VertexLayout::Apply<TexturedVertex>();
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+	typedef std::chrono::steady_clock Clock;
+	auto Elapsed = [](Clock::time_point start) { return std::chrono::duration<double, std::milli>(Clock::now() - start).count(); };
+	const char* names[] = { "draw per quad", "instanced", "instanced + streamed" };
+
+	printf("Best of %d frames, 256x256 target\n", frames);
+	printf("%9s  %-22s %12s %12s %12s\n", "quads", "method", "CPU ms", "frame ms", "ns/quad");
+	std::vector<QuadInstance> instances;
+	for (int count = 1; count <= maxInstances; count *= 10)
+	{
+		instances.resize(count);
+		LayoutInstances(instances.data(), count, 0);
+		StreamBuffer stream;
+		stream.Create((unsigned int)(count * sizeof(QuadInstance)));
+		for (int method = 0; method < 3; method++)
+		{
+			if (method == 0 && count > maxDraws)
+			{
+				printf("%9d  %-22s %12s\n", count, names[method], "skipped");
+				continue;
+			}
+			// Per-instance attributes: off (constant uniforms) for a draw per quad, the static buffer or the stream
+			if (method == 0)
+			{
+				for (const VertexAttribute& attribute : QuadInstance::Attributes())
+					glDisableVertexAttribArray(attribute.location);
+			}
+			else if (method == 1)
+			{
+				glBindBuffer(GL_ARRAY_BUFFER, buffers[2]);
+				glBufferData(GL_ARRAY_BUFFER, count * sizeof(QuadInstance), instances.data(), GL_STATIC_DRAW);
+				VertexLayout::Apply<QuadInstance>(0, 1);
+			}
+			(method == 0 ? perDraw : instanced)->Use();
+
+			double cpuMs = 1e30, frameMs = 1e30;
+			for (int frame = -1; frame < frames; frame++)								// Frame -1 warms up
+			{
+				Clock::time_point start = Clock::now();
+				glClear(GL_COLOR_BUFFER_BIT);
+				if (method == 0)
+				{
+					for (const QuadInstance& instance : instances)
+					{
+						glUniform4f(offsetScale, instance.aOffsetScale.x, instance.aOffsetScale.y, instance.aOffsetScale.z, instance.aOffsetScale.w);
+						glUniform4f(uvRect, instance.aUVRect.x, instance.aUVRect.y, instance.aUVRect.z, instance.aUVRect.w);
+						glUniform4f(tint, instance.aTint.x / 255.0f, instance.aTint.y / 255.0f, instance.aTint.z / 255.0f, instance.aTint.w / 255.0f);
+						glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, 0);
+					}
+				}
+				else
+				{
+					if (method == 2)
+					{
+						stream.BeginFrame();
+						unsigned int offset = 0;
+						QuadInstance* target = (QuadInstance*)stream.Allocate((unsigned int)(count * sizeof(QuadInstance)), sizeof(QuadInstance), offset);
+						LayoutInstances(target, count, frame);
+						stream.Commit();
+						glBindBuffer(GL_ARRAY_BUFFER, stream.ID());
+						VertexLayout::Apply<QuadInstance>(offset, 1);					// No base instance on 3.3: point the attributes at this frame's region
+					}
+					glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, 0, count);
+				}
+				double cpu = Elapsed(start);
+				glFinish();
+				if (frame >= 0)
+				{
+					cpuMs = std::min(cpuMs, cpu);
+					frameMs = std::min(frameMs, Elapsed(start));
+				}
+			}
+			printf("%9d  %-22s %12.3f %12.3f %12.1f\n", count, names[method], cpuMs, frameMs, frameMs * 1e6 / count);
+		}
+	}
+
+	unsigned char pixel[4];
+	glReadPixels(128, 128, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+	printf("(center pixel %d %d %d)\n", pixel[0], pixel[1], pixel[2]);
+	glDeleteTextures(1, &texture);
+	glDeleteVertexArrays(1, &VAO);
+	glDeleteBuffers(3, buffers);
+	delete perDraw;
+	delete instanced;
+	return 0;
+}
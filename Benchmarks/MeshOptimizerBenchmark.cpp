@@ -0,0 +1,82 @@
+// MeshOptimizer on a side x side grid (TexturedVertex), given the ways meshes tend to arrive:
+//   - "soup": unindexed, three vertices per triangle, triangles in random order (what glDrawArrays data looks like)
+//   - "indexed, shuffled": already welded, but triangles in random order
+//   - "indexed, row order": welded, triangles row by row (a naive generator)
+// Reports vertices, ACMR (FIFO cache of MeshOptimizer::ACMR_CACHE_SIZE) and bytes before/after, and the time taken.
+// No GL context needed.
+//
+// Build: g++ -O2 -std=c++17 -I<deps>/include Benchmarks/MeshOptimizerBenchmark.cpp -o MeshOptimizerBenchmark
+// Usage: MeshOptimizerBenchmark [side]
+
+#include "../VertexLayout.h"
+#include "../MeshOptimizer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+	int side = argc > 1 ? atoi(argv[1]) : 256;
+
+	std::vector<TexturedVertex> grid;
+	for (int y = 0; y < side; y++)
+	{
+		for (int x = 0; x < side; x++)
+		{
+			float u = x / (float)(side - 1), v = y / (float)(side - 1);
+			grid.push_back({ { u * 2.0f - 1.0f, v * 2.0f - 1.0f, 0.0f }, { u, v, 1.0f - u }, { u, v } });
+		}
+	}
+	std::vector<unsigned int> rows;
+	for (int y = 0; y + 1 < side; y++)
+	{
+		for (int x = 0; x + 1 < side; x++)
+		{
+			unsigned int corner = (unsigned int)(y * side + x);
+			unsigned int quad[6] = { corner, corner + 1, corner + side, corner + 1, corner + side + 1, corner + (unsigned int)side };
+			rows.insert(rows.end(), quad, quad + 6);
+		}
+	}
+
+	// Same triangles in random order
+	std::vector<unsigned int> order(rows.size() / 3);
+	for (size_t t = 0; t < order.size(); t++)
+		order[t] = (unsigned int)t;
+	std::shuffle(order.begin(), order.end(), std::mt19937(1));
+	std::vector<unsigned int> shuffled;
+	std::vector<TexturedVertex> soup;
+	for (unsigned int t : order)
+	{
+		for (int corner = 0; corner < 3; corner++)
+		{
+			shuffled.push_back(rows[t * 3 + corner]);
+			soup.push_back(grid[rows[t * 3 + corner]]);
+		}
+	}
+
+	typedef std::chrono::steady_clock Clock;
+	typedef MeshOptimizer<TexturedVertex> Optimizer;
+	struct Case
+	{
+		const char* name;
+		const std::vector<TexturedVertex>* vertices;
+		const std::vector<unsigned int>* indices;
+	} cases[] = { { "soup", &soup, nullptr }, { "indexed, shuffled", &grid, &shuffled }, { "indexed, row order", &grid, &rows } };
+
+	printf("%d x %d grid, %zu triangles\n", side, side, rows.size() / 3);
+	for (const Case& test : cases)
+	{
+		Optimizer::Stats stats;
+		Clock::time_point start = Clock::now();
+		Optimizer::Result result = Optimizer::Optimize(test.vertices->data(), test.vertices->size(), test.indices ? test.indices->data() : nullptr,
+			test.indices ? test.indices->size() : 0, &stats);
+		double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		stats.Print(test.name);
+		printf("  %s indices, %.2f ms\n", result.indexType == GL_UNSIGNED_SHORT ? "16-bit" : "32-bit", ms);
+	}
+	return 0;
+}
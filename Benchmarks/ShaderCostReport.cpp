@@ -0,0 +1,100 @@
+// Static shader cost report
+// Analyzes every vertex (.vs) and fragment (.fs) shader under a directory in every combination of the keywords it
+// tests with #ifdef (see ShaderCostAnalyzer): texture fetches, duplicated fetches, ALU estimate, varyings, uniforms.
+// Prints a table and a warning per duplicated fetch; --json writes one JSON object per variant, so the numbers can be
+// kept per commit and compared over time. No GL context needed.
+// Must be started from the directory the app loads Shaders/ from (generated includes are registered under that path).
+//
+// Build: g++ -O2 -std=c++17 -I<deps>/include Benchmarks/ShaderCostReport.cpp -o ShaderCostReport
+// Usage: ShaderCostReport [directory] [--json file] [--werror]
+//        --werror: exit with 1 when any variant has a duplicated fetch
+
+#include "../ShaderCost.h"
+#include "../ShaderSources.h"
+#include "../UniformBuffers.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+	std::string directory = "Shaders";
+	const char* jsonPath = nullptr;
+	bool warningsAsErrors = false;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+			jsonPath = argv[++i];
+		else if (strcmp(argv[i], "--werror") == 0)
+			warningsAsErrors = true;
+		else
+			directory = argv[i];
+	}
+	UniformBuffers::RegisterBlocks();												// Include/UniformBlocks.glsl is generated, not on disk
+
+	std::vector<std::string> paths;
+	std::error_code error;
+	for (std::filesystem::recursive_directory_iterator it(directory, error), end; !error && it != end; it.increment(error))
+	{
+		std::string path = it->path().generic_string();
+		if (it->is_regular_file() && ShaderSources::IsShaderFile(it->path()) && ShaderCostAnalyzer::StageOf(path) != "unknown")
+			paths.push_back(path);
+	}
+	std::sort(paths.begin(), paths.end());
+	if (paths.empty())
+	{
+		printf("ERROR::SHADER_COST::NO_SHADERS %s\n", directory.c_str());
+		return -1;
+	}
+
+	ShaderCostAnalyzer analyzer;
+	std::vector<ShaderCost> costs;
+	for (const std::string& path : paths)
+	{
+		// Every on/off combination of the shader's keywords
+		std::vector<std::string> keywords = analyzer.Keywords(path);
+		for (size_t mask = 0; mask < ((size_t)1 << keywords.size()); mask++)
+		{
+			ShaderDefines defines;
+			for (size_t keyword = 0; keyword < keywords.size(); keyword++)
+			{
+				if (mask & ((size_t)1 << keyword))
+					defines.emplace_back(keywords[keyword], "");
+			}
+			ShaderCost cost;
+			if (analyzer.Analyze(path, defines, cost))
+				costs.push_back(cost);
+		}
+	}
+
+	printf("%-20s %-40s %7s %7s %5s %6s %9s %6s %8s\n", "shader", "variant", "fetches", "unique", "alu", "trans.", "varyings", "comps", "uniforms");
+	int duplicates = 0;
+	for (const ShaderCost& cost : costs)
+	{
+		printf("%-20s %-40s %7d %7d %5d %6d %9d %6d %8d\n", cost.path.c_str(), cost.variant.empty() ? "-" : cost.variant.c_str(),
+			cost.textureFetches, cost.uniqueFetches, cost.aluOps, cost.transcendentals, cost.varyings, cost.varyingComponents, cost.uniforms);
+		duplicates += (int)cost.duplicateFetches.size();
+	}
+	for (const ShaderCost& cost : costs)
+		cost.PrintWarnings();
+
+	if (jsonPath)
+	{
+		FILE* file = fopen(jsonPath, "wb");
+		if (!file)
+		{
+			printf("ERROR::SHADER_COST::CANNOT_WRITE %s\n", jsonPath);
+			return -1;
+		}
+		fputs("[\n", file);
+		for (size_t i = 0; i < costs.size(); i++)
+			fprintf(file, "  %s%s\n", costs[i].ToJSON().c_str(), i + 1 < costs.size() ? "," : "");
+		fputs("]\n", file);
+		fclose(file);
+	}
+	return warningsAsErrors && duplicates > 0 ? 1 : 0;
+}
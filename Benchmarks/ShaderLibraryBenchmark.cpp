@@ -0,0 +1,93 @@
+// Program build time for N programs: one Shader at a time (compile, query, link, query) vs one ShaderLibrary batch
+// (every compile and link submitted before any status query, completion polled with GL_COMPLETION_STATUS_KHR).
+// Every run uses fresh sources and switches off the ProgramCache and Mesa's disk cache, so both sides really compile.
+// Runs on a headless EGL context.
+//
+// Build: g++ -O2 -std=c++17 -I<deps>/include Benchmarks/ShaderLibraryBenchmark.cpp glad.c -o ShaderLibraryBenchmark -lEGL -ldl
+// Usage: ShaderLibraryBenchmark [programs]
+
+#include "../my_glad.h"
+#include "../HeadlessContext.h"
+#include "../Shader.h"
+#include "../ShaderLibrary.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Unique, not entirely trivial fragment shader so no compiler cache can help and there is real work per program
+static void WriteProgram(const std::filesystem::path& dir, const std::string& name, int salt)
+{
+	std::ofstream vs(dir / (name + ".vs"));
+	vs << "#version 330 core\nlayout (location = 0) in vec3 aPos;\nout vec2 uv;\n"
+		  "void main() { uv = aPos.xy * " << salt << ".0; gl_Position = vec4(aPos, 1.0); }\n";
+	std::ofstream fs(dir / (name + ".fs"));
+	fs << "#version 330 core\nin vec2 uv;\nout vec4 FragColor;\nuniform sampler2D tex;\n"
+		  "void main() {\n\tvec4 sum = vec4(0.0);\n"
+		  "\tfor (int i = 0; i < 16; i++) {\n"
+		  "\t\tvec2 offset = vec2(sin(float(i) * " << salt << ".1), cos(float(i) * 0.7));\n"
+		  "\t\tsum += texture(tex, uv + offset * 0.01) * pow(abs(offset.x), 1.5);\n"
+		  "\t}\n\tFragColor = sum / " << salt + 1 << ".0;\n}\n";
+}
+
+int main(int argc, char** argv)
+{
+	int count = argc > 1 ? atoi(argv[1]) : 32;
+	setenv("MESA_SHADER_CACHE_DISABLE", "true", 1);
+
+	HeadlessContext context;
+	if (!context.Init() || !gladLoadGLLoader(HeadlessContext::GetProcAddress()))
+		return -1;
+	ProgramCache::Get().enabled = false;
+
+	std::filesystem::path dir = std::filesystem::temp_directory_path() / "shader_library_benchmark";
+	std::filesystem::create_directories(dir);
+	int salt = (int)(std::chrono::steady_clock::now().time_since_epoch().count() % 100000);
+	for (int i = 0; i < count * 2; i++)
+		WriteProgram(dir, "program" + std::to_string(i), salt + i);
+
+	typedef std::chrono::steady_clock Clock;
+
+	// One by one through the Shader constructor
+	Clock::time_point start = Clock::now();
+	std::vector<std::unique_ptr<Shader>> serial;
+	for (int i = 0; i < count; i++)
+	{
+		std::string base = (dir / ("program" + std::to_string(i))).string();
+		serial.push_back(std::make_unique<Shader>((base + ".vs").c_str(), (base + ".fs").c_str()));
+	}
+	double serialMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	// One batch, polled like a render loop would
+	start = Clock::now();
+	ShaderLibrary library(HeadlessContext::GetProcAddress());
+	for (int i = count; i < count * 2; i++)
+	{
+		std::string base = (dir / ("program" + std::to_string(i))).string();
+		library.Add(base, base + ".vs", base + ".fs");
+	}
+	library.Submit();
+	double submitMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	double firstReadyMs = -1.0;
+	while (library.Poll() < count && library.PendingCount() > 0)
+	{
+		if (firstReadyMs < 0.0 && library.ReadyCount() > 0)
+			firstReadyMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+	double batchMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	if (firstReadyMs < 0.0)
+		firstReadyMs = batchMs;
+
+	printf("Renderer: %s, parallel compile extension: %s\n", (const char*)glGetString(GL_RENDERER), library.ParallelCompileSupported() ? "yes" : "no");
+	printf("%d programs\n", count);
+	printf("%-28s %10.2f ms\n", "Shader, one at a time", serialMs);
+	printf("%-28s %10.2f ms (submit %.2f ms, first program ready after %.2f ms, %d failed)\n", "ShaderLibrary batch", batchMs, submitMs, firstReadyMs, count - library.ReadyCount());
+
+	std::filesystem::remove_all(dir);
+	return 0;
+}
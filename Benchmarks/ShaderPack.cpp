@@ -0,0 +1,76 @@
+// Packs every shader file under a directory into one ShaderArchive, for the app to map at start-up instead of opening
+// each file (see SHADER_ARCHIVE in main.cpp). Run it as a build step whenever the sources change, from the directory the
+// app is started in: entries are keyed by the path the app loads them from ("Shaders/Quad.fs").
+// Sources are packed as written; #include and defines are still resolved when a variant is built.
+// --check writes nothing: it exits with 1 when the archive is missing or its contents differ from the directory, so a
+// build can run "ShaderPack --check || ShaderPack" and the app doesn't have to stat every entry at start-up.
+//
+// Build: g++ -O2 -std=c++17 Benchmarks/ShaderPack.cpp -o ShaderPack
+// Usage: ShaderPack [--check] [directory=Shaders] [output=Shaders.pak]
+
+#include "../ShaderArchive.h"
+#include "../ShaderSources.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Why the archive at 'path' doesn't match the sources on disk, "" when it does
+std::string FindOutdated(const char* path, const ShaderSources& sources, const std::vector<std::string>& paths)
+{
+	ShaderArchive archive;
+	if (!archive.Open(path))
+		return "missing";
+	for (const std::string& name : paths)
+	{
+		std::string_view packed;
+		if (!archive.Find(name, packed))
+			return name + " is not packed";
+		if (packed != sources.Get(name))
+			return name + " changed";
+	}
+	return archive.Count() == paths.size() ? std::string() : std::string("holds removed files");
+}
+
+int main(int argc, char** argv)
+{
+	bool check = argc > 1 && strcmp(argv[1], "--check") == 0;
+	int first = check ? 2 : 1;
+	std::string directory = argc > first ? argv[first] : "Shaders";
+	std::string output = argc > first + 1 ? argv[first + 1] : "Shaders.pak";
+
+	ShaderSources sources;															// No archive is mounted here, so these come from disk
+	if (!sources.LoadDirectory(directory) || sources.Count() == 0)
+	{
+		printf("ERROR::SHADER_PACK::NO_SHADERS %s\n", directory.c_str());
+		return -1;
+	}
+	std::vector<std::string> paths = sources.Paths();
+	std::sort(paths.begin(), paths.end());											// Same input, same archive
+	if (check)
+	{
+		std::string outdated = FindOutdated(output.c_str(), sources, paths);
+		if (!outdated.empty())
+		{
+			printf("%s: out of date (%s)\n", output.c_str(), outdated.c_str());
+			return 1;
+		}
+		printf("%s: up to date (%zu files)\n", output.c_str(), paths.size());
+		return 0;
+	}
+	std::vector<std::pair<std::string, std::string_view>> entries;
+	size_t bytes = 0;
+	for (const std::string& path : paths)
+	{
+		entries.emplace_back(path, sources.Get(path));
+		bytes += sources.Get(path).size();
+	}
+	if (!ShaderArchive::Write(output.c_str(), entries))
+		return -1;
+	printf("%s: %zu files, %.1f KB of source\n", output.c_str(), entries.size(), bytes / 1024.0);
+	return 0;
+}
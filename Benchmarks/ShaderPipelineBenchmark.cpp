@@ -0,0 +1,143 @@
+// Build cost of every combination of V vertex shaders and F fragment shaders:
+//   - one linked Shader per combination (V * F programs, each stage compiled again for every program it is in)
+//   - ShaderPipelines: V + F separable stage programs, V * F pipeline objects referencing them
+// Both then draw one combination into a framebuffer and the results are compared.
+// Every run uses fresh sources and switches off the ProgramCache and Mesa's disk cache, so both sides really compile.
+// Runs on a headless EGL context.
+//
+// Build: g++ -O2 -std=c++17 -I<deps>/include Benchmarks/ShaderPipelineBenchmark.cpp glad.c -o ShaderPipelineBenchmark -lEGL -ldl
+// Usage: ShaderPipelineBenchmark [vertex shaders] [fragment shaders]
+
+#include "../my_glad.h"
+#include "../HeadlessContext.h"
+#include "../Framebuffer.h"
+#include "../Shader.h"
+#include "../ShaderPipelines.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+static std::string VertexSource(int salt)
+{
+	return "#version 330 core\nlayout (location = 0) in vec2 aPos;\nout vec2 uv;\n"
+		   "void main() {\n\tuv = aPos * 0.5 + 0.5;\n"
+		   "\tfloat angle = " + std::to_string(salt) + ".0 * 0.001;\n"
+		   "\tvec2 rotated = vec2(aPos.x * cos(angle) - aPos.y * sin(angle), aPos.x * sin(angle) + aPos.y * cos(angle));\n"
+		   "\tgl_Position = vec4(rotated, 0.0, 1.0);\n}\n";
+}
+
+static std::string FragmentSource(int salt)
+{
+	return "#version 330 core\nin vec2 uv;\nout vec4 FragColor;\n"
+		   "void main() {\n\tvec4 sum = vec4(0.0);\n"
+		   "\tfor (int i = 0; i < 16; i++)\n"
+		   "\t\tsum += vec4(sin(uv.x * float(i) * " + std::to_string(salt) + ".1), cos(uv.y * float(i)), uv.x, 1.0);\n"
+		   "\tFragColor = abs(sum) / 16.0;\n}\n";
+}
+
+static void DrawInto(Framebuffer& framebuffer, unsigned char* pixel)
+{
+	framebuffer.Bind();
+	glClear(GL_COLOR_BUFFER_BIT);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+	glReadPixels(16, 16, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+}
+
+int main(int argc, char** argv)
+{
+	int vertexCount = argc > 1 ? atoi(argv[1]) : 4;
+	int fragmentCount = argc > 2 ? atoi(argv[2]) : 8;
+	setenv("MESA_SHADER_CACHE_DISABLE", "true", 1);
+
+	HeadlessContext context;
+	if (!context.Init() || !gladLoadGLLoader(HeadlessContext::GetProcAddress()))
+		return -1;
+	ProgramCache::Get().enabled = false;
+	if (!ShaderPipelines::Supported())
+	{
+		printf("ERROR::SHADER::PIPELINE::NOT_SUPPORTED\n");
+		return -1;
+	}
+
+	int salt = (int)(std::chrono::steady_clock::now().time_since_epoch().count() % 100000);
+	std::vector<std::string> vertexSources, fragmentSources;
+	for (int i = 0; i < vertexCount * 2; i++)
+		vertexSources.push_back(VertexSource(salt + i));
+	for (int i = 0; i < fragmentCount * 2; i++)
+		fragmentSources.push_back(FragmentSource(salt + i));
+	// Each side gets its own half of the sources, so neither profits from the driver having seen the other's
+	for (int i = 0; i < vertexCount * 2; i++)
+		ShaderPreprocessor::AddGeneratedFile("Shaders/Bench" + std::to_string(i) + ".vs", vertexSources[i]);
+	for (int i = 0; i < fragmentCount * 2; i++)
+		ShaderPreprocessor::AddGeneratedFile("Shaders/Bench" + std::to_string(i) + ".fs", fragmentSources[i]);
+
+	typedef std::chrono::steady_clock Clock;
+
+	// Linked pairs
+	Clock::time_point start = Clock::now();
+	std::vector<std::unique_ptr<Shader>> linked;
+	for (int v = 0; v < vertexCount; v++)
+	{
+		for (int f = 0; f < fragmentCount; f++)
+			linked.push_back(std::make_unique<Shader>(vertexSources[v], fragmentSources[f], "Bench.vs", "Bench.fs"));
+	}
+	double linkedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	// Separable stages + pipelines
+	start = Clock::now();
+	ShaderPipelines pipelines;
+	std::vector<unsigned int> combinations;
+	for (int v = 0; v < vertexCount; v++)
+	{
+		for (int f = 0; f < fragmentCount; f++)
+		{
+			std::string vertexPath = "Shaders/Bench" + std::to_string(vertexCount + v) + ".vs";
+			std::string fragmentPath = "Shaders/Bench" + std::to_string(fragmentCount + f) + ".fs";
+			combinations.push_back(pipelines.Pipeline(vertexPath, fragmentPath));
+		}
+	}
+	double pipelineMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	// Same sources drawn both ways (the last combination of each side uses the same salts relative to its half)
+	const float triangle[] = { -1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f };
+	unsigned int VAO, VBO;
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(1, &VBO);
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(triangle), triangle, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+	Framebuffer framebuffer;
+	if (!framebuffer.Create(32, 32))
+		return -1;
+
+	std::unique_ptr<Shader> reference = std::make_unique<Shader>(vertexSources[vertexCount * 2 - 1], fragmentSources[fragmentCount * 2 - 1], "Bench.vs", "Bench.fs");
+	unsigned char linkedPixel[4], pipelinePixel[4];
+	reference->Use();
+	DrawInto(framebuffer, linkedPixel);
+	glUseProgram(0);
+	glBindProgramPipeline(combinations.back());
+	bool valid = pipelines.Validate(combinations.back());
+	DrawInto(framebuffer, pipelinePixel);
+
+	int programCount = vertexCount * fragmentCount;
+	printf("%d vertex x %d fragment shaders = %d combinations\n", vertexCount, fragmentCount, programCount);
+	printf("%-18s %8.2f ms  %3d programs linked, %3d shaders compiled\n", "linked pairs", linkedMs, programCount, programCount * 2);
+	printf("%-18s %8.2f ms  %3d programs linked, %3d shaders compiled, %d pipelines\n", "separable stages", pipelineMs, pipelines.StageCount(), pipelines.StageCount(), pipelines.PipelineCount());
+	printf("Same output: %s (%d %d %d vs %d %d %d), pipeline %s\n", memcmp(linkedPixel, pipelinePixel, 4) == 0 ? "yes" : "NO",
+		linkedPixel[0], linkedPixel[1], linkedPixel[2], pipelinePixel[0], pipelinePixel[1], pipelinePixel[2], valid ? "valid" : "INVALID");
+	pipelines.PrintStats();
+
+	for (auto& shader : linked)
+		glDeleteProgram(shader->ID);
+	glDeleteProgram(reference->ID);
+	glDeleteVertexArrays(1, &VAO);
+	glDeleteBuffers(1, &VBO);
+	return 0;
+}
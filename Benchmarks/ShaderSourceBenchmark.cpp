@@ -0,0 +1,131 @@
+// Shader source loading over a few hundred generated files (no GL needed):
+//   - std::ifstream -> std::stringstream -> std::string per file (what the Shader constructor used to do)
+//   - ShaderSources::ReadFile, one pre-sized string and one read() per file
+//   - ShaderSources::Load, all files as one batch in one buffer
+//   - ShaderSources::LoadDirectory, same plus listing the directory
+//   - ShaderArchive: all files packed into one archive beforehand, mounted (one open + mmap) and looked up by name
+// Files are read once before timing, so every method works from the page cache.
+//
+// Build: g++ -O2 -std=c++17 Benchmarks/ShaderSourceBenchmark.cpp -o ShaderSourceBenchmark
+// Usage: ShaderSourceBenchmark [files] [iterations]
+
+#include "../ShaderSources.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static std::vector<std::string> WriteFiles(const std::filesystem::path& dir, int count)
+{
+	std::filesystem::remove_all(dir);
+	std::filesystem::create_directories(dir);
+	std::vector<std::string> paths;
+	for (int i = 0; i < count; i++)
+	{
+		std::string path = (dir / ("shader" + std::to_string(i) + (i % 2 ? ".fs" : ".vs"))).generic_string();
+		std::ofstream file(path);
+		file << "#version 330 core\n";
+		for (int line = 0; line < 40 + i % 80; line++)				// 1-5 KB, roughly what real shaders are
+			file << "uniform vec4 parameter" << line << "; // padding to make the file a realistic size\n";
+		file << "void main() {}\n";
+		paths.push_back(path);
+	}
+	return paths;
+}
+
+int main(int argc, char** argv)
+{
+	int count = argc > 1 ? atoi(argv[1]) : 300;
+	int iterations = argc > 2 ? atoi(argv[2]) : 50;
+
+	std::filesystem::path dir = std::filesystem::temp_directory_path() / "shader_source_benchmark";
+	std::vector<std::string> paths = WriteFiles(dir, count);
+
+	std::string archivePath = (dir / "shaders.pak").generic_string();
+	{
+		ShaderSources sources;
+		sources.Load(paths);
+		std::vector<std::pair<std::string, std::string_view>> entries;
+		for (const std::string& path : paths)
+			entries.emplace_back(path, sources.Get(path));
+		if (!ShaderArchive::Write(archivePath.c_str(), entries))
+			return -1;
+	}
+
+	typedef std::chrono::steady_clock Clock;
+	const int METHODS = 5;
+	const char* labels[METHODS] = { "ifstream + stringstream + string", "ShaderSources::ReadFile", "ShaderSources::Load", "ShaderSources::LoadDirectory", "ShaderArchive mount + Load" };
+	double best[METHODS] = { 1e30, 1e30, 1e30, 1e30, 1e30 };
+	size_t bytes[METHODS] = {};
+	for (int iteration = -1; iteration < iterations; iteration++)		// Iteration -1 warms the page cache
+	{
+		for (int method = 0; method < METHODS; method++)
+		{
+			size_t total = 0;
+			Clock::time_point start = Clock::now();
+			if (method == 0)
+			{
+				for (const std::string& path : paths)
+				{
+					std::ifstream file;
+					file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+					file.open(path);
+					std::stringstream stream;
+					stream << file.rdbuf();
+					file.close();
+					std::string code = stream.str();
+					total += code.size();
+				}
+			}
+			else if (method == 1)
+			{
+				std::string code;
+				for (const std::string& path : paths)
+				{
+					ShaderSources::ReadFile(path.c_str(), code);
+					total += code.size();
+				}
+			}
+			else if (method == 2)
+			{
+				ShaderSources sources;
+				sources.Load(paths);
+				for (const std::string& path : paths)
+					total += sources.Get(path).size();
+			}
+			else if (method == 3)
+			{
+				ShaderSources sources;
+				sources.LoadDirectory(dir.generic_string());
+				for (const std::string& path : paths)
+					total += sources.Get(path).size();
+			}
+			else
+			{
+				ShaderArchive::Mount(archivePath.c_str());
+				ShaderSources sources;
+				sources.Load(paths);
+				for (const std::string& path : paths)
+					total += sources.Get(path).size();
+				ShaderArchive::Mounted().Close();						// The other methods have to read the files
+			}
+			double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+			if (iteration >= 0)
+				best[method] = std::min(best[method], ms);
+			bytes[method] = total;
+		}
+	}
+
+	printf("%d files, %.1f KB, best of %d\n", count, bytes[0] / 1024.0, iterations);
+	for (int method = 0; method < METHODS; method++)
+		printf("%-34s %8.3f ms %8.2f us/file%s\n", labels[method], best[method], best[method] * 1000.0 / count, bytes[method] == bytes[0] ? "" : "  SIZE MISMATCH");
+
+	std::filesystem::remove_all(dir);
+	return 0;
+}
@@ -0,0 +1,124 @@
+// First-frame time of a freshly linked program, with and without a ShaderWarmup pass before it.
+// Each round builds two new programs from fresh sources (ProgramCache and Mesa's disk cache off), then for each:
+//   - optionally warms it up with one draw into an 8x8 target
+//   - times the first 800x600 frame drawn with it, then a second one as the steady-state reference
+// Runs on a headless EGL context.
+//
+// Build: g++ -O2 -std=c++17 -I<deps>/include Benchmarks/ShaderWarmupBenchmark.cpp glad.c -o ShaderWarmupBenchmark -lEGL -ldl
+// Usage: ShaderWarmupBenchmark [rounds]
+
+#include "../my_glad.h"
+#include "../HeadlessContext.h"
+#include "../Framebuffer.h"
+#include "../Shader.h"
+#include "../ShaderWarmup.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+static const char* VERTEX_SOURCE =
+	"#version 330 core\n"
+	"layout (location = 0) in vec2 aPos;\n"
+	"out vec2 uv;\n"
+	"void main() { uv = aPos * 0.5 + 0.5; gl_Position = vec4(aPos, 0.0, 1.0); }\n";
+
+// Samples an RGB and an RGBA texture, like the scene's shader
+static std::string FragmentSource(int salt)
+{
+	return "#version 330 core\nin vec2 uv;\nout vec4 FragColor;\n"
+		   "uniform sampler2D texture1;\nuniform sampler2D texture2;\n"
+		   "void main() {\n\tvec4 sum = vec4(0.0);\n"
+		   "\tfor (int i = 0; i < 8; i++) {\n"
+		   "\t\tvec2 offset = vec2(sin(float(i) * " + std::to_string(salt) + ".1), cos(float(i))) * 0.01;\n"
+		   "\t\tsum += mix(texture(texture1, uv + offset), texture(texture2, uv - offset), 0.6);\n"
+		   "\t}\n\tFragColor = sum / 8.0;\n}\n";
+}
+
+static unsigned int MakeTexture(GLenum format, unsigned char value)
+{
+	std::vector<unsigned char> pixels(64 * 64 * 4, value);
+	unsigned int texture;
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, format, 64, 64, 0, format, GL_UNSIGNED_BYTE, pixels.data());
+	glGenerateMipmap(GL_TEXTURE_2D);
+	return texture;
+}
+
+int main(int argc, char** argv)
+{
+	int rounds = argc > 1 ? atoi(argv[1]) : 5;
+	setenv("MESA_SHADER_CACHE_DISABLE", "true", 1);
+
+	HeadlessContext context;
+	if (!context.Init() || !gladLoadGLLoader(HeadlessContext::GetProcAddress()))
+		return -1;
+	ProgramCache::Get().enabled = false;
+
+	Framebuffer framebuffer;
+	if (!framebuffer.Create(800, 600))
+		return -1;
+	framebuffer.Bind();
+
+	const float triangle[] = { -1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f };
+	unsigned int VAO, VBO;
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(1, &VBO);
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(triangle), triangle, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+	unsigned int textures[2] = { MakeTexture(GL_RGB, 200), MakeTexture(GL_RGBA, 100) };
+
+	typedef std::chrono::steady_clock Clock;
+	auto DrawFrame = [&](unsigned int program)
+	{
+		Clock::time_point start = Clock::now();
+		glClear(GL_COLOR_BUFFER_BIT);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, textures[0]);
+		glActiveTexture(GL_TEXTURE1);
+		glBindTexture(GL_TEXTURE_2D, textures[1]);
+		glUseProgram(program);
+		glBindVertexArray(VAO);
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+		glFinish();
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	};
+
+	double firstMs[2] = {}, steadyMs[2] = {}, warmupMs = 0.0;
+	int salt = (int)(Clock::now().time_since_epoch().count() % 100000);
+	for (int round = 0; round < rounds; round++)
+	{
+		for (int warm = 0; warm < 2; warm++)
+		{
+			Shader shader(VERTEX_SOURCE, FragmentSource(salt++), "Warmup.vs", "Warmup.fs");
+			shader.Use();
+			shader.setInt("texture1", 0);
+			shader.setInt("texture2", 1);
+			if (warm)
+			{
+				ShaderWarmup warmup;
+				warmup.AddDraw("Warmup", shader.ID, VAO, { { 0, GL_TEXTURE_2D, textures[0] }, { 1, GL_TEXTURE_2D, textures[1] } }, GL_TRIANGLES, 3);
+				warmupMs += warmup.Run();
+			}
+			firstMs[warm] += DrawFrame(shader.ID);
+			steadyMs[warm] += DrawFrame(shader.ID);
+			glDeleteProgram(shader.ID);
+		}
+	}
+
+	printf("%d rounds, 800x600 frames\n", rounds);
+	printf("%-16s first frame %8.3f ms, second frame %8.3f ms\n", "no warm-up", firstMs[0] / rounds, steadyMs[0] / rounds);
+	printf("%-16s first frame %8.3f ms, second frame %8.3f ms (warm-up itself %.3f ms)\n", "with warm-up", firstMs[1] / rounds, steadyMs[1] / rounds, warmupMs / rounds);
+
+	glDeleteTextures(2, textures);
+	glDeleteVertexArrays(1, &VAO);
+	glDeleteBuffers(1, &VBO);
+	return 0;
+}
@@ -0,0 +1,152 @@
+// Cold-start regression harness
+// Runs the renderer headless ('<app> --frames 1 --trace <file>') as a fresh process several times, takes the median
+// duration of every start-up phase from the Chrome traces and compares them with a saved baseline.
+// Must be started from the directory the app loads Shaders/ and Textures/ from.
+//
+// Build: g++ -O2 -std=c++17 Benchmarks/StartupHarness.cpp -o StartupHarness
+// Usage: StartupHarness <app> [--runs N] [--save baseline.json] [--baseline baseline.json] [--threshold 0.25] [--min-us 200]
+//        Exits with 1 when any phase is more than 'threshold' (fraction) and 'min-us' microseconds slower than the baseline.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+const char* TIME_TO_FIRST_FRAME = "Time to first frame";
+
+// Sums the durations per phase name of one trace written by Timeline::WriteChromeTrace (one event per line)
+static bool ReadTrace(const char* path, std::map<std::string, double>& phases)
+{
+	FILE* file = fopen(path, "rb");
+	if (!file)
+		return false;
+	char line[4096];
+	double end = 0.0;
+	while (fgets(line, sizeof(line), file))
+	{
+		const char* name = strstr(line, "\"name\": \"");
+		const char* ts = strstr(line, "\"ts\": ");
+		const char* dur = strstr(line, "\"dur\": ");
+		if (!name || !ts || !dur)
+			continue;
+		name += strlen("\"name\": \"");
+		const char* nameEnd = strchr(name, '"');
+		if (!nameEnd)
+			continue;
+		double start = atof(ts + strlen("\"ts\": "));
+		double duration = atof(dur + strlen("\"dur\": "));
+		phases[std::string(name, nameEnd)] += duration;
+		end = std::max(end, start + duration);
+	}
+	fclose(file);
+	phases[TIME_TO_FIRST_FRAME] = end;
+	return end > 0.0;
+}
+
+// Baseline files hold one "phase": microseconds pair per line
+static std::map<std::string, double> ReadBaseline(const char* path)
+{
+	std::map<std::string, double> baseline;
+	FILE* file = fopen(path, "rb");
+	if (!file)
+		return baseline;
+	char line[1024];
+	while (fgets(line, sizeof(line), file))
+	{
+		const char* name = strchr(line, '"');
+		const char* nameEnd = name ? strchr(name + 1, '"') : nullptr;
+		const char* colon = nameEnd ? strchr(nameEnd, ':') : nullptr;
+		if (colon)
+			baseline[std::string(name + 1, nameEnd)] = atof(colon + 1);
+	}
+	fclose(file);
+	return baseline;
+}
+
+static bool WriteBaseline(const char* path, const std::map<std::string, double>& medians)
+{
+	FILE* file = fopen(path, "wb");
+	if (!file)
+		return false;
+	fprintf(file, "{\n");
+	size_t index = 0;
+	for (const auto& phase : medians)
+		fprintf(file, "  \"%s\": %.3f%s\n", phase.first.c_str(), phase.second, ++index < medians.size() ? "," : "");
+	fprintf(file, "}\n");
+	fclose(file);
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		printf("Usage: %s <app> [--runs N] [--save file] [--baseline file] [--threshold fraction] [--min-us us]\n", argv[0]);
+		return -1;
+	}
+	const char* app = argv[1];
+	int runs = 10;
+	const char* savePath = nullptr;
+	const char* baselinePath = nullptr;
+	double threshold = 0.25;
+	double minUs = 200.0;
+	for (int i = 2; i + 1 < argc; i += 2)
+	{
+		if (strcmp(argv[i], "--runs") == 0) runs = atoi(argv[i + 1]);
+		else if (strcmp(argv[i], "--save") == 0) savePath = argv[i + 1];
+		else if (strcmp(argv[i], "--baseline") == 0) baselinePath = argv[i + 1];
+		else if (strcmp(argv[i], "--threshold") == 0) threshold = atof(argv[i + 1]);
+		else if (strcmp(argv[i], "--min-us") == 0) minUs = atof(argv[i + 1]);
+	}
+
+	const char* tracePath = "startup_harness_trace.json";
+	std::map<std::string, std::vector<double>> samples;
+	for (int run = 0; run < runs; run++)
+	{
+		remove(tracePath);
+		std::string command = std::string("\"") + app + "\" --frames 1 --trace " + tracePath + " > /dev/null";
+		std::map<std::string, double> phases;
+		if (system(command.c_str()) != 0 || !ReadTrace(tracePath, phases))
+		{
+			printf("ERROR::HARNESS::RUN_%d_FAILED\n", run);
+			return -1;
+		}
+		for (const auto& phase : phases)
+			samples[phase.first].push_back(phase.second);
+	}
+	remove(tracePath);
+
+	std::map<std::string, double> medians;
+	for (auto& phase : samples)
+	{
+		std::sort(phase.second.begin(), phase.second.end());
+		medians[phase.first] = phase.second[phase.second.size() / 2];
+	}
+
+	std::map<std::string, double> baseline;
+	if (baselinePath)
+		baseline = ReadBaseline(baselinePath);
+
+	bool regressed = false;
+	printf("%-28s %14s %14s\n", "phase", "median (us)", "baseline (us)");
+	for (const auto& phase : medians)
+	{
+		auto base = baseline.find(phase.first);
+		bool slower = base != baseline.end() && phase.second > base->second * (1.0 + threshold) && phase.second - base->second > minUs;
+		if (base != baseline.end())
+			printf("%-28s %14.1f %14.1f%s\n", phase.first.c_str(), phase.second, base->second, slower ? "  REGRESSION" : "");
+		else
+			printf("%-28s %14.1f %14s\n", phase.first.c_str(), phase.second, "-");
+		regressed = regressed || slower;
+	}
+
+	if (savePath && !WriteBaseline(savePath, medians))
+	{
+		printf("ERROR::HARNESS::CANNOT_WRITE %s\n", savePath);
+		return -1;
+	}
+	return regressed ? 1 : 0;
+}
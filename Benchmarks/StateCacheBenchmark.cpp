@@ -0,0 +1,119 @@
+// N draws per frame that each bind their state the way RenderScene does (program, vertex array, two texture units),
+// although every draw uses the same state:
+//   - plain GL calls, every bind reaches the driver
+//   - through a GLStateCache, which drops everything after the first draw of the run
+// Triangles are degenerate, so the time is the CPU side of the draw calls and not rasterization.
+// Runs on a headless EGL context.
+//
+// Build: g++ -O2 -std=c++17 -I<deps>/include Benchmarks/StateCacheBenchmark.cpp glad.c -o StateCacheBenchmark -lEGL -ldl
+// Usage: StateCacheBenchmark [draws] [frames]
+
+#include "../my_glad.h"
+#include "../HeadlessContext.h"
+#include "../Framebuffer.h"
+#include "../Shader.h"
+#include "../GLStateCache.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+
+static const char* VERTEX_SOURCE =
+	"#version 330 core\n"
+	"layout (location = 0) in vec2 aPos;\n"
+	"void main() { gl_Position = vec4(aPos, 0.0, 1.0); }\n";
+
+static const char* FRAGMENT_SOURCE =
+	"#version 330 core\n"
+	"out vec4 FragColor;\n"
+	"uniform sampler2D texture1;\n"
+	"uniform sampler2D texture2;\n"
+	"void main() { FragColor = texture(texture1, vec2(0.5)) + texture(texture2, vec2(0.5)); }\n";
+
+int main(int argc, char** argv)
+{
+	int draws = argc > 1 ? atoi(argv[1]) : 5000;
+	int frames = argc > 2 ? atoi(argv[2]) : 50;
+
+	HeadlessContext context;
+	if (!context.Init() || !gladLoadGLLoader(HeadlessContext::GetProcAddress()))
+		return -1;
+	ProgramCache::Get().enabled = false;
+
+	Framebuffer framebuffer;
+	if (!framebuffer.Create(64, 64))
+		return -1;
+	framebuffer.Bind();
+
+	const float triangle[] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };		// Zero area: nothing to rasterize
+	unsigned int VAO, VBO, textures[2];
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(1, &VBO);
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(triangle), triangle, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+	glGenTextures(2, textures);
+	const unsigned char texel[4] = { 255, 128, 0, 255 };
+	for (unsigned int texture : textures)
+	{
+		glBindTexture(GL_TEXTURE_2D, texture);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, texel);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	}
+
+	Shader shader(VERTEX_SOURCE, FRAGMENT_SOURCE, "StateCache.vs", "StateCache.fs");
+	shader.Use();
+	shader.setInt("texture1", 0);
+	shader.setInt("texture2", 1);
+
+	typedef std::chrono::steady_clock Clock;
+	GLStateCache state;
+	double submitMs[2] = {}, frameMs[2] = {};
+	for (int method = 0; method < 2; method++)
+	{
+		glFinish();
+		for (int frame = 0; frame < frames; frame++)
+		{
+			Clock::time_point start = Clock::now();
+			state.BeginFrame();
+			glClear(GL_COLOR_BUFFER_BIT);
+			for (int draw = 0; draw < draws; draw++)
+			{
+				if (method == 0)
+				{
+					glActiveTexture(GL_TEXTURE0);
+					glBindTexture(GL_TEXTURE_2D, textures[0]);
+					glActiveTexture(GL_TEXTURE1);
+					glBindTexture(GL_TEXTURE_2D, textures[1]);
+					glUseProgram(shader.ID);
+					glBindVertexArray(VAO);
+				}
+				else
+				{
+					state.BindTextureUnit(0, GL_TEXTURE_2D, textures[0]);
+					state.BindTextureUnit(1, GL_TEXTURE_2D, textures[1]);
+					state.UseProgram(shader.ID);
+					state.BindVertexArray(VAO);
+				}
+				glDrawArrays(GL_TRIANGLES, 0, 3);
+			}
+			submitMs[method] += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+			glFinish();
+			frameMs[method] += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		}
+	}
+	state.BeginFrame();
+
+	printf("%d draws, %d frames\n", draws, frames);
+	const char* labels[2] = { "plain GL binds", "GLStateCache" };
+	for (int method = 0; method < 2; method++)
+		printf("%-16s CPU submit %8.3f ms/frame, frame %8.3f ms\n", labels[method], submitMs[method] / frames, frameMs[method] / frames);
+	state.PrintStats();
+
+	glDeleteTextures(2, textures);
+	glDeleteVertexArrays(1, &VAO);
+	glDeleteBuffers(1, &VBO);
+	return 0;
+}
@@ -0,0 +1,140 @@
+// N sprites (two triangles of ColorVertex each) whose vertices are written anew every frame, sent four ways:
+//   - glBufferSubData into the same buffer every frame (the driver may have to wait for, or copy around, last frame)
+//   - orphaning: glBufferData(nullptr) then glBufferSubData (a fresh allocation behind the same name each frame)
+//   - StreamBuffer, GL 3.3 path: glMapBufferRange(UNSYNCHRONIZED) of the frame's region, fences between regions
+//   - StreamBuffer, persistent: glBufferStorage mapped once, written in place (skipped without GL 4.4/ARB_buffer_storage)
+// Frames are not glFinish()ed, so the GPU runs behind the CPU as it would in an application. Reports the CPU time per
+// frame spent writing and submitting, the total per frame including the final glFinish(), and how often the
+// StreamBuffers had to wait for the GPU. Runs on a headless EGL context.
+//
+// Build: g++ -O2 -std=c++17 -I<deps>/include Benchmarks/StreamBufferBenchmark.cpp glad.c -o StreamBufferBenchmark -lEGL -ldl
+// Usage: StreamBufferBenchmark [sprites] [frames]
+
+#include "../my_glad.h"
+#include "../HeadlessContext.h"
+#include "../Framebuffer.h"
+#include "../Shader.h"
+#include "../VertexLayout.h"
+#include "../StreamBuffer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+static const char* VERTEX_SOURCE =
+	"#version 330 core\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"layout (location = 1) in vec3 aColor;\n"
+	"out vec3 ourColor;\n"
+	"void main() { ourColor = aColor; gl_Position = vec4(aPos, 1.0); }\n";
+
+static const char* FRAGMENT_SOURCE =
+	"#version 330 core\n"
+	"in vec3 ourColor;\n"
+	"out vec4 FragColor;\n"
+	"void main() { FragColor = vec4(ourColor, 1.0); }\n";
+
+static const int VERTICES_PER_SPRITE = 6;
+
+// Sprites drifting in a circle, so every vertex really changes every frame
+static void WriteSprites(ColorVertex* out, int sprites, int frame)
+{
+	for (int sprite = 0; sprite < sprites; sprite++)
+	{
+		float angle = sprite * 0.618f + frame * 0.01f;
+		float x = cosf(angle) * 0.9f, y = sinf(angle) * 0.9f, size = 0.004f;
+		float corners[VERTICES_PER_SPRITE][2] = { { -1, -1 }, { 1, -1 }, { -1, 1 }, { 1, -1 }, { 1, 1 }, { -1, 1 } };
+		for (int corner = 0; corner < VERTICES_PER_SPRITE; corner++)
+			out[sprite * VERTICES_PER_SPRITE + corner] = { { x + corners[corner][0] * size, y + corners[corner][1] * size, 0.0f }, { 1.0f, 0.5f, 0.25f } };
+	}
+}
+
+int main(int argc, char** argv)
+{
+	int sprites = argc > 1 ? atoi(argv[1]) : 10000;
+	int frames = argc > 2 ? atoi(argv[2]) : 200;
+
+	HeadlessContext context;
+	if (!context.Init() || !gladLoadGLLoader(HeadlessContext::GetProcAddress()))
+		return -1;
+	Framebuffer framebuffer;
+	if (!framebuffer.Create(64, 64))
+		return -1;
+	framebuffer.Bind();
+	Shader shader(VERTEX_SOURCE, FRAGMENT_SOURCE, "Stream.vs", "Stream.fs");
+	shader.Use();
+
+	const unsigned int frameBytes = (unsigned int)(sprites * VERTICES_PER_SPRITE * sizeof(ColorVertex));
+	std::vector<ColorVertex> staging(sprites * VERTICES_PER_SPRITE);
+	typedef std::chrono::steady_clock Clock;
+	auto Elapsed = [](Clock::time_point start) { return std::chrono::duration<double, std::milli>(Clock::now() - start).count(); };
+
+	const char* names[] = { "glBufferSubData", "orphan + glBufferSubData", "StreamBuffer, unsynchronized map", "StreamBuffer, persistent" };
+	printf("%d sprites (%.1f KB of vertices) per frame, %d frames\n", sprites, frameBytes / 1024.0, frames);
+	for (int method = 0; method < 4; method++)
+	{
+		if (method == 3 && !StreamBuffer::PersistentSupported())
+		{
+			printf("%-34s not supported by this context\n", names[method]);
+			continue;
+		}
+		unsigned int VAO, VBO = 0;
+		glGenVertexArrays(1, &VAO);
+		glBindVertexArray(VAO);
+		StreamBuffer stream;
+		if (method < 2)
+		{
+			glGenBuffers(1, &VBO);
+			glBindBuffer(GL_ARRAY_BUFFER, VBO);
+			glBufferData(GL_ARRAY_BUFFER, frameBytes, nullptr, GL_STREAM_DRAW);
+		}
+		else
+		{
+			stream.Create(frameBytes, 3, method == 3);
+			glBindBuffer(GL_ARRAY_BUFFER, stream.ID());
+		}
+		VertexLayout::Apply<ColorVertex>();
+		glFinish();
+
+		double submitMs = 0.0;
+		Clock::time_point start = Clock::now();
+		for (int frame = 0; frame < frames; frame++)
+		{
+			Clock::time_point submitStart = Clock::now();
+			glClear(GL_COLOR_BUFFER_BIT);
+			int first = 0;
+			if (method < 2)
+			{
+				WriteSprites(staging.data(), sprites, frame);
+				if (method == 1)
+					glBufferData(GL_ARRAY_BUFFER, frameBytes, nullptr, GL_STREAM_DRAW);
+				glBufferSubData(GL_ARRAY_BUFFER, 0, frameBytes, staging.data());
+			}
+			else
+			{
+				stream.BeginFrame();
+				unsigned int offset = 0;
+				ColorVertex* vertices = (ColorVertex*)stream.Allocate(frameBytes, sizeof(ColorVertex), offset);
+				WriteSprites(vertices, sprites, frame);
+				stream.Commit();
+				first = (int)(offset / sizeof(ColorVertex));
+			}
+			glDrawArrays(GL_TRIANGLES, first, sprites * VERTICES_PER_SPRITE);
+			submitMs += Elapsed(submitStart);
+		}
+		glFinish();
+		double totalMs = Elapsed(start);
+
+		unsigned char pixel[4];
+		glReadPixels(0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);		// Keeps the draws from being skipped
+		printf("%-34s CPU %7.3f ms/frame, total %7.3f ms/frame\n", names[method], submitMs / frames, totalMs / frames);
+		if (method >= 2)
+			stream.PrintStats("sprites");
+		glDeleteVertexArrays(1, &VAO);
+		if (VBO)
+			glDeleteBuffers(1, &VBO);
+	}
+	return 0;
+}
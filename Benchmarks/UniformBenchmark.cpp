@@ -0,0 +1,99 @@
+// Uniform update microbenchmark: 10k uniform sets per frame through
+//   - glGetUniformLocation with a std::string built per call (what Shader::setFloat used to do)
+//   - Shader::setFloat(std::string_view) hashed lookup in the uniform cache
+//   - Shader::setFloat(UniformHandle), location resolved once up front
+// Runs on a headless EGL context; start it from the repository root.
+//
+// Build: g++ -O2 -std=c++17 -I<deps>/include Benchmarks/UniformBenchmark.cpp glad.c -o UniformBenchmark -lEGL -ldl
+// Usage: UniformBenchmark [frames]
+
+#include "../my_glad.h"
+#include "../HeadlessContext.h"
+#include "../Shader.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+const int UNIFORM_COUNT = 16;
+const int SETS_PER_FRAME = 10000;
+
+static std::string WriteShaders()
+{
+	std::filesystem::path dir = std::filesystem::temp_directory_path() / "uniform_benchmark";
+	std::filesystem::create_directories(dir);
+
+	std::ofstream vs(dir / "bench.vs");
+	vs << "#version 330 core\nlayout (location = 0) in vec3 aPos;\nvoid main() { gl_Position = vec4(aPos, 1.0); }\n";
+
+	// Every uniform feeds the output so none get optimized away
+	std::ofstream fs(dir / "bench.fs");
+	fs << "#version 330 core\nout vec4 FragColor;\n";
+	for (int i = 0; i < UNIFORM_COUNT; i++)
+		fs << "uniform float weight" << i << ";\n";
+	fs << "void main() { float sum = 0.0;";
+	for (int i = 0; i < UNIFORM_COUNT; i++)
+		fs << " sum += weight" << i << ";";
+	fs << " FragColor = vec4(sum); }\n";
+	return dir.string();
+}
+
+int main(int argc, char** argv)
+{
+	int frames = argc > 1 ? atoi(argv[1]) : 100;
+
+	HeadlessContext context;
+	if (!context.Init() || !gladLoadGLLoader(HeadlessContext::GetProcAddress()))
+		return -1;
+
+	std::string dir = WriteShaders();
+	Shader shader((dir + "/bench.vs").c_str(), (dir + "/bench.fs").c_str());
+	shader.Use();
+
+	std::string names[UNIFORM_COUNT];
+	UniformHandle handles[UNIFORM_COUNT];
+	for (int i = 0; i < UNIFORM_COUNT; i++)
+	{
+		names[i] = "weight" + std::to_string(i);
+		handles[i] = shader.GetUniform(names[i]);
+	}
+
+	typedef std::chrono::steady_clock Clock;
+	double results[3] = {};
+	const char* labels[3] = { "glGetUniformLocation + std::string", "cached lookup (string_view)", "UniformHandle" };
+	for (int method = 0; method < 3; method++)
+	{
+		Clock::time_point start = Clock::now();
+		for (int frame = 0; frame < frames; frame++)
+		{
+			for (int set = 0; set < SETS_PER_FRAME; set++)
+			{
+				int uniform = set % UNIFORM_COUNT;
+				float value = (float)set;
+				if (method == 0)
+				{
+					std::string name = names[uniform].c_str();			// Copy, like passing a literal to a const std::string& parameter
+					glUniform1f(glGetUniformLocation(shader.ID, name.c_str()), value);
+				}
+				else if (method == 1)
+				{
+					shader.setFloat(names[uniform], value);
+				}
+				else
+				{
+					shader.setFloat(handles[uniform], value);
+				}
+			}
+		}
+		glFinish();
+		results[method] = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frames;
+	}
+
+	printf("%d uniform sets per frame, %d frames\n", SETS_PER_FRAME, frames);
+	for (int method = 0; method < 3; method++)
+		printf("%-38s %8.3f ms/frame %8.1f ns/set\n", labels[method], results[method], results[method] * 1.0e6 / SETS_PER_FRAME);
+	return 0;
+}
@@ -0,0 +1,151 @@
+// Per-object uniforms for N small quads per frame:
+//   - two glUniform4f per draw (offset/scale and tint) through UniformHandles
+//   - UniformRing: every ObjectBlock/MaterialBlock of the frame written into the mapped ring, glBindBufferRange per draw
+// Runs on a headless EGL context.
+//
+// Build: g++ -O2 -std=c++17 -I<deps>/include Benchmarks/UniformBufferBenchmark.cpp glad.c -o UniformBufferBenchmark -lEGL -ldl
+// Usage: UniformBufferBenchmark [objects] [frames]
+
+#include "../my_glad.h"
+#include "../HeadlessContext.h"
+#include "../Framebuffer.h"
+#include "../Shader.h"
+#include "../UniformBuffers.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+static const char* VERTEX_SOURCE =
+	"#version 330 core\n"
+	"layout (location = 0) in vec2 aPos;\n"
+	"#ifdef UNIFORM_BLOCKS\n"
+	"#include \"Include/UniformBlocks.glsl\"\n"
+	"#else\n"
+	"uniform vec4 offsetScale;\n"
+	"#endif\n"
+	"void main() { gl_Position = vec4(aPos * offsetScale.zw + offsetScale.xy, 0.0, 1.0); }\n";
+
+static const char* FRAGMENT_SOURCE =
+	"#version 330 core\n"
+	"out vec4 FragColor;\n"
+	"#ifdef UNIFORM_BLOCKS\n"
+	"#include \"Include/UniformBlocks.glsl\"\n"
+	"#else\n"
+	"uniform vec4 tint;\n"
+	"#endif\n"
+	"void main() { FragColor = tint; }\n";
+
+// Builds the benchmark program through the same preprocessor the app uses (generated blocks included)
+static Shader* BuildShader(const ShaderDefines& defines)
+{
+	ShaderPreprocessor::AddGeneratedFile("Shaders/Bench.vs", VERTEX_SOURCE);
+	ShaderPreprocessor::AddGeneratedFile("Shaders/Bench.fs", FRAGMENT_SOURCE);
+	ShaderPreprocessor preprocessor;
+	std::string vertex, fragment;
+	preprocessor.Process("Shaders/Bench.vs", defines, vertex);
+	preprocessor.Process("Shaders/Bench.fs", defines, fragment);
+	return new Shader(vertex, fragment, "Bench.vs", "Bench.fs");
+}
+
+int main(int argc, char** argv)
+{
+	int objects = argc > 1 ? atoi(argv[1]) : 2000;
+	int frames = argc > 2 ? atoi(argv[2]) : 50;
+
+	HeadlessContext context;
+	if (!context.Init() || !gladLoadGLLoader(HeadlessContext::GetProcAddress()))
+		return -1;
+	ProgramCache::Get().enabled = false;
+	UniformBuffers::RegisterBlocks();
+
+	Framebuffer framebuffer;
+	if (!framebuffer.Create(64, 64))
+		return -1;
+	framebuffer.Bind();
+
+	const float quad[] = { -1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f, 1.0f };
+	unsigned int VAO, VBO;
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(1, &VBO);
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+
+	Shader* plain = BuildShader(ShaderDefines());
+	Shader* blocks = BuildShader({ { "UNIFORM_BLOCKS", "" } });
+	UniformBuffers::BindBlocks(blocks->ID);
+	if (!UniformBuffers::ValidateBlocks(blocks->ID))
+		return -1;
+	UniformHandle offsetScale = plain->GetUniform("offsetScale");
+	UniformHandle tint = plain->GetUniform("tint");
+
+	UniformRing ring;
+	ring.Create(objects * 2 * 256 + 256);							// Worst case: every block on its own 256 byte aligned slot
+
+	typedef std::chrono::steady_clock Clock;
+	double results[2] = {}, submitMs[2] = {};
+	for (int method = 0; method < 2; method++)
+	{
+		(method == 0 ? plain : blocks)->Use();
+		glFinish();
+		Clock::time_point start = Clock::now();
+		for (int frame = 0; frame < frames; frame++)
+		{
+			Clock::time_point submitStart = Clock::now();
+			glClear(GL_COLOR_BUFFER_BIT);
+			if (method == 0)
+			{
+				for (int object = 0; object < objects; object++)
+				{
+					float x = (object % 64) / 32.0f - 1.0f, y = (object / 64 % 64) / 32.0f - 1.0f;
+					glUniform4f(offsetScale.location, x, y, 0.002f, 0.002f);
+					glUniform4f(tint.location, x, y, 1.0f, 1.0f);
+					glDrawArrays(GL_TRIANGLES, 0, 6);
+				}
+			}
+			else
+			{
+				ring.BeginFrame();
+				std::vector<UniformRange> ranges(objects * 2);
+				for (int object = 0; object < objects; object++)
+				{
+					float x = (object % 64) / 32.0f - 1.0f, y = (object / 64 % 64) / 32.0f - 1.0f;
+					ObjectBlock objectBlock = {};
+					objectBlock.offsetScale = { x, y, 0.002f, 0.002f };
+					MaterialBlock material = {};
+					material.tint = { x, y, 1.0f, 1.0f };
+					ranges[object * 2] = ring.Push(objectBlock);
+					ranges[object * 2 + 1] = ring.Push(material);
+				}
+				ring.Upload();
+				for (int object = 0; object < objects; object++)
+				{
+					ring.Bind<ObjectBlock>(ranges[object * 2]);
+					ring.Bind<MaterialBlock>(ranges[object * 2 + 1]);
+					glDrawArrays(GL_TRIANGLES, 0, 6);
+				}
+			}
+			submitMs[method] += std::chrono::duration<double, std::milli>(Clock::now() - submitStart).count();
+		}
+		glFinish();
+		results[method] = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frames;
+	}
+
+	unsigned char pixel[4];
+	glReadPixels(32, 32, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+	printf("%d objects, %d frames (center pixel %d %d %d)\n", objects, frames, pixel[0], pixel[1], pixel[2]);
+	const char* labels[2] = { "glUniform4f x2 per draw", "UBO ring + glBindBufferRange" };
+	for (int method = 0; method < 2; method++)
+		printf("%-32s %8.3f ms/frame (CPU submit %.3f ms)\n", labels[method], results[method], submitMs[method] / frames);
+
+	delete plain;
+	delete blocks;
+	glDeleteVertexArrays(1, &VAO);
+	glDeleteBuffers(1, &VBO);
+	return 0;
+}
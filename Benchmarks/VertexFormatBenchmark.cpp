@@ -0,0 +1,134 @@
+// Vertex bandwidth of the full and the compressed quad format (TexturedVertex vs PackedTexturedVertex, VertexLayout.h).
+// A grid mesh of side x side vertices is uploaded in each format and drawn into a small target (so vertex fetch, not
+// fill, is what's measured) with the scene's attributes: position, color, texture coordinates.
+// Reports bytes per vertex, buffer size and upload time, the best draw time and vertex throughput, and the largest
+// quantization error. Runs on a headless EGL context.
+//
+// Build: g++ -O2 -std=c++17 -I<deps>/include Benchmarks/VertexFormatBenchmark.cpp glad.c -o VertexFormatBenchmark -lEGL -ldl
+// Usage: VertexFormatBenchmark [side] [draws]
+
+#include "../my_glad.h"
+#include "../HeadlessContext.h"
+#include "../Framebuffer.h"
+#include "../Shader.h"
+#include "../VertexLayout.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+static const char* VERTEX_SOURCE =
+	"#version 330 core\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"layout (location = 1) in vec3 aColor;\n"
+	"layout (location = 2) in vec2 aTexCoord;\n"
+	"out vec3 ourColor;\n"
+	"void main() { ourColor = aColor * aTexCoord.x + aTexCoord.y; gl_Position = vec4(aPos, 1.0); }\n";
+
+static const char* FRAGMENT_SOURCE =
+	"#version 330 core\n"
+	"in vec3 ourColor;\n"
+	"out vec4 FragColor;\n"
+	"void main() { FragColor = vec4(ourColor, 1.0); }\n";
+
+int main(int argc, char** argv)
+{
+	int side = argc > 1 ? atoi(argv[1]) : 1024;
+	int draws = argc > 2 ? atoi(argv[2]) : 10;
+
+	HeadlessContext context;
+	if (!context.Init() || !gladLoadGLLoader(HeadlessContext::GetProcAddress()))
+		return -1;
+	Framebuffer framebuffer;
+	if (!framebuffer.Create(64, 64))
+		return -1;
+	framebuffer.Bind();
+	Shader shader(VERTEX_SOURCE, FRAGMENT_SOURCE, "VertexFormat.vs", "VertexFormat.fs");
+	shader.Use();
+	VertexLayout::Validate<TexturedVertex>(shader.ID);
+
+	// Grid over [-1, 1]^2 with a color gradient and [0, 1] texture coordinates
+	std::vector<TexturedVertex> vertices((size_t)side * side);
+	for (int y = 0; y < side; y++)
+	{
+		for (int x = 0; x < side; x++)
+		{
+			float u = x / (float)(side - 1), v = y / (float)(side - 1);
+			vertices[(size_t)y * side + x] = { { u * 2.0f - 1.0f, v * 2.0f - 1.0f, 0.0f }, { u, v, 1.0f - u }, { u, v } };
+		}
+	}
+	std::vector<unsigned int> indices;
+	indices.reserve((size_t)(side - 1) * (side - 1) * 6);
+	for (int y = 0; y + 1 < side; y++)
+	{
+		for (int x = 0; x + 1 < side; x++)
+		{
+			unsigned int corner = (unsigned int)(y * side + x);
+			unsigned int quad[6] = { corner, corner + 1, corner + side, corner + 1, corner + side + 1, corner + (unsigned int)side };
+			indices.insert(indices.end(), quad, quad + 6);
+		}
+	}
+	float error = 0.0f;
+	std::vector<PackedTexturedVertex> packed;
+	if (!VertexLayout::Compress(vertices.data(), vertices.size(), packed, 1e-2f, &error))
+		return -1;
+
+	unsigned int EBO;
+	glGenBuffers(1, &EBO);
+	typedef std::chrono::steady_clock Clock;
+	struct Result
+	{
+		const char* name;
+		size_t stride;
+		double uploadMs, drawMs;
+	} results[2] = { { "TexturedVertex", sizeof(TexturedVertex), 0.0, 1e30 }, { "PackedTexturedVertex", sizeof(PackedTexturedVertex), 0.0, 1e30 } };
+	for (int format = 0; format < 2; format++)
+	{
+		unsigned int VAO, VBO;
+		glGenVertexArrays(1, &VAO);
+		glGenBuffers(1, &VBO);
+		glBindVertexArray(VAO);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+
+		Clock::time_point start = Clock::now();
+		if (format == 0)
+			glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(TexturedVertex), vertices.data(), GL_STATIC_DRAW);
+		else
+			glBufferData(GL_ARRAY_BUFFER, packed.size() * sizeof(PackedTexturedVertex), packed.data(), GL_STATIC_DRAW);
+		glFinish();
+		results[format].uploadMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+		if (format == 0)
+			VertexLayout::Apply<TexturedVertex>();
+		else
+			VertexLayout::Apply<PackedTexturedVertex>();
+
+		for (int draw = -1; draw < draws; draw++)											// Draw -1 is the warm-up
+		{
+			start = Clock::now();
+			glClear(GL_COLOR_BUFFER_BIT);
+			glDrawElements(GL_TRIANGLES, (int)indices.size(), GL_UNSIGNED_INT, 0);
+			glFinish();
+			double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+			if (draw >= 0)
+				results[format].drawMs = std::min(results[format].drawMs, ms);
+		}
+		glDeleteVertexArrays(1, &VAO);
+		glDeleteBuffers(1, &VBO);
+	}
+
+	printf("%d x %d grid: %zu vertices, %zu indices, best of %d draws\n", side, side, vertices.size(), indices.size(), draws);
+	for (const Result& result : results)
+	{
+		double megabytes = vertices.size() * result.stride / (1024.0 * 1024.0);
+		printf("%-22s %3zu bytes/vertex %8.2f MB, upload %7.2f ms, draw %8.2f ms %8.1f Mvertices/s\n", result.name, result.stride,
+			megabytes, result.uploadMs, result.drawMs, indices.size() / (result.drawMs * 1000.0));
+	}
+	printf("Largest quantization error: %g\n", error);
+
+	glDeleteBuffers(1, &EBO);
+	return 0;
+}
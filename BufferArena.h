@@ -0,0 +1,316 @@
+#ifndef BUFFER_ARENA_H
+#define BUFFER_ARENA_H
+
+#include "my_glad.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+/*	One big GL buffer that many meshes' vertex or index data is suballocated from, instead of a buffer object per mesh.
+Ranges are handed out by an offset allocator: a free list kept sorted by offset, first fit, with neighbouring free
+blocks merged again on Free(). Every allocation has its own alignment; vertex data is aligned to the vertex size, so
+its offset divided by the stride is the baseVertex for glDrawElementsBaseVertex (see ArenaDraw).
+Allocations are referred to by id, since their offsets move: when the buffer is full it grows (a bigger buffer, live
+ranges copied over on the GPU) and Defragment() packs live ranges to the front. Either replaces the GL buffer, which
+Generation() reports; VAOs pointing at the old one have to be set up again.
+Data goes in and moves through GL_COPY_WRITE_BUFFER / GL_COPY_READ_BUFFER, which leaves the array and element buffer
+bindings (and so the bound VAO and a GLStateCache) alone. */
+class BufferArena
+{
+public:
+	// Where an allocation is, for drawing from it
+	struct Range
+	{
+		unsigned int offset = 0, size = 0;
+	};
+
+	BufferArena() = default;
+	~BufferArena()
+	{
+		if (buffer)
+			glDeleteBuffers(1, &buffer);
+	}
+	BufferArena(const BufferArena&) = delete;
+	BufferArena& operator=(const BufferArena&) = delete;
+
+	bool Create(unsigned int initialCapacity, unsigned int usage = GL_STATIC_DRAW)
+	{
+		this->usage = usage;
+		capacity = std::max(initialCapacity, 16u);
+		buffer = NewBuffer(capacity);
+		freeBlocks.clear();
+		freeBlocks[0] = capacity;
+		return buffer != 0;
+	}
+
+	// 'size' bytes at an offset that is a multiple of 'alignment' (any value, not just powers of two).
+	// Returns the allocation's id, -1 if the buffer couldn't grow to fit it
+	int Allocate(unsigned int size, unsigned int alignment = 4)
+	{
+		alignment = std::max(alignment, 1u);
+		unsigned int offset;
+		if (!FindFree(size, alignment, offset))
+		{
+			// Growing only adds space at the tail, so size it from there: holes in the middle don't help this request
+			if (!Grow(std::max(capacity * 2, capacity + size + alignment)) || !FindFree(size, alignment, offset))
+			{
+				printf("ERROR::BUFFER_ARENA::OUT_OF_MEMORY %u bytes\n", size);
+				return -1;
+			}
+		}
+		Take(offset, size);
+
+		int id;
+		if (!freeIds.empty())
+		{
+			id = freeIds.back();
+			freeIds.pop_back();
+		}
+		else
+		{
+			id = (int)allocations.size();
+			allocations.emplace_back();
+		}
+		allocations[id] = { offset, size, alignment, true };
+		used += size;
+		return id;
+	}
+
+	void Free(int id)
+	{
+		if (!IsLive(id))
+			return;
+		Allocation& allocation = allocations[id];
+		Release(allocation.offset, allocation.size);
+		used -= allocation.size;
+		allocation.live = false;
+		freeIds.push_back(id);
+	}
+
+	// Copies 'size' bytes into allocation 'id' at 'offset' bytes from its start
+	bool Upload(int id, const void* data, unsigned int size, unsigned int offset = 0)
+	{
+		if (!IsLive(id) || offset + size > allocations[id].size)
+		{
+			printf("ERROR::BUFFER_ARENA::BAD_UPLOAD allocation %d, %u bytes\n", id, size);
+			return false;
+		}
+		glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		glBufferSubData(GL_COPY_WRITE_BUFFER, allocations[id].offset + offset, size, data);
+		return true;
+	}
+	// Allocate() + Upload() for data that's written once
+	int Add(const void* data, unsigned int size, unsigned int alignment = 4)
+	{
+		int id = Allocate(size, alignment);
+		if (id >= 0)
+			Upload(id, data, size);
+		return id;
+	}
+
+	Range Get(int id) const
+	{
+		if (!IsLive(id))
+			return Range();
+		return Range{ allocations[id].offset, allocations[id].size };
+	}
+
+	// Moves every live allocation to the front (keeping their order and alignment), leaving one free block at the end
+	void Defragment()
+	{
+		std::vector<int> live;
+		for (int id = 0; id < (int)allocations.size(); id++)
+		{
+			if (allocations[id].live)
+				live.push_back(id);
+		}
+		std::sort(live.begin(), live.end(), [this](int a, int b) { return allocations[a].offset < allocations[b].offset; });
+		unsigned int target = NewBuffer(capacity);
+		glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+		unsigned int end = 0;
+		for (int id : live)
+		{
+			Allocation& allocation = allocations[id];
+			unsigned int offset = AlignUp(end, allocation.alignment);
+			glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, allocation.offset, offset, allocation.size);
+			allocation.offset = offset;
+			end = offset + allocation.size;
+		}
+		Replace(target);
+		freeBlocks.clear();
+		if (end < capacity)
+			freeBlocks[end] = capacity - end;
+	}
+
+	// The GL buffer to bind. Changes when the arena grows or is defragmented (see Generation())
+	unsigned int ID() const
+	{
+		return buffer;
+	}
+	int Generation() const
+	{
+		return generation;
+	}
+	unsigned int Capacity() const
+	{
+		return capacity;
+	}
+	unsigned int Used() const
+	{
+		return used;
+	}
+	unsigned int LargestFree() const
+	{
+		unsigned int largest = 0;
+		for (const auto& block : freeBlocks)
+			largest = std::max(largest, block.second);
+		return largest;
+	}
+	// 0 when all free space is one block, towards 1 the more it is split into small pieces
+	float Fragmentation() const
+	{
+		unsigned int free = 0;												// Not capacity - used: alignment padding is neither
+		for (const auto& block : freeBlocks)
+			free += block.second;
+		return free == 0 ? 0.0f : 1.0f - (float)LargestFree() / (float)free;
+	}
+
+	void PrintStats(const char* name) const
+	{
+		printf("Buffer arena %s: %u of %u bytes used, %d allocations, %zu free blocks (%.0f%% fragmented), %d buffer replacements\n", name,
+			used, capacity, (int)(allocations.size() - freeIds.size()), freeBlocks.size(), Fragmentation() * 100.0f, generation);
+	}
+
+private:
+	struct Allocation
+	{
+		unsigned int offset = 0, size = 0, alignment = 1;
+		bool live = false;
+	};
+
+	unsigned int buffer = 0;
+	unsigned int capacity = 0, used = 0, usage = GL_STATIC_DRAW;
+	int generation = 0;
+	std::map<unsigned int, unsigned int> freeBlocks;					// Offset -> size, never two adjacent
+	std::vector<Allocation> allocations;
+	std::vector<int> freeIds;
+
+	static unsigned int AlignUp(unsigned int offset, unsigned int alignment)
+	{
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+	bool IsLive(int id) const
+	{
+		return id >= 0 && id < (int)allocations.size() && allocations[id].live;
+	}
+
+	unsigned int NewBuffer(unsigned int size) const
+	{
+		unsigned int id = 0;
+		glGenBuffers(1, &id);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, id);
+		glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, usage);
+		return id;
+	}
+	void Replace(unsigned int target)
+	{
+		glDeleteBuffers(1, &buffer);
+		buffer = target;
+		generation++;
+	}
+
+	bool FindFree(unsigned int size, unsigned int alignment, unsigned int& offset) const
+	{
+		for (const auto& block : freeBlocks)
+		{
+			unsigned int start = AlignUp(block.first, alignment);
+			if (start + size <= block.first + block.second)
+			{
+				offset = start;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Removes [offset, offset + size) from the free block containing it; what's left either side stays free
+	void Take(unsigned int offset, unsigned int size)
+	{
+		auto block = std::prev(freeBlocks.upper_bound(offset));
+		unsigned int blockStart = block->first, blockEnd = block->first + block->second;
+		freeBlocks.erase(block);
+		if (offset > blockStart)
+			freeBlocks[blockStart] = offset - blockStart;
+		if (offset + size < blockEnd)
+			freeBlocks[offset + size] = blockEnd - (offset + size);
+	}
+
+	void Release(unsigned int offset, unsigned int size)
+	{
+		auto next = freeBlocks.lower_bound(offset);
+		if (next != freeBlocks.end() && offset + size == next->first)
+		{
+			size += next->second;
+			next = freeBlocks.erase(next);
+		}
+		if (next != freeBlocks.begin())
+		{
+			auto previous = std::prev(next);
+			if (previous->first + previous->second == offset)
+			{
+				previous->second += size;
+				return;
+			}
+		}
+		freeBlocks[offset] = size;
+	}
+
+	// Bigger buffer with the live data copied over at the same offsets; the new space is free at the end
+	bool Grow(unsigned int newCapacity)
+	{
+		unsigned int target = NewBuffer(newCapacity);
+		if (!target)
+			return false;
+		glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+		glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, capacity);
+		Replace(target);
+		Release(capacity, newCapacity - capacity);
+		capacity = newCapacity;
+		return true;
+	}
+};
+
+// One mesh drawn from two arenas: its indices in one and its vertices (of one format) in the other. Any number of
+// them can be drawn with the same VAO, which only has to point at the two arena buffers. Offsets are read when it is
+// made, so make it again after either arena grows or is defragmented
+struct ArenaDraw
+{
+	unsigned int indexOffset = 0;										// Bytes into the index arena
+	int indexCount = 0;
+	unsigned int indexType = GL_UNSIGNED_INT;
+	int baseVertex = 0;													// Vertex offset / stride
+
+	ArenaDraw() = default;
+	ArenaDraw(const BufferArena& indices, int indexAllocation, int indexCount, unsigned int indexType,
+			  const BufferArena& vertices, int vertexAllocation, unsigned int vertexStride)
+		: indexOffset(indices.Get(indexAllocation).offset), indexCount(indexCount), indexType(indexType),
+		  baseVertex((int)(vertices.Get(vertexAllocation).offset / vertexStride))
+	{
+	}
+
+	void Draw(unsigned int mode = GL_TRIANGLES) const
+	{
+		glDrawElementsBaseVertex(mode, indexCount, indexType, (const void*)(size_t)indexOffset, baseVertex);
+	}
+	// 'instanceCount' copies in one draw. Per-instance attributes (divisor 1) are not offset by the base vertex, so
+	// their pointers give the start of the instance data themselves
+	void DrawInstanced(int instanceCount, unsigned int mode = GL_TRIANGLES) const
+	{
+		glDrawElementsInstancedBaseVertex(mode, indexCount, indexType, (const void*)(size_t)indexOffset, instanceCount, baseVertex);
+	}
+};
+
+#endif // !BUFFER_ARENA_H
@@ -0,0 +1,211 @@
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#include <glad/glad.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+/*	Per-frame timing for the benchmark mode.
+Frame time is measured end to end (including swap or glFinish), CPU time covers just the draw submission and GPU time
+comes from GL_TIME_ELAPSED queries. Queries are kept in a small ring and read back a few frames later, so timing
+never stalls the pipeline waiting for the GPU. */
+class FrameTimer
+{
+public:
+	std::vector<double> frameMs, cpuMs, gpuMs;
+
+	FrameTimer()
+	{
+		glGenQueries(QUERY_COUNT, queries);
+	}
+	~FrameTimer()
+	{
+		glDeleteQueries(QUERY_COUNT, queries);
+	}
+	FrameTimer(const FrameTimer&) = delete;
+	FrameTimer& operator=(const FrameTimer&) = delete;
+
+	void BeginFrame()
+	{
+		unsigned int slot = frame % QUERY_COUNT;
+		if (frame >= QUERY_COUNT)
+			ReadQuery(slot);														// Result from QUERY_COUNT frames ago, long finished by now
+		glBeginQuery(GL_TIME_ELAPSED, queries[slot]);
+		frameStart = Clock::now();
+	}
+
+	// Draw calls are submitted, presentation (swap or glFinish) comes next
+	void EndSubmit()
+	{
+		glEndQuery(GL_TIME_ELAPSED);
+		cpuMs.push_back(Milliseconds(frameStart));
+	}
+
+	void EndFrame()
+	{
+		frameMs.push_back(Milliseconds(frameStart));
+		frame++;
+	}
+
+	// Collect the queries still in flight once the run is over
+	void Finish()
+	{
+		unsigned int pending = std::min(frame, QUERY_COUNT);
+		for (unsigned int i = frame - pending; i < frame; i++)
+			ReadQuery(i % QUERY_COUNT);
+	}
+
+private:
+	typedef std::chrono::steady_clock Clock;
+	static const unsigned int QUERY_COUNT = 8;
+
+	unsigned int queries[QUERY_COUNT];
+	unsigned int frame = 0;
+	Clock::time_point frameStart;
+
+	static double Milliseconds(Clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	void ReadQuery(unsigned int slot)
+	{
+		GLuint64 elapsedNs = 0;
+		glGetQueryObjectui64v(queries[slot], GL_QUERY_RESULT, &elapsedNs);
+		gpuMs.push_back(elapsedNs / 1.0e6);
+	}
+};
+
+// Summary of one timing series
+struct Percentiles
+{
+	double mean = 0.0, p50 = 0.0, p95 = 0.0, p99 = 0.0;
+
+	static Percentiles Of(std::vector<double> samples)
+	{
+		Percentiles result;
+		if (samples.empty())
+			return result;
+		std::sort(samples.begin(), samples.end());
+		for (double sample : samples)
+			result.mean += sample;
+		result.mean /= samples.size();
+		result.p50 = samples[(samples.size() - 1) * 50 / 100];
+		result.p95 = samples[(samples.size() - 1) * 95 / 100];
+		result.p99 = samples[(samples.size() - 1) * 99 / 100];
+		return result;
+	}
+};
+
+struct FrameReport
+{
+	std::string renderer;
+	int warmupFrames = 0, measuredFrames = 0;
+	Percentiles frame, cpu, gpu;
+	double meanFps = 0.0;
+	double low1PercentFps = 0.0;											// Average FPS over the slowest 1% of frames
+
+	static FrameReport Build(const FrameTimer& timer, int warmupFrames)
+	{
+		FrameReport report;
+		const char* renderer = (const char*)glGetString(GL_RENDERER);
+		report.renderer = renderer ? renderer : "unknown";
+		report.warmupFrames = warmupFrames;
+		report.measuredFrames = (int)timer.frameMs.size();
+		report.frame = Percentiles::Of(timer.frameMs);
+		report.cpu = Percentiles::Of(timer.cpuMs);
+		report.gpu = Percentiles::Of(timer.gpuMs);
+		report.meanFps = report.frame.mean > 0.0 ? 1000.0 / report.frame.mean : 0.0;
+
+		std::vector<double> slowest = timer.frameMs;
+		std::sort(slowest.begin(), slowest.end(), [](double a, double b) { return a > b; });
+		size_t count = std::max<size_t>(1, slowest.size() / 100);
+		double slowestMs = 0.0;
+		for (size_t i = 0; i < count && i < slowest.size(); i++)
+			slowestMs += slowest[i];
+		report.low1PercentFps = slowestMs > 0.0 ? 1000.0 * count / slowestMs : 0.0;
+		return report;
+	}
+
+	// Flat keys so CI scripts (and CompareToBaseline) can pick values out without a JSON library
+	std::string ToJSON() const
+	{
+		std::string escaped;
+		for (char c : renderer)
+		{
+			if (c == '"' || c == '\\')
+				escaped += '\\';
+			escaped += c;
+		}
+		char buffer[2048];
+		snprintf(buffer, sizeof(buffer),
+			"{\n"
+			"  \"renderer\": \"%s\",\n"
+			"  \"warmup_frames\": %d,\n"
+			"  \"measured_frames\": %d,\n"
+			"  \"mean_fps\": %.3f,\n"
+			"  \"low_1pct_fps\": %.3f,\n"
+			"  \"frame_mean_ms\": %.4f,\n  \"frame_p50_ms\": %.4f,\n  \"frame_p95_ms\": %.4f,\n  \"frame_p99_ms\": %.4f,\n"
+			"  \"cpu_mean_ms\": %.4f,\n  \"cpu_p50_ms\": %.4f,\n  \"cpu_p95_ms\": %.4f,\n  \"cpu_p99_ms\": %.4f,\n"
+			"  \"gpu_mean_ms\": %.4f,\n  \"gpu_p50_ms\": %.4f,\n  \"gpu_p95_ms\": %.4f,\n  \"gpu_p99_ms\": %.4f\n"
+			"}\n",
+			escaped.c_str(), warmupFrames, measuredFrames, meanFps, low1PercentFps,
+			frame.mean, frame.p50, frame.p95, frame.p99,
+			cpu.mean, cpu.p50, cpu.p95, cpu.p99,
+			gpu.mean, gpu.p50, gpu.p95, gpu.p99);
+		return buffer;
+	}
+};
+
+// Reads one numeric value written by FrameReport::ToJSON
+inline bool ReadJSONNumber(const std::string& json, const char* key, double& value)
+{
+	std::string quoted = std::string("\"") + key + "\":";
+	size_t position = json.find(quoted);
+	return position != std::string::npos && sscanf(json.c_str() + position + quoted.size(), "%lf", &value) == 1;
+}
+
+// Compares a report against a saved baseline report. Times may grow and frame rates may drop by at most
+// 'tolerance' (0.10 = 10%). Prints every regression and returns false if there was any
+inline bool CompareToBaseline(const FrameReport& report, const char* baselinePath, double tolerance)
+{
+	FILE* file = fopen(baselinePath, "rb");
+	if (!file)
+	{
+		printf("ERROR::BENCHMARK::BASELINE_NOT_FOUND %s\n", baselinePath);
+		return false;
+	}
+	std::string baseline;
+	char chunk[1024];
+	size_t read;
+	while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0)
+		baseline.append(chunk, read);
+	fclose(file);
+
+	std::string current = report.ToJSON();
+	struct Metric { const char* key; bool higherIsBetter; };
+	const Metric metrics[] = {	{ "mean_fps", true }, { "low_1pct_fps", true },
+								{ "frame_p50_ms", false }, { "frame_p95_ms", false }, { "frame_p99_ms", false },
+								{ "cpu_p95_ms", false }, { "gpu_p95_ms", false } };
+	bool passed = true;
+	for (const Metric& metric : metrics)
+	{
+		double then, now;
+		if (!ReadJSONNumber(baseline, metric.key, then) || !ReadJSONNumber(current, metric.key, now) || then <= 0.0)
+			continue;
+		bool regressed = metric.higherIsBetter ? now < then * (1.0 - tolerance) : now > then * (1.0 + tolerance);
+		if (regressed)
+		{
+			printf("REGRESSION %s: %.4f -> %.4f (%+.1f%%)\n", metric.key, then, now, (now - then) * 100.0 / then);
+			passed = false;
+		}
+	}
+	return passed;
+}
+
+#endif // !FRAME_STATS_H
@@ -0,0 +1,91 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <glad/glad.h>
+
+#include <vector>
+#include <stdio.h>
+
+/*	Offscreen render target: a framebuffer object with a single RGBA8 color renderbuffer.
+Used when there is no window (headless mode), since then there is no default framebuffer to draw into. */
+class Framebuffer
+{
+public:
+	unsigned int ID = 0;
+	unsigned int width = 0, height = 0;
+
+	Framebuffer() {}
+	~Framebuffer()
+	{
+		if (ID != 0)
+		{
+			glDeleteFramebuffers(1, &ID);
+			glDeleteRenderbuffers(1, &colorBuffer);
+		}
+	}
+	Framebuffer(const Framebuffer&) = delete;
+	Framebuffer& operator=(const Framebuffer&) = delete;
+
+	bool Create(unsigned int w, unsigned int h)
+	{
+		width = w;
+		height = h;
+		glGenFramebuffers(1, &ID);
+		glBindFramebuffer(GL_FRAMEBUFFER, ID);
+
+		glGenRenderbuffers(1, &colorBuffer);
+		glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		{
+			printf("ERROR::FRAMEBUFFER::NOT_COMPLETE\n");
+			return false;
+		}
+		return true;
+	}
+
+	// Make it the draw target and match the viewport to its size
+	void Bind() const
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, ID);
+		glViewport(0, 0, width, height);
+	}
+
+	// Read back the color buffer and write it as binary PPM (no image writer dependency needed)
+	bool SavePPM(const char* path) const
+	{
+		std::vector<unsigned char> pixels((size_t)width * height * 4);
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, ID);
+		glPixelStorei(GL_PACK_ALIGNMENT, 1);
+		glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+		FILE* file = fopen(path, "wb");
+		if (!file)
+		{
+			printf("ERROR::FRAMEBUFFER::CANNOT_OPEN %s\n", path);
+			return false;
+		}
+		fprintf(file, "P6\n%u %u\n255\n", width, height);
+		std::vector<unsigned char> row((size_t)width * 3);
+		for (unsigned int y = height; y-- > 0;)											// OpenGL rows start at the bottom, PPM rows at the top
+		{
+			const unsigned char* src = &pixels[(size_t)y * width * 4];
+			for (unsigned int x = 0; x < width; x++)
+			{
+				row[x * 3 + 0] = src[x * 4 + 0];
+				row[x * 3 + 1] = src[x * 4 + 1];
+				row[x * 3 + 2] = src[x * 4 + 2];
+			}
+			fwrite(row.data(), 1, row.size(), file);
+		}
+		fclose(file);
+		return true;
+	}
+
+private:
+	unsigned int colorBuffer = 0;
+};
+
+#endif // !FRAMEBUFFER_H
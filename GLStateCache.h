@@ -0,0 +1,214 @@
+#ifndef GL_STATE_CACHE_H
+#define GL_STATE_CACHE_H
+
+#include "my_glad.h"
+
+#include <stdio.h>
+
+/*	Shadow copy of the GL state the render loop binds every frame: program or program pipeline, vertex array, active
+texture unit and the texture on each unit, buffer bindings (plain and indexed ranges) and polygon mode. A call that
+would set what is already set is dropped before it reaches the driver, which otherwise validates it all over again.
+One GLStateCache per context (the state it mirrors belongs to the context). Everything starts out unknown, so the
+first call of each kind always goes through. Code that binds any of this state with plain GL calls has to call
+Invalidate() afterwards, or the cache may drop a call that was needed. */
+class GLStateCache
+{
+public:
+	static const unsigned int TEXTURE_UNITS = 16;
+	static const unsigned int INDEXED_BINDINGS = 16;					// Uniform buffer binding points tracked (GL 3.3 guarantees 36, we use a few)
+
+	// Calls seen by the cache, split into those sent to GL and those dropped as redundant
+	struct Counters
+	{
+		int issued = 0, skipped = 0;
+	};
+
+	GLStateCache()
+	{
+		Invalidate();
+	}
+
+	// Forgets everything, so the next call of each kind goes through
+	void Invalidate()
+	{
+		program = pipeline = vertexArray = activeUnit = UNKNOWN;
+		arrayBuffer = elementBuffer = uniformBuffer = UNKNOWN;
+		polygonMode = UNKNOWN;
+		for (unsigned int unit = 0; unit < TEXTURE_UNITS; unit++)
+			textures[unit] = { UNKNOWN, UNKNOWN };
+		for (unsigned int index = 0; index < INDEXED_BINDINGS; index++)
+			uniformRanges[index] = { UNKNOWN, 0, 0 };
+	}
+
+	// Starts counting a new frame; the one before is kept for LastFrame()
+	void BeginFrame()
+	{
+		lastFrame = frame;
+		frame = Counters();
+	}
+	const Counters& LastFrame() const
+	{
+		return lastFrame;
+	}
+	const Counters& Total() const
+	{
+		return total;
+	}
+
+	void UseProgram(unsigned int id)
+	{
+		if (Changed(program, id))
+			glUseProgram(id);
+	}
+
+	// A pipeline is only used while no program is, so this also sets the program to 0
+	void BindProgramPipeline(unsigned int id)
+	{
+		UseProgram(0);
+		if (Changed(pipeline, id))
+			glBindProgramPipeline(id);
+	}
+
+	// The element array binding is part of the vertex array, so it is unknown again after a switch
+	void BindVertexArray(unsigned int id)
+	{
+		if (Changed(vertexArray, id))
+		{
+			glBindVertexArray(id);
+			elementBuffer = UNKNOWN;
+		}
+	}
+
+	void ActiveTexture(unsigned int unit)
+	{
+		if (Changed(activeUnit, unit))
+			glActiveTexture(GL_TEXTURE0 + unit);
+	}
+	// Binds to the active unit (glBindTexture semantics)
+	void BindTexture(GLenum target, unsigned int texture)
+	{
+		if (activeUnit >= TEXTURE_UNITS)
+		{
+			Count(true);
+			glBindTexture(target, texture);
+			return;
+		}
+		TextureBinding& binding = textures[activeUnit];
+		if (binding.target == target && binding.texture == texture)
+		{
+			Count(false);
+			return;
+		}
+		Count(true);
+		glBindTexture(target, texture);
+		binding.target = target;
+		binding.texture = texture;
+	}
+	// Binds 'texture' to 'unit', switching the active unit only when the binding actually has to change
+	void BindTextureUnit(unsigned int unit, GLenum target, unsigned int texture)
+	{
+		if (unit < TEXTURE_UNITS && textures[unit].target == target && textures[unit].texture == texture)
+		{
+			frame.skipped += 2;											// Both the glActiveTexture and the glBindTexture
+			total.skipped += 2;
+			return;
+		}
+		ActiveTexture(unit);
+		BindTexture(target, texture);
+	}
+
+	void BindBuffer(GLenum target, unsigned int buffer)
+	{
+		unsigned int* binding = BufferBinding(target);
+		if (!binding)
+		{
+			Count(true);
+			glBindBuffer(target, buffer);
+		}
+		else if (Changed(*binding, buffer))
+			glBindBuffer(target, buffer);
+	}
+	// glBindBufferRange for uniform buffers. Also sets the plain GL_UNIFORM_BUFFER binding, like GL does
+	void BindBufferRange(GLenum target, unsigned int index, unsigned int buffer, GLintptr offset, GLsizeiptr size)
+	{
+		if (target != GL_UNIFORM_BUFFER || index >= INDEXED_BINDINGS)
+		{
+			Count(true);
+			glBindBufferRange(target, index, buffer, offset, size);
+			return;
+		}
+		BufferRange& range = uniformRanges[index];
+		if (range.buffer == buffer && range.offset == offset && range.size == size)
+		{
+			Count(false);
+			return;
+		}
+		Count(true);
+		glBindBufferRange(target, index, buffer, offset, size);
+		range = { buffer, offset, size };
+		uniformBuffer = buffer;
+	}
+
+	// Only GL_FRONT_AND_BACK exists in the core profile, so one mode covers it
+	void PolygonMode(GLenum mode)
+	{
+		if (Changed(polygonMode, mode))
+			glPolygonMode(GL_FRONT_AND_BACK, mode);
+	}
+
+	void PrintStats() const
+	{
+		int calls = lastFrame.issued + lastFrame.skipped;
+		printf("GL state cache: %d of %d state calls dropped last frame (%d of %d in total)\n", lastFrame.skipped, calls, total.skipped, total.issued + total.skipped);
+	}
+
+private:
+	static const unsigned int UNKNOWN = 0xFFFFFFFFu;					// Never a valid name, unit or enum
+
+	struct TextureBinding
+	{
+		GLenum target;
+		unsigned int texture;
+	};
+	struct BufferRange
+	{
+		unsigned int buffer;
+		GLintptr offset;
+		GLsizeiptr size;
+	};
+
+	unsigned int program, pipeline, vertexArray, activeUnit;
+	unsigned int arrayBuffer, elementBuffer, uniformBuffer;
+	unsigned int polygonMode;
+	TextureBinding textures[TEXTURE_UNITS];
+	BufferRange uniformRanges[INDEXED_BINDINGS];
+	Counters frame, lastFrame, total;
+
+	void Count(bool issued)
+	{
+		(issued ? frame.issued : frame.skipped)++;
+		(issued ? total.issued : total.skipped)++;
+	}
+
+	// Updates 'current' and returns true when 'value' is different from it
+	bool Changed(unsigned int& current, unsigned int value)
+	{
+		bool changed = current != value;
+		current = value;
+		Count(changed);
+		return changed;
+	}
+
+	unsigned int* BufferBinding(GLenum target)
+	{
+		switch (target)
+		{
+		case GL_ARRAY_BUFFER:			return &arrayBuffer;
+		case GL_ELEMENT_ARRAY_BUFFER:	return &elementBuffer;
+		case GL_UNIFORM_BUFFER:			return &uniformBuffer;
+		default:						return nullptr;
+		}
+	}
+};
+
+#endif // !GL_STATE_CACHE_H
@@ -0,0 +1,94 @@
+#ifndef HEADLESS_CONTEXT_H
+#define HEADLESS_CONTEXT_H
+
+#include "my_glad.h"
+
+#include <stdio.h>
+#ifndef _WIN32
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+/*	OpenGL context without any window system. Uses a surfaceless EGL display (Mesa's EGL_MESA_platform_surfaceless,
+which is what llvmpipe gives us on CPU-only machines), so there is no default framebuffer: everything has to be
+rendered into a framebuffer object (see Framebuffer.h).
+The context is created for and made current on the calling thread; each thread that needs GL creates its own. */
+class HeadlessContext
+{
+public:
+	HeadlessContext() {}
+	~HeadlessContext()
+	{
+#ifndef _WIN32
+		if (context != EGL_NO_CONTEXT)
+		{
+			eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+			eglDestroyContext(display, context);
+			eglReleaseThread();
+		}
+#endif
+	}
+	HeadlessContext(const HeadlessContext&) = delete;
+	HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+	// Creates a 3.3 core context (same as the GLFW window asks for) and makes it current
+	bool Init()
+	{
+#ifdef _WIN32
+		printf("ERROR::HEADLESS::EGL_NOT_AVAILABLE\n");
+		return false;
+#else
+		PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+		display = eglGetPlatformDisplayEXT ? eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr) : EGL_NO_DISPLAY;
+		if (display == EGL_NO_DISPLAY)
+			display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+		if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr))
+		{
+			printf("ERROR::HEADLESS::EGL_INITIALIZE_FAILED\n");
+			return false;
+		}
+
+		// The bound API is per thread, so this has to happen on every thread that creates a context
+		if (!eglBindAPI(EGL_OPENGL_API))
+		{
+			printf("ERROR::HEADLESS::OPENGL_API_NOT_SUPPORTED\n");
+			return false;
+		}
+
+		const EGLint contextAttribs[] = {	EGL_CONTEXT_MAJOR_VERSION, 3,
+											EGL_CONTEXT_MINOR_VERSION, 3,
+											EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+											EGL_NONE };
+		context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttribs);			// No config: surfaceless contexts never draw to a window surface
+		if (context == EGL_NO_CONTEXT)
+		{
+			printf("ERROR::HEADLESS::CONTEXT_CREATION_FAILED (0x%x)\n", eglGetError());
+			return false;
+		}
+		if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+		{
+			printf("ERROR::HEADLESS::MAKE_CURRENT_FAILED (0x%x)\n", eglGetError());
+			return false;
+		}
+		return true;
+#endif
+	}
+
+	// Function passed to GLAD to load the OpenGL function pointers (counterpart of glfwGetProcAddress)
+	static GLADloadproc GetProcAddress()
+	{
+#ifdef _WIN32
+		return nullptr;
+#else
+		return (GLADloadproc)eglGetProcAddress;
+#endif
+	}
+
+private:
+#ifndef _WIN32
+	EGLDisplay display = EGL_NO_DISPLAY;
+	EGLContext context = EGL_NO_CONTEXT;
+#endif
+};
+
+#endif // !HEADLESS_CONTEXT_H
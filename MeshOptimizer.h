@@ -0,0 +1,297 @@
+#ifndef MESH_OPTIMIZER_H
+#define MESH_OPTIMIZER_H
+
+#include "my_glad.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*	Load-time optimization of an indexed triangle list (GL_TRIANGLES), in this order:
+	- welding: vertices with identical bytes are merged through a hash map and the indices pointed at the survivor
+	- triangle order for the post-transform vertex cache (Tom Forsyth's linear-speed algorithm), so a vertex
+	  shaded for one triangle is still cached when its neighbours use it
+	- vertex order for fetch locality: vertices are renumbered in the order the triangles first use them
+	- index width: GL_UNSIGNED_SHORT when every index fits in 16 bits, GL_UNSIGNED_INT otherwise
+Works on any vertex struct without implicit padding (every format from VertexLayout.h qualifies), since vertices are
+compared and hashed as raw bytes. Triangles are not clipped or merged, so what gets drawn doesn't change. */
+template <typename Vertex>
+class MeshOptimizer
+{
+public:
+	// The optimized mesh, ready for glBufferData and glDrawElements(GL_TRIANGLES, indexCount, indexType, 0)
+	struct Result
+	{
+		std::vector<Vertex> vertices;
+		std::vector<unsigned char> indexData;
+		unsigned int indexType = GL_UNSIGNED_INT;
+		int indexCount = 0;
+	};
+
+	// Before and after numbers. ACMR: vertices transformed per triangle with a FIFO cache of ACMR_CACHE_SIZE
+	// entries (1.0 means every vertex was shaded once, 3.0 that nothing was ever reused)
+	struct Stats
+	{
+		size_t verticesBefore = 0, verticesAfter = 0, indices = 0;
+		size_t bytesBefore = 0, bytesAfter = 0;
+		float acmrBefore = 0.0f, acmrAfter = 0.0f;
+
+		void Print(const char* name) const
+		{
+			// Signed: a mesh without shared vertices grows once it gains an index buffer
+			long long saved = (long long)bytesBefore - (long long)bytesAfter;
+			printf("Mesh %s: %zu -> %zu vertices, %zu indices, ACMR %.3f -> %.3f, %zu -> %zu bytes (%s%lld%s)\n", name,
+				verticesBefore, verticesAfter, indices, acmrBefore, acmrAfter, bytesBefore, bytesAfter,
+				saved >= 0 ? "" : "grew by ", saved >= 0 ? saved : -saved, saved >= 0 ? " saved" : "");
+		}
+	};
+
+	static const int CACHE_SIZE = 32;								// Modelled cache of the triangle ordering
+	static const int ACMR_CACHE_SIZE = 16;							// Cache the reported ACMR is measured with
+
+	// Optimizes 'vertices' drawn with 'indices' (nullptr: non-indexed, every 3 vertices a triangle)
+	static Result Optimize(const Vertex* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount, Stats* stats = nullptr)
+	{
+		std::vector<unsigned int> sequential;
+		if (!indices)
+		{
+			sequential.resize(vertexCount);
+			for (size_t i = 0; i < vertexCount; i++)
+				sequential[i] = (unsigned int)i;
+			indices = sequential.data();
+			indexCount = vertexCount;
+		}
+		if (indexCount % 3 != 0)
+			printf("ERROR::MESH_OPTIMIZER::NOT_TRIANGLES %zu indices\n", indexCount);
+		indexCount -= indexCount % 3;
+
+		Result result;
+		std::vector<unsigned int> welded;
+		Weld(vertices, vertexCount, indices, indexCount, result.vertices, welded);
+		std::vector<unsigned int> ordered = OrderTriangles(welded, result.vertices.size());
+		OrderVertices(result.vertices, ordered);
+
+		result.indexCount = (int)ordered.size();
+		if (result.vertices.size() <= 65536)
+		{
+			result.indexType = GL_UNSIGNED_SHORT;
+			result.indexData.resize(ordered.size() * sizeof(uint16_t));
+			uint16_t* narrow = (uint16_t*)result.indexData.data();
+			for (size_t i = 0; i < ordered.size(); i++)
+				narrow[i] = (uint16_t)ordered[i];
+		}
+		else
+		{
+			result.indexType = GL_UNSIGNED_INT;
+			result.indexData.resize(ordered.size() * sizeof(uint32_t));
+			memcpy(result.indexData.data(), ordered.data(), result.indexData.size());
+		}
+
+		if (stats)
+		{
+			stats->verticesBefore = vertexCount;
+			stats->verticesAfter = result.vertices.size();
+			stats->indices = indexCount;
+			stats->bytesBefore = vertexCount * sizeof(Vertex) + (sequential.empty() ? indexCount * sizeof(unsigned int) : 0);
+			stats->bytesAfter = result.vertices.size() * sizeof(Vertex) + result.indexData.size();
+			stats->acmrBefore = ACMR(indices, indexCount);
+			stats->acmrAfter = ACMR(ordered.data(), ordered.size());
+		}
+		return result;
+	}
+
+	// Vertices transformed per triangle with a FIFO post-transform cache of 'cacheSize' entries
+	static float ACMR(const unsigned int* indices, size_t indexCount, int cacheSize = ACMR_CACHE_SIZE)
+	{
+		if (indexCount < 3)
+			return 0.0f;
+		std::vector<unsigned int> fifo((size_t)cacheSize, ~0u);
+		size_t next = 0, misses = 0;
+		for (size_t i = 0; i < indexCount; i++)
+		{
+			if (std::find(fifo.begin(), fifo.end(), indices[i]) != fifo.end())
+				continue;
+			fifo[next] = indices[i];
+			next = (next + 1) % fifo.size();
+			misses++;
+		}
+		return (float)misses / (float)(indexCount / 3);
+	}
+
+private:
+	struct BytesHash
+	{
+		size_t operator()(const Vertex& vertex) const
+		{
+			const unsigned char* bytes = (const unsigned char*)&vertex;
+			uint64_t hash = 14695981039346656037ull;						// FNV-1a
+			for (size_t i = 0; i < sizeof(Vertex); i++)
+				hash = (hash ^ bytes[i]) * 1099511628211ull;
+			return (size_t)hash;
+		}
+	};
+	struct BytesEqual
+	{
+		bool operator()(const Vertex& a, const Vertex& b) const
+		{
+			return memcmp(&a, &b, sizeof(Vertex)) == 0;
+		}
+	};
+
+	static void Weld(const Vertex* vertices, size_t vertexCount, const unsigned int* indices, size_t indexCount, std::vector<Vertex>& unique, std::vector<unsigned int>& remapped)
+	{
+		std::unordered_map<Vertex, unsigned int, BytesHash, BytesEqual> first;
+		first.reserve(vertexCount);
+		std::vector<unsigned int> remap(vertexCount, ~0u);
+		remapped.resize(indexCount);
+		for (size_t i = 0; i < indexCount; i++)
+		{
+			unsigned int index = indices[i];
+			if (remap[index] == ~0u)
+			{
+				auto inserted = first.emplace(vertices[index], (unsigned int)unique.size());
+				if (inserted.second)
+					unique.push_back(vertices[index]);
+				remap[index] = inserted.first->second;
+			}
+			remapped[i] = remap[index];
+		}
+	}
+
+	// Forsyth: each vertex scores by its position in a modelled LRU cache and by how many triangles still need it,
+	// and the triangle with the highest sum among those touching the cache goes next
+	static float VertexScore(int cachePosition, int remaining)
+	{
+		static const int TABLE_VALENCE = 32;
+		struct Tables
+		{
+			float cache[CACHE_SIZE], valence[TABLE_VALENCE];
+			Tables()
+			{
+				for (int position = 0; position < CACHE_SIZE; position++)
+					cache[position] = position < 3 ? 0.75f : powf(1.0f - (position - 3) / (float)(CACHE_SIZE - 3), 1.5f);
+				for (int count = 1; count < TABLE_VALENCE; count++)
+					valence[count] = 2.0f / sqrtf((float)count);			// Finish off vertices with few triangles left
+			}
+		};
+		static const Tables tables;											// Scoring runs ~35 times per triangle, so no pow/sqrt there
+		if (remaining == 0)
+			return -1.0f;
+		float score = cachePosition >= 0 ? tables.cache[cachePosition] : 0.0f;
+		return score + (remaining < TABLE_VALENCE ? tables.valence[remaining] : 2.0f / sqrtf((float)remaining));
+	}
+
+	static std::vector<unsigned int> OrderTriangles(const std::vector<unsigned int>& indices, size_t vertexCount)
+	{
+		size_t triangleCount = indices.size() / 3;
+		std::vector<int> remaining(vertexCount, 0), cachePosition(vertexCount, -1);
+		for (unsigned int index : indices)
+			remaining[index]++;
+		std::vector<size_t> firstTriangle(vertexCount + 1, 0);				// Triangles of vertex v: adjacency[firstTriangle[v] .. firstTriangle[v + 1])
+		for (size_t v = 0; v < vertexCount; v++)
+			firstTriangle[v + 1] = firstTriangle[v] + remaining[v];
+		std::vector<unsigned int> adjacency(indices.size());
+		std::vector<size_t> filled(firstTriangle.begin(), firstTriangle.end() - 1);
+		for (size_t i = 0; i < indices.size(); i++)
+			adjacency[filled[indices[i]]++] = (unsigned int)(i / 3);
+
+		std::vector<float> vertexScore(vertexCount), triangleScore(triangleCount, 0.0f);
+		for (size_t v = 0; v < vertexCount; v++)
+			vertexScore[v] = VertexScore(-1, remaining[v]);
+		for (size_t t = 0; t < triangleCount; t++)
+			triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+		std::vector<unsigned char> emitted(triangleCount, 0);
+
+		std::vector<unsigned int> output;
+		output.reserve(indices.size());
+		std::vector<unsigned int> cache, nextCache;
+		size_t scanFrom = 0;													// Fallback scan resumes here, so the total is linear
+		size_t best = triangleCount;
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			if (best == triangleCount || triangleScore[t] > triangleScore[best])
+				best = t;
+		}
+		while (best < triangleCount)
+		{
+			emitted[best] = 1;
+			triangleScore[best] = -1.0f;
+			const unsigned int* triangle = &indices[best * 3];
+			nextCache.clear();
+			for (int corner = 0; corner < 3; corner++)
+			{
+				unsigned int v = triangle[corner];
+				output.push_back(v);
+				remaining[v]--;
+				if (std::find(nextCache.begin(), nextCache.end(), v) == nextCache.end())
+					nextCache.push_back(v);										// Degenerate triangles repeat a vertex
+			}
+			for (unsigned int v : cache)
+			{
+				if (v != triangle[0] && v != triangle[1] && v != triangle[2])
+					nextCache.push_back(v);
+			}
+			for (size_t position = 0; position < nextCache.size(); position++)
+			{
+				unsigned int v = nextCache[position];
+				cachePosition[v] = position < (size_t)CACHE_SIZE ? (int)position : -1;	// The ones past the end fall out
+			}
+			cache.assign(nextCache.begin(), nextCache.begin() + std::min(nextCache.size(), (size_t)CACHE_SIZE));
+
+			// Rescore every vertex whose cache position changed and the triangles using them, then pick the best of those
+			for (unsigned int v : nextCache)
+			{
+				float score = VertexScore(cachePosition[v], remaining[v]);
+				float delta = score - vertexScore[v];
+				vertexScore[v] = score;
+				for (size_t a = firstTriangle[v]; a < firstTriangle[v + 1]; a++)
+				{
+					if (!emitted[adjacency[a]])
+						triangleScore[adjacency[a]] += delta;
+				}
+			}
+			best = triangleCount;
+			for (unsigned int v : cache)
+			{
+				for (size_t a = firstTriangle[v]; a < firstTriangle[v + 1]; a++)
+				{
+					unsigned int t = adjacency[a];
+					if (!emitted[t] && (best == triangleCount || triangleScore[t] > triangleScore[best]))
+						best = t;
+				}
+			}
+			if (best == triangleCount)											// Nothing left next to the cache: start somewhere new
+			{
+				while (scanFrom < triangleCount && emitted[scanFrom])
+					scanFrom++;
+				best = scanFrom;
+			}
+		}
+		return output;
+	}
+
+	// Renumbers vertices in order of first use, so vertex fetches walk the buffer forwards
+	static void OrderVertices(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
+	{
+		std::vector<unsigned int> remap(vertices.size(), ~0u);
+		std::vector<Vertex> ordered;
+		ordered.reserve(vertices.size());
+		for (unsigned int& index : indices)
+		{
+			if (remap[index] == ~0u)
+			{
+				remap[index] = (unsigned int)ordered.size();
+				ordered.push_back(vertices[index]);
+			}
+			index = remap[index];
+		}
+		vertices.swap(ordered);													// Vertices no triangle uses are dropped
+	}
+};
+
+#endif // !MESH_OPTIMIZER_H
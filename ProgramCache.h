@@ -0,0 +1,217 @@
+#ifndef PROGRAM_CACHE_H
+#define PROGRAM_CACHE_H
+
+#include "my_glad.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+/*	On-disk cache of linked program binaries (GL_ARB_get_program_binary, core since 4.1).
+Entries are keyed by a hash of the shader sources, the defines and the driver's vendor/renderer/version strings,
+so a driver update or a source edit simply misses. A binary the driver refuses (format or driver mismatch)
+counts as a miss and the caller compiles as usual. Every entry also remembers how long its compile + link took,
+which is what a hit saves.
+Shared by all contexts/threads: entries are written to a temporary file and renamed into place. */
+class ProgramCache
+{
+public:
+	bool enabled = true;
+	std::filesystem::path directory = "ShaderCache";
+
+	static ProgramCache& Get()
+	{
+		static ProgramCache instance;
+		return instance;
+	}
+
+	// 64-bit FNV-1a over every part, with a separator so ("ab", "c") and ("a", "bc") differ
+	static uint64_t Key(std::string_view vertexSource, std::string_view fragmentSource, std::string_view defines = std::string_view())
+	{
+		uint64_t hash = 14695981039346656037ull;
+		auto mix = [&hash](std::string_view part)
+		{
+			for (char c : part)
+				hash = (hash ^ (unsigned char)c) * 1099511628211ull;
+			hash = (hash ^ 0xFFu) * 1099511628211ull;
+		};
+		const GLenum driverStrings[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+		for (GLenum name : driverStrings)
+		{
+			const char* value = (const char*)glGetString(name);
+			mix(value ? value : "");
+		}
+		mix(vertexSource);
+		mix(fragmentSource);
+		mix(defines);
+		return hash;
+	}
+
+	// The driver has to offer at least one binary format, and the entry points need a 4.1 context or the extension.
+	// Asked on every Load/Store/PrepareForLink, so the answer is kept per thread until another GL context is current
+	bool Supported() const
+	{
+		if (!enabled)
+			return false;
+		static thread_local unsigned int checkedContext = 0;
+		static thread_local bool supported = false;
+		unsigned int context = gladGetGLContextId();
+		if (context != checkedContext)
+		{
+			checkedContext = context;
+			supported = false;
+			if ((gladIsGLVersionAtLeast(4, 1) || gladHasExtension("GL_ARB_get_program_binary")) &&
+				gladHasGLFunction("glProgramBinary") && gladHasGLFunction("glGetProgramBinary"))
+			{
+				int formats = 0;
+				glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+				supported = formats > 0;
+			}
+		}
+		return supported;
+	}
+
+	// Must be called before glLinkProgram for GetProgramBinary to be allowed on the result
+	void PrepareForLink(unsigned int program) const
+	{
+		if (Supported())
+			glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
+	// Tries to fill 'program' from the cache. Returns true if it is linked and ready to use
+	bool Load(unsigned int program, uint64_t key)
+	{
+		if (!Supported())
+			return false;
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		std::filesystem::path path = EntryPath(key);
+		FILE* file = fopen(path.string().c_str(), "rb");
+		if (!file)
+		{
+			misses++;
+			return false;
+		}
+		// The length comes from disk: a truncated or corrupt entry must not size the buffer
+		std::error_code error;
+		uintmax_t fileSize = std::filesystem::file_size(path, error);
+		EntryHeader header;
+		std::vector<char> binary;
+		bool read = !error && fread(&header, sizeof(header), 1, file) == 1 && header.magic == MAGIC
+			&& header.length <= fileSize - sizeof(header);
+		if (read)
+		{
+			binary.resize(header.length);
+			read = fread(binary.data(), 1, binary.size(), file) == binary.size();
+		}
+		fclose(file);
+
+		int linked = 0;
+		if (read)
+		{
+			glProgramBinary(program, header.format, binary.data(), (GLsizei)binary.size());
+			glGetProgramiv(program, GL_LINK_STATUS, &linked);
+		}
+		if (!linked)
+		{
+			misses++;
+			rejected++;												// Stale entry (e.g. driver changed its format); it gets overwritten after compiling
+			return false;
+		}
+
+		hits++;
+		double loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		AddSaved(header.compileMs - loadMs);
+		return true;
+	}
+
+	// Saves a freshly linked program. 'compileMs' is the compile + link time a future hit will save
+	void Store(unsigned int program, uint64_t key, double compileMs)
+	{
+		if (!Supported())
+			return;
+
+		int length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0)
+			return;
+		std::vector<char> binary(length);
+		EntryHeader header;
+		glGetProgramBinary(program, length, &length, &header.format, binary.data());
+		header.magic = MAGIC;
+		header.length = (uint32_t)length;
+		header.compileMs = compileMs;
+
+		std::error_code error;
+		std::filesystem::create_directories(directory, error);
+		std::filesystem::path path = EntryPath(key);
+		std::filesystem::path temporary = path;
+		temporary += ".tmp" + std::to_string(ProcessId()) + "_" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+		FILE* file = fopen(temporary.string().c_str(), "wb");
+		if (!file)
+			return;
+		bool written = fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(binary.data(), 1, header.length, file) == header.length;
+		fclose(file);
+		if (written)
+			std::filesystem::rename(temporary, path, error);
+		else
+			std::filesystem::remove(temporary, error);
+	}
+
+	void PrintStats() const
+	{
+		if (hits + misses > 0)
+			printf("Program cache: %d hits, %d misses (%d rejected by the driver), %.2f ms compile time saved\n", hits.load(), misses.load(), rejected.load(), savedUs / 1000.0);
+	}
+
+	std::atomic<int> hits{ 0 }, misses{ 0 }, rejected{ 0 };
+	std::atomic<long long> savedUs{ 0 };
+
+private:
+	static const uint32_t MAGIC = 0x42504C47;						// "GLPB"
+
+	struct EntryHeader
+	{
+		uint32_t magic = 0;
+		GLenum format = 0;
+		uint32_t length = 0;
+		double compileMs = 0.0;
+	};
+
+	std::filesystem::path EntryPath(uint64_t key) const
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+		return directory / name;
+	}
+
+	// Thread ids only differ within one process, several processes may share the cache directory
+	static long ProcessId()
+	{
+#ifdef _WIN32
+		return (long)_getpid();
+#else
+		return (long)getpid();
+#endif
+	}
+
+	void AddSaved(double ms)
+	{
+		if (ms > 0.0)
+			savedUs += (long long)(ms * 1000.0);
+	}
+};
+
+#endif // !PROGRAM_CACHE_H
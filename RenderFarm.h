@@ -0,0 +1,104 @@
+#ifndef RENDER_FARM_H
+#define RENDER_FARM_H
+
+#include "my_glad.h"
+#include "HeadlessContext.h"
+
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*	Renders independent jobs concurrently, one headless GL context per worker thread.
+Every worker creates its own HeadlessContext and GLAD dispatch table (gladCreateGLContext), runs SetupWorker once,
+then keeps pulling job indices from a shared queue and runs RenderJob for each until the queue is empty.
+Only the job phase is timed: all workers finish their setup before the clock starts. */
+class RenderFarm
+{
+public:
+	std::function<bool(int worker)> SetupWorker;							// Build per-thread GL state (shaders, buffers, textures, framebuffer)
+	std::function<void(int worker, int job)> RenderJob;					// Render one job on the worker's context
+	std::function<void(int worker)> CleanupWorker;							// Delete per-thread GL state while the context is still current
+
+	// Runs jobs [0, jobCount) on 'threads' workers. Returns the seconds spent rendering, or a negative value on failure
+	double Run(int threads, int jobCount)
+	{
+		// Switches GLAD to per-thread tables for the rest of the process (only the first call does anything)
+		gladEnableGLContextDispatch();
+
+		nextJob = 0;
+		readyWorkers = 0;
+		failedWorkers = 0;
+		started = false;
+
+		std::vector<std::thread> workers;
+		for (int worker = 0; worker < threads; worker++)
+			workers.emplace_back(&RenderFarm::WorkerMain, this, worker, jobCount);
+
+		// Wait until every worker has its context and scene, then release them all at once
+		std::chrono::steady_clock::time_point start;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			ready.wait(lock, [&] { return readyWorkers == threads; });
+			start = std::chrono::steady_clock::now();
+			started = true;
+		}
+		go.notify_all();
+
+		for (std::thread& worker : workers)
+			worker.join();
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		return failedWorkers > 0 ? -1.0 : seconds;
+	}
+
+private:
+	std::atomic<int> nextJob{ 0 };
+	std::atomic<int> failedWorkers{ 0 };
+	std::mutex mutex;
+	std::condition_variable ready, go;
+	int readyWorkers = 0;
+	bool started = false;
+
+	void WorkerMain(int worker, int jobCount)
+	{
+		HeadlessContext context;
+		GladGLContext* dispatch = nullptr;
+		bool ok = context.Init();
+		if (ok)
+		{
+			dispatch = gladCreateGLContext(HeadlessContext::GetProcAddress());
+			gladMakeGLContextCurrent(dispatch);
+			ok = dispatch != nullptr && SetupWorker(worker);
+		}
+		if (!ok)
+		{
+			printf("ERROR::RENDER_FARM::WORKER_%d_SETUP_FAILED\n", worker);
+			failedWorkers++;
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			readyWorkers++;
+			ready.notify_one();
+			go.wait(lock, [&] { return started; });
+		}
+
+		if (ok)
+		{
+			for (int job = nextJob++; job < jobCount; job = nextJob++)
+				RenderJob(worker, job);
+			glFinish();
+			CleanupWorker(worker);
+		}
+
+		gladMakeGLContextCurrent(nullptr);
+		if (dispatch)
+			gladDestroyGLContext(dispatch);
+	}
+};
+
+#endif // !RENDER_FARM_H
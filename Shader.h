@@ -3,9 +3,16 @@
 
 #include <glad/glad.h>
 
+#include "Timeline.h"
+#include "ProgramCache.h"
+#include "ShaderSources.h"
+#include "ShaderPreprocessor.h"
+
+#include <chrono>
 #include <string>
-#include <fstream>
-#include <sstream>
+#include <string_view>
+#include <vector>
+#include <stdint.h>
 #include <stdio.h>
 // Defining shaders in GLSL (OpenGL Shading Language) store as a C string
 /*	In Modetn OpenGL, it is required to define at least vertex and
@@ -22,46 +29,169 @@ Fragment shader only requires one output variable: a vector of size 4 that defin
 output ('out' keyword declares output values). In this case output value is name 'FragColor' which is
 assigned an orange color with alpha value of 1.0f*/
 
+// Handle to a uniform of one program: just its location, so setting through it is a single GL call
+struct UniformHandle
+{
+	int location = -1;
+};
+
 class Shader
 {
 public:
 	// The program ID
 	unsigned int ID;
 
-	// Constructor reads and builds the shader
-	Shader(const GLchar* vertexPath, const GLchar* fragmentPath)			// Requires the filepath of the source code of vertex and fragment shader respectively
+	// Constructor reads and builds the shader. 'defines' picks the variant (see ShaderPreprocessor)
+	Shader(const GLchar* vertexPath, const GLchar* fragmentPath, const ShaderDefines& defines = ShaderDefines())	// Requires the filepath of the source code of vertex and fragment shader respectively
 	{
 		//	------ Retrieve the vertex/fragment source cpde from filepath	------
-		std::string vertexCode;
-		std::string fragmentCode;
-		std::ifstream vShaderFile;
-		std::ifstream fShaderFile;
-		// Ensure ifstream objects can throw exceptions:
-		vShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-		fShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-		try
+		// Both files are read straight into one buffer (no stream/string copies), then #includes and defines are resolved
+		ShaderSources sources;
+		{
+			TimelineScope phase("Shader read", vertexPath);
+			if (!sources.Load({ vertexPath, fragmentPath }))
+				printf("ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ\n");
+		}
+		BuildVariant(sources, vertexPath, fragmentPath, defines);
+	}
+	// Builds from sources already loaded in a batch (e.g. ShaderSources::LoadDirectory("Shaders"))
+	Shader(const ShaderSources& sources, const GLchar* vertexPath, const GLchar* fragmentPath, const ShaderDefines& defines = ShaderDefines())
+	{
+		BuildVariant(sources, vertexPath, fragmentPath, defines);
+	}
+	// Builds from final (already preprocessed) source text. The names only show up in the timeline and error messages
+	Shader(std::string_view vertexSource, std::string_view fragmentSource, const GLchar* vertexName, const GLchar* fragmentName)
+	{
+		Build(vertexSource, fragmentSource, vertexName, fragmentName);
+	}
+	// Wraps a program that is already linked (ShaderLibrary builds them in batches)
+	explicit Shader(unsigned int linkedProgram)
+		: ID(linkedProgram)
+	{
+		CacheUniforms();
+	}
+	// Switches to another linked program (hot reload) and deletes the old one. Uniform locations are reflected again,
+	// so UniformHandles taken before have to be fetched again, and uniform values set on the old program are gone
+	void Adopt(unsigned int linkedProgram)
+	{
+		unsigned int oldProgram = ID;
+		ID = linkedProgram;
+		CacheUniforms();
+		glDeleteProgram(oldProgram);
+	}
+	// Use/Activate the shader
+	void Use()
+	{
+		glUseProgram(ID);
+	}
+	// FNV-1a, constexpr so names known at compile time (string literals) can be hashed by the compiler
+	static constexpr uint32_t HashName(std::string_view name)
+	{
+		uint32_t hash = 2166136261u;
+		for (char c : name)
+			hash = (hash ^ (unsigned char)c) * 16777619u;
+		return hash;
+	}
+
+	// Location of an active uniform from the cache built after linking (-1 if there is no such uniform, same as GL).
+	// No allocation and no GL call
+	int GetUniformLocation(std::string_view name) const
+	{
+		if (uniformSlots.empty())
+			return -1;
+		uint32_t hash = HashName(name);
+		size_t mask = uniformSlots.size() - 1;
+		for (size_t slot = hash & mask; uniformSlots[slot].location != -1; slot = (slot + 1) & mask)
+		{
+			if (uniformSlots[slot].hash == hash && uniformSlots[slot].name == name)
+				return uniformSlots[slot].location;
+		}
+		return -1;
+	}
+	UniformHandle GetUniform(std::string_view name) const
+	{
+		UniformHandle handle;
+		handle.location = GetUniformLocation(name);
+		return handle;
+	}
+
+	// Utility uniform functions
+	void setBool(std::string_view name, bool val) const
+	{
+		glUniform1i(GetUniformLocation(name), (int)val);
+	}
+	void setInt(std::string_view name, int val) const
+	{
+		glUniform1i(GetUniformLocation(name), val);
+	}
+	void setFloat(std::string_view name, float val) const
+	{
+		glUniform1f(GetUniformLocation(name), val);
+	}
+	// Handle versions for per-frame updates: skip the lookup entirely
+	void setBool(UniformHandle uniform, bool val) const
+	{
+		glUniform1i(uniform.location, (int)val);
+	}
+	void setInt(UniformHandle uniform, int val) const
+	{
+		glUniform1i(uniform.location, val);
+	}
+	void setFloat(UniformHandle uniform, float val) const
+	{
+		glUniform1f(uniform.location, val);
+	}
+
+private:
+	struct UniformSlot
+	{
+		uint32_t hash = 0;
+		int location = -1;										// -1 marks an empty slot
+		std::string name;
+	};
+	std::vector<UniformSlot> uniformSlots;						// Open addressing table, size is a power of two
+
+	void BuildVariant(const ShaderSources& sources, const GLchar* vertexPath, const GLchar* fragmentPath, const ShaderDefines& defines)
+	{
+		ShaderPreprocessor preprocessor(&sources);
+		std::string vertexSource, fragmentSource;
 		{
-			// Open files
-			vShaderFile.open(vertexPath);
-			fShaderFile.open(fragmentPath);
-			std::stringstream vShaderStream, fShaderStream;
-			// Read file's buffer content into steams
-			vShaderStream << vShaderFile.rdbuf();
-			fShaderStream << fShaderFile.rdbuf();
-			// Close files
-			vShaderFile.close();
-			fShaderFile.close();
-			// Convert stream into string
-			vertexCode = vShaderStream.str();
-			fragmentCode = fShaderStream.str();
+			TimelineScope phase("Shader preprocess", fragmentPath);
+			preprocessor.Process(vertexPath, defines, vertexSource);
+			preprocessor.Process(fragmentPath, defines, fragmentSource);
 		}
-		catch (std::ifstream::failure e)
+		Build(vertexSource, fragmentSource, vertexPath, fragmentPath);
+	}
+
+	// Loads the program from the binary cache, or compiles and links it
+	void Build(std::string_view vertexSource, std::string_view fragmentSource, const GLchar* vertexPath, const GLchar* fragmentPath)
+	{
+		ID = glCreateProgram();
+		uint64_t cacheKey = ProgramCache::Key(vertexSource, fragmentSource);
+		bool success;
 		{
-			printf("ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ\n");
+			TimelineScope phase("Program binary load", fragmentPath);
+			success = ProgramCache::Get().Load(ID, cacheKey);
+		}
+		if (!success)
+		{
+			std::chrono::steady_clock::time_point compileStart = std::chrono::steady_clock::now();
+			success = CompileAndLink(vertexSource, fragmentSource, vertexPath, fragmentPath);
+			if (success)
+				ProgramCache::Get().Store(ID, cacheKey, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - compileStart).count());
 		}
-		const char* vShaderCode = vertexCode.c_str();
-		const char* fShaderCode = fragmentCode.c_str();
 
+		if (success)
+			CacheUniforms();
+	}
+
+	// Compiles both stages and links them into ID (already created by Build())
+	bool CompileAndLink(std::string_view vertexSource, std::string_view fragmentSource, const GLchar* vertexPath, const GLchar* fragmentPath)
+	{
+		const char* vShaderCode = vertexSource.data();
+		const char* fShaderCode = fragmentSource.data();
+		int vShaderLength = (int)vertexSource.size();
+		int fShaderLength = (int)fragmentSource.size();
 
 		//	------ Compile shaders	------
 		unsigned int vertex, fragment;
@@ -69,10 +199,13 @@ public:
 		char infoLog[512];
 		
 		// Vertex Shader
-		vertex = glCreateShader(GL_VERTEX_SHADER);
-		glShaderSource(vertex, 1, &vShaderCode, nullptr);
-		glCompileShader(vertex);
-		glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
+		{
+			TimelineScope phase("Shader compile", vertexPath);
+			vertex = glCreateShader(GL_VERTEX_SHADER);
+			glShaderSource(vertex, 1, &vShaderCode, &vShaderLength);
+			glCompileShader(vertex);
+			glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
+		}
 		if (!success)
 		{
 			glGetShaderInfoLog(vertex, 512, nullptr, infoLog);
@@ -80,10 +213,13 @@ public:
 		};
 
 		// Fragment Shader
-		fragment = glCreateShader(GL_FRAGMENT_SHADER);
-		glShaderSource(fragment, 1, &fShaderCode, nullptr);
-		glCompileShader(fragment);
-		glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
+		{
+			TimelineScope phase("Shader compile", fragmentPath);
+			fragment = glCreateShader(GL_FRAGMENT_SHADER);
+			glShaderSource(fragment, 1, &fShaderCode, &fShaderLength);
+			glCompileShader(fragment);
+			glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
+		}
 		if (!success)
 		{
 			glGetShaderInfoLog(fragment, 512, nullptr, infoLog);
@@ -91,11 +227,14 @@ public:
 		};
 
 		// Shader program
-		ID = glCreateProgram();
-		glAttachShader(ID, vertex);
-		glAttachShader(ID, fragment);
-		glLinkProgram(ID);
-		glGetProgramiv(ID, GL_LINK_STATUS, &success);
+		{
+			TimelineScope phase("Shader link", fragmentPath);
+			ProgramCache::Get().PrepareForLink(ID);
+			glAttachShader(ID, vertex);
+			glAttachShader(ID, fragment);
+			glLinkProgram(ID);
+			glGetProgramiv(ID, GL_LINK_STATUS, &success);
+		}
 		if (!success)
 		{
 			glGetProgramInfoLog(ID, 512, nullptr, infoLog);
@@ -106,26 +245,57 @@ public:
 		glDeleteShader(vertex);
 		glDeleteShader(fragment);
 
+		return success != 0;
 	}
-	// Use/Activate the shader
-	void Use()
-	{
-		glUseProgram(ID);
-	}
-	// Utility uniform functions
-	void setBool(const std::string &name, bool val) const
-	{
-		glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)val);
-	}
-	void setInt(const std::string &name, int val) const
-	{
-		glUniform1i(glGetUniformLocation(ID, name.c_str()), val);
-	}
-	void setFloat(const std::string &name, float val) const
+
+	// Reflects every active uniform once after linking. Arrays are stored under "name", "name[0]", "name[1]", ...
+	void CacheUniforms()
 	{
-		glUniform1f(glGetUniformLocation(ID, name.c_str()), val);
-	}
+		int count = 0, maxLength = 0;
+		glGetProgramiv(ID, GL_ACTIVE_UNIFORMS, &count);
+		glGetProgramiv(ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+		std::vector<std::pair<std::string, int>> uniforms;
+		std::vector<char> nameBuffer(maxLength + 1);
+		for (int index = 0; index < count; index++)
+		{
+			int size = 0, length = 0;
+			GLenum type;
+			glGetActiveUniform(ID, index, (GLsizei)nameBuffer.size(), &length, &size, &type, nameBuffer.data());
+			std::string name(nameBuffer.data(), length);
+			int location = glGetUniformLocation(ID, name.c_str());
+			if (location < 0)
+				continue;											// Uniform block members have no location
+			if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+			{
+				std::string base = name.substr(0, name.size() - 3);
+				uniforms.emplace_back(base, location);
+				for (int element = 1; element < size; element++)
+				{
+					std::string elementName = base + "[" + std::to_string(element) + "]";
+					int elementLocation = glGetUniformLocation(ID, elementName.c_str());
+					if (elementLocation >= 0)
+						uniforms.emplace_back(elementName, elementLocation);
+				}
+			}
+			uniforms.emplace_back(name, location);
+		}
 
+		size_t tableSize = 8;
+		while (tableSize < uniforms.size() * 2)
+			tableSize <<= 1;
+		uniformSlots.assign(tableSize, UniformSlot());
+		for (auto& uniform : uniforms)
+		{
+			uint32_t hash = HashName(uniform.first);
+			size_t slot = hash & (tableSize - 1);
+			while (uniformSlots[slot].location != -1)
+				slot = (slot + 1) & (tableSize - 1);
+			uniformSlots[slot].hash = hash;
+			uniformSlots[slot].location = uniform.second;
+			uniformSlots[slot].name = std::move(uniform.first);
+		}
+	}
 };
 
 
@@ -0,0 +1,277 @@
+#ifndef SHADER_ARCHIVE_H
+#define SHADER_ARCHIVE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*	All shader sources packed into one file (Benchmarks/ShaderPack.cpp writes it at build time):
+
+	Header		magic, version, entry count, slot count
+	Slot[]		open addressing hash table (slot count is a power of two), FNV-1a 64 of the name, linear probing
+	blob		names and sources, each NUL terminated
+
+At run time the file is mapped once (open + fstat + mmap) and a lookup is a hash and a probe into the mapping: no
+per-file syscalls and no copies. Entries are keyed by the path the shader would be loaded from
+("Shaders/Quad.fs", "Shaders/Include/Defaults.glsl"). The mounted archive is consulted by ShaderSources and
+ShaderPreprocessor before the file system, so it has to be rebuilt when the sources change (hot reload reads the
+loose files instead). FindStale() tells when it wasn't: a loose file newer than the archive or of a different size.
+It stats every entry, so only interactive sessions run it; ShaderPack --check compares contents at build time. */
+class ShaderArchive
+{
+public:
+	static const uint32_t MAGIC = 0x4B504853;							// "SHPK"
+	static const uint32_t VERSION = 1;
+
+	ShaderArchive() = default;
+	~ShaderArchive()
+	{
+		Close();
+	}
+	ShaderArchive(const ShaderArchive&) = delete;
+	ShaderArchive& operator=(const ShaderArchive&) = delete;
+
+	// The archive ShaderSources and ShaderPreprocessor look in (empty until Mount() succeeds)
+	static ShaderArchive& Mounted()
+	{
+		static ShaderArchive archive;
+		return archive;
+	}
+	// Maps 'path' as the mounted archive. A missing file is not an error (loose files are used then)
+	static bool Mount(const char* path)
+	{
+		return Mounted().Open(path);
+	}
+
+	bool Open(const char* path)
+	{
+		Close();
+		std::error_code error;
+		written = std::filesystem::last_write_time(path, error);
+#ifdef _WIN32
+		FILE* file = fopen(path, "rb");
+		if (!file)
+			return false;
+		fseek(file, 0, SEEK_END);
+		size = (size_t)ftell(file);
+		fseek(file, 0, SEEK_SET);
+		copy.reset(new char[size > 0 ? size : 1]);
+		bool read = fread(copy.get(), 1, size, file) == size;
+		fclose(file);
+		if (!read)
+		{
+			Close();
+			return false;
+		}
+		data = copy.get();
+#else
+		int file = open(path, O_RDONLY | O_CLOEXEC);
+		if (file < 0)
+			return false;
+		struct stat info;
+		if (fstat(file, &info) != 0 || info.st_size < (off_t)sizeof(Header))
+		{
+			close(file);
+			printf("ERROR::SHADER_ARCHIVE::INVALID %s\n", path);
+			return false;
+		}
+		size = (size_t)info.st_size;
+		void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+		close(file);													// The mapping keeps the file alive
+		if (mapping == MAP_FAILED)
+		{
+			printf("ERROR::SHADER_ARCHIVE::CANNOT_MAP %s\n", path);
+			size = 0;
+			return false;
+		}
+		data = (const char*)mapping;
+#endif
+		if (!Validate())
+		{
+			printf("ERROR::SHADER_ARCHIVE::INVALID %s\n", path);
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+	void Close()
+	{
+#ifndef _WIN32
+		if (data)
+			munmap((void*)data, size);
+#endif
+		copy.reset();
+		data = nullptr;
+		size = 0;
+	}
+
+	bool IsOpen() const
+	{
+		return data != nullptr;
+	}
+
+	// Source stored under 'name'. The view points into the mapping (NUL terminated) and stays valid while it is open
+	bool Find(std::string_view name, std::string_view& source) const
+	{
+		if (!data)
+			return false;
+		const Header* header = (const Header*)data;
+		const Slot* slots = (const Slot*)(data + sizeof(Header));
+		uint64_t hash = Hash(name);
+		uint32_t mask = header->slotCount - 1;
+		for (uint32_t slot = (uint32_t)hash & mask, probes = 0; probes < header->slotCount; slot = (slot + 1) & mask, probes++)
+		{
+			const Slot& entry = slots[slot];
+			if (entry.nameLength == 0)
+				return false;											// Empty slot ends the probe sequence
+			if (entry.hash == hash && std::string_view(data + entry.nameOffset, entry.nameLength) == name)
+			{
+				source = std::string_view(data + entry.dataOffset, entry.dataLength);
+				return true;
+			}
+		}
+		return false;
+	}
+	bool Contains(std::string_view name) const
+	{
+		std::string_view source;
+		return Find(name, source);
+	}
+	uint32_t Count() const
+	{
+		return data ? ((const Header*)data)->entryCount : 0;
+	}
+
+	// Name of an entry whose loose file was edited after the archive was written (it is newer, or its size differs),
+	// empty when the archive is current. One stat per entry; entries without a loose file don't count
+	std::string FindStale() const
+	{
+		if (!data)
+			return std::string();
+		const Header* header = (const Header*)data;
+		const Slot* slots = (const Slot*)(data + sizeof(Header));
+		for (uint32_t slot = 0; slot < header->slotCount; slot++)
+		{
+			const Slot& entry = slots[slot];
+			if (entry.nameLength == 0)
+				continue;
+			std::string name(data + entry.nameOffset, entry.nameLength);
+			std::error_code timeError, sizeError;
+			std::filesystem::file_time_type modified = std::filesystem::last_write_time(name, timeError);
+			uintmax_t fileSize = std::filesystem::file_size(name, sizeError);
+			if (timeError || sizeError)
+				continue;
+			if (modified > written || fileSize != entry.dataLength)
+				return name;
+		}
+		return std::string();
+	}
+
+	// Packs 'entries' (name, source) into an archive at 'path'
+	static bool Write(const char* path, const std::vector<std::pair<std::string, std::string_view>>& entries)
+	{
+		uint32_t slotCount = 8;
+		while (slotCount < entries.size() * 2)
+			slotCount <<= 1;											// At most half full, so probe sequences stay short
+		std::vector<Slot> slots(slotCount, Slot());
+		std::string blob;
+		size_t blobStart = sizeof(Header) + slotCount * sizeof(Slot);
+		for (const auto& entry : entries)
+		{
+			uint64_t hash = Hash(entry.first);
+			uint32_t slot = (uint32_t)hash & (slotCount - 1);
+			while (slots[slot].nameLength != 0)
+				slot = (slot + 1) & (slotCount - 1);
+			slots[slot].hash = hash;
+			slots[slot].nameOffset = (uint32_t)(blobStart + blob.size());
+			slots[slot].nameLength = (uint32_t)entry.first.size();
+			blob.append(entry.first);
+			blob += '\0';
+			slots[slot].dataOffset = (uint32_t)(blobStart + blob.size());
+			slots[slot].dataLength = (uint32_t)entry.second.size();
+			blob.append(entry.second.data(), entry.second.size());
+			blob += '\0';
+		}
+
+		Header header;
+		header.magic = MAGIC;
+		header.version = VERSION;
+		header.entryCount = (uint32_t)entries.size();
+		header.slotCount = slotCount;
+		FILE* file = fopen(path, "wb");
+		if (!file)
+		{
+			printf("ERROR::SHADER_ARCHIVE::CANNOT_WRITE %s\n", path);
+			return false;
+		}
+		bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+					   fwrite(slots.data(), sizeof(Slot), slots.size(), file) == slots.size() &&
+					   fwrite(blob.data(), 1, blob.size(), file) == blob.size();
+		written = fclose(file) == 0 && written;
+		if (!written)
+			printf("ERROR::SHADER_ARCHIVE::CANNOT_WRITE %s\n", path);
+		return written;
+	}
+
+private:
+	struct Header
+	{
+		uint32_t magic = 0, version = 0, entryCount = 0, slotCount = 0;
+	};
+	struct Slot
+	{
+		uint64_t hash = 0;
+		uint32_t nameOffset = 0, nameLength = 0;						// nameLength 0 marks an empty slot
+		uint32_t dataOffset = 0, dataLength = 0;
+	};
+
+	const char* data = nullptr;
+	size_t size = 0;
+	std::filesystem::file_time_type written;							// When the archive file was last written
+	std::unique_ptr<char[]> copy;										// Where the file is read to when it can't be mapped
+
+	static uint64_t Hash(std::string_view name)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		for (char c : name)
+			hash = (hash ^ (unsigned char)c) * 1099511628211ull;
+		return hash;
+	}
+
+	// Header and every used slot have to point inside the file, so lookups never need to check again
+	bool Validate() const
+	{
+		const Header* header = (const Header*)data;
+		if (header->magic != MAGIC || header->version != VERSION || header->slotCount == 0 || (header->slotCount & (header->slotCount - 1)) != 0)
+			return false;
+		if (sizeof(Header) + (size_t)header->slotCount * sizeof(Slot) > size)
+			return false;
+		const Slot* slots = (const Slot*)(data + sizeof(Header));
+		uint32_t used = 0;
+		for (uint32_t slot = 0; slot < header->slotCount; slot++)
+		{
+			const Slot& entry = slots[slot];
+			if (entry.nameLength == 0)
+				continue;
+			used++;
+			if ((size_t)entry.nameOffset + entry.nameLength >= size || (size_t)entry.dataOffset + entry.dataLength >= size)
+				return false;											// '>=': the NUL after each has to be inside as well
+		}
+		return used == header->entryCount && used < header->slotCount;
+	}
+};
+
+#endif // !SHADER_ARCHIVE_H
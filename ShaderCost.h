@@ -0,0 +1,640 @@
+#ifndef SHADER_COST_H
+#define SHADER_COST_H
+
+#include "ShaderPreprocessor.h"
+
+#include <stdio.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*	Static cost estimate of one shader variant, read off its GLSL without compiling it:
+	- texture fetches (texture(), texelFetch(), textureLod(), ...) per call site, and fetches repeated with exactly
+	  the same sampler and coordinate expression within one function. Those are pure waste unless the coordinate
+	  changes in between, so they are reported as warnings
+	- an ALU estimate: binary arithmetic operators plus built-in function calls, transcendental ones (sin, pow,
+	  exp, sqrt, ...) also counted on their own. Scalar and vector operations count the same and loops count once
+	- varyings (vertex outputs / fragment inputs) with their component count, vertex attributes, fragment outputs,
+	  uniforms, samplers and uniform blocks
+Works on the preprocessor's output, so #includes are resolved and #if/#ifdef are evaluated with the variant's
+defines. Line numbers in the results point into the original files. */
+struct ShaderCost
+{
+	// A texture fetch that appears more than once with the same arguments in one function
+	struct DuplicateFetch
+	{
+		std::string call;											// Normalized call, e.g. "texture(texture2,TexCoord)"
+		std::string function;
+		int count = 0;
+		std::string file;
+		int line = 0;												// First occurrence
+	};
+
+	std::string path, stage, variant;								// variant: the defines, e.g. "TEXTURED UNIFORM_BLOCKS"
+	int textureFetches = 0, uniqueFetches = 0;
+	int aluOps = 0, transcendentals = 0;
+	int attributes = 0, varyings = 0, varyingComponents = 0, outputs = 0;
+	int uniforms = 0, samplers = 0, uniformBlocks = 0;
+	std::vector<DuplicateFetch> duplicateFetches;
+
+	void PrintWarnings() const
+	{
+		for (const DuplicateFetch& duplicate : duplicateFetches)
+			printf("WARNING::SHADER_COST::DUPLICATE_FETCH %s:%d [%s] %s() fetches %s %d times\n", duplicate.file.c_str(), duplicate.line, variant.c_str(), duplicate.function.c_str(), duplicate.call.c_str(), duplicate.count);
+	}
+
+	// One flat JSON object, same style as FrameReport::ToJSON. Built by appending, so any number of duplicates and
+	// any path length fit, and every string goes through Quote()
+	std::string ToJSON() const
+	{
+		std::string json = "{ \"path\": " + Quote(path) + ", \"stage\": " + Quote(stage) + ", \"variant\": " + Quote(variant);
+		const std::pair<const char*, int> counts[] = { { "texture_fetches", textureFetches }, { "unique_fetches", uniqueFetches },
+			{ "alu_ops", aluOps }, { "transcendentals", transcendentals }, { "attributes", attributes }, { "varyings", varyings },
+			{ "varying_components", varyingComponents }, { "outputs", outputs }, { "uniforms", uniforms }, { "samplers", samplers },
+			{ "uniform_blocks", uniformBlocks } };
+		for (const auto& count : counts)
+			json += std::string(", \"") + count.first + "\": " + std::to_string(count.second);
+		json += ", \"duplicate_fetches\": [";
+		for (size_t i = 0; i < duplicateFetches.size(); i++)
+		{
+			const DuplicateFetch& duplicate = duplicateFetches[i];
+			json += i == 0 ? "" : ", ";
+			json += "{ \"call\": " + Quote(duplicate.call) + ", \"function\": " + Quote(duplicate.function) +
+					", \"count\": " + std::to_string(duplicate.count) + ", \"file\": " + Quote(duplicate.file) +
+					", \"line\": " + std::to_string(duplicate.line) + " }";
+		}
+		json += "] }";
+		return json;
+	}
+
+	// 'text' as a JSON string literal: quotes and backslashes escaped, control characters as \u00XX
+	static std::string Quote(const std::string& text)
+	{
+		std::string quoted = "\"";
+		for (char c : text)
+		{
+			if (c == '"' || c == '\\')
+			{
+				quoted += '\\';
+				quoted += c;
+			}
+			else if ((unsigned char)c < 0x20)
+			{
+				char escape[8];
+				snprintf(escape, sizeof(escape), "\\u%04x", (unsigned char)c);
+				quoted += escape;
+			}
+			else
+				quoted += c;
+		}
+		return quoted + "\"";
+	}
+};
+
+class ShaderCostAnalyzer
+{
+public:
+	// Analyzes 'path' (stage from the extension: .vs vertex, .fs fragment) built with 'defines'
+	bool Analyze(const std::string& path, const ShaderDefines& defines, ShaderCost& cost)
+	{
+		std::string source;
+		std::vector<std::string> files;
+		if (!preprocessor.Process(path, defines, source, &files))
+			return false;
+		cost = ShaderCost();
+		cost.path = path;
+		cost.stage = StageOf(path);
+		for (const auto& define : defines)
+			cost.variant += (cost.variant.empty() ? "" : " ") + define.first;
+		std::vector<Token> tokens = Tokenize(ActiveCode(source, files, nullptr));
+		AnalyzeTokens(tokens, cost);
+		return true;
+	}
+
+	// Keywords the shader (with its includes) tests in #ifdef/#ifndef/#if/#elif but never #defines itself:
+	// the switches its variants are made of
+	std::vector<std::string> Keywords(const std::string& path)
+	{
+		std::string source;
+		std::vector<std::string> files;
+		preprocessor.Process(path, ShaderDefines(), source, &files);
+		std::set<std::string> tested, defined;
+		ActiveCode(source, files, &tested, &defined);
+		std::vector<std::string> keywords;
+		for (const std::string& name : tested)
+		{
+			if (!defined.count(name))
+				keywords.push_back(name);
+		}
+		return keywords;
+	}
+
+	static std::string StageOf(const std::string& path)
+	{
+		std::string_view name(path);
+		if (name.size() >= 3 && name.substr(name.size() - 3) == ".vs")
+			return "vertex";
+		if (name.size() >= 3 && name.substr(name.size() - 3) == ".fs")
+			return "fragment";
+		return "unknown";
+	}
+
+private:
+	struct Token
+	{
+		std::string text;
+		std::string file;
+		int line;
+	};
+
+	ShaderPreprocessor preprocessor;
+
+	static bool IsIdentifierStart(char c)
+	{
+		return isalpha((unsigned char)c) || c == '_';
+	}
+	static bool IsIdentifierChar(char c)
+	{
+		return isalnum((unsigned char)c) || c == '_';
+	}
+
+	// ---------- Conditional compilation ----------
+	// Evaluates #if expressions: defined(X), defined X, integers, macros with integer values, ! && || == != < > <= >=
+	class Expression
+	{
+	public:
+		Expression(std::string_view text, const std::map<std::string, std::string>& macros, std::set<std::string>* tested)
+			: macros(macros), tested(tested)
+		{
+			for (size_t i = 0; i < text.size(); )
+			{
+				if (isspace((unsigned char)text[i]))
+					i++;
+				else if (IsIdentifierChar(text[i]))
+				{
+					size_t start = i;
+					while (i < text.size() && IsIdentifierChar(text[i]))
+						i++;
+					tokens.emplace_back(text.substr(start, i - start));
+				}
+				else
+				{
+					std::string_view pair = text.substr(i, 2);
+					size_t length = (pair == "&&" || pair == "||" || pair == "==" || pair == "!=" || pair == "<=" || pair == ">=") ? 2 : 1;
+					tokens.emplace_back(text.substr(i, length));
+					i += length;
+				}
+			}
+		}
+		long Evaluate()
+		{
+			return Or();
+		}
+
+	private:
+		const std::map<std::string, std::string>& macros;
+		std::set<std::string>* tested;
+		std::vector<std::string> tokens;
+		size_t at = 0;
+
+		bool Accept(const char* token)
+		{
+			if (at < tokens.size() && tokens[at] == token)
+			{
+				at++;
+				return true;
+			}
+			return false;
+		}
+		long Or()
+		{
+			long value = And();
+			while (Accept("||"))
+				value = (And() || value) ? 1 : 0;
+			return value;
+		}
+		long And()
+		{
+			long value = Compare();
+			while (Accept("&&"))
+				value = (Compare() && value) ? 1 : 0;
+			return value;
+		}
+		long Compare()
+		{
+			long value = Unary();
+			for (;;)
+			{
+				if (Accept("=="))		value = value == Unary();
+				else if (Accept("!="))	value = value != Unary();
+				else if (Accept("<="))	value = value <= Unary();
+				else if (Accept(">="))	value = value >= Unary();
+				else if (Accept("<"))	value = value < Unary();
+				else if (Accept(">"))	value = value > Unary();
+				else					return value;
+			}
+		}
+		long Unary()
+		{
+			if (Accept("!"))
+				return !Unary();
+			if (Accept("("))
+			{
+				long value = Or();
+				Accept(")");
+				return value;
+			}
+			if (at >= tokens.size())
+				return 0;
+			std::string token = tokens[at++];
+			if (token == "defined")
+			{
+				bool parenthesized = Accept("(");
+				std::string name = at < tokens.size() ? tokens[at++] : "";
+				if (parenthesized)
+					Accept(")");
+				if (tested)
+					tested->insert(name);
+				return macros.count(name) ? 1 : 0;
+			}
+			if (isdigit((unsigned char)token[0]))
+				return strtol(token.c_str(), nullptr, 0);
+			if (tested)
+				tested->insert(token);
+			auto macro = macros.find(token);
+			return macro != macros.end() ? strtol(macro->second.c_str(), nullptr, 0) : 0;
+		}
+	};
+
+	// Code left after evaluating the conditionals, comments stripped, one entry per line with its origin.
+	// Collects the names tested by conditionals and the names #defined when asked to
+	static std::vector<std::pair<std::string, std::pair<std::string, int>>> ActiveCode(const std::string& source, const std::vector<std::string>& files, std::set<std::string>* tested, std::set<std::string>* defined = nullptr)
+	{
+		struct Branch
+		{
+			bool parentActive, taken, active;
+		};
+		std::vector<Branch> branches;
+		std::map<std::string, std::string> macros;
+		std::vector<std::pair<std::string, std::pair<std::string, int>>> lines;
+		int fileIndex = 0, line = 1;
+		bool inComment = false;
+		for (size_t lineStart = 0; lineStart < source.size(); )
+		{
+			size_t lineEnd = source.find('\n', lineStart);
+			if (lineEnd == std::string::npos)
+				lineEnd = source.size();
+			std::string text = StripComments(std::string_view(source).substr(lineStart, lineEnd - lineStart), inComment);
+			lineStart = lineEnd + 1;
+			int thisLine = line++;
+			bool active = branches.empty() || branches.back().active;
+
+			size_t hash = text.find_first_not_of(" \t");
+			if (hash == std::string::npos || text[hash] != '#')
+			{
+				if (active)
+					lines.emplace_back(text, std::make_pair(fileIndex < (int)files.size() ? files[fileIndex] : std::string(), thisLine));
+				continue;
+			}
+			std::string_view directive = std::string_view(text).substr(hash + 1);
+			directive.remove_prefix(std::min(directive.size(), directive.find_first_not_of(" \t")));
+			size_t nameEnd = 0;
+			while (nameEnd < directive.size() && IsIdentifierChar(directive[nameEnd]))
+				nameEnd++;
+			std::string_view name = directive.substr(0, nameEnd);
+			std::string_view rest = directive.substr(nameEnd);
+			std::string word = FirstWord(rest);
+
+			if (name == "line")
+			{
+				char* end = nullptr;
+				line = (int)strtol(std::string(rest).c_str(), &end, 10);
+				fileIndex = (int)strtol(end, nullptr, 10);
+			}
+			else if (name == "ifdef" || name == "ifndef")
+			{
+				if (tested)
+					tested->insert(word);
+				bool condition = macros.count(word) != 0;
+				if (name == "ifndef")
+					condition = !condition;
+				branches.push_back({ active, condition, active && condition });
+			}
+			else if (name == "if")
+			{
+				bool condition = Expression(rest, macros, tested).Evaluate() != 0;
+				branches.push_back({ active, condition, active && condition });
+			}
+			else if (name == "elif" && !branches.empty())
+			{
+				Branch& branch = branches.back();
+				bool condition = !branch.taken && Expression(rest, macros, tested).Evaluate() != 0;
+				branch.active = branch.parentActive && condition;
+				branch.taken = branch.taken || condition;
+			}
+			else if (name == "else" && !branches.empty())
+			{
+				Branch& branch = branches.back();
+				branch.active = branch.parentActive && !branch.taken;
+				branch.taken = true;
+			}
+			else if (name == "endif" && !branches.empty())
+				branches.pop_back();
+			else if (name == "define" && active)
+			{
+				if (defined)
+					defined->insert(word);
+				std::string_view value = rest.substr(std::min(rest.size(), rest.find(word) + word.size()));
+				size_t valueStart = value.find_first_not_of(" \t");
+				macros[word] = valueStart == std::string_view::npos ? "" : std::string(value.substr(valueStart));
+			}
+			else if (name == "undef" && active)
+				macros.erase(word);
+		}
+		return lines;
+	}
+
+	static std::string FirstWord(std::string_view text)
+	{
+		size_t start = text.find_first_not_of(" \t");
+		if (start == std::string_view::npos)
+			return std::string();
+		size_t end = start;
+		while (end < text.size() && IsIdentifierChar(text[end]))
+			end++;
+		return std::string(text.substr(start, end - start));
+	}
+
+	static std::string StripComments(std::string_view text, bool& inComment)
+	{
+		std::string result;
+		for (size_t i = 0; i < text.size(); i++)
+		{
+			if (inComment)
+			{
+				if (text.substr(i, 2) == "*/")
+				{
+					inComment = false;
+					i++;
+				}
+				continue;
+			}
+			if (text.substr(i, 2) == "//")
+				break;
+			if (text.substr(i, 2) == "/*")
+			{
+				inComment = true;
+				i++;
+				result += ' ';
+				continue;
+			}
+			result += text[i];
+		}
+		return result;
+	}
+
+	static std::vector<Token> Tokenize(const std::vector<std::pair<std::string, std::pair<std::string, int>>>& lines)
+	{
+		static const char* const TWO_CHAR_OPERATORS[] = { "+=", "-=", "*=", "/=", "%=", "++", "--", "==", "!=", "<=", ">=", "&&", "||", "<<", ">>" };
+		std::vector<Token> tokens;
+		for (const auto& line : lines)
+		{
+			const std::string& text = line.first;
+			for (size_t i = 0; i < text.size(); )
+			{
+				char c = text[i];
+				size_t start = i;
+				if (isspace((unsigned char)c))
+				{
+					i++;
+					continue;
+				}
+				if (IsIdentifierStart(c))
+				{
+					while (i < text.size() && IsIdentifierChar(text[i]))
+						i++;
+				}
+				else if (isdigit((unsigned char)c) || (c == '.' && i + 1 < text.size() && isdigit((unsigned char)text[i + 1])))
+				{
+					while (i < text.size() && (IsIdentifierChar(text[i]) || text[i] == '.'))
+						i++;
+				}
+				else
+				{
+					i++;
+					for (const char* op : TWO_CHAR_OPERATORS)
+					{
+						if (text.compare(start, 2, op) == 0)
+						{
+							i = start + 2;
+							break;
+						}
+					}
+				}
+				tokens.push_back({ text.substr(start, i - start), line.second.first, line.second.second });
+			}
+		}
+		return tokens;
+	}
+
+	// ---------- Analysis ----------
+	static int Components(const std::string& type)
+	{
+		if (type == "float" || type == "int" || type == "uint" || type == "bool")
+			return 1;
+		if (type.size() == 4 && type.compare(0, 3, "vec") == 0)
+			return type[3] - '0';
+		if (type.size() == 5 && (type[0] == 'i' || type[0] == 'u' || type[0] == 'b' || type[0] == 'd') && type.compare(1, 3, "vec") == 0)
+			return type[4] - '0';
+		if (type.compare(0, 3, "mat") == 0 && type.size() == 4)
+			return (type[3] - '0') * (type[3] - '0');
+		if (type.compare(0, 3, "mat") == 0 && type.size() == 6)
+			return (type[3] - '0') * (type[5] - '0');
+		return 0;
+	}
+
+	static bool IsTextureFunction(const std::string& name)
+	{
+		static const std::set<std::string> functions = { "texture", "textureOffset", "textureProj", "textureProjOffset", "textureLod", "textureLodOffset",
+			"textureProjLod", "textureProjLodOffset", "textureGrad", "textureGradOffset", "textureProjGrad", "textureProjGradOffset",
+			"texelFetch", "texelFetchOffset", "textureGather", "textureGatherOffset" };
+		return functions.count(name) != 0;
+	}
+	static bool IsTranscendental(const std::string& name)
+	{
+		static const std::set<std::string> functions = { "sin", "cos", "tan", "asin", "acos", "atan", "sinh", "cosh", "tanh",
+			"pow", "exp", "log", "exp2", "log2", "sqrt", "inversesqrt" };
+		return functions.count(name) != 0;
+	}
+	static bool IsBuiltinMath(const std::string& name)
+	{
+		static const std::set<std::string> functions = { "radians", "degrees", "abs", "sign", "floor", "ceil", "trunc", "round", "fract", "mod",
+			"min", "max", "clamp", "mix", "step", "smoothstep", "length", "distance", "dot", "cross", "normalize", "reflect", "refract",
+			"faceforward", "matrixCompMult", "transpose", "inverse", "determinant", "outerProduct", "dFdx", "dFdy", "fwidth" };
+		return functions.count(name) != 0 || IsTranscendental(name);
+	}
+
+	static bool IsOperand(const std::string& token)
+	{
+		return IsIdentifierChar(token[0]) || token[0] == '.' || token == ")" || token == "]";
+	}
+
+	static size_t MatchingClose(const std::vector<Token>& tokens, size_t open, const char* openText, const char* closeText)
+	{
+		int depth = 0;
+		for (size_t i = open; i < tokens.size(); i++)
+		{
+			if (tokens[i].text == openText)
+				depth++;
+			else if (tokens[i].text == closeText && --depth == 0)
+				return i;
+		}
+		return tokens.size();
+	}
+
+	void AnalyzeTokens(const std::vector<Token>& tokens, ShaderCost& cost) const
+	{
+		bool vertex = cost.stage == "vertex";
+		std::vector<size_t> statement;										// Token indices of the global statement so far
+		for (size_t i = 0; i < tokens.size(); i++)
+		{
+			const std::string& text = tokens[i].text;
+			if (text != ";" && text != "{")
+			{
+				statement.push_back(i);
+				continue;
+			}
+			if (text == "{")
+			{
+				size_t close = MatchingClose(tokens, i, "{", "}");
+				bool function = !statement.empty() && tokens[statement.back()].text == ")";
+				if (function)
+				{
+					std::string name;
+					for (size_t s = 0; s + 1 < statement.size(); s++)
+					{
+						if (tokens[statement[s + 1]].text == "(")
+						{
+							name = tokens[statement[s]].text;
+							break;
+						}
+					}
+					AnalyzeFunction(tokens, i + 1, close, name, cost);
+				}
+				else
+				{
+					for (size_t s : statement)
+					{
+						if (tokens[s].text == "uniform")
+							cost.uniformBlocks++;
+					}
+					while (close < tokens.size() && tokens[close].text != ";")
+						close++;										// Instance name, if any
+				}
+				i = close;
+				statement.clear();
+				continue;
+			}
+			Declaration(tokens, statement, vertex, cost);
+			statement.clear();
+		}
+
+		cost.uniqueFetches = cost.textureFetches;
+		for (const ShaderCost::DuplicateFetch& duplicate : cost.duplicateFetches)
+			cost.uniqueFetches -= duplicate.count - 1;
+	}
+
+	// Global 'in'/'out'/'uniform' declaration (layout qualifiers and precision are skipped)
+	static void Declaration(const std::vector<Token>& tokens, const std::vector<size_t>& statement, bool vertex, ShaderCost& cost)
+	{
+		std::string qualifier, type;
+		int names = 0, arraySize = 1;
+		for (size_t s = 0; s < statement.size(); s++)
+		{
+			const std::string& text = tokens[statement[s]].text;
+			if (text == "layout" && s + 1 < statement.size() && tokens[statement[s + 1]].text == "(")
+			{
+				while (s < statement.size() && tokens[statement[s]].text != ")")
+					s++;
+			}
+			else if (text == "in" || text == "out" || text == "uniform")
+				qualifier = text;
+			else if (text == "[" && s + 1 < statement.size())
+				arraySize = std::max(1, atoi(tokens[statement[s + 1]].text.c_str()));
+			else if (IsIdentifierStart(text[0]) && !qualifier.empty())
+			{
+				if (type.empty() && text != "flat" && text != "smooth" && text != "noperspective" && text != "highp" && text != "mediump" && text != "lowp")
+					type = text;
+				else if (!type.empty())
+					names++;
+			}
+		}
+		if (qualifier.empty() || names == 0)
+			return;
+		int count = names * arraySize;
+		if (qualifier == "uniform")
+		{
+			cost.uniforms += count;
+			if (type.find("sampler") != std::string::npos)
+				cost.samplers += count;
+		}
+		else if ((qualifier == "out") == vertex)
+		{
+			cost.varyings += count;
+			cost.varyingComponents += count * Components(type);
+		}
+		else if (qualifier == "in")
+			cost.attributes += count;
+		else
+			cost.outputs += count;
+	}
+
+	void AnalyzeFunction(const std::vector<Token>& tokens, size_t begin, size_t end, const std::string& function, ShaderCost& cost) const
+	{
+		std::map<std::string, ShaderCost::DuplicateFetch> fetches;
+		std::vector<std::string> order;
+		for (size_t i = begin; i < end; i++)
+		{
+			const std::string& text = tokens[i].text;
+			bool call = i + 1 < end && tokens[i + 1].text == "(";
+			if (call && IsTextureFunction(text))
+			{
+				size_t close = MatchingClose(tokens, i + 1, "(", ")");
+				std::string key = text;
+				for (size_t a = i + 1; a <= close && a < end; a++)
+					key += tokens[a].text;
+				ShaderCost::DuplicateFetch& fetch = fetches[key];
+				if (fetch.count++ == 0)
+				{
+					fetch.call = key;
+					fetch.function = function;
+					fetch.file = tokens[i].file;
+					fetch.line = tokens[i].line;
+					order.push_back(key);
+				}
+				cost.textureFetches++;
+			}
+			else if (call && IsBuiltinMath(text))
+			{
+				cost.aluOps++;
+				if (IsTranscendental(text))
+					cost.transcendentals++;
+			}
+			else if (i > begin && IsOperand(tokens[i - 1].text) &&
+				(text == "+" || text == "-" || text == "*" || text == "/" || text == "%" || text == "+=" || text == "-=" || text == "*=" || text == "/="))
+				cost.aluOps++;
+		}
+		for (const std::string& key : order)
+		{
+			if (fetches[key].count > 1)
+				cost.duplicateFetches.push_back(fetches[key]);
+		}
+	}
+};
+
+#endif // !SHADER_COST_H
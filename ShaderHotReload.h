@@ -0,0 +1,333 @@
+#ifndef SHADER_HOT_RELOAD_H
+#define SHADER_HOT_RELOAD_H
+
+#include "my_glad.h"
+
+#include "Shader.h"
+#include "ShaderPreprocessor.h"
+#include "ProgramCache.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+/*	Rebuilds shaders while the program runs when their files change on disk (Linux inotify; elsewhere Start() fails
+and nothing is watched). Update() is called once per frame on the GL thread and never waits:
+	- changed files are picked up from the non-blocking inotify descriptor
+	- only programs whose dependency set (shader files plus everything they #include) contains a changed file are rebuilt
+	- the new program is compiled and linked next to the old one and polled with GL_COMPLETION_STATUS_KHR where the
+	  driver has it (without the extension the driver finishes it when the status is read)
+	- after a successful link it replaces Shader::ID between two frames, so no draw ever sees a half-built program.
+	  If compiling or linking fails the error is printed and the old program stays in use */
+class ShaderHotReload
+{
+public:
+	ShaderHotReload()
+	{
+		parallel = gladHasExtension("GL_KHR_parallel_shader_compile") || gladHasExtension("GL_ARB_parallel_shader_compile");
+	}
+	// A build still in flight is left to the GL context (this may run after the context is gone)
+	~ShaderHotReload()
+	{
+#ifdef __linux__
+		if (inotifyFd >= 0)
+			close(inotifyFd);
+#endif
+	}
+	ShaderHotReload(const ShaderHotReload&) = delete;
+	ShaderHotReload& operator=(const ShaderHotReload&) = delete;
+
+	// Starts watching 'directory' and every directory below it, including ones created later
+	bool Start(const std::string& directory = "Shaders")
+	{
+#ifdef __linux__
+		inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (inotifyFd < 0)
+		{
+			printf("ERROR::HOT_RELOAD::INOTIFY_INIT_FAILED\n");
+			return false;
+		}
+		AddWatchTree(Normalize(directory), nullptr);
+		return !directories.empty();
+#else
+		printf("ERROR::HOT_RELOAD::NOT_SUPPORTED\n");
+		return false;
+#endif
+	}
+
+	// Rebuilds 'shader' from these files when any of them (or their includes) change. 'onReload' runs after every
+	// successful swap, to set uniform values again (they belong to the old program)
+	void Watch(Shader& shader, const std::string& vertexPath, const std::string& fragmentPath, const ShaderDefines& defines = ShaderDefines(), std::function<void(Shader&)> onReload = nullptr)
+	{
+		Entry entry;
+		entry.shader = &shader;
+		entry.vertexPath = vertexPath;
+		entry.fragmentPath = fragmentPath;
+		entry.defines = defines;
+		entry.onReload = onReload;
+		std::string vertexSource, fragmentSource;
+		Preprocess(entry, vertexSource, fragmentSource);
+		entries.push_back(entry);
+	}
+
+	// Once per frame, on the thread the GL context is current on
+	void Update()
+	{
+		std::vector<std::string> changed = ReadChanges();
+		for (Entry& entry : entries)
+		{
+			bool affected = false;
+			for (const std::string& path : changed)
+				affected = affected || std::find(entry.dependencies.begin(), entry.dependencies.end(), path) != entry.dependencies.end();
+			if (!affected)
+				continue;
+			if (entry.program)
+				entry.stale = true;											// Rebuilt again once the build in flight is done
+			else
+				Rebuild(entry);
+		}
+		for (Entry& entry : entries)
+		{
+			if (entry.program && IsComplete(entry.program))
+				Finish(entry);
+		}
+	}
+
+	int ReloadCount() const
+	{
+		return reloads;
+	}
+	int FailureCount() const
+	{
+		return failures;
+	}
+
+private:
+	struct Entry
+	{
+		Shader* shader = nullptr;
+		std::string vertexPath, fragmentPath;
+		ShaderDefines defines;
+		std::function<void(Shader&)> onReload;
+		std::vector<std::string> dependencies;						// Normalized paths, as they come out of inotify
+		unsigned int program = 0, vertex = 0, fragment = 0;			// Build in flight (0 when there is none)
+		uint64_t cacheKey = 0;
+		bool stale = false;
+		std::chrono::steady_clock::time_point started;
+	};
+
+	std::vector<Entry> entries;
+	std::unordered_map<int, std::string> directories;					// inotify watch descriptor -> directory
+	int inotifyFd = -1;
+	bool parallel = false;
+	int reloads = 0, failures = 0;
+
+	static std::string Normalize(const std::string& path)
+	{
+		return std::filesystem::path(path).lexically_normal().generic_string();
+	}
+
+	void AddWatch(const std::string& directory)
+	{
+#ifdef __linux__
+		// Editors either rewrite the file (close after write) or write a new one and rename it over the old one.
+		// IN_CREATE is only acted on for directories, which need a watch of their own
+		const uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+		int watch = inotify_add_watch(inotifyFd, directory.c_str(), mask);
+		if (watch < 0)
+			printf("ERROR::HOT_RELOAD::CANNOT_WATCH %s\n", directory.c_str());
+		else
+			directories[watch] = directory;
+#endif
+	}
+
+	// Watches 'directory' and everything below it. With 'existing', files already in there are reported as changed:
+	// a directory that just appeared may have been filled before its watch was in place
+	void AddWatchTree(const std::string& directory, std::vector<std::string>* existing)
+	{
+		AddWatch(directory);
+		std::error_code error;
+		for (std::filesystem::recursive_directory_iterator it(directory, error), end; !error && it != end; it.increment(error))
+		{
+			if (it->is_directory())
+				AddWatch(Normalize(it->path().generic_string()));
+			else if (existing)
+				AddChange(*existing, Normalize(it->path().generic_string()));
+		}
+	}
+
+	static void AddChange(std::vector<std::string>& changed, const std::string& path)
+	{
+		if (std::find(changed.begin(), changed.end(), path) == changed.end())
+			changed.push_back(path);
+	}
+
+	// Drains the inotify descriptor. Every path is reported once however many events it got (editors often produce several)
+	std::vector<std::string> ReadChanges()
+	{
+		std::vector<std::string> changed;
+#ifdef __linux__
+		if (inotifyFd < 0)
+			return changed;
+		alignas(struct inotify_event) char buffer[4096];
+		for (;;)
+		{
+			ssize_t length = read(inotifyFd, buffer, sizeof(buffer));
+			if (length <= 0)
+				break;														// EAGAIN: nothing (more) to read
+			for (char* at = buffer; at < buffer + length; )
+			{
+				const struct inotify_event* event = (const struct inotify_event*)at;
+				at += sizeof(struct inotify_event) + event->len;
+				auto directory = directories.find(event->wd);
+				if (event->len == 0 || directory == directories.end())
+					continue;
+				std::string path = Normalize(directory->second + "/" + event->name);
+				if (event->mask & IN_ISDIR)
+				{
+					if (event->mask & (IN_CREATE | IN_MOVED_TO))
+						AddWatchTree(path, &changed);
+					continue;
+				}
+				if (event->mask & IN_CREATE)
+					continue;												// The IN_CLOSE_WRITE that follows is the one that matters
+				AddChange(changed, path);
+			}
+		}
+#endif
+		return changed;
+	}
+
+	// A failed build keeps the old dependencies and adds the files it could not read, so the edit (or the file
+	// being created) that fixes it triggers the next rebuild
+	bool Preprocess(Entry& entry, std::string& vertexSource, std::string& fragmentSource)
+	{
+		ShaderPreprocessor preprocessor(nullptr, false);					// Fresh one every time and never the archive, so nothing stale is reused
+		std::vector<std::string> vertexFiles, fragmentFiles, vertexMissing, fragmentMissing;
+		bool success = preprocessor.Process(entry.vertexPath, entry.defines, vertexSource, &vertexFiles, &vertexMissing);
+		success = preprocessor.Process(entry.fragmentPath, entry.defines, fragmentSource, &fragmentFiles, &fragmentMissing) && success;
+		if (success)
+			entry.dependencies.clear();
+		for (const std::vector<std::string>* files : { &vertexFiles, &fragmentFiles, &vertexMissing, &fragmentMissing })
+		{
+			for (const std::string& file : *files)
+			{
+				std::string path = Normalize(file);
+				if (std::find(entry.dependencies.begin(), entry.dependencies.end(), path) == entry.dependencies.end())
+					entry.dependencies.push_back(path);
+			}
+		}
+		return success;
+	}
+
+	// Submits compile + link of the new version without reading any status back
+	void Rebuild(Entry& entry)
+	{
+		std::string vertexSource, fragmentSource;
+		if (!Preprocess(entry, vertexSource, fragmentSource))
+		{
+			printf("ERROR::HOT_RELOAD::KEEPING_OLD_PROGRAM %s\n", entry.fragmentPath.c_str());
+			failures++;
+			return;
+		}
+		entry.started = std::chrono::steady_clock::now();
+		entry.cacheKey = ProgramCache::Key(vertexSource, fragmentSource);
+		entry.program = glCreateProgram();
+		entry.vertex = CompileAsync(GL_VERTEX_SHADER, vertexSource);
+		entry.fragment = CompileAsync(GL_FRAGMENT_SHADER, fragmentSource);
+		ProgramCache::Get().PrepareForLink(entry.program);
+		glAttachShader(entry.program, entry.vertex);
+		glAttachShader(entry.program, entry.fragment);
+		glLinkProgram(entry.program);
+	}
+
+	static unsigned int CompileAsync(GLenum type, const std::string& code)
+	{
+		const char* source = code.c_str();
+		int length = (int)code.size();
+		unsigned int shader = glCreateShader(type);
+		glShaderSource(shader, 1, &source, &length);
+		glCompileShader(shader);
+		return shader;
+	}
+
+	bool IsComplete(unsigned int program) const
+	{
+		if (!parallel)
+			return true;
+		int complete = 0;
+		glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &complete);
+		return complete != 0;
+	}
+
+	// Swaps the new program in if it linked, otherwise reports why and keeps the old one
+	void Finish(Entry& entry)
+	{
+		int linked, success;
+		char infoLog[512];
+		glGetProgramiv(entry.program, GL_LINK_STATUS, &linked);
+		if (linked)
+		{
+			ProgramCache::Get().Store(entry.program, entry.cacheKey, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - entry.started).count());
+			entry.shader->Adopt(entry.program);
+			entry.program = 0;
+			if (entry.onReload)
+				entry.onReload(*entry.shader);
+			reloads++;
+			printf("Reloaded %s + %s\n", entry.vertexPath.c_str(), entry.fragmentPath.c_str());
+		}
+		else
+		{
+			glGetShaderiv(entry.vertex, GL_COMPILE_STATUS, &success);
+			if (!success)
+			{
+				glGetShaderInfoLog(entry.vertex, 512, nullptr, infoLog);
+				printf("ERROR::SHADER::VERTEX::COMPILATION_FAILED %s\n%s\n", entry.vertexPath.c_str(), infoLog);
+			}
+			glGetShaderiv(entry.fragment, GL_COMPILE_STATUS, &success);
+			if (!success)
+			{
+				glGetShaderInfoLog(entry.fragment, 512, nullptr, infoLog);
+				printf("ERROR::SHADER::FRAGMENT::COMPILATION_FAILED %s\n%s\n", entry.fragmentPath.c_str(), infoLog);
+			}
+			glGetProgramInfoLog(entry.program, 512, nullptr, infoLog);
+			printf("ERROR::SHADER::PROGRAM::LINKING_FAILED %s\n%s\n", entry.fragmentPath.c_str(), infoLog);
+			printf("ERROR::HOT_RELOAD::KEEPING_OLD_PROGRAM %s\n", entry.fragmentPath.c_str());
+			failures++;
+		}
+		Discard(entry);
+
+		if (entry.stale)
+		{
+			entry.stale = false;
+			Rebuild(entry);
+		}
+	}
+
+	// Deletes whatever is left of the build in flight
+	static void Discard(Entry& entry)
+	{
+		if (entry.program)
+			glDeleteProgram(entry.program);
+		if (entry.vertex)
+			glDeleteShader(entry.vertex);
+		if (entry.fragment)
+			glDeleteShader(entry.fragment);
+		entry.program = entry.vertex = entry.fragment = 0;
+	}
+};
+
+#endif // !SHADER_HOT_RELOAD_H
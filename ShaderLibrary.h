@@ -0,0 +1,317 @@
+#ifndef SHADER_LIBRARY_H
+#define SHADER_LIBRARY_H
+
+#include "my_glad.h"
+
+#include "Shader.h"
+#include "ProgramCache.h"
+#include "ShaderSources.h"
+#include "ShaderPreprocessor.h"
+#include "Timeline.h"
+
+#include <stdio.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// GL_KHR_parallel_shader_compile (glad was generated without extensions)
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#endif
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+/*	Builds a batch of programs without stalling on each one. Submit() issues every compile and then every link
+before asking GL about any of them; asking for GL_COMPILE_STATUS/GL_LINK_STATUS right away (what the Shader
+constructor does) makes the driver finish that shader before returning. With GL_KHR_parallel_shader_compile
+(or the ARB version) the driver spreads the batch over its compiler threads and Poll() checks
+GL_COMPLETION_STATUS_KHR, which never blocks, so rendering can start with whichever programs are ready.
+Without the extension the batch still goes out in one go and Poll() simply finishes everything.
+Programs found in the ProgramCache are ready straight after Submit(), and variants whose preprocessed text is identical
+are built once. */
+class ShaderLibrary
+{
+public:
+	// 'load' resolves glMaxShaderCompilerThreadsKHR to let the driver use all its compiler threads;
+	// without it the driver's default thread count is used
+	ShaderLibrary(GLADloadproc load = nullptr)
+	{
+		parallel = gladHasExtension("GL_KHR_parallel_shader_compile") || gladHasExtension("GL_ARB_parallel_shader_compile");
+		if (parallel && load)
+		{
+			typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+			PFNGLMAXSHADERCOMPILERTHREADSKHRPROC maxThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+			if (!maxThreads)
+				maxThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsARB");
+			if (maxThreads)
+				maxThreads(0xFFFFFFFFu);							// "As many as the implementation likes"
+		}
+	}
+	~ShaderLibrary()
+	{
+		Release();
+	}
+	ShaderLibrary(const ShaderLibrary&) = delete;
+	ShaderLibrary& operator=(const ShaderLibrary&) = delete;
+
+	// Registers a program (a variant of it, with 'defines') under 'name'. Nothing is read or compiled before Submit().
+	// Names are unique: adding one that is already taken is an error and nothing is added
+	bool Add(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath, const ShaderDefines& defines = ShaderDefines())
+	{
+		if (index.count(name))
+		{
+			printf("ERROR::SHADER_LIBRARY::DUPLICATE_NAME %s\n", name.c_str());
+			return false;
+		}
+		Program program;
+		program.name = name;
+		program.vertexPath = vertexPath;
+		program.fragmentPath = fragmentPath;
+		program.defines = defines;
+		index[name] = programs.size();
+		programs.push_back(std::move(program));
+		return true;
+	}
+
+	// Hands every added program that hasn't been submitted yet to the driver
+	void Submit()
+	{
+		TimelineScope phase("Shader library submit");
+		submitTime = std::chrono::steady_clock::now();
+		ProgramCache& cache = ProgramCache::Get();
+
+		// Every source of the batch in one read pass (glShaderSource copies them, so the buffer only lives through Submit)
+		std::vector<std::string> paths;
+		for (const Program& program : programs)
+		{
+			if (program.state == State::Added)
+			{
+				paths.push_back(program.vertexPath);
+				paths.push_back(program.fragmentPath);
+			}
+		}
+		ShaderSources sources;
+		sources.Load(paths);
+		ShaderPreprocessor preprocessor(&sources);
+
+		// Cache hits first, then all compiles, then all links: no status query anywhere in between
+		std::unordered_map<uint64_t, size_t> submitted;
+		std::string vertexSource, fragmentSource;
+		for (size_t programIndex = 0; programIndex < programs.size(); programIndex++)
+		{
+			Program& program = programs[programIndex];
+			if (program.state != State::Added)
+				continue;
+			if (!preprocessor.Process(program.vertexPath, program.defines, vertexSource) || !preprocessor.Process(program.fragmentPath, program.defines, fragmentSource))
+			{
+				program.state = State::Failed;
+				continue;
+			}
+			program.cacheKey = ProgramCache::Key(vertexSource, fragmentSource);
+			auto same = submitted.find(program.cacheKey);
+			if (same != submitted.end())
+			{
+				program.aliasOf = same->second;							// Identical text: share the program built for the first one
+				program.state = State::Alias;
+				Program& target = programs[same->second];
+				if (target.state == State::Ready)
+					readyCount++;
+				else
+					target.aliases++;										// Counted as ready along with the target
+				continue;
+			}
+			submitted[program.cacheKey] = programIndex;
+			program.ID = glCreateProgram();
+			if (cache.Load(program.ID, program.cacheKey))
+			{
+				program.shader = std::make_unique<Shader>(program.ID);
+				program.state = State::Ready;
+				readyCount += 1 + program.aliases;
+				continue;
+			}
+			program.vertex = CompileAsync(GL_VERTEX_SHADER, vertexSource);
+			program.fragment = CompileAsync(GL_FRAGMENT_SHADER, fragmentSource);
+			program.state = State::Compiling;
+		}
+		for (Program& program : programs)
+		{
+			if (program.state != State::Compiling)
+				continue;
+			cache.PrepareForLink(program.ID);
+			glAttachShader(program.ID, program.vertex);
+			glAttachShader(program.ID, program.fragment);
+			glLinkProgram(program.ID);
+		}
+	}
+
+	// Finishes every program the driver is done with, without waiting for the rest. Returns how many programs are ready
+	int Poll()
+	{
+		for (Program& program : programs)
+		{
+			if (program.state == State::Compiling && IsComplete(program))
+				Finish(program);
+		}
+		return readyCount;
+	}
+
+	// The program if it is ready, nullptr while it is still being built (or if it failed)
+	Shader* Get(const std::string& name) const
+	{
+		auto found = index.find(name);
+		return found != index.end() ? Resolve(found->second).shader.get() : nullptr;
+	}
+
+	// Blocks until 'name' is built. Use it for programs needed before anything can be drawn
+	Shader* Wait(const std::string& name)
+	{
+		auto found = index.find(name);
+		if (found == index.end())
+			return nullptr;
+		Program& program = Resolve(found->second);
+		if (program.state == State::Compiling)
+			Finish(program);
+		return program.shader.get();
+	}
+
+	void WaitAll()
+	{
+		for (Program& program : programs)
+		{
+			if (program.state == State::Compiling)
+				Finish(program);
+		}
+	}
+
+	// Deletes every build still in flight; they end up Failed. Needs the context to be current,
+	// so call it before tearing the context down when the library outlives it (the destructor calls it too)
+	void Release()
+	{
+		for (Program& program : programs)
+		{
+			if (program.state != State::Compiling)
+				continue;
+			glDeleteShader(program.vertex);
+			glDeleteShader(program.fragment);
+			glDeleteProgram(program.ID);
+			program.vertex = program.fragment = program.ID = 0;
+			program.state = State::Failed;
+		}
+	}
+
+	bool ParallelCompileSupported() const
+	{
+		return parallel;
+	}
+	// Includes names that share another program's build once that build is ready
+	int ReadyCount() const
+	{
+		return readyCount;
+	}
+	// Programs submitted but not finished yet
+	int PendingCount() const
+	{
+		int pending = 0;
+		for (const Program& program : programs)
+			pending += program.state == State::Compiling;
+		return pending;
+	}
+
+private:
+	enum class State { Added, Compiling, Ready, Failed, Alias };
+
+	struct Program
+	{
+		std::string name, vertexPath, fragmentPath;
+		ShaderDefines defines;
+		size_t aliasOf = 0;											// Program with the same preprocessed text when state is Alias
+		int aliases = 0;											// Alias entries waiting for this build
+		unsigned int ID = 0, vertex = 0, fragment = 0;
+		uint64_t cacheKey = 0;
+		State state = State::Added;
+		std::unique_ptr<Shader> shader;
+	};
+
+	std::vector<Program> programs;
+	std::unordered_map<std::string, size_t> index;
+	bool parallel = false;
+	int readyCount = 0;
+	std::chrono::steady_clock::time_point submitTime;
+
+	Program& Resolve(size_t programIndex)
+	{
+		return programs[programIndex].state == State::Alias ? programs[programs[programIndex].aliasOf] : programs[programIndex];
+	}
+	const Program& Resolve(size_t programIndex) const
+	{
+		return programs[programIndex].state == State::Alias ? programs[programs[programIndex].aliasOf] : programs[programIndex];
+	}
+
+	static unsigned int CompileAsync(GLenum type, std::string_view code)
+	{
+		const char* source = code.data();
+		int length = (int)code.size();
+		unsigned int shader = glCreateShader(type);
+		glShaderSource(shader, 1, &source, &length);
+		glCompileShader(shader);
+		return shader;
+	}
+
+	bool IsComplete(const Program& program) const
+	{
+		if (!parallel)
+			return true;												// No way to ask without blocking, so just finish it
+		int complete = 0;
+		glGetProgramiv(program.ID, GL_COMPLETION_STATUS_KHR, &complete);
+		return complete != 0;
+	}
+
+	// Reads the results (this is where the driver blocks if the program isn't done) and wraps the program in a Shader
+	void Finish(Program& program)
+	{
+		int linked, success;
+		char infoLog[512];
+		glGetProgramiv(program.ID, GL_LINK_STATUS, &linked);
+		if (!linked)
+		{
+			glGetShaderiv(program.vertex, GL_COMPILE_STATUS, &success);
+			if (!success)
+			{
+				glGetShaderInfoLog(program.vertex, 512, nullptr, infoLog);
+				printf("ERROR::SHADER::VERTEX::COMPILATION_FAILED %s\n%s\n", program.vertexPath.c_str(), infoLog);
+			}
+			glGetShaderiv(program.fragment, GL_COMPILE_STATUS, &success);
+			if (!success)
+			{
+				glGetShaderInfoLog(program.fragment, 512, nullptr, infoLog);
+				printf("ERROR::SHADER::FRAGMENT::COMPILATION_FAILED %s\n%s\n", program.fragmentPath.c_str(), infoLog);
+			}
+			glGetProgramInfoLog(program.ID, 512, nullptr, infoLog);
+			printf("ERROR::SHADER::PROGRAM::LINKING_FAILED %s\n%s\n", program.name.c_str(), infoLog);
+		}
+		glDeleteShader(program.vertex);
+		glDeleteShader(program.fragment);
+		program.vertex = program.fragment = 0;
+
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		Timeline::Get().Record("Program ready", program.name.c_str(), submitTime, now);
+		if (!linked)
+		{
+			glDeleteProgram(program.ID);
+			program.ID = 0;
+			program.state = State::Failed;
+			return;
+		}
+		// Time since the batch was submitted: an upper bound of what this program cost to build
+		ProgramCache::Get().Store(program.ID, program.cacheKey, std::chrono::duration<double, std::milli>(now - submitTime).count());
+		program.shader = std::make_unique<Shader>(program.ID);
+		program.state = State::Ready;
+		readyCount += 1 + program.aliases;
+	}
+};
+
+#endif // !SHADER_LIBRARY_H
@@ -0,0 +1,200 @@
+#ifndef SHADER_PIPELINES_H
+#define SHADER_PIPELINES_H
+
+#include "my_glad.h"
+
+#include "Shader.h"
+#include "ShaderPreprocessor.h"
+#include "ProgramCache.h"
+#include "Timeline.h"
+
+#include <stdio.h>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*	Separable programs (one stage each) mixed and matched in program pipeline objects (GL 4.1 or
+ARB_separate_shader_objects). With Shader every vertex/fragment pair is its own program, so a vertex shader used
+with N fragment shaders is compiled and linked N times. Here every stage is built once and a pipeline just
+references the stage programs:
+
+	ShaderPipelines pipelines;
+	unsigned int vertexColors = pipelines.Pipeline("Shaders/Quad.vs", "Shaders/Quad.fs");
+	unsigned int uniformColor = pipelines.Pipeline("Shaders/Quad.vs", "Shaders/Quad.fs", { { "UNIFORM_COLOR", "" } });
+	state.BindProgramPipeline(uniformColor);							// Or glUseProgram(0) + glBindProgramPipeline()
+
+Builds and links grow with the number of distinct stages, not with the number of combinations. Stages are keyed by
+their preprocessed text, so defines a stage doesn't mention don't make a new one (Quad.vs above is built once).
+Uniforms belong to the stage program that declares them: set them with glProgramUniform* on StageShader(...)->ID.
+Outputs of the vertex stage are matched to fragment inputs by name, as with linked programs. */
+class ShaderPipelines
+{
+public:
+	~ShaderPipelines()
+	{
+		for (auto& pipeline : pipelines)
+			glDeleteProgramPipelines(1, &pipeline.second);
+		for (auto& stage : stages)
+			glDeleteProgram(stage.second->ID);
+	}
+	ShaderPipelines() = default;
+	ShaderPipelines(const ShaderPipelines&) = delete;
+	ShaderPipelines& operator=(const ShaderPipelines&) = delete;
+
+	// True when the current context can do separable programs
+	static bool Supported()
+	{
+		return gladHasGLFunction("glUseProgramStages") && (gladIsGLVersionAtLeast(4, 1) || gladHasExtension("GL_ARB_separate_shader_objects"));
+	}
+
+	// Separable program of one stage (GL_VERTEX_SHADER or GL_FRAGMENT_SHADER) built from 'path' with 'defines'.
+	// 0 if it didn't preprocess, compile or link
+	unsigned int Stage(GLenum type, const std::string& path, const ShaderDefines& defines = ShaderDefines())
+	{
+		std::string source;
+		{
+			TimelineScope phase("Shader preprocess", path.c_str());
+			if (!preprocessor.Process(path, defines, source))
+				return 0;
+		}
+		uint64_t key = ProgramCache::Key(source, std::string_view(), type == GL_VERTEX_SHADER ? "separable vertex" : "separable fragment");
+		auto stage = stages.find(key);
+		if (stage != stages.end())
+			return stage->second->ID;
+
+		unsigned int program = Build(type, source, path.c_str(), key);
+		if (program == 0)
+			return 0;
+		std::unique_ptr<Shader> shader = std::make_unique<Shader>(program);
+		stagePrograms[program] = shader.get();
+		stages.emplace(key, std::move(shader));
+		return program;
+	}
+
+	// Pipeline object running 'vertexStage' and 'fragmentStage' (from Stage()), created once per pair
+	unsigned int Pipeline(unsigned int vertexStage, unsigned int fragmentStage)
+	{
+		if (vertexStage == 0 || fragmentStage == 0)
+			return 0;
+		std::pair<unsigned int, unsigned int> stagePair(vertexStage, fragmentStage);
+		auto pipeline = pipelines.find(stagePair);
+		if (pipeline != pipelines.end())
+			return pipeline->second;
+
+		unsigned int id = 0;
+		glGenProgramPipelines(1, &id);
+		glUseProgramStages(id, GL_VERTEX_SHADER_BIT, vertexStage);
+		glUseProgramStages(id, GL_FRAGMENT_SHADER_BIT, fragmentStage);
+		pipelines.emplace(stagePair, id);
+		return id;
+	}
+	// Both stages from files with the same defines
+	unsigned int Pipeline(const std::string& vertexPath, const std::string& fragmentPath, const ShaderDefines& defines = ShaderDefines())
+	{
+		return Pipeline(Stage(GL_VERTEX_SHADER, vertexPath, defines), Stage(GL_FRAGMENT_SHADER, fragmentPath, defines));
+	}
+
+	// The stage program wrapped in a Shader for its uniform cache (nullptr for an unknown program).
+	// Shader::Use() and set*() don't apply to a pipeline; use glProgramUniform* with the locations instead
+	const Shader* StageShader(unsigned int stageProgram) const
+	{
+		auto stage = stagePrograms.find(stageProgram);
+		return stage != stagePrograms.end() ? stage->second : nullptr;
+	}
+
+	// Checks the pipeline against the current GL state (interface matching, sampler units) and prints why it can't draw
+	bool Validate(unsigned int pipeline) const
+	{
+		int valid = 0;
+		glValidateProgramPipeline(pipeline);
+		glGetProgramPipelineiv(pipeline, GL_VALIDATE_STATUS, &valid);
+		if (!valid)
+		{
+			char infoLog[512] = "";
+			glGetProgramPipelineInfoLog(pipeline, 512, nullptr, infoLog);
+			printf("ERROR::SHADER::PIPELINE::VALIDATION_FAILED\n%s\n", infoLog);
+		}
+		return valid != 0;
+	}
+
+	int StageCount() const
+	{
+		return (int)stages.size();
+	}
+	int PipelineCount() const
+	{
+		return (int)pipelines.size();
+	}
+	void PrintStats() const
+	{
+		printf("Shader pipelines: %d pipelines from %d stage programs (%d linked, %.2f ms compile + link)\n", PipelineCount(), StageCount(), links, buildMs);
+	}
+
+private:
+	ShaderPreprocessor preprocessor;
+	std::unordered_map<uint64_t, std::unique_ptr<Shader>> stages;				// Preprocessed text (and stage type) -> stage program
+	std::unordered_map<unsigned int, Shader*> stagePrograms;					// Stage program ID -> its Shader
+	std::map<std::pair<unsigned int, unsigned int>, unsigned int> pipelines;	// (vertex, fragment) stage programs -> pipeline
+	int links = 0;
+	double buildMs = 0.0;
+
+	// Loads the stage program from the binary cache, or compiles and links it as separable
+	unsigned int Build(GLenum type, const std::string& source, const char* path, uint64_t key)
+	{
+		unsigned int program = glCreateProgram();
+		glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);		// Has to be set before linking (or loading a binary)
+		{
+			TimelineScope phase("Program binary load", path);
+			if (ProgramCache::Get().Load(program, key))
+				return program;
+		}
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		const char* code = source.c_str();
+		int length = (int)source.size();
+		int success;
+		char infoLog[512];
+		unsigned int shader = glCreateShader(type);
+		{
+			TimelineScope phase("Shader compile", path);
+			glShaderSource(shader, 1, &code, &length);
+			glCompileShader(shader);
+			glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+		}
+		if (!success)
+		{
+			glGetShaderInfoLog(shader, 512, nullptr, infoLog);
+			printf("ERROR::SHADER::%s::COMPILATION_FAILED %s\n%s\n", type == GL_VERTEX_SHADER ? "VERTEX" : "FRAGMENT", path, infoLog);
+			glDeleteShader(shader);
+			glDeleteProgram(program);
+			return 0;
+		}
+		{
+			TimelineScope phase("Shader link", path);
+			ProgramCache::Get().PrepareForLink(program);
+			glAttachShader(program, shader);
+			glLinkProgram(program);
+			glGetProgramiv(program, GL_LINK_STATUS, &success);
+		}
+		glDetachShader(program, shader);
+		glDeleteShader(shader);
+		if (!success)
+		{
+			glGetProgramInfoLog(program, 512, nullptr, infoLog);
+			printf("ERROR::SHADER::PROGRAM::LINKING_FAILED %s\n%s\n", path, infoLog);
+			glDeleteProgram(program);
+			return 0;
+		}
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		links++;
+		buildMs += ms;
+		ProgramCache::Get().Store(program, key, ms);
+		return program;
+	}
+};
+
+#endif // !SHADER_PIPELINES_H
@@ -0,0 +1,234 @@
+#ifndef SHADER_PREPROCESSOR_H
+#define SHADER_PREPROCESSOR_H
+
+#include "ShaderSources.h"
+#include "ShaderArchive.h"
+
+#include <stdio.h>
+#include <ctype.h>
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Keyword/value pairs a shader variant is compiled with: ("TEXTURED", "") or ("MIX_WEIGHT", "0.6")
+typedef std::vector<std::pair<std::string, std::string>> ShaderDefines;
+
+/*	Turns one shader file into the text handed to glShaderSource:
+	- '#include "file"' is replaced by that file (path relative to the including file). Every file is pulled in once
+	  per shader, like #pragma once, and include cycles are an error
+	- the variant's defines go right after #version (GLSL wants #version first). Only the ones the expanded source
+	  mentions are emitted, so keywords a shader doesn't care about don't produce a different (duplicate) variant
+	- '#line' directives keep compiler errors pointing at the right line. The source string number in them is the
+	  file's index in the dependency list, 0 being the shader itself
+Files are read once per preprocessor and served from 'preloaded' first when it has them, then from the mounted
+ShaderArchive (generated files before all of them). 'useArchive' false skips the archive, for reading edits on disk. */
+class ShaderPreprocessor
+{
+public:
+	ShaderPreprocessor(const ShaderSources* preloaded = nullptr, bool useArchive = true)
+		: preloaded(preloaded), useArchive(useArchive)
+	{
+	}
+
+	// 'dependencies' gets every file the result was built from, the shader itself first.
+	// 'missing' gets the files that were needed (the shader or an #include) but could not be read
+	bool Process(const std::string& path, const ShaderDefines& defines, std::string& output, std::vector<std::string>* dependencies = nullptr,
+				 std::vector<std::string>* missing = nullptr)
+	{
+		std::vector<std::string> files, stack, unread;
+		std::string body;
+		bool success = Expand(path, files, stack, unread, body);
+		if (dependencies)
+			*dependencies = files;
+		if (missing)
+			*missing = unread;
+
+		// Defines go after the #version line; the '#line 2 0' puts numbering back to where it was
+		size_t insertAt = 0;
+		int versionLine = 0;
+		for (size_t lineStart = 0, line = 1; lineStart < body.size(); line++)
+		{
+			size_t lineEnd = body.find('\n', lineStart);
+			if (lineEnd == std::string::npos)
+				lineEnd = body.size();
+			if (StartsWithDirective(std::string_view(body).substr(lineStart, lineEnd - lineStart), "version"))
+			{
+				insertAt = std::min(lineEnd + 1, body.size());
+				versionLine = (int)line;
+				break;
+			}
+			lineStart = lineEnd + 1;
+		}
+		std::string defineBlock;
+		for (const auto& define : defines)
+		{
+			if (Mentions(body, define.first))
+				defineBlock += "#define " + define.first + (define.second.empty() ? "" : " " + define.second) + "\n";
+		}
+
+		output.clear();
+		output.reserve(body.size() + defineBlock.size() + 16);
+		output.append(body, 0, insertAt);
+		if (insertAt > 0 && output.back() != '\n')
+			output += '\n';
+		if (!defineBlock.empty())
+		{
+			output += defineBlock;
+			output += "#line " + std::to_string(versionLine + 1) + " 0\n";
+		}
+		output.append(body, insertAt, std::string::npos);
+		return success;
+	}
+
+	// Makes '#include' of 'path' (as it resolves, e.g. "Shaders/Include/UniformBlocks.glsl") produce 'text' instead of
+	// reading a file. For GLSL generated from C++ declarations, see UniformBuffers.h
+	static void AddGeneratedFile(const std::string& path, const std::string& text)
+	{
+		GeneratedFiles()[path] = text;
+	}
+
+	// Forgets the cached contents of 'path' (or of every file), so the next Process() reads it again.
+	// The preloaded batch is dropped as well, it would be just as stale
+	void Invalidate(const std::string& path)
+	{
+		fileCache.erase(path);
+		preloaded = nullptr;
+	}
+	void InvalidateAll()
+	{
+		fileCache.clear();
+		preloaded = nullptr;
+	}
+
+private:
+	const ShaderSources* preloaded;
+	bool useArchive;
+	std::unordered_map<std::string, std::string> fileCache;
+
+	static std::unordered_map<std::string, std::string>& GeneratedFiles()
+	{
+		static std::unordered_map<std::string, std::string> generated;
+		return generated;
+	}
+
+	bool Read(const std::string& path, std::string_view& source)
+	{
+		auto generated = GeneratedFiles().find(path);
+		if (generated != GeneratedFiles().end())
+		{
+			source = generated->second;
+			return true;
+		}
+		if (preloaded && preloaded->Contains(path))
+		{
+			source = preloaded->Get(path);
+			return true;
+		}
+		if (useArchive && ShaderArchive::Mounted().Find(path, source))
+			return true;
+		auto cached = fileCache.find(path);
+		if (cached == fileCache.end())
+		{
+			std::string code;
+			if (!ShaderSources::ReadFile(path.c_str(), code))
+				return false;
+			cached = fileCache.emplace(path, std::move(code)).first;
+		}
+		source = cached->second;
+		return true;
+	}
+
+	bool Expand(const std::string& path, std::vector<std::string>& files, std::vector<std::string>& stack, std::vector<std::string>& unread, std::string& output)
+	{
+		if (std::find(stack.begin(), stack.end(), path) != stack.end())
+		{
+			printf("ERROR::SHADER::INCLUDE_CYCLE %s\n", path.c_str());
+			return false;
+		}
+		if (std::find(files.begin(), files.end(), path) != files.end())
+			return true;													// Already part of this shader
+		std::string_view source;
+		if (!Read(path, source))
+		{
+			printf("ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ %s\n", path.c_str());
+			if (std::find(unread.begin(), unread.end(), path) == unread.end())
+				unread.push_back(path);
+			return false;
+		}
+		int fileIndex = (int)files.size();
+		files.push_back(path);
+		stack.push_back(path);
+
+		bool success = true;
+		int line = 1;
+		for (size_t lineStart = 0; lineStart < source.size(); line++)
+		{
+			size_t lineEnd = source.find('\n', lineStart);
+			if (lineEnd == std::string_view::npos)
+				lineEnd = source.size();
+			std::string_view text = source.substr(lineStart, lineEnd - lineStart);
+			lineStart = lineEnd + 1;
+
+			if (!StartsWithDirective(text, "include"))
+			{
+				output.append(text.data(), text.size());
+				output += '\n';
+				continue;
+			}
+			size_t open = text.find('"');
+			size_t close = open == std::string_view::npos ? open : text.find('"', open + 1);
+			if (close == std::string_view::npos)
+			{
+				printf("ERROR::SHADER::BAD_INCLUDE %s:%d\n", path.c_str(), line);
+				success = false;
+				output += '\n';
+				continue;
+			}
+			std::filesystem::path includePath = std::filesystem::path(path).parent_path() / std::string(text.substr(open + 1, close - open - 1));
+			std::string include = includePath.lexically_normal().generic_string();
+			output += "#line 1 " + std::to_string(files.size()) + "\n";
+			success = Expand(include, files, stack, unread, output) && success;
+			output += "#line " + std::to_string(line + 1) + " " + std::to_string(fileIndex) + "\n";
+		}
+		stack.pop_back();
+		return success;
+	}
+
+	// "  #  name ..." with any amount of blanks around the '#'
+	static bool StartsWithDirective(std::string_view line, std::string_view name)
+	{
+		size_t i = 0;
+		while (i < line.size() && (line[i] == ' ' || line[i] == '\t'))
+			i++;
+		if (i == line.size() || line[i] != '#')
+			return false;
+		i++;
+		while (i < line.size() && (line[i] == ' ' || line[i] == '\t'))
+			i++;
+		return line.substr(i, name.size()) == name && (i + name.size() == line.size() || !IsIdentifierChar(line[i + name.size()]));
+	}
+
+	// Whole-word occurrence of 'name' anywhere in 'text'
+	static bool Mentions(const std::string& text, const std::string& name)
+	{
+		for (size_t at = text.find(name); at != std::string::npos; at = text.find(name, at + 1))
+		{
+			bool startsWord = at == 0 || !IsIdentifierChar(text[at - 1]);
+			bool endsWord = at + name.size() == text.size() || !IsIdentifierChar(text[at + name.size()]);
+			if (startsWord && endsWord)
+				return true;
+		}
+		return false;
+	}
+
+	static bool IsIdentifierChar(char c)
+	{
+		return isalnum((unsigned char)c) || c == '_';
+	}
+};
+
+#endif // !SHADER_PREPROCESSOR_H
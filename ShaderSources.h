@@ -0,0 +1,191 @@
+#ifndef SHADER_SOURCES_H
+#define SHADER_SOURCES_H
+
+#include "ShaderArchive.h"
+
+#include <stdio.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/*	Shader sources read straight into one buffer sized for the whole batch: one allocation per batch and one read()
+per file, no stream or string copies in between. Get() hands out views into that buffer, which go to
+glShaderSource() as pointer + length. Every source is also NUL terminated, so a view's data() works as a C string.
+The views stay valid until the next Load()/LoadDirectory() or until the ShaderSources is destroyed.
+Files in the mounted ShaderArchive aren't read at all: their views point straight into the archive's mapping. */
+class ShaderSources
+{
+public:
+	// Replaces the current batch with 'paths'. Returns false if any file couldn't be read (the others are still loaded)
+	bool Load(const std::vector<std::string>& paths)
+	{
+		files.clear();
+		buffer.reset();
+
+		// Sizes first, so the whole batch fits in one allocation
+		std::vector<std::pair<const std::string*, size_t>> batch;
+		size_t total = 0;
+		bool allRead = true;
+		for (const std::string& path : paths)
+		{
+			if (files.count(path))
+				continue;
+			std::string_view packed;
+			if (ShaderArchive::Mounted().Find(path, packed))
+			{
+				files[path] = Span{ 0, packed.size(), packed.data() };
+				continue;
+			}
+			std::error_code error;
+			size_t size = (size_t)std::filesystem::file_size(path, error);
+			if (error)
+			{
+				printf("ERROR::SHADER_SOURCES::CANNOT_OPEN %s\n", path.c_str());
+				allRead = false;
+				continue;
+			}
+			files[path] = Span();
+			batch.emplace_back(&path, size);
+			total += size + 1;
+		}
+		buffer.reset(new char[total > 0 ? total : 1]);
+
+		size_t offset = 0;
+		for (const auto& file : batch)
+		{
+			size_t length = ReadInto(file.first->c_str(), buffer.get() + offset, file.second);
+			if (length == (size_t)-1)
+			{
+				printf("ERROR::SHADER_SOURCES::CANNOT_READ %s\n", file.first->c_str());
+				files.erase(*file.first);
+				allRead = false;
+				continue;
+			}
+			buffer[offset + length] = '\0';
+			files[*file.first] = Span{ offset, length };
+			offset += file.second + 1;
+		}
+		return allRead;
+	}
+
+	// Every shader file under 'directory' (recursively) in one batch, keyed as "<directory>/<relative path>"
+	bool LoadDirectory(const std::string& directory)
+	{
+		std::vector<std::string> paths;
+		std::error_code error;
+		for (std::filesystem::recursive_directory_iterator it(directory, error), end; !error && it != end; it.increment(error))
+		{
+			if (it->is_regular_file() && IsShaderFile(it->path()))
+				paths.push_back(it->path().generic_string());
+		}
+		if (error)
+		{
+			printf("ERROR::SHADER_SOURCES::CANNOT_LIST %s\n", directory.c_str());
+			return false;
+		}
+		return Load(paths);
+	}
+
+	// Source of a loaded file (empty if it isn't part of the batch). Paths have to be spelled as they were loaded
+	std::string_view Get(const std::string& path) const
+	{
+		auto found = files.find(path);
+		if (found == files.end())
+			return std::string_view();
+		const char* start = found->second.external ? found->second.external : buffer.get() + found->second.offset;
+		return std::string_view(start, found->second.length);
+	}
+	bool Contains(const std::string& path) const
+	{
+		return files.count(path) != 0;
+	}
+	size_t Count() const
+	{
+		return files.size();
+	}
+	std::vector<std::string> Paths() const
+	{
+		std::vector<std::string> paths;
+		for (const auto& file : files)
+			paths.push_back(file.first);
+		return paths;
+	}
+
+	static bool IsShaderFile(const std::filesystem::path& path)
+	{
+		static const char* const extensions[] = { ".vs", ".fs", ".gs", ".glsl", ".vert", ".frag", ".geom", ".comp" };
+		std::string extension = path.extension().string();
+		for (const char* known : extensions)
+		{
+			if (extension == known)
+				return true;
+		}
+		return false;
+	}
+
+	// Single file into 'code', sized once: for one-off reads that don't warrant a batch
+	static bool ReadFile(const char* path, std::string& code)
+	{
+		std::error_code error;
+		size_t size = (size_t)std::filesystem::file_size(path, error);
+		if (error)
+			return false;
+		code.resize(size);
+		size_t length = ReadInto(path, code.data(), size);
+		if (length == (size_t)-1)
+			return false;
+		code.resize(length);
+		return true;
+	}
+
+private:
+	struct Span
+	{
+		size_t offset = 0, length = 0;
+		const char* external = nullptr;									// Set for sources served from the ShaderArchive
+	};
+	std::unique_ptr<char[]> buffer;
+	std::unordered_map<std::string, Span> files;
+
+	// Reads up to 'size' bytes of 'path' into 'destination'. Returns the number of bytes read, (size_t)-1 on failure
+	static size_t ReadInto(const char* path, char* destination, size_t size)
+	{
+#ifdef _WIN32
+		FILE* file = fopen(path, "rb");
+		if (!file)
+			return (size_t)-1;
+		size_t length = fread(destination, 1, size, file);
+		bool failed = ferror(file) != 0;
+		fclose(file);
+		return failed ? (size_t)-1 : length;
+#else
+		int file = open(path, O_RDONLY);
+		if (file < 0)
+			return (size_t)-1;
+		size_t length = 0;
+		while (length < size)											// read() may return less than asked for, so loop until the file is in
+		{
+			ssize_t count = read(file, destination + length, size - length);
+			if (count < 0)
+			{
+				close(file);
+				return (size_t)-1;
+			}
+			if (count == 0)
+				break;													// File shrank since it was measured
+			length += (size_t)count;
+		}
+		close(file);
+		return length;
+#endif
+	}
+};
+
+#endif // !SHADER_SOURCES_H
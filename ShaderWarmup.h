@@ -0,0 +1,111 @@
+#ifndef SHADER_WARMUP_H
+#define SHADER_WARMUP_H
+
+#include "my_glad.h"
+
+#include "Framebuffer.h"
+#include "GLStateCache.h"
+#include "Timeline.h"
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*	Draws every program/vertex array/texture combination once into a tiny offscreen target before the render loop
+needs it. Linking is not the end of shader compilation on many drivers: the machine code is generated (or
+specialized for the bound texture formats, vertex layout and render target) at the first draw that uses the
+program, which then shows up as a spike in the first frame that draws with it. Run() pays for that up front, with
+one "Shader warm-up" entry per draw in the start-up timeline.
+
+A draw is either a plain combination (AddDraw) or any callable that sets its own state and draws (Add), e.g. the
+real render function, which covers exactly the state the frame will use. */
+class ShaderWarmup
+{
+public:
+	// One texture binding of a warm-up draw (the format of the texture is what matters to the driver)
+	struct Texture
+	{
+		unsigned int unit;
+		GLenum target;
+		unsigned int texture;
+	};
+
+	void Add(const std::string& name, std::function<void()> draw)
+	{
+		draws.emplace_back(name, draw);
+	}
+
+	// Draws 'count' vertices (indexed when 'indexType' isn't 0) with the program, vertex array and textures
+	void AddDraw(const std::string& name, unsigned int program, unsigned int vertexArray, const std::vector<Texture>& textures, GLenum mode, int count, GLenum indexType = 0)
+	{
+		Add(name, [this, program, vertexArray, textures, mode, count, indexType]()
+		{
+			for (const Texture& texture : textures)
+			{
+				if (state)
+					state->BindTextureUnit(texture.unit, texture.target, texture.texture);
+				else
+				{
+					glActiveTexture(GL_TEXTURE0 + texture.unit);
+					glBindTexture(texture.target, texture.texture);
+				}
+			}
+			if (state)
+			{
+				state->UseProgram(program);
+				state->BindVertexArray(vertexArray);
+			}
+			else
+			{
+				glUseProgram(program);
+				glBindVertexArray(vertexArray);
+			}
+			if (indexType)
+				glDrawElements(mode, count, indexType, 0);
+			else
+				glDrawArrays(mode, 0, count);
+		});
+	}
+
+	// Binds go through 'stateCache' when there is one (the warm-up draws then leave it up to date)
+	void SetStateCache(GLStateCache* stateCache)
+	{
+		state = stateCache;
+	}
+
+	// Runs every draw added so far into a size x size RGBA8 target and waits for the GPU, so nothing is left for the
+	// first real frame. The framebuffer and viewport bound before are restored. Returns the time it took in ms
+	double Run(unsigned int size = 8)
+	{
+		if (draws.empty())
+			return 0.0;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		int previousFramebuffer = 0, previousViewport[4];
+		glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousFramebuffer);
+		glGetIntegerv(GL_VIEWPORT, previousViewport);
+
+		Framebuffer target;
+		if (!target.Create(size, size))
+			return 0.0;
+		target.Bind();
+		for (const auto& draw : draws)
+		{
+			TimelineScope phase("Shader warm-up", draw.first.c_str());
+			draw.second();
+			glFinish();														// Draws (and the code generation behind them) really done
+		}
+		draws.clear();
+
+		glBindFramebuffer(GL_FRAMEBUFFER, previousFramebuffer);
+		glViewport(previousViewport[0], previousViewport[1], previousViewport[2], previousViewport[3]);
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+private:
+	std::vector<std::pair<std::string, std::function<void()>>> draws;
+	GLStateCache* state = nullptr;
+};
+
+#endif // !SHADER_WARMUP_H
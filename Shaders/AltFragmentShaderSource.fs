@@ -1,7 +0,0 @@
-#version 330 core
-out vec4 FragColor;
-uniform vec4 ourColor;
-void main()
-{
-	FragColor = ourColor;
-}
\ No newline at end of file
@@ -0,0 +1,4 @@
+// Default values of the specialization constants. A variant overrides one by passing it as a define
+#ifndef MIX_WEIGHT
+#define MIX_WEIGHT 0.6
+#endif
@@ -0,0 +1,43 @@
+#version 330 core
+// Variants: TEXTURED mixes texture2 over texture1 by MIX_WEIGHT, UNIFORM_COLOR draws the 'ourColor' uniform,
+// neither draws the vertex colors. UNIFORM_BLOCKS multiplies the result by MaterialBlock's tint, INSTANCED by the
+// instance's
+#include "Include/Defaults.glsl"
+#ifdef UNIFORM_BLOCKS
+#include "Include/UniformBlocks.glsl"
+#endif
+out vec4 FragColor;
+
+#ifdef UNIFORM_COLOR
+uniform vec4 ourColor;
+#else
+in vec3 ourColor;
+#endif
+#ifdef INSTANCED
+in vec4 InstanceTint;
+#endif
+#ifdef TEXTURED
+in vec2 TexCoord;
+
+uniform sampler2D texture1;
+uniform sampler2D texture2;
+#endif
+
+void main()
+{
+#if defined(TEXTURED)
+    vec4 base = texture(texture1, TexCoord);
+    vec4 overlay = texture(texture2, TexCoord);
+    FragColor = mix(base, overlay, overlay.a * MIX_WEIGHT);
+#elif defined(UNIFORM_COLOR)
+    FragColor = ourColor;
+#else
+    FragColor = vec4(ourColor, 1.0);
+#endif
+#ifdef UNIFORM_BLOCKS
+    FragColor *= tint;
+#endif
+#ifdef INSTANCED
+    FragColor *= InstanceTint;
+#endif
+}
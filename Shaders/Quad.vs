@@ -0,0 +1,46 @@
+#version 330 core
+// Variants: TEXTURED adds texture coordinates (attribute 2), UNIFORM_BLOCKS places the quad with ObjectBlock,
+// INSTANCED draws a copy per instance placed, cropped and tinted by the QuadInstance attributes (3 to 5)
+#ifdef UNIFORM_BLOCKS
+#include "Include/UniformBlocks.glsl"
+#endif
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+#ifdef TEXTURED
+layout (location = 2) in vec2 aTexCoord;
+#endif
+#ifdef INSTANCED
+layout (location = 3) in vec4 aOffsetScale;		// xy offset, zw scale
+layout (location = 4) in vec4 aUVRect;			// xy corner, zw size of the texture area shown
+layout (location = 5) in vec4 aTint;
+#endif
+
+out vec3 ourColor;
+#ifdef TEXTURED
+out vec2 TexCoord;
+#endif
+#ifdef INSTANCED
+out vec4 InstanceTint;
+#endif
+
+void main()
+{
+    vec3 position = aPos;
+#ifdef INSTANCED
+    position.xy = position.xy * aOffsetScale.zw + aOffsetScale.xy;
+    InstanceTint = aTint;
+#endif
+#ifdef UNIFORM_BLOCKS
+    gl_Position = vec4(position.xy * offsetScale.zw + offsetScale.xy, position.z, 1.0);
+#else
+    gl_Position = vec4(position, 1.0);
+#endif
+    ourColor = aColor;
+#ifdef TEXTURED
+#ifdef INSTANCED
+    TexCoord = aUVRect.xy + aTexCoord * aUVRect.zw;
+#else
+    TexCoord = aTexCoord;
+#endif
+#endif
+}
@@ -0,0 +1,185 @@
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#include "my_glad.h"
+
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+
+/*	A buffer for data written anew every frame (sprites, particles, per-frame uniform blocks), split into one region
+per frame in flight. The CPU writes the current region straight into mapped memory while the GPU may still be
+reading the previous ones; a fence placed after each frame's commands tells when a region can be written again, so
+there's no per-frame allocation and no implicit synchronization inside glBufferSubData/glMapBuffer.
+	- GL 4.4 / ARB_buffer_storage: the whole buffer is created with glBufferStorage and mapped once, persistent and
+	  coherent, for its whole lifetime
+	- otherwise (GL 3.3): each frame maps its region with glMapBufferRange(UNSYNCHRONIZED | INVALIDATE_RANGE |
+	  FLUSH_EXPLICIT) and Commit() flushes and unmaps it
+A frame: BeginFrame(), any number of Allocate() to write into, Commit() before the draws that read it. Mapping goes
+through GL_COPY_WRITE_BUFFER, so the array/element/uniform bindings (and a GLStateCache) are never disturbed. */
+class StreamBuffer
+{
+public:
+	StreamBuffer() = default;
+	~StreamBuffer()
+	{
+		for (GLsync& fence : fences)
+		{
+			if (fence)
+				glDeleteSync(fence);
+		}
+		if (buffer)
+		{
+			if (mapped)
+			{
+				glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+				glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+			}
+			glDeleteBuffers(1, &buffer);
+		}
+	}
+	StreamBuffer(const StreamBuffer&) = delete;
+	StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+	// True when the current context can map a buffer persistently
+	static bool PersistentSupported()
+	{
+		return gladHasGLFunction("glBufferStorage") && (gladIsGLVersionAtLeast(4, 4) || gladHasExtension("GL_ARB_buffer_storage"));
+	}
+
+	// 'allowPersistent' false forces the GL 3.3 path (for comparing the two)
+	bool Create(unsigned int bytesPerFrame, unsigned int framesInFlight = 3, bool allowPersistent = true)
+	{
+		regionSize = bytesPerFrame;
+		regionCount = framesInFlight > 0 ? framesInFlight : 1;
+		fences.assign(regionCount, nullptr);
+		persistent = allowPersistent && PersistentSupported();
+		GLsizeiptr size = (GLsizeiptr)regionSize * regionCount;
+
+		glGenBuffers(1, &buffer);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		if (persistent)
+		{
+			const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glBufferStorage(GL_COPY_WRITE_BUFFER, size, nullptr, flags);
+			mapped = (unsigned char*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags);
+			if (!mapped)
+			{
+				printf("ERROR::STREAM_BUFFER::CANNOT_MAP %u bytes\n", (unsigned int)size);
+				return false;
+			}
+		}
+		else
+			glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, GL_STREAM_DRAW);
+		region = regionCount - 1;										// The first BeginFrame() starts at region 0
+		return buffer != 0;
+	}
+
+	// Fences the frame before (it has been submitted by now) and moves to the next region, waiting for the GPU to be
+	// done with it if it isn't yet
+	void BeginFrame()
+	{
+		if (frames > 0)
+		{
+			Commit();
+			fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		}
+		region = (region + 1) % regionCount;
+		used = 0;
+		frames++;
+		overflowReported = false;
+
+		if (GLsync fence = fences[region])
+		{
+			if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED)	// Only costs anything if the GPU is framesInFlight behind
+			{
+				std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+				while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED)
+					;
+				waits++;
+				waitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			}
+			glDeleteSync(fence);
+			fences[region] = nullptr;
+		}
+		if (!persistent)
+		{
+			glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+			const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT;
+			mapped = (unsigned char*)glMapBufferRange(GL_COPY_WRITE_BUFFER, (GLintptr)region * regionSize, regionSize, flags);
+		}
+	}
+
+	// 'size' bytes of this frame's region to write, at a multiple of 'alignment' from the start of the buffer (which is
+	// returned in 'offset', for glBindBufferRange or attribute pointers). nullptr once the region is full or after Commit()
+	void* Allocate(unsigned int size, unsigned int alignment, unsigned int& offset)
+	{
+		alignment = alignment > 0 ? alignment : 1;
+		unsigned int start = regionBase() + used;
+		start = (start + alignment - 1) / alignment * alignment;
+		if (!mapped || start + size > regionBase() + regionSize)
+		{
+			if (!overflowReported)
+				printf("ERROR::STREAM_BUFFER::REGION_FULL %u bytes per frame\n", regionSize);
+			overflowReported = true;
+			return nullptr;
+		}
+		used = start + size - regionBase();
+		offset = start;
+		bytesWritten += size;
+		return persistent ? mapped + start : mapped + (start - regionBase());
+	}
+
+	// Makes what was written visible to the draws that follow. Nothing to do for a coherent persistent mapping
+	void Commit()
+	{
+		if (persistent || !mapped)
+			return;
+		glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		if (used > 0)
+			glFlushMappedBufferRange(GL_COPY_WRITE_BUFFER, 0, used);
+		glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+		mapped = nullptr;
+	}
+
+	unsigned int ID() const
+	{
+		return buffer;
+	}
+	bool Persistent() const
+	{
+		return persistent;
+	}
+	unsigned int BytesUsed() const
+	{
+		return used;
+	}
+	int FrameCount() const
+	{
+		return frames;
+	}
+
+	void PrintStats(const char* name) const
+	{
+		printf("Stream buffer %s: %s, %u x %u bytes, %d frames, %.1f KB written, waited on the GPU %d times (%.2f ms)\n", name,
+			persistent ? "persistent mapping" : "unsynchronized map per frame", regionCount, regionSize, frames, bytesWritten / 1024.0, waits, waitMs);
+	}
+
+private:
+	unsigned int buffer = 0;
+	unsigned int regionSize = 0, regionCount = 0;
+	unsigned int region = 0, used = 0;
+	bool persistent = false, overflowReported = false;
+	unsigned char* mapped = nullptr;									// Whole buffer (persistent) or the current region (per frame)
+	std::vector<GLsync> fences;											// Per region, set once the frame that wrote it is submitted
+	int frames = 0, waits = 0;
+	double waitMs = 0.0;
+	double bytesWritten = 0.0;
+
+	unsigned int regionBase() const
+	{
+		return region * regionSize;
+	}
+};
+
+#endif // !STREAM_BUFFER_H
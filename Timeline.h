@@ -0,0 +1,128 @@
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*	Records named phases (start-up steps mostly) with their start time and duration and writes them out in the
+Chrome trace-event format, which chrome://tracing and https://ui.perfetto.dev open directly.
+Time 0 is the first call to Timeline::Get(), so main() calls it before doing anything else.
+Safe to record from several threads; each thread gets its own row in the trace. */
+class Timeline
+{
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	struct Event
+	{
+		std::string name;
+		std::string detail;
+		double startUs, durationUs;
+		int thread;
+	};
+
+	static Timeline& Get()
+	{
+		static Timeline instance;
+		return instance;
+	}
+
+	void Record(const char* name, const char* detail, Clock::time_point start, Clock::time_point end)
+	{
+		Event event;
+		event.name = name;
+		event.detail = detail ? detail : "";
+		event.startUs = std::chrono::duration<double, std::micro>(start - origin).count();
+		event.durationUs = std::chrono::duration<double, std::micro>(end - start).count();
+		event.thread = ThreadIndex();
+		std::lock_guard<std::mutex> lock(mutex);
+		events.push_back(event);
+	}
+
+	std::vector<Event> Events()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		return events;
+	}
+
+	// One event per line, so simple tools (Benchmarks/StartupHarness) can read it back without a JSON parser
+	bool WriteChromeTrace(const char* path)
+	{
+		FILE* file = fopen(path, "wb");
+		if (!file)
+		{
+			printf("ERROR::TIMELINE::CANNOT_WRITE %s\n", path);
+			return false;
+		}
+		std::vector<Event> snapshot = Events();
+		fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+		for (size_t i = 0; i < snapshot.size(); i++)
+		{
+			const Event& event = snapshot[i];
+			fprintf(file, "{\"name\": \"%s\", \"cat\": \"startup\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": 1, \"tid\": %d, \"args\": {\"detail\": \"%s\"}}%s\n",
+				Escape(event.name).c_str(), event.startUs, event.durationUs, event.thread, Escape(event.detail).c_str(), i + 1 < snapshot.size() ? "," : "");
+		}
+		fprintf(file, "]}\n");
+		fclose(file);
+		return true;
+	}
+
+private:
+	Clock::time_point origin = Clock::now();
+	std::mutex mutex;
+	std::vector<Event> events;
+
+	static int ThreadIndex()
+	{
+		static std::atomic<int> nextThread{ 0 };
+		thread_local int thread = nextThread++;
+		return thread;
+	}
+
+	static std::string Escape(const std::string& text)
+	{
+		std::string escaped;
+		for (char c : text)
+		{
+			if (c == '"' || c == '\\')
+				escaped += '\\';
+			escaped += c;
+		}
+		return escaped;
+	}
+};
+
+// Records the enclosing scope as one phase. A null name records nothing, which keeps conditional phases (first frame only) simple
+class TimelineScope
+{
+public:
+	TimelineScope(const char* name, const char* detail = nullptr)
+		: name(name), detail(detail), start(Timeline::Clock::now())
+	{
+	}
+	~TimelineScope()
+	{
+		End();
+	}
+
+	// Ends the phase before the scope does
+	void End()
+	{
+		if (name)
+			Timeline::Get().Record(name, detail, start, Timeline::Clock::now());
+		name = nullptr;
+	}
+	TimelineScope(const TimelineScope&) = delete;
+	TimelineScope& operator=(const TimelineScope&) = delete;
+
+private:
+	const char* name;
+	const char* detail;
+	Timeline::Clock::time_point start;
+};
+
+#endif // !TIMELINE_H
@@ -0,0 +1,232 @@
+#ifndef UNIFORM_BUFFERS_H
+#define UNIFORM_BUFFERS_H
+
+#include "my_glad.h"
+
+#include "ShaderPreprocessor.h"
+#include "GLStateCache.h"
+#include "StreamBuffer.h"
+
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*	Uniform buffer objects (UBOs) with std140 layout. A block is declared once in C++ as a list of fields and both the
+C++ struct and the GLSL declaration are generated from that list, so they can't drift apart:
+
+	#define MY_BLOCK_FIELDS(FIELD) FIELD(vec4, color) FIELD(float, weight)
+	DECLARE_STD140_BLOCK(MyBlock, 3, MY_BLOCK_FIELDS)		// Binding point 3
+
+MyBlock is then a plain struct to fill in, MyBlock::Glsl() the matching 'layout(std140) uniform MyBlock { ... };'
+and UniformBuffers::Validate<MyBlock>() checks a linked program's block against the struct.
+Field types are the GLSL names: float, int, vec2, vec4, ivec4, mat4. vec3 and arrays are left out on purpose: std140
+pads them in ways a C++ struct doesn't (use vec4 instead). */
+
+// ---------- std140 types ----------
+namespace std140
+{
+	struct alignas(8) vec2 { float x, y; };
+	struct alignas(16) vec4 { float x, y, z, w; };
+	struct alignas(16) ivec4 { int x, y, z, w; };
+	struct alignas(16) mat4 { vec4 columns[4]; };						// Column major, like GLSL
+}
+
+#define STD140_MEMBER(type, name) type name;
+#define STD140_GLSL_MEMBER(type, name) "\t" #type " " #name ";\n"
+#define STD140_OFFSET(type, name) offsets.emplace_back(#name, offsetof(Self, name));
+
+#define DECLARE_STD140_BLOCK(Name, Binding, FIELDS)																\
+	namespace std140																							\
+	{																											\
+		struct alignas(16) Name																					\
+		{																										\
+			FIELDS(STD140_MEMBER)																				\
+			static const unsigned int BINDING = Binding;														\
+			static const char* BlockName() { return #Name; }													\
+			static const char* Glsl() { return "layout(std140) uniform " #Name "\n{\n" FIELDS(STD140_GLSL_MEMBER) "};\n"; }	\
+			static std::vector<std::pair<const char*, size_t>> Offsets()										\
+			{																									\
+				typedef Name Self;																				\
+				std::vector<std::pair<const char*, size_t>> offsets;											\
+				FIELDS(STD140_OFFSET)																			\
+				return offsets;																					\
+			}																									\
+		};																										\
+	}																											\
+	typedef std140::Name Name;
+
+// ---------- Blocks used by Shaders/Quad.* (through Shaders/Include/UniformBlocks.glsl) ----------
+#define FRAME_BLOCK_FIELDS(FIELD)		\
+	FIELD(vec4, viewport)				/* x, y, width, height */		\
+	FIELD(float, time)					/* Seconds since start */		\
+	FIELD(int, frame)
+#define MATERIAL_BLOCK_FIELDS(FIELD)	\
+	FIELD(vec4, tint)					/* Multiplies the output color */
+#define OBJECT_BLOCK_FIELDS(FIELD)		\
+	FIELD(vec4, offsetScale)			/* xy: offset, zw: scale, applied to aPos.xy */
+
+DECLARE_STD140_BLOCK(FrameBlock, 0, FRAME_BLOCK_FIELDS)
+DECLARE_STD140_BLOCK(MaterialBlock, 1, MATERIAL_BLOCK_FIELDS)
+DECLARE_STD140_BLOCK(ObjectBlock, 2, OBJECT_BLOCK_FIELDS)
+
+namespace UniformBuffers
+{
+	// Makes '#include "Include/UniformBlocks.glsl"' from a shader in Shaders/ resolve to the generated declarations.
+	// Has to run before the first shader using them is built
+	inline void RegisterBlocks()
+	{
+		std::string glsl = "// Generated from the declarations in UniformBuffers.h\n";
+		glsl += FrameBlock::Glsl();
+		glsl += MaterialBlock::Glsl();
+		glsl += ObjectBlock::Glsl();
+		ShaderPreprocessor::AddGeneratedFile("Shaders/Include/UniformBlocks.glsl", glsl);
+	}
+
+	// Points 'program's block T (if it has one) at T's binding point. GL 3.3 has no layout(binding = N) for blocks,
+	// so this is done once per program after linking
+	template <typename T>
+	void BindBlock(unsigned int program)
+	{
+		unsigned int blockIndex = glGetUniformBlockIndex(program, T::BlockName());
+		if (blockIndex != GL_INVALID_INDEX)
+			glUniformBlockBinding(program, blockIndex, T::BINDING);
+	}
+	inline void BindBlocks(unsigned int program)
+	{
+		BindBlock<FrameBlock>(program);
+		BindBlock<MaterialBlock>(program);
+		BindBlock<ObjectBlock>(program);
+	}
+
+	// Compares the offsets GL gives the members of 'program's block T with the C++ struct.
+	// Members the compiler removed (unused) are skipped. True if they all match (or the program has no such block)
+	template <typename T>
+	bool Validate(unsigned int program)
+	{
+		unsigned int blockIndex = glGetUniformBlockIndex(program, T::BlockName());
+		if (blockIndex == GL_INVALID_INDEX)
+			return true;
+		bool valid = true;
+		int dataSize = 0;
+		glGetActiveUniformBlockiv(program, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &dataSize);
+		if (dataSize > (int)sizeof(T))
+		{
+			printf("ERROR::UBO::BLOCK_SIZE_MISMATCH %s: GL %d bytes, C++ %d bytes\n", T::BlockName(), dataSize, (int)sizeof(T));
+			valid = false;
+		}
+		for (const auto& member : T::Offsets())
+		{
+			const char* name = member.first;
+			unsigned int index = GL_INVALID_INDEX;
+			glGetUniformIndices(program, 1, &name, &index);
+			if (index == GL_INVALID_INDEX)
+				continue;
+			int offset = -1;
+			glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_OFFSET, &offset);
+			if (offset != (int)member.second)
+			{
+				printf("ERROR::UBO::OFFSET_MISMATCH %s.%s: GL %d, C++ %d\n", T::BlockName(), name, offset, (int)member.second);
+				valid = false;
+			}
+		}
+		return valid;
+	}
+	inline bool ValidateBlocks(unsigned int program)
+	{
+		bool frame = Validate<FrameBlock>(program);
+		bool material = Validate<MaterialBlock>(program);
+		bool object = Validate<ObjectBlock>(program);
+		return frame && material && object;
+	}
+}
+
+// Where a block ended up in the ring: pass it to UniformRing::Bind()
+struct UniformRange
+{
+	unsigned int offset = 0, size = 0;
+};
+
+/*	One uniform buffer split into a region per frame in flight (a StreamBuffer). Blocks for the frame (per-frame,
+per-material and per-object alike) are written straight into the mapped region, Upload() makes them visible, and
+each draw then just binds its range with glBindBufferRange. A fence per region keeps the CPU from overwriting
+blocks the GPU may still be reading, without the implicit wait a glBufferSubData into a busy buffer can cost. */
+class UniformRing
+{
+public:
+	bool Create(unsigned int bytesPerFrame, unsigned int framesInFlight = 3, bool allowPersistent = true)
+	{
+		int alignment = 0;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		offsetAlignment = alignment > 0 ? (unsigned int)alignment : 256;
+		regionSize = Align(bytesPerFrame);
+		return stream.Create(regionSize, framesInFlight, allowPersistent);
+	}
+
+	void BeginFrame()
+	{
+		stream.BeginFrame();
+	}
+
+	// Copies 'block' into this frame's region. Returns an empty range once the region is full
+	template <typename T>
+	UniformRange Push(const T& block)
+	{
+		UniformRange range;
+		void* target = stream.Allocate((unsigned int)sizeof(T), offsetAlignment, range.offset);
+		if (!target)
+			return range;
+		memcpy(target, &block, sizeof(T));
+		range.size = (unsigned int)sizeof(T);
+		return range;
+	}
+
+	// Makes everything pushed since BeginFrame() visible. Call before the draws that bind the ranges
+	void Upload()
+	{
+		stream.Commit();
+	}
+
+	void Bind(unsigned int bindingPoint, UniformRange range, GLStateCache* state = nullptr) const
+	{
+		if (range.size == 0)
+			return;
+		if (state)
+			state->BindBufferRange(GL_UNIFORM_BUFFER, bindingPoint, stream.ID(), range.offset, range.size);
+		else
+			glBindBufferRange(GL_UNIFORM_BUFFER, bindingPoint, stream.ID(), range.offset, range.size);
+	}
+	template <typename T>
+	void Bind(UniformRange range, GLStateCache* state = nullptr) const
+	{
+		Bind(T::BINDING, range, state);
+	}
+
+	unsigned int BytesUsed() const
+	{
+		return stream.BytesUsed();
+	}
+	// Number of BeginFrame() calls so far
+	int FrameCount() const
+	{
+		return stream.FrameCount();
+	}
+	void PrintStats() const
+	{
+		stream.PrintStats("uniforms");
+	}
+
+private:
+	StreamBuffer stream;
+	unsigned int offsetAlignment = 256;									// glBindBufferRange offsets have to be multiples of this
+	unsigned int regionSize = 0;
+
+	unsigned int Align(unsigned int bytes) const
+	{
+		return (bytes + offsetAlignment - 1) / offsetAlignment * offsetAlignment;
+	}
+};
+
+#endif // !UNIFORM_BUFFERS_H
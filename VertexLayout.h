@@ -0,0 +1,315 @@
+#ifndef VERTEX_LAYOUT_H
+#define VERTEX_LAYOUT_H
+
+#include "my_glad.h"
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/*	Vertex formats declared once in C++ as a list of attributes. The struct, the glVertexAttribPointer setup and the
+check against a linked program are all generated from that list, so strides and offsets are never written by hand:
+
+	#define MY_VERTEX_ATTRIBUTES(ATTRIBUTE) ATTRIBUTE(0, vec3, aPos) ATTRIBUTE(1, vec2, aTexCoord)
+	DECLARE_VERTEX_FORMAT(MyVertex, MY_VERTEX_ATTRIBUTES)		// Locations 0 and 1, named like the shader inputs
+
+MyVertex is then a plain struct to fill vertex arrays with, VertexLayout::Apply<MyVertex>() sets up the bound VAO
+for the bound GL_ARRAY_BUFFER and VertexLayout::Validate<MyVertex>() checks a linked program's active attributes
+against it. Per-instance data is declared the same way (at locations after the vertex's) and applied with a divisor.
+Attribute types are in the vertex namespace below; VertexAttributeType<T> tells GL how to read each.
+
+Packed types (half floats, normalized 8/16-bit integers) read as the same GLSL types as the float ones, so a
+compressed copy of a format only differs in the types of its list and works with the same shaders.
+VertexLayout::Compress() converts vertices between two formats with the same attribute names and checks the
+quantization error against a bound. */
+
+// ---------- Attribute types ----------
+namespace vertex
+{
+	struct vec2 { float x, y; };
+	struct vec3 { float x, y, z; };
+	struct vec4 { float x, y, z, w; };
+
+	// Packed types. 3-component ones are padded to 4, so the attribute after them stays 4-byte aligned
+	struct half2 { uint16_t x, y; };
+	struct half3 { uint16_t x, y, z, padding; };
+	struct half4 { uint16_t x, y, z, w; };
+	struct unorm8x3 { uint8_t x, y, z, padding; };						// [0, 1] in steps of 1/255
+	struct unorm8x4 { uint8_t x, y, z, w; };
+	struct unorm16x2 { uint16_t x, y; };								// [0, 1] in steps of 1/65535
+
+	// IEEE 754 binary16, rounded to nearest even. Out of range values become infinity
+	inline uint16_t FloatToHalf(float value)
+	{
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		uint32_t sign = (bits >> 16) & 0x8000;
+		uint32_t mantissa = bits & 0x7FFFFF;
+		int exponent = (int)((bits >> 23) & 0xFF);
+		if (exponent == 0xFF)
+			return (uint16_t)(sign | 0x7C00 | (mantissa ? 0x200 : 0));	// Infinity, NaN
+		exponent += 15 - 127;
+		if (exponent >= 31)
+			return (uint16_t)(sign | 0x7C00);
+		uint32_t half, rest, halfway;
+		if (exponent <= 0)
+		{
+			if (exponent < -10)
+				return (uint16_t)sign;										// Below half the smallest subnormal
+			int shift = 14 - exponent;										// Subnormal: implicit 1 becomes explicit
+			mantissa |= 0x800000;
+			half = mantissa >> shift;
+			rest = mantissa & ((1u << shift) - 1);
+			halfway = 1u << (shift - 1);
+		}
+		else
+		{
+			half = ((uint32_t)exponent << 10) | (mantissa >> 13);
+			rest = mantissa & 0x1FFF;
+			halfway = 0x1000;
+		}
+		if (rest > halfway || (rest == halfway && (half & 1)))
+			half++;															// A carry into the exponent is still the right result
+		return (uint16_t)(sign | half);
+	}
+	inline float HalfToFloat(uint16_t half)
+	{
+		uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+		uint32_t exponent = (half >> 10) & 0x1F, mantissa = half & 0x3FF;
+		if (exponent == 0)
+			return (sign ? -1.0f : 1.0f) * ldexpf((float)mantissa, -24);
+		uint32_t bits = sign | (exponent == 31 ? 0x7F800000 | (mantissa << 13) : ((exponent + 112) << 23) | (mantissa << 13));
+		float value;
+		memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	// Each Encode() converts one attribute and returns the largest error of its components after decoding
+	inline float EncodeHalf(float value, uint16_t& half)
+	{
+		half = FloatToHalf(value);
+		return fabsf(HalfToFloat(half) - value);
+	}
+	template <typename T>
+	float EncodeUnorm(float value, T& unorm)
+	{
+		const float scale = (float)(T)~(T)0;
+		unorm = (T)lroundf(std::min(std::max(value, 0.0f), 1.0f) * scale);
+		return fabsf(unorm / scale - value);								// Includes what clamping cut off
+	}
+
+	inline float Encode(const vec2& value, vec2& out) { out = value; return 0.0f; }
+	inline float Encode(const vec3& value, vec3& out) { out = value; return 0.0f; }
+	inline float Encode(const vec4& value, vec4& out) { out = value; return 0.0f; }
+	inline float Encode(const vec2& value, half2& out)
+	{
+		return std::max(EncodeHalf(value.x, out.x), EncodeHalf(value.y, out.y));
+	}
+	inline float Encode(const vec3& value, half3& out)
+	{
+		out.padding = 0;
+		return std::max({ EncodeHalf(value.x, out.x), EncodeHalf(value.y, out.y), EncodeHalf(value.z, out.z) });
+	}
+	inline float Encode(const vec4& value, half4& out)
+	{
+		return std::max({ EncodeHalf(value.x, out.x), EncodeHalf(value.y, out.y), EncodeHalf(value.z, out.z), EncodeHalf(value.w, out.w) });
+	}
+	inline float Encode(const vec3& value, unorm8x3& out)
+	{
+		out.padding = 0;
+		return std::max({ EncodeUnorm(value.x, out.x), EncodeUnorm(value.y, out.y), EncodeUnorm(value.z, out.z) });
+	}
+	inline float Encode(const vec4& value, unorm8x4& out)
+	{
+		return std::max({ EncodeUnorm(value.x, out.x), EncodeUnorm(value.y, out.y), EncodeUnorm(value.z, out.z), EncodeUnorm(value.w, out.w) });
+	}
+	inline float Encode(const vec2& value, unorm16x2& out)
+	{
+		return std::max(EncodeUnorm(value.x, out.x), EncodeUnorm(value.y, out.y));
+	}
+}
+
+// How GL reads an attribute of type T: component count and type, whether it's normalized (or read as integer) and the
+// GLSL type the shader input has to be declared with
+template <typename T> struct VertexAttributeType;
+template <> struct VertexAttributeType<vertex::vec2> { enum { COMPONENTS = 2, TYPE = GL_FLOAT, NORMALIZED = GL_FALSE, INTEGER = 0, GLSL_TYPE = GL_FLOAT_VEC2 }; };
+template <> struct VertexAttributeType<vertex::vec3> { enum { COMPONENTS = 3, TYPE = GL_FLOAT, NORMALIZED = GL_FALSE, INTEGER = 0, GLSL_TYPE = GL_FLOAT_VEC3 }; };
+template <> struct VertexAttributeType<vertex::vec4> { enum { COMPONENTS = 4, TYPE = GL_FLOAT, NORMALIZED = GL_FALSE, INTEGER = 0, GLSL_TYPE = GL_FLOAT_VEC4 }; };
+template <> struct VertexAttributeType<vertex::half2> { enum { COMPONENTS = 2, TYPE = GL_HALF_FLOAT, NORMALIZED = GL_FALSE, INTEGER = 0, GLSL_TYPE = GL_FLOAT_VEC2 }; };
+template <> struct VertexAttributeType<vertex::half3> { enum { COMPONENTS = 3, TYPE = GL_HALF_FLOAT, NORMALIZED = GL_FALSE, INTEGER = 0, GLSL_TYPE = GL_FLOAT_VEC3 }; };
+template <> struct VertexAttributeType<vertex::half4> { enum { COMPONENTS = 4, TYPE = GL_HALF_FLOAT, NORMALIZED = GL_FALSE, INTEGER = 0, GLSL_TYPE = GL_FLOAT_VEC4 }; };
+template <> struct VertexAttributeType<vertex::unorm8x3> { enum { COMPONENTS = 3, TYPE = GL_UNSIGNED_BYTE, NORMALIZED = GL_TRUE, INTEGER = 0, GLSL_TYPE = GL_FLOAT_VEC3 }; };
+template <> struct VertexAttributeType<vertex::unorm8x4> { enum { COMPONENTS = 4, TYPE = GL_UNSIGNED_BYTE, NORMALIZED = GL_TRUE, INTEGER = 0, GLSL_TYPE = GL_FLOAT_VEC4 }; };
+template <> struct VertexAttributeType<vertex::unorm16x2> { enum { COMPONENTS = 2, TYPE = GL_UNSIGNED_SHORT, NORMALIZED = GL_TRUE, INTEGER = 0, GLSL_TYPE = GL_FLOAT_VEC2 }; };
+
+// One attribute of a format, as VertexLayout passes it to GL
+struct VertexAttribute
+{
+	unsigned int location;
+	const char* name;
+	int components;
+	unsigned int type;								// Component type in the buffer (GL_FLOAT, ...)
+	unsigned char normalized;
+	bool integer;									// Read with glVertexAttribIPointer (ivec/uvec inputs)
+	unsigned int glslType;							// Type of the shader input (GL_FLOAT_VEC3, ...)
+	size_t offset;
+};
+
+#define VERTEX_MEMBER(location, type, name) vertex::type name;
+#define VERTEX_ATTRIBUTE(location, type, name)																	\
+	attributes.push_back(VertexAttribute{ location, #name, VertexAttributeType<vertex::type>::COMPONENTS,		\
+		VertexAttributeType<vertex::type>::TYPE, VertexAttributeType<vertex::type>::NORMALIZED,					\
+		VertexAttributeType<vertex::type>::INTEGER != 0, VertexAttributeType<vertex::type>::GLSL_TYPE,			\
+		offsetof(Self, name) });
+#define VERTEX_ENCODE(location, type, name) error = std::max(error, vertex::Encode(source.name, name));
+
+#define DECLARE_VERTEX_FORMAT(Name, ATTRIBUTES)																	\
+	struct Name																									\
+	{																											\
+		ATTRIBUTES(VERTEX_MEMBER)																				\
+		static const char* FormatName() { return #Name; }														\
+		static const std::vector<VertexAttribute>& Attributes()													\
+		{																										\
+			typedef Name Self;																					\
+			static const std::vector<VertexAttribute> attributes = []()											\
+			{																									\
+				std::vector<VertexAttribute> attributes;														\
+				ATTRIBUTES(VERTEX_ATTRIBUTE)																	\
+				return attributes;																				\
+			}();																								\
+			return attributes;																					\
+		}																										\
+		/* Fills this vertex from one of another format with the same attribute names, returns the largest error */	\
+		template <typename Source>																				\
+		float Encode(const Source& source)																		\
+		{																										\
+			float error = 0.0f;																					\
+			ATTRIBUTES(VERTEX_ENCODE)																			\
+			return error;																						\
+		}																										\
+	};
+
+// ---------- Formats used by main.cpp ----------
+#define COLOR_VERTEX_ATTRIBUTES(ATTRIBUTE)		\
+	ATTRIBUTE(0, vec3, aPos)					\
+	ATTRIBUTE(1, vec3, aColor)
+#define TEXTURED_VERTEX_ATTRIBUTES(ATTRIBUTE)	\
+	ATTRIBUTE(0, vec3, aPos)					\
+	ATTRIBUTE(1, vec3, aColor)					\
+	ATTRIBUTE(2, vec2, aTexCoord)
+#define PACKED_TEXTURED_VERTEX_ATTRIBUTES(ATTRIBUTE)	/* 16 bytes instead of TexturedVertex's 32 */	\
+	ATTRIBUTE(0, half3, aPos)					\
+	ATTRIBUTE(1, unorm8x3, aColor)				\
+	ATTRIBUTE(2, unorm16x2, aTexCoord)
+#define QUAD_INSTANCE_ATTRIBUTES(ATTRIBUTE)		/* Per instance (divisor 1), after the quad's own attributes */	\
+	ATTRIBUTE(3, vec4, aOffsetScale)			\
+	ATTRIBUTE(4, vec4, aUVRect)					\
+	ATTRIBUTE(5, unorm8x4, aTint)
+
+DECLARE_VERTEX_FORMAT(ColorVertex, COLOR_VERTEX_ATTRIBUTES)
+DECLARE_VERTEX_FORMAT(TexturedVertex, TEXTURED_VERTEX_ATTRIBUTES)
+DECLARE_VERTEX_FORMAT(PackedTexturedVertex, PACKED_TEXTURED_VERTEX_ATTRIBUTES)
+DECLARE_VERTEX_FORMAT(QuadInstance, QUAD_INSTANCE_ATTRIBUTES)
+
+namespace VertexLayout
+{
+	// Points the bound VAO's attributes at the bound GL_ARRAY_BUFFER, vertices of format T starting at byte 'offset'.
+	// A 'divisor' of 1 makes T per-instance data: one element per instance instead of per vertex
+	template <typename T>
+	void Apply(size_t offset = 0, unsigned int divisor = 0)
+	{
+		for (const VertexAttribute& attribute : T::Attributes())
+		{
+			const void* pointer = (const void*)(offset + attribute.offset);
+			if (attribute.integer)
+				glVertexAttribIPointer(attribute.location, attribute.components, attribute.type, sizeof(T), pointer);
+			else
+				glVertexAttribPointer(attribute.location, attribute.components, attribute.type, attribute.normalized, sizeof(T), pointer);
+			glVertexAttribDivisor(attribute.location, divisor);
+			glEnableVertexAttribArray(attribute.location);
+		}
+	}
+
+	// Converts 'count' vertices to format T (which needs the same attribute names as Source). Fails, leaving
+	// 'packed' empty, when any component would be off by more than 'maxError' (units of the attribute: positions in
+	// model space, colors and texture coordinates in [0, 1]); the caller keeps the full format then
+	template <typename T, typename Source>
+	bool Compress(const Source* vertices, size_t count, std::vector<T>& packed, float maxError, float* largestError = nullptr)
+	{
+		packed.resize(count);
+		float error = 0.0f;
+		for (size_t i = 0; i < count; i++)
+			error = std::max(error, packed[i].Encode(vertices[i]));
+		if (largestError)
+			*largestError = error;
+		if (!(error <= maxError))													// NaN counts as over
+		{
+			printf("ERROR::VERTEX_LAYOUT::ERROR_BOUND %s: %g > %g\n", T::FormatName(), error, maxError);
+			packed.clear();
+			return false;
+		}
+		return true;
+	}
+
+	// Compares 'program's active vertex inputs with the formats it is drawn with (the vertex format, then any
+	// per-instance ones): every input has to be an attribute of one of them, at the same location and of the same
+	// GLSL type. Attributes the program doesn't use (other variants, or removed by the compiler) are fine. True if
+	// everything matches
+	template <typename... Formats>
+	bool Validate(unsigned int program)
+	{
+		const char* formatNames[] = { Formats::FormatName()... };
+		const std::vector<VertexAttribute>* formats[] = { &Formats::Attributes()... };
+		std::string formatName;
+		for (const char* name : formatNames)
+			formatName += formatName.empty() ? name : std::string(" + ") + name;
+
+		bool valid = true;
+		int count = 0, maxLength = 0;
+		glGetProgramiv(program, GL_ACTIVE_ATTRIBUTES, &count);
+		glGetProgramiv(program, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &maxLength);
+		std::vector<char> name(maxLength > 0 ? maxLength : 1);
+		for (int i = 0; i < count; i++)
+		{
+			int size = 0;
+			unsigned int type = 0;
+			glGetActiveAttrib(program, i, (int)name.size(), nullptr, &size, &type, name.data());
+			if (strncmp(name.data(), "gl_", 3) == 0)
+				continue;															// Built-ins (gl_VertexID, ...) don't come from a buffer
+			const VertexAttribute* attribute = nullptr;
+			for (const std::vector<VertexAttribute>* attributes : formats)
+			{
+				for (const VertexAttribute& candidate : *attributes)
+				{
+					if (strcmp(candidate.name, name.data()) == 0)
+						attribute = &candidate;
+				}
+			}
+			if (!attribute)
+			{
+				printf("ERROR::VERTEX_LAYOUT::MISSING_ATTRIBUTE %s has no %s\n", formatName.c_str(), name.data());
+				valid = false;
+				continue;
+			}
+			int location = glGetAttribLocation(program, name.data());
+			if (location != (int)attribute->location)
+			{
+				printf("ERROR::VERTEX_LAYOUT::LOCATION_MISMATCH %s.%s: GL %d, C++ %u\n", formatName.c_str(), name.data(), location, attribute->location);
+				valid = false;
+			}
+			if (type != attribute->glslType)
+			{
+				printf("ERROR::VERTEX_LAYOUT::TYPE_MISMATCH %s.%s: GL 0x%X, C++ 0x%X\n", formatName.c_str(), name.data(), type, attribute->glslType);
+				valid = false;
+			}
+		}
+		return valid;
+	}
+}
+
+#endif // !VERTEX_LAYOUT_H
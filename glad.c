@@ -141,85 +141,197 @@ struct gladGLversionStruct GLVersion;
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static const char **exts_i = NULL;
+/* Extensions are interned once per load into an open addressing hash set,
+ * so has_ext() and gladHasExtension() cost one hash and (usually) one strcmp.
+ * Every GladGLContext owns one; the set for the global load lives in the
+ * default context further down. */
+struct gladExtEntry {
+    unsigned int hash;
+    const char *name;
+};
 
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        unsigned int index;
+struct gladExtSet {
+    char *pool;
+    struct gladExtEntry *set;
+    unsigned int mask;
+    int count;
+};
 
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (const char **)realloc((void *)exts_i, (size_t)num_exts_i * (sizeof *exts_i));
-        }
+static unsigned int hash_ext(const char *ext, size_t length) {
+    /* FNV-1a */
+    unsigned int hash = 2166136261u;
+    size_t index;
+    for(index = 0; index < length; index++) {
+        hash ^= (unsigned char)ext[index];
+        hash *= 16777619u;
+    }
+    return hash;
+}
 
-        if (exts_i == NULL) {
-            return 0;
-        }
+static void free_exts(struct gladExtSet *exts) {
+    if (exts->set != NULL) {
+        free((void *)exts->set);
+        exts->set = NULL;
+    }
+    if (exts->pool != NULL) {
+        free((void *)exts->pool);
+        exts->pool = NULL;
+    }
+    exts->mask = 0;
+    exts->count = 0;
+}
 
-        for(index = 0; index < (unsigned)num_exts_i; index++) {
-            exts_i[index] = (const char*)glGetStringi(GL_EXTENSIONS, index);
+static void insert_ext(struct gladExtSet *exts, const char *ext) {
+    unsigned int hash = hash_ext(ext, strlen(ext));
+    unsigned int slot = hash & exts->mask;
+
+    while(exts->set[slot].name != NULL) {
+        if(exts->set[slot].hash == hash && strcmp(exts->set[slot].name, ext) == 0) {
+            return;
         }
+        slot = (slot + 1) & exts->mask;
     }
-#endif
-    return 1;
+    exts->set[slot].hash = hash;
+    exts->set[slot].name = ext;
+    exts->count++;
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        free((void *)exts_i);
-        exts_i = NULL;
+static int build_ext_set(struct gladExtSet *exts, int count) {
+    unsigned int size = 16;
+    char *ext;
+
+    /* Keep the load factor at or below 1/2 */
+    while(size < (unsigned)count * 2) {
+        size <<= 1;
+    }
+    exts->set = (struct gladExtEntry *)calloc(size, sizeof *exts->set);
+    if (exts->set == NULL) {
+        return 0;
+    }
+    exts->mask = size - 1;
+
+    /* exts->pool holds 'count' NUL terminated names back to back */
+    ext = exts->pool;
+    while(count-- > 0) {
+        if(*ext != '\0') {
+            insert_ext(exts, ext);
+        }
+        ext += strlen(ext) + 1;
     }
+    return 1;
 }
 
-static int has_ext(const char *ext) {
+/* The entry points are passed in so a context's set can be built from its own table */
+static int get_exts(struct gladExtSet *exts, int major, PFNGLGETSTRINGPROC get_string,
+                    PFNGLGETINTEGERVPROC get_integerv, PFNGLGETSTRINGIPROC get_stringi) {
+    int count = 0;
+
+    free_exts(exts);
 #ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
+    if(major < 3 || get_integerv == NULL || get_stringi == NULL) {
+#else
+    (void)major; (void)get_integerv; (void)get_stringi;
 #endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
+        const char *names = (const char *)get_string(GL_EXTENSIONS);
+        size_t length;
+        char *ext;
+
+        if (names == NULL) {
+            /* No extension string is not a load failure, the set is just empty */
+            names = "";
+        }
+        length = strlen(names);
+        exts->pool = (char *)malloc(length + 1);
+        if (exts->pool == NULL) {
             return 0;
         }
+        memcpy(exts->pool, names, length + 1);
 
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
+        /* Split the space separated list in place */
+        count = 1;
+        for(ext = exts->pool; *ext != '\0'; ext++) {
+            if(*ext == ' ') {
+                *ext = '\0';
+                count++;
             }
-            extensions = terminator;
         }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
-        int index;
+        unsigned int index;
+        int num_exts_i = 0;
+        size_t length = 0;
+        char *ext;
+
+        get_integerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        for(index = 0; index < (unsigned)num_exts_i; index++) {
+            const char *e = (const char*)get_stringi(GL_EXTENSIONS, index);
+            length += (e != NULL ? strlen(e) : 0) + 1;
+        }
 
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+        exts->pool = (char *)malloc(length + 1);
+        if (exts->pool == NULL) {
+            return 0;
+        }
 
-            if(strcmp(e, ext) == 0) {
-                return 1;
-            }
+        ext = exts->pool;
+        for(index = 0; index < (unsigned)num_exts_i; index++) {
+            const char *e = (const char*)get_stringi(GL_EXTENSIONS, index);
+            size_t e_length = e != NULL ? strlen(e) : 0;
+            memcpy(ext, e != NULL ? e : "", e_length + 1);
+            ext += e_length + 1;
         }
+        count = num_exts_i;
     }
 #endif
+    return build_ext_set(exts, count);
+}
+
+static int has_ext(const struct gladExtSet *exts, const char *ext) {
+    unsigned int hash;
+    unsigned int slot;
+
+    if(exts->set == NULL || ext == NULL) {
+        return 0;
+    }
+
+    hash = hash_ext(ext, strlen(ext));
+    slot = hash & exts->mask;
+    while(exts->set[slot].name != NULL) {
+        if(exts->set[slot].hash == hash && strcmp(exts->set[slot].name, ext) == 0) {
+            return 1;
+        }
+        slot = (slot + 1) & exts->mask;
+    }
 
     return 0;
 }
+
+/* Turns a GL_VERSION string ("4.5 (Core Profile) Mesa", "OpenGL ES 3.2 ...") into major/minor */
+static void parse_version(const char *version, int *major, int *minor) {
+    int i;
+    const char* prefixes[] = {
+        "OpenGL ES-CM ",
+        "OpenGL ES-CL ",
+        "OpenGL ES ",
+        NULL
+    };
+
+    *major = 0; *minor = 0;
+    for (i = 0;  prefixes[i];  i++) {
+        const size_t length = strlen(prefixes[i]);
+        if (strncmp(version, prefixes[i], length) == 0) {
+            version += length;
+            break;
+        }
+    }
+
+/* PR #18 */
+#ifdef _MSC_VER
+    sscanf_s(version, "%d.%d", major, minor);
+#else
+    sscanf(version, "%d.%d", major, minor);
+#endif
+}
 int GLAD_GL_VERSION_1_0;
 int GLAD_GL_VERSION_1_1;
 int GLAD_GL_VERSION_1_2;
@@ -1287,6 +1399,7401 @@ PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines;
 PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv;
 PFNGLCLIPCONTROLPROC glad_glClipControl;
 PFNGLGETPROGRAMRESOURCEIVPROC glad_glGetProgramResourceiv;
+/* Lazy dispatch: every pointer starts out as a trampoline which asks the
+ * loader for the real entry point on first call, patches the pointer and
+ * forwards the call. Only the functions actually used ever get resolved. */
+static GLADloadproc glad_lazy_loader;
+
+static void* glad_lazy_resolve(void** slot, const char *name) {
+    void* proc = glad_lazy_loader(name);
+    *slot = proc;
+    return proc;
+}
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum arg0, GLint arg1, GLenum arg2, GLint arg3, GLint arg4, GLsizei arg5, GLint arg6) {
+	((PFNGLCOPYTEXIMAGE1DPROC)glad_lazy_resolve((void**)&glad_glCopyTexImage1D, "glCopyTexImage1D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glTextureParameterf(GLuint arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLTEXTUREPARAMETERFPROC)glad_lazy_resolve((void**)&glad_glTextureParameterf, "glTextureParameterf"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBI3UIPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI3ui, "glVertexAttribI3ui"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertexArrayElementBuffer(GLuint arg0, GLuint arg1) {
+	((PFNGLVERTEXARRAYELEMENTBUFFERPROC)glad_lazy_resolve((void**)&glad_glVertexArrayElementBuffer, "glVertexArrayElementBuffer"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glWindowPos2s(GLshort arg0, GLshort arg1) {
+	((PFNGLWINDOWPOS2SPROC)glad_lazy_resolve((void**)&glad_glWindowPos2s, "glWindowPos2s"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTextureStorage3DMultisample(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+	((PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)glad_lazy_resolve((void**)&glad_glTextureStorage3DMultisample, "glTextureStorage3DMultisample"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glTextureParameterfv(GLuint arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLTEXTUREPARAMETERFVPROC)glad_lazy_resolve((void**)&glad_glTextureParameterfv, "glTextureParameterfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glWindowPos2i(GLint arg0, GLint arg1) {
+	((PFNGLWINDOWPOS2IPROC)glad_lazy_resolve((void**)&glad_glWindowPos2i, "glWindowPos2i"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glWindowPos2f(GLfloat arg0, GLfloat arg1) {
+	((PFNGLWINDOWPOS2FPROC)glad_lazy_resolve((void**)&glad_glWindowPos2f, "glWindowPos2f"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glWindowPos2d(GLdouble arg0, GLdouble arg1) {
+	((PFNGLWINDOWPOS2DPROC)glad_lazy_resolve((void**)&glad_glWindowPos2d, "glWindowPos2d"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertex2fv(const GLfloat * arg0) {
+	((PFNGLVERTEX2FVPROC)glad_lazy_resolve((void**)&glad_glVertex2fv, "glVertex2fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glIndexi(GLint arg0) {
+	((PFNGLINDEXIPROC)glad_lazy_resolve((void**)&glad_glIndexi, "glIndexi"))(arg0);
+}
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3) {
+	((PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_resolve((void**)&glad_glFramebufferRenderbuffer, "glFramebufferRenderbuffer"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniformSubroutinesuiv(GLenum arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLUNIFORMSUBROUTINESUIVPROC)glad_lazy_resolve((void**)&glad_glUniformSubroutinesuiv, "glUniformSubroutinesuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glRectdv(const GLdouble * arg0, const GLdouble * arg1) {
+	((PFNGLRECTDVPROC)glad_lazy_resolve((void**)&glad_glRectdv, "glRectdv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLsizei arg9, const void * arg10) {
+	((PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_lazy_resolve((void**)&glad_glCompressedTexSubImage3D, "glCompressedTexSubImage3D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static void APIENTRY glad_lazy_glEvalCoord2d(GLdouble arg0, GLdouble arg1) {
+	((PFNGLEVALCOORD2DPROC)glad_lazy_resolve((void**)&glad_glEvalCoord2d, "glEvalCoord2d"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glEvalCoord2f(GLfloat arg0, GLfloat arg1) {
+	((PFNGLEVALCOORD2FPROC)glad_lazy_resolve((void**)&glad_glEvalCoord2f, "glEvalCoord2f"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetDoublei_v(GLenum arg0, GLuint arg1, GLdouble * arg2) {
+	((PFNGLGETDOUBLEI_VPROC)glad_lazy_resolve((void**)&glad_glGetDoublei_v, "glGetDoublei_v"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glIndexd(GLdouble arg0) {
+	((PFNGLINDEXDPROC)glad_lazy_resolve((void**)&glad_glIndexd, "glIndexd"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint arg0, const GLshort * arg1) {
+	((PFNGLVERTEXATTRIB1SVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib1sv, "glVertexAttrib1sv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glIndexf(GLfloat arg0) {
+	((PFNGLINDEXFPROC)glad_lazy_resolve((void**)&glad_glIndexf, "glIndexf"))(arg0);
+}
+static void APIENTRY glad_lazy_glBindSampler(GLuint arg0, GLuint arg1) {
+	((PFNGLBINDSAMPLERPROC)glad_lazy_resolve((void**)&glad_glBindSampler, "glBindSampler"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glLineWidth(GLfloat arg0) {
+	((PFNGLLINEWIDTHPROC)glad_lazy_resolve((void**)&glad_glLineWidth, "glLineWidth"))(arg0);
+}
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLCOLORP3UIVPROC)glad_lazy_resolve((void**)&glad_glColorP3uiv, "glColorP3uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum arg0, GLuint arg1, GLint * arg2) {
+	((PFNGLGETINTEGERI_VPROC)glad_lazy_resolve((void**)&glad_glGetIntegeri_v, "glGetIntegeri_v"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetMapfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETMAPFVPROC)glad_lazy_resolve((void**)&glad_glGetMapfv, "glGetMapfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glIndexs(GLshort arg0) {
+	((PFNGLINDEXSPROC)glad_lazy_resolve((void**)&glad_glIndexs, "glIndexs"))(arg0);
+}
+static void APIENTRY glad_lazy_glCompileShader(GLuint arg0) {
+	((PFNGLCOMPILESHADERPROC)glad_lazy_resolve((void**)&glad_glCompileShader, "glCompileShader"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLsizei * arg4, GLenum * arg5, GLchar * arg6) {
+	((PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_lazy_resolve((void**)&glad_glGetTransformFeedbackVarying, "glGetTransformFeedbackVarying"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glWindowPos2iv(const GLint * arg0) {
+	((PFNGLWINDOWPOS2IVPROC)glad_lazy_resolve((void**)&glad_glWindowPos2iv, "glWindowPos2iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStreamInstanced(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3) {
+	((PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)glad_lazy_resolve((void**)&glad_glDrawTransformFeedbackStreamInstanced, "glDrawTransformFeedbackStreamInstanced"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glIndexfv(const GLfloat * arg0) {
+	((PFNGLINDEXFVPROC)glad_lazy_resolve((void**)&glad_glIndexfv, "glIndexfv"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetCompressedTextureImage(GLuint arg0, GLint arg1, GLsizei arg2, void * arg3) {
+	((PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)glad_lazy_resolve((void**)&glad_glGetCompressedTextureImage, "glGetCompressedTextureImage"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetnMapfv(GLenum arg0, GLenum arg1, GLsizei arg2, GLfloat * arg3) {
+	((PFNGLGETNMAPFVPROC)glad_lazy_resolve((void**)&glad_glGetnMapfv, "glGetnMapfv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glFogiv(GLenum arg0, const GLint * arg1) {
+	((PFNGLFOGIVPROC)glad_lazy_resolve((void**)&glad_glFogiv, "glFogiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum arg0, GLuint arg1) {
+	((PFNGLSTENCILMASKSEPARATEPROC)glad_lazy_resolve((void**)&glad_glStencilMaskSeparate, "glStencilMaskSeparate"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glRasterPos2fv(const GLfloat * arg0) {
+	((PFNGLRASTERPOS2FVPROC)glad_lazy_resolve((void**)&glad_glRasterPos2fv, "glRasterPos2fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glLightModeliv(GLenum arg0, const GLint * arg1) {
+	((PFNGLLIGHTMODELIVPROC)glad_lazy_resolve((void**)&glad_glLightModeliv, "glLightModeliv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glDepthRangef(GLfloat arg0, GLfloat arg1) {
+	((PFNGLDEPTHRANGEFPROC)glad_lazy_resolve((void**)&glad_glDepthRangef, "glDepthRangef"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirectCount(GLenum arg0, GLenum arg1, const void * arg2, GLintptr arg3, GLsizei arg4, GLsizei arg5) {
+	((PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)glad_lazy_resolve((void**)&glad_glMultiDrawElementsIndirectCount, "glMultiDrawElementsIndirectCount"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glColor4ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+	((PFNGLCOLOR4UIPROC)glad_lazy_resolve((void**)&glad_glColor4ui, "glColor4ui"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3fv(const GLfloat * arg0) {
+	((PFNGLSECONDARYCOLOR3FVPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3fv, "glSecondaryColor3fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	((PFNGLMULTITEXCOORDP3UIPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoordP3ui, "glMultiTexCoordP3ui"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMemoryBarrierByRegion(GLbitfield arg0) {
+	((PFNGLMEMORYBARRIERBYREGIONPROC)glad_lazy_resolve((void**)&glad_glMemoryBarrierByRegion, "glMemoryBarrierByRegion"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETNAMEDBUFFERPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glGetNamedBufferParameteriv, "glGetNamedBufferParameteriv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glFogfv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLFOGFVPROC)glad_lazy_resolve((void**)&glad_glFogfv, "glFogfv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum arg0, GLuint arg1) {
+	((PFNGLVERTEXP4UIPROC)glad_lazy_resolve((void**)&glad_glVertexP4ui, "glVertexP4ui"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseInstance(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLuint arg5) {
+	((PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)glad_lazy_resolve((void**)&glad_glDrawElementsInstancedBaseInstance, "glDrawElementsInstancedBaseInstance"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glEnablei(GLenum arg0, GLuint arg1) {
+	((PFNGLENABLEIPROC)glad_lazy_resolve((void**)&glad_glEnablei, "glEnablei"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glProgramUniform3dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	((PFNGLPROGRAMUNIFORM3DVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform3dv, "glProgramUniform3dv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertex4iv(const GLint * arg0) {
+	((PFNGLVERTEX4IVPROC)glad_lazy_resolve((void**)&glad_glVertex4iv, "glVertex4iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glEvalCoord1fv(const GLfloat * arg0) {
+	((PFNGLEVALCOORD1FVPROC)glad_lazy_resolve((void**)&glad_glEvalCoord1fv, "glEvalCoord1fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glWindowPos2sv(const GLshort * arg0) {
+	((PFNGLWINDOWPOS2SVPROC)glad_lazy_resolve((void**)&glad_glWindowPos2sv, "glWindowPos2sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBP4UIPROC)glad_lazy_resolve((void**)&glad_glVertexAttribP4ui, "glVertexAttribP4ui"))(arg0, arg1, arg2, arg3);
+}
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum arg0) {
+	return ((PFNGLCREATESHADERPROC)glad_lazy_resolve((void**)&glad_glCreateShader, "glCreateShader"))(arg0);
+}
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint arg0) {
+	return ((PFNGLISBUFFERPROC)glad_lazy_resolve((void**)&glad_glIsBuffer, "glIsBuffer"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum arg0, GLuint arg1, GLfloat * arg2) {
+	((PFNGLGETMULTISAMPLEFVPROC)glad_lazy_resolve((void**)&glad_glGetMultisamplefv, "glGetMultisamplefv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX2DVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix2dv, "glProgramUniformMatrix2dv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENRENDERBUFFERSPROC)glad_lazy_resolve((void**)&glad_glGenRenderbuffers, "glGenRenderbuffers"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLsizei arg6, GLsizei arg7) {
+	((PFNGLCOPYTEXSUBIMAGE2DPROC)glad_lazy_resolve((void**)&glad_glCopyTexSubImage2D, "glCopyTexSubImage2D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLint arg5, GLsizei arg6, const void * arg7) {
+	((PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_lazy_resolve((void**)&glad_glCompressedTexImage2D, "glCompressedTexImage2D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint arg0, GLfloat arg1) {
+	((PFNGLVERTEXATTRIB1FPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib1f, "glVertexAttrib1f"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3) {
+	((PFNGLBLENDFUNCSEPARATEPROC)glad_lazy_resolve((void**)&glad_glBlendFuncSeparate, "glBlendFuncSeparate"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertex4fv(const GLfloat * arg0) {
+	((PFNGLVERTEX4FVPROC)glad_lazy_resolve((void**)&glad_glVertex4fv, "glVertex4fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glMinSampleShading(GLfloat arg0) {
+	((PFNGLMINSAMPLESHADINGPROC)glad_lazy_resolve((void**)&glad_glMinSampleShading, "glMinSampleShading"))(arg0);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferfi(GLuint arg0, GLenum arg1, GLint arg2, GLfloat arg3, GLint arg4) {
+	((PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)glad_lazy_resolve((void**)&glad_glClearNamedFramebufferfi, "glClearNamedFramebufferfi"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectuiv(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	((PFNGLGETQUERYBUFFEROBJECTUIVPROC)glad_lazy_resolve((void**)&glad_glGetQueryBufferObjectuiv, "glGetQueryBufferObjectuiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glBindTexture(GLenum arg0, GLuint arg1) {
+	((PFNGLBINDTEXTUREPROC)glad_lazy_resolve((void**)&glad_glBindTexture, "glBindTexture"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint arg0, GLshort arg1) {
+	((PFNGLVERTEXATTRIB1SPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib1s, "glVertexAttrib1s"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTexCoord2fv(const GLfloat * arg0) {
+	((PFNGLTEXCOORD2FVPROC)glad_lazy_resolve((void**)&glad_glTexCoord2fv, "glTexCoord2fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glSampleMaski(GLuint arg0, GLbitfield arg1) {
+	((PFNGLSAMPLEMASKIPROC)glad_lazy_resolve((void**)&glad_glSampleMaski, "glSampleMaski"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum arg0, GLuint arg1) {
+	((PFNGLVERTEXP2UIPROC)glad_lazy_resolve((void**)&glad_glVertexP2ui, "glVertexP2ui"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3, GLenum arg4, const void * arg5, GLint arg6) {
+	((PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_lazy_resolve((void**)&glad_glDrawRangeElementsBaseVertex, "glDrawRangeElementsBaseVertex"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glTexCoord4fv(const GLfloat * arg0) {
+	((PFNGLTEXCOORD4FVPROC)glad_lazy_resolve((void**)&glad_glTexCoord4fv, "glTexCoord4fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX3X2FVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix3x2fv, "glUniformMatrix3x2fv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glDebugMessageControl(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, const GLuint * arg4, GLboolean arg5) {
+	((PFNGLDEBUGMESSAGECONTROLPROC)glad_lazy_resolve((void**)&glad_glDebugMessageControl, "glDebugMessageControl"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glPointSize(GLfloat arg0) {
+	((PFNGLPOINTSIZEPROC)glad_lazy_resolve((void**)&glad_glPointSize, "glPointSize"))(arg0);
+}
+static void APIENTRY glad_lazy_glBindTextureUnit(GLuint arg0, GLuint arg1) {
+	((PFNGLBINDTEXTUREUNITPROC)glad_lazy_resolve((void**)&glad_glBindTextureUnit, "glBindTextureUnit"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIB2DVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib2dv, "glVertexAttrib2dv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint arg0) {
+	((PFNGLDELETEPROGRAMPROC)glad_lazy_resolve((void**)&glad_glDeleteProgram, "glDeleteProgram"))(arg0);
+}
+static void APIENTRY glad_lazy_glColor4bv(const GLbyte * arg0) {
+	((PFNGLCOLOR4BVPROC)glad_lazy_resolve((void**)&glad_glColor4bv, "glColor4bv"))(arg0);
+}
+static void APIENTRY glad_lazy_glRasterPos2f(GLfloat arg0, GLfloat arg1) {
+	((PFNGLRASTERPOS2FPROC)glad_lazy_resolve((void**)&glad_glRasterPos2f, "glRasterPos2f"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glRasterPos2d(GLdouble arg0, GLdouble arg1) {
+	((PFNGLRASTERPOS2DPROC)glad_lazy_resolve((void**)&glad_glRasterPos2d, "glRasterPos2d"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glLoadIdentity(void) {
+	((PFNGLLOADIDENTITYPROC)glad_lazy_resolve((void**)&glad_glLoadIdentity, "glLoadIdentity"))();
+}
+static void APIENTRY glad_lazy_glRasterPos2i(GLint arg0, GLint arg1) {
+	((PFNGLRASTERPOS2IPROC)glad_lazy_resolve((void**)&glad_glRasterPos2i, "glRasterPos2i"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirect(GLenum arg0, const void * arg1, GLsizei arg2, GLsizei arg3) {
+	((PFNGLMULTIDRAWARRAYSINDIRECTPROC)glad_lazy_resolve((void**)&glad_glMultiDrawArraysIndirect, "glMultiDrawArraysIndirect"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum arg0, GLenum arg1, GLsizei arg2, GLsizei arg3) {
+	((PFNGLRENDERBUFFERSTORAGEPROC)glad_lazy_resolve((void**)&glad_glRenderbufferStorage, "glRenderbufferStorage"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX4X3FVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix4x3fv, "glUniformMatrix4x3fv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glColor3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+	((PFNGLCOLOR3BPROC)glad_lazy_resolve((void**)&glad_glColor3b, "glColor3b"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum arg0, GLint arg1, const GLfloat * arg2) {
+	((PFNGLCLEARBUFFERFVPROC)glad_lazy_resolve((void**)&glad_glClearBufferfv, "glClearBufferfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glEdgeFlag(GLboolean arg0) {
+	((PFNGLEDGEFLAGPROC)glad_lazy_resolve((void**)&glad_glEdgeFlag, "glEdgeFlag"))(arg0);
+}
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETESAMPLERSPROC)glad_lazy_resolve((void**)&glad_glDeleteSamplers, "glDeleteSamplers"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertex3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLVERTEX3DPROC)glad_lazy_resolve((void**)&glad_glVertex3d, "glVertex3d"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertex3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLVERTEX3FPROC)glad_lazy_resolve((void**)&glad_glVertex3f, "glVertex3f"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetnMapiv(GLenum arg0, GLenum arg1, GLsizei arg2, GLint * arg3) {
+	((PFNGLGETNMAPIVPROC)glad_lazy_resolve((void**)&glad_glGetnMapiv, "glGetnMapiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertex3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLVERTEX3IPROC)glad_lazy_resolve((void**)&glad_glVertex3i, "glVertex3i"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glColor3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLCOLOR3IPROC)glad_lazy_resolve((void**)&glad_glColor3i, "glColor3i"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glUniform3d(GLint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLUNIFORM3DPROC)glad_lazy_resolve((void**)&glad_glUniform3d, "glUniform3d"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniform3f(GLint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLUNIFORM3FPROC)glad_lazy_resolve((void**)&glad_glUniform3f, "glUniform3f"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint arg0, const GLubyte * arg1) {
+	((PFNGLVERTEXATTRIB4UBVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4ubv, "glVertexAttrib4ubv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glColor3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLCOLOR3SPROC)glad_lazy_resolve((void**)&glad_glColor3s, "glColor3s"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertex3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLVERTEX3SPROC)glad_lazy_resolve((void**)&glad_glVertex3s, "glVertex3s"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum arg0, GLuint arg1) {
+	((PFNGLTEXCOORDP2UIPROC)glad_lazy_resolve((void**)&glad_glTexCoordP2ui, "glTexCoordP2ui"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glColorMaski(GLuint arg0, GLboolean arg1, GLboolean arg2, GLboolean arg3, GLboolean arg4) {
+	((PFNGLCOLORMASKIPROC)glad_lazy_resolve((void**)&glad_glColorMaski, "glColorMaski"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum arg0, GLint arg1, GLfloat arg2, GLint arg3) {
+	((PFNGLCLEARBUFFERFIPROC)glad_lazy_resolve((void**)&glad_glClearBufferfi, "glClearBufferfi"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glDrawArraysIndirect(GLenum arg0, const void * arg1) {
+	((PFNGLDRAWARRAYSINDIRECTPROC)glad_lazy_resolve((void**)&glad_glDrawArraysIndirect, "glDrawArraysIndirect"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTexCoord1iv(const GLint * arg0) {
+	((PFNGLTEXCOORD1IVPROC)glad_lazy_resolve((void**)&glad_glTexCoord1iv, "glTexCoord1iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLint arg7, GLbitfield arg8, GLenum arg9) {
+	((PFNGLBLITFRAMEBUFFERPROC)glad_lazy_resolve((void**)&glad_glBlitFramebuffer, "glBlitFramebuffer"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static void APIENTRY glad_lazy_glPauseTransformFeedback(void) {
+	((PFNGLPAUSETRANSFORMFEEDBACKPROC)glad_lazy_resolve((void**)&glad_glPauseTransformFeedback, "glPauseTransformFeedback"))();
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	((PFNGLMULTITEXCOORDP2UIPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoordP2ui, "glMultiTexCoordP2ui"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix3x2dv, "glProgramUniformMatrix3x2dv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glCopyNamedBufferSubData(GLuint arg0, GLuint arg1, GLintptr arg2, GLintptr arg3, GLsizeiptr arg4) {
+	((PFNGLCOPYNAMEDBUFFERSUBDATAPROC)glad_lazy_resolve((void**)&glad_glCopyNamedBufferSubData, "glCopyNamedBufferSubData"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferTexture(GLuint arg0, GLenum arg1, GLuint arg2, GLint arg3) {
+	((PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)glad_lazy_resolve((void**)&glad_glNamedFramebufferTexture, "glNamedFramebufferTexture"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix3x2fv, "glProgramUniformMatrix3x2fv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETSAMPLERPARAMETERIIVPROC)glad_lazy_resolve((void**)&glad_glGetSamplerParameterIiv, "glGetSamplerParameterIiv"))(arg0, arg1, arg2);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint arg0, const GLchar * arg1) {
+	return ((PFNGLGETFRAGDATAINDEXPROC)glad_lazy_resolve((void**)&glad_glGetFragDataIndex, "glGetFragDataIndex"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttribL4d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	((PFNGLVERTEXATTRIBL4DPROC)glad_lazy_resolve((void**)&glad_glVertexAttribL4d, "glVertexAttribL4d"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glBindImageTexture(GLuint arg0, GLuint arg1, GLint arg2, GLboolean arg3, GLint arg4, GLenum arg5, GLenum arg6) {
+	((PFNGLBINDIMAGETEXTUREPROC)glad_lazy_resolve((void**)&glad_glBindImageTexture, "glBindImageTexture"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLVERTEXATTRIB3FPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib3f, "glVertexAttrib3f"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX4FVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix4fv, "glProgramUniformMatrix4fv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glVertex2iv(const GLint * arg0) {
+	((PFNGLVERTEX2IVPROC)glad_lazy_resolve((void**)&glad_glVertex2iv, "glVertex2iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjecti64v(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	((PFNGLGETQUERYBUFFEROBJECTI64VPROC)glad_lazy_resolve((void**)&glad_glGetQueryBufferObjecti64v, "glGetQueryBufferObjecti64v"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glColor3sv(const GLshort * arg0) {
+	((PFNGLCOLOR3SVPROC)glad_lazy_resolve((void**)&glad_glColor3sv, "glColor3sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint arg0, GLenum arg1, GLdouble * arg2) {
+	((PFNGLGETVERTEXATTRIBDVPROC)glad_lazy_resolve((void**)&glad_glGetVertexAttribdv, "glGetVertexAttribdv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glActiveShaderProgram(GLuint arg0, GLuint arg1) {
+	((PFNGLACTIVESHADERPROGRAMPROC)glad_lazy_resolve((void**)&glad_glActiveShaderProgram, "glActiveShaderProgram"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX3X4FVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix3x4fv, "glUniformMatrix3x4fv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX3DVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix3dv, "glUniformMatrix3dv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glNormalPointer(GLenum arg0, GLsizei arg1, const GLvoid * arg2) {
+	((PFNGLNORMALPOINTERPROC)glad_lazy_resolve((void**)&glad_glNormalPointer, "glNormalPointer"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLTEXCOORDP3UIVPROC)glad_lazy_resolve((void**)&glad_glTexCoordP3uiv, "glTexCoordP3uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertex4sv(const GLshort * arg0) {
+	((PFNGLVERTEX4SVPROC)glad_lazy_resolve((void**)&glad_glVertex4sv, "glVertex4sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribLFormat(GLuint arg0, GLuint arg1, GLint arg2, GLenum arg3, GLuint arg4) {
+	((PFNGLVERTEXARRAYATTRIBLFORMATPROC)glad_lazy_resolve((void**)&glad_glVertexArrayAttribLFormat, "glVertexArrayAttribLFormat"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glInvalidateBufferSubData(GLuint arg0, GLintptr arg1, GLsizeiptr arg2) {
+	((PFNGLINVALIDATEBUFFERSUBDATAPROC)glad_lazy_resolve((void**)&glad_glInvalidateBufferSubData, "glInvalidateBufferSubData"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glPassThrough(GLfloat arg0) {
+	((PFNGLPASSTHROUGHPROC)glad_lazy_resolve((void**)&glad_glPassThrough, "glPassThrough"))(arg0);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	((PFNGLMULTITEXCOORDP4UIPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoordP4ui, "glMultiTexCoordP4ui"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glFogi(GLenum arg0, GLint arg1) {
+	((PFNGLFOGIPROC)glad_lazy_resolve((void**)&glad_glFogi, "glFogi"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glBegin(GLenum arg0) {
+	((PFNGLBEGINPROC)glad_lazy_resolve((void**)&glad_glBegin, "glBegin"))(arg0);
+}
+static void APIENTRY glad_lazy_glEvalCoord2dv(const GLdouble * arg0) {
+	((PFNGLEVALCOORD2DVPROC)glad_lazy_resolve((void**)&glad_glEvalCoord2dv, "glEvalCoord2dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glColor3ubv(const GLubyte * arg0) {
+	((PFNGLCOLOR3UBVPROC)glad_lazy_resolve((void**)&glad_glColor3ubv, "glColor3ubv"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexPointer(GLint arg0, GLenum arg1, GLsizei arg2, const GLvoid * arg3) {
+	((PFNGLVERTEXPOINTERPROC)glad_lazy_resolve((void**)&glad_glVertexPointer, "glVertexPointer"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3uiv(const GLuint * arg0) {
+	((PFNGLSECONDARYCOLOR3UIVPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3uiv, "glSecondaryColor3uiv"))(arg0);
+}
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETEFRAMEBUFFERSPROC)glad_lazy_resolve((void**)&glad_glDeleteFramebuffers, "glDeleteFramebuffers"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glDrawArrays(GLenum arg0, GLint arg1, GLsizei arg2) {
+	((PFNGLDRAWARRAYSPROC)glad_lazy_resolve((void**)&glad_glDrawArrays, "glDrawArrays"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glUniform1ui(GLint arg0, GLuint arg1) {
+	((PFNGLUNIFORM1UIPROC)glad_lazy_resolve((void**)&glad_glUniform1ui, "glUniform1ui"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTRANSFORMFEEDBACKIVPROC)glad_lazy_resolve((void**)&glad_glGetTransformFeedbackiv, "glGetTransformFeedbackiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1d(GLenum arg0, GLdouble arg1) {
+	((PFNGLMULTITEXCOORD1DPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord1d, "glMultiTexCoord1d"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1f(GLenum arg0, GLfloat arg1) {
+	((PFNGLMULTITEXCOORD1FPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord1f, "glMultiTexCoord1f"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glProgramParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	((PFNGLPROGRAMPARAMETERIPROC)glad_lazy_resolve((void**)&glad_glProgramParameteri, "glProgramParameteri"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glLightfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLLIGHTFVPROC)glad_lazy_resolve((void**)&glad_glLightfv, "glLightfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum arg0, GLuint arg1) {
+	((PFNGLTEXCOORDP3UIPROC)glad_lazy_resolve((void**)&glad_glTexCoordP3ui, "glTexCoordP3ui"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLVERTEXATTRIB3DPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib3d, "glVertexAttrib3d"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glClear(GLbitfield arg0) {
+	((PFNGLCLEARPROC)glad_lazy_resolve((void**)&glad_glClear, "glClear"))(arg0);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1i(GLenum arg0, GLint arg1) {
+	((PFNGLMULTITEXCOORD1IPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord1i, "glMultiTexCoord1i"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+	((PFNGLGETACTIVEUNIFORMNAMEPROC)glad_lazy_resolve((void**)&glad_glGetActiveUniformName, "glGetActiveUniformName"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glMemoryBarrier(GLbitfield arg0) {
+	((PFNGLMEMORYBARRIERPROC)glad_lazy_resolve((void**)&glad_glMemoryBarrier, "glMemoryBarrier"))(arg0);
+}
+static GLenum APIENTRY glad_lazy_glGetGraphicsResetStatus(void) {
+	return ((PFNGLGETGRAPHICSRESETSTATUSPROC)glad_lazy_resolve((void**)&glad_glGetGraphicsResetStatus, "glGetGraphicsResetStatus"))();
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1s(GLenum arg0, GLshort arg1) {
+	((PFNGLMULTITEXCOORD1SPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord1s, "glMultiTexCoord1s"))(arg0, arg1);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum arg0) {
+	return ((PFNGLISENABLEDPROC)glad_lazy_resolve((void**)&glad_glIsEnabled, "glIsEnabled"))(arg0);
+}
+static void APIENTRY glad_lazy_glStencilOp(GLenum arg0, GLenum arg1, GLenum arg2) {
+	((PFNGLSTENCILOPPROC)glad_lazy_resolve((void**)&glad_glStencilOp, "glStencilOp"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	((PFNGLGETQUERYOBJECTUIVPROC)glad_lazy_resolve((void**)&glad_glGetQueryObjectuiv, "glGetQueryObjectuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4) {
+	((PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_lazy_resolve((void**)&glad_glFramebufferTexture2D, "glFramebufferTexture2D"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glGetFramebufferAttachmentParameteriv, "glGetFramebufferAttachmentParameteriv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glTranslatef(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLTRANSLATEFPROC)glad_lazy_resolve((void**)&glad_glTranslatef, "glTranslatef"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint arg0, GLubyte arg1, GLubyte arg2, GLubyte arg3, GLubyte arg4) {
+	((PFNGLVERTEXATTRIB4NUBPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4Nub, "glVertexAttrib4Nub"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glTranslated(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLTRANSLATEDPROC)glad_lazy_resolve((void**)&glad_glTranslated, "glTranslated"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexCoord3sv(const GLshort * arg0) {
+	((PFNGLTEXCOORD3SVPROC)glad_lazy_resolve((void**)&glad_glTexCoord3sv, "glTexCoord3sv"))(arg0);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint arg0, const GLchar * arg1) {
+	return ((PFNGLGETFRAGDATALOCATIONPROC)glad_lazy_resolve((void**)&glad_glGetFragDataLocation, "glGetFragDataLocation"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTEXTUREPARAMETERIIVPROC)glad_lazy_resolve((void**)&glad_glGetTextureParameterIiv, "glGetTextureParameterIiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLint arg4, GLenum arg5, GLenum arg6, const GLvoid * arg7) {
+	((PFNGLTEXIMAGE1DPROC)glad_lazy_resolve((void**)&glad_glTexImage1D, "glTexImage1D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage3D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLsizei arg7, GLsizei arg8) {
+	((PFNGLCOPYTEXTURESUBIMAGE3DPROC)glad_lazy_resolve((void**)&glad_glCopyTextureSubImage3D, "glCopyTextureSubImage3D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLVERTEXP3UIVPROC)glad_lazy_resolve((void**)&glad_glVertexP3uiv, "glVertexP3uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLTEXPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glTexParameteriv, "glTexParameteriv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribIFormat(GLuint arg0, GLuint arg1, GLint arg2, GLenum arg3, GLuint arg4) {
+	((PFNGLVERTEXARRAYATTRIBIFORMATPROC)glad_lazy_resolve((void**)&glad_glVertexArrayAttribIFormat, "glVertexArrayAttribIFormat"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3bv(const GLbyte * arg0) {
+	((PFNGLSECONDARYCOLOR3BVPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3bv, "glSecondaryColor3bv"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetMaterialfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETMATERIALFVPROC)glad_lazy_resolve((void**)&glad_glGetMaterialfv, "glGetMaterialfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetTexImage(GLenum arg0, GLint arg1, GLenum arg2, GLenum arg3, GLvoid * arg4) {
+	((PFNGLGETTEXIMAGEPROC)glad_lazy_resolve((void**)&glad_glGetTexImage, "glGetTexImage"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glFogCoordfv(const GLfloat * arg0) {
+	((PFNGLFOGCOORDFVPROC)glad_lazy_resolve((void**)&glad_glFogCoordfv, "glFogCoordfv"))(arg0);
+}
+static void APIENTRY glad_lazy_glPixelMapuiv(GLenum arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLPIXELMAPUIVPROC)glad_lazy_resolve((void**)&glad_glPixelMapuiv, "glPixelMapuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	((PFNGLGETSHADERINFOLOGPROC)glad_lazy_resolve((void**)&glad_glGetShaderInfoLog, "glGetShaderInfoLog"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint arg0, GLenum arg1, GLint64 * arg2) {
+	((PFNGLGETQUERYOBJECTI64VPROC)glad_lazy_resolve((void**)&glad_glGetQueryObjecti64v, "glGetQueryObjecti64v"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENFRAMEBUFFERSPROC)glad_lazy_resolve((void**)&glad_glGenFramebuffers, "glGenFramebuffers"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glCreateTextures(GLenum arg0, GLsizei arg1, GLuint * arg2) {
+	((PFNGLCREATETEXTURESPROC)glad_lazy_resolve((void**)&glad_glCreateTextures, "glCreateTextures"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackBufferBase(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)glad_lazy_resolve((void**)&glad_glTransformFeedbackBufferBase, "glTransformFeedbackBufferBase"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glIndexsv(const GLshort * arg0) {
+	((PFNGLINDEXSVPROC)glad_lazy_resolve((void**)&glad_glIndexsv, "glIndexsv"))(arg0);
+}
+static void APIENTRY glad_lazy_glClearTexSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+	((PFNGLCLEARTEXSUBIMAGEPROC)glad_lazy_resolve((void**)&glad_glClearTexSubImage, "glClearTexSubImage"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix3x4dv, "glProgramUniformMatrix3x4dv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLuint * arg3) {
+	((PFNGLGETATTACHEDSHADERSPROC)glad_lazy_resolve((void**)&glad_glGetAttachedShaders, "glGetAttachedShaders"))(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint arg0) {
+	return ((PFNGLISRENDERBUFFERPROC)glad_lazy_resolve((void**)&glad_glIsRenderbuffer, "glIsRenderbuffer"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertex3iv(const GLint * arg0) {
+	((PFNGLVERTEX3IVPROC)glad_lazy_resolve((void**)&glad_glVertex3iv, "glVertex3iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glBitmap(GLsizei arg0, GLsizei arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4, GLfloat arg5, const GLubyte * arg6) {
+	((PFNGLBITMAPPROC)glad_lazy_resolve((void**)&glad_glBitmap, "glBitmap"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static GLuint APIENTRY glad_lazy_glGetDebugMessageLog(GLuint arg0, GLsizei arg1, GLenum * arg2, GLenum * arg3, GLuint * arg4, GLenum * arg5, GLsizei * arg6, GLchar * arg7) {
+	return ((PFNGLGETDEBUGMESSAGELOGPROC)glad_lazy_resolve((void**)&glad_glGetDebugMessageLog, "glGetDebugMessageLog"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_lazy_glProgramUniform1uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	((PFNGLPROGRAMUNIFORM1UIVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform1uiv, "glProgramUniform1uiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glMateriali(GLenum arg0, GLenum arg1, GLint arg2) {
+	((PFNGLMATERIALIPROC)glad_lazy_resolve((void**)&glad_glMateriali, "glMateriali"))(arg0, arg1, arg2);
+}
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint arg0) {
+	return ((PFNGLISVERTEXARRAYPROC)glad_lazy_resolve((void**)&glad_glIsVertexArray, "glIsVertexArray"))(arg0);
+}
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint arg0) {
+	((PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve((void**)&glad_glDisableVertexAttribArray, "glDisableVertexAttribArray"))(arg0);
+}
+static void APIENTRY glad_lazy_glProgramUniform2iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	((PFNGLPROGRAMUNIFORM2IVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform2iv, "glProgramUniform2iv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETQUERYIVPROC)glad_lazy_resolve((void**)&glad_glGetQueryiv, "glGetQueryiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexCoord4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLTEXCOORD4FPROC)glad_lazy_resolve((void**)&glad_glTexCoord4f, "glTexCoord4f"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glBlitNamedFramebuffer(GLuint arg0, GLuint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLint arg7, GLint arg8, GLint arg9, GLbitfield arg10, GLenum arg11) {
+	((PFNGLBLITNAMEDFRAMEBUFFERPROC)glad_lazy_resolve((void**)&glad_glBlitNamedFramebuffer, "glBlitNamedFramebuffer"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
+}
+static void APIENTRY glad_lazy_glTexCoord4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLTEXCOORD4DPROC)glad_lazy_resolve((void**)&glad_glTexCoord4d, "glTexCoord4d"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glCreateQueries(GLenum arg0, GLsizei arg1, GLuint * arg2) {
+	((PFNGLCREATEQUERIESPROC)glad_lazy_resolve((void**)&glad_glCreateQueries, "glCreateQueries"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETSAMPLERPARAMETERFVPROC)glad_lazy_resolve((void**)&glad_glGetSamplerParameterfv, "glGetSamplerParameterfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexCoord4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLTEXCOORD4IPROC)glad_lazy_resolve((void**)&glad_glTexCoord4i, "glTexCoord4i"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glShaderStorageBlockBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLSHADERSTORAGEBLOCKBINDINGPROC)glad_lazy_resolve((void**)&glad_glShaderStorageBlockBinding, "glShaderStorageBlockBinding"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMaterialf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLMATERIALFPROC)glad_lazy_resolve((void**)&glad_glMaterialf, "glMaterialf"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexCoord4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLTEXCOORD4SPROC)glad_lazy_resolve((void**)&glad_glTexCoord4s, "glTexCoord4s"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix4x2dv, "glProgramUniformMatrix4x2dv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint arg0, GLsizei arg1, const GLchar *const* arg2, GLuint * arg3) {
+	((PFNGLGETUNIFORMINDICESPROC)glad_lazy_resolve((void**)&glad_glGetUniformIndices, "glGetUniformIndices"))(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint arg0) {
+	return ((PFNGLISSHADERPROC)glad_lazy_resolve((void**)&glad_glIsShader, "glIsShader"))(arg0);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2s(GLenum arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLMULTITEXCOORD2SPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord2s, "glMultiTexCoord2s"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint arg0, const GLubyte * arg1) {
+	((PFNGLVERTEXATTRIBI4UBVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI4ubv, "glVertexAttribI4ubv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertex3dv(const GLdouble * arg0) {
+	((PFNGLVERTEX3DVPROC)glad_lazy_resolve((void**)&glad_glVertex3dv, "glVertex3dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum arg0, GLint64 * arg1) {
+	((PFNGLGETINTEGER64VPROC)glad_lazy_resolve((void**)&glad_glGetInteger64v, "glGetInteger64v"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum arg0, const GLint * arg1) {
+	((PFNGLPOINTPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glPointParameteriv, "glPointParameteriv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetnMinmax(GLenum arg0, GLboolean arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	((PFNGLGETNMINMAXPROC)glad_lazy_resolve((void**)&glad_glGetnMinmax, "glGetnMinmax"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glEnable(GLenum arg0) {
+	((PFNGLENABLEPROC)glad_lazy_resolve((void**)&glad_glEnable, "glEnable"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint arg0, GLsizei arg1, const GLuint * arg2, GLenum arg3, GLint * arg4) {
+	((PFNGLGETACTIVEUNIFORMSIVPROC)glad_lazy_resolve((void**)&glad_glGetActiveUniformsiv, "glGetActiveUniformsiv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glColor4fv(const GLfloat * arg0) {
+	((PFNGLCOLOR4FVPROC)glad_lazy_resolve((void**)&glad_glColor4fv, "glColor4fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexCoord1fv(const GLfloat * arg0) {
+	((PFNGLTEXCOORD1FVPROC)glad_lazy_resolve((void**)&glad_glTexCoord1fv, "glTexCoord1fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLVERTEXARRAYATTRIBBINDINGPROC)glad_lazy_resolve((void**)&glad_glVertexArrayAttribBinding, "glVertexArrayAttribBinding"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTextureStorage1D(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3) {
+	((PFNGLTEXTURESTORAGE1DPROC)glad_lazy_resolve((void**)&glad_glTextureStorage1D, "glTextureStorage1D"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glPopDebugGroup(void) {
+	((PFNGLPOPDEBUGGROUPPROC)glad_lazy_resolve((void**)&glad_glPopDebugGroup, "glPopDebugGroup"))();
+}
+static void APIENTRY glad_lazy_glBlendEquationi(GLuint arg0, GLenum arg1) {
+	((PFNGLBLENDEQUATIONIPROC)glad_lazy_resolve((void**)&glad_glBlendEquationi, "glBlendEquationi"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTexCoord2sv(const GLshort * arg0) {
+	((PFNGLTEXCOORD2SVPROC)glad_lazy_resolve((void**)&glad_glTexCoord2sv, "glTexCoord2sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIB4DVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4dv, "glVertexAttrib4dv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1dv(GLenum arg0, const GLdouble * arg1) {
+	((PFNGLMULTITEXCOORD1DVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord1dv, "glMultiTexCoord1dv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetProgramInterfaceiv(GLuint arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETPROGRAMINTERFACEIVPROC)glad_lazy_resolve((void**)&glad_glGetProgramInterfaceiv, "glGetProgramInterfaceiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2i(GLenum arg0, GLint arg1, GLint arg2) {
+	((PFNGLMULTITEXCOORD2IPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord2i, "glMultiTexCoord2i"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexCoord3fv(const GLfloat * arg0) {
+	((PFNGLTEXCOORD3FVPROC)glad_lazy_resolve((void**)&glad_glTexCoord3fv, "glTexCoord3fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3usv(const GLushort * arg0) {
+	((PFNGLSECONDARYCOLOR3USVPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3usv, "glSecondaryColor3usv"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexGenf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLTEXGENFPROC)glad_lazy_resolve((void**)&glad_glTexGenf, "glTexGenf"))(arg0, arg1, arg2);
+}
+static void * APIENTRY glad_lazy_glMapNamedBuffer(GLuint arg0, GLenum arg1) {
+	return ((PFNGLMAPNAMEDBUFFERPROC)glad_lazy_resolve((void**)&glad_glMapNamedBuffer, "glMapNamedBuffer"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLMULTITEXCOORDP3UIVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoordP3uiv, "glMultiTexCoordP3uiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBP3UIPROC)glad_lazy_resolve((void**)&glad_glVertexAttribP3ui, "glVertexAttribP3ui"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertexAttribL1dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIBL1DVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribL1dv, "glVertexAttribL1dv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTextureBufferRange(GLuint arg0, GLenum arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	((PFNGLTEXTUREBUFFERRANGEPROC)glad_lazy_resolve((void**)&glad_glTextureBufferRange, "glTextureBufferRange"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetnUniformdv(GLuint arg0, GLint arg1, GLsizei arg2, GLdouble * arg3) {
+	((PFNGLGETNUNIFORMDVPROC)glad_lazy_resolve((void**)&glad_glGetnUniformdv, "glGetnUniformdv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	((PFNGLMULTITEXCOORDP1UIPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoordP1ui, "glMultiTexCoordP1ui"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3ui(GLuint arg0, GLint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+	((PFNGLPROGRAMUNIFORM3UIPROC)glad_lazy_resolve((void**)&glad_glProgramUniform3ui, "glProgramUniform3ui"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackBufferRange(GLuint arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	((PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)glad_lazy_resolve((void**)&glad_glTransformFeedbackBufferRange, "glTransformFeedbackBufferRange"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetPointerv(GLenum arg0, GLvoid ** arg1) {
+	((PFNGLGETPOINTERVPROC)glad_lazy_resolve((void**)&glad_glGetPointerv, "glGetPointerv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexBindingDivisor(GLuint arg0, GLuint arg1) {
+	((PFNGLVERTEXBINDINGDIVISORPROC)glad_lazy_resolve((void**)&glad_glVertexBindingDivisor, "glVertexBindingDivisor"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat arg0, GLfloat arg1) {
+	((PFNGLPOLYGONOFFSETPROC)glad_lazy_resolve((void**)&glad_glPolygonOffset, "glPolygonOffset"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint arg0, GLint arg1, GLuint * arg2) {
+	((PFNGLGETUNIFORMUIVPROC)glad_lazy_resolve((void**)&glad_glGetUniformuiv, "glGetUniformuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glNormal3fv(const GLfloat * arg0) {
+	((PFNGLNORMAL3FVPROC)glad_lazy_resolve((void**)&glad_glNormal3fv, "glNormal3fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLSECONDARYCOLOR3SPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3s, "glSecondaryColor3s"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferDrawBuffers(GLuint arg0, GLsizei arg1, const GLenum * arg2) {
+	((PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)glad_lazy_resolve((void**)&glad_glNamedFramebufferDrawBuffers, "glNamedFramebufferDrawBuffers"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glDepthRange(GLclampd arg0, GLclampd arg1) {
+	((PFNGLDEPTHRANGEPROC)glad_lazy_resolve((void**)&glad_glDepthRange, "glDepthRange"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glFrustum(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+	((PFNGLFRUSTUMPROC)glad_lazy_resolve((void**)&glad_glFrustum, "glFrustum"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4sv(GLenum arg0, const GLshort * arg1) {
+	((PFNGLMULTITEXCOORD4SVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord4sv, "glMultiTexCoord4sv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexArrayBindingDivisor(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLVERTEXARRAYBINDINGDIVISORPROC)glad_lazy_resolve((void**)&glad_glVertexArrayBindingDivisor, "glVertexArrayBindingDivisor"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum arg0) {
+	((PFNGLDRAWBUFFERPROC)glad_lazy_resolve((void**)&glad_glDrawBuffer, "glDrawBuffer"))(arg0);
+}
+static void APIENTRY glad_lazy_glPushMatrix(void) {
+	((PFNGLPUSHMATRIXPROC)glad_lazy_resolve((void**)&glad_glPushMatrix, "glPushMatrix"))();
+}
+static void APIENTRY glad_lazy_glGetnPixelMapusv(GLenum arg0, GLsizei arg1, GLushort * arg2) {
+	((PFNGLGETNPIXELMAPUSVPROC)glad_lazy_resolve((void**)&glad_glGetnPixelMapusv, "glGetnPixelMapusv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glRasterPos3fv(const GLfloat * arg0) {
+	((PFNGLRASTERPOS3FVPROC)glad_lazy_resolve((void**)&glad_glRasterPos3fv, "glRasterPos3fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glOrtho(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+	((PFNGLORTHOPROC)glad_lazy_resolve((void**)&glad_glOrtho, "glOrtho"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4) {
+	((PFNGLDRAWELEMENTSINSTANCEDPROC)glad_lazy_resolve((void**)&glad_glDrawElementsInstanced, "glDrawElementsInstanced"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glWindowPos3sv(const GLshort * arg0) {
+	((PFNGLWINDOWPOS3SVPROC)glad_lazy_resolve((void**)&glad_glWindowPos3sv, "glWindowPos3sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexAttribL4dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIBL4DVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribL4dv, "glVertexAttribL4dv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glProgramUniform1i(GLuint arg0, GLint arg1, GLint arg2) {
+	((PFNGLPROGRAMUNIFORM1IPROC)glad_lazy_resolve((void**)&glad_glProgramUniform1i, "glProgramUniform1i"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glUniform2dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	((PFNGLUNIFORM2DVPROC)glad_lazy_resolve((void**)&glad_glUniform2dv, "glUniform2dv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniform1d(GLuint arg0, GLint arg1, GLdouble arg2) {
+	((PFNGLPROGRAMUNIFORM1DPROC)glad_lazy_resolve((void**)&glad_glProgramUniform1d, "glProgramUniform1d"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniform1f(GLuint arg0, GLint arg1, GLfloat arg2) {
+	((PFNGLPROGRAMUNIFORM1FPROC)glad_lazy_resolve((void**)&glad_glProgramUniform1f, "glProgramUniform1f"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glClearIndex(GLfloat arg0) {
+	((PFNGLCLEARINDEXPROC)glad_lazy_resolve((void**)&glad_glClearIndex, "glClearIndex"))(arg0);
+}
+static void APIENTRY glad_lazy_glMap1d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLint arg4, const GLdouble * arg5) {
+	((PFNGLMAP1DPROC)glad_lazy_resolve((void**)&glad_glMap1d, "glMap1d"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glMap1f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLint arg4, const GLfloat * arg5) {
+	((PFNGLMAP1FPROC)glad_lazy_resolve((void**)&glad_glMap1f, "glMap1f"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glFlush(void) {
+	((PFNGLFLUSHPROC)glad_lazy_resolve((void**)&glad_glFlush, "glFlush"))();
+}
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glGetRenderbufferParameteriv, "glGetRenderbufferParameteriv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glBeginQueryIndexed(GLenum arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLBEGINQUERYINDEXEDPROC)glad_lazy_resolve((void**)&glad_glBeginQueryIndexed, "glBeginQueryIndexed"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	((PFNGLPROGRAMUNIFORM3IVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform3iv, "glProgramUniform3iv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glIndexiv(const GLint * arg0) {
+	((PFNGLINDEXIVPROC)glad_lazy_resolve((void**)&glad_glIndexiv, "glIndexiv"))(arg0);
+}
+static void APIENTRY glad_lazy_glNamedRenderbufferStorage(GLuint arg0, GLenum arg1, GLsizei arg2, GLsizei arg3) {
+	((PFNGLNAMEDRENDERBUFFERSTORAGEPROC)glad_lazy_resolve((void**)&glad_glNamedRenderbufferStorage, "glNamedRenderbufferStorage"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glRasterPos3sv(const GLshort * arg0) {
+	((PFNGLRASTERPOS3SVPROC)glad_lazy_resolve((void**)&glad_glRasterPos3sv, "glRasterPos3sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint arg0, GLenum arg1, void ** arg2) {
+	((PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_lazy_resolve((void**)&glad_glGetVertexAttribPointerv, "glGetVertexAttribPointerv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glPixelZoom(GLfloat arg0, GLfloat arg1) {
+	((PFNGLPIXELZOOMPROC)glad_lazy_resolve((void**)&glad_glPixelZoom, "glPixelZoom"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glPolygonOffsetClamp(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLPOLYGONOFFSETCLAMPPROC)glad_lazy_resolve((void**)&glad_glPolygonOffsetClamp, "glPolygonOffsetClamp"))(arg0, arg1, arg2);
+}
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum arg0, GLbitfield arg1) {
+	return ((PFNGLFENCESYNCPROC)glad_lazy_resolve((void**)&glad_glFenceSync, "glFenceSync"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETEVERTEXARRAYSPROC)glad_lazy_resolve((void**)&glad_glDeleteVertexArrays, "glDeleteVertexArrays"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glColorP3ui(GLenum arg0, GLuint arg1) {
+	((PFNGLCOLORP3UIPROC)glad_lazy_resolve((void**)&glad_glColorP3ui, "glColorP3ui"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLint arg5, GLuint arg6) {
+	((PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)glad_lazy_resolve((void**)&glad_glDrawElementsInstancedBaseVertexBaseInstance, "glDrawElementsInstancedBaseVertexBaseInstance"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glTextureStorage2DMultisample(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+	((PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)glad_lazy_resolve((void**)&glad_glTextureStorage2DMultisample, "glTextureStorage2DMultisample"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint arg0, const GLshort * arg1) {
+	((PFNGLVERTEXATTRIB3SVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib3sv, "glVertexAttrib3sv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint arg0, GLenum arg1) {
+	((PFNGLBEGINCONDITIONALRENDERPROC)glad_lazy_resolve((void**)&glad_glBeginConditionalRender, "glBeginConditionalRender"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glPushDebugGroup(GLenum arg0, GLuint arg1, GLsizei arg2, const GLchar * arg3) {
+	((PFNGLPUSHDEBUGGROUPPROC)glad_lazy_resolve((void**)&glad_glPushDebugGroup, "glPushDebugGroup"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetShaderPrecisionFormat(GLenum arg0, GLenum arg1, GLint * arg2, GLint * arg3) {
+	((PFNGLGETSHADERPRECISIONFORMATPROC)glad_lazy_resolve((void**)&glad_glGetShaderPrecisionFormat, "glGetShaderPrecisionFormat"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glValidateProgramPipeline(GLuint arg0) {
+	((PFNGLVALIDATEPROGRAMPIPELINEPROC)glad_lazy_resolve((void**)&glad_glValidateProgramPipeline, "glValidateProgramPipeline"))(arg0);
+}
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLint arg4) {
+	((PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve((void**)&glad_glDrawElementsBaseVertex, "glDrawElementsBaseVertex"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum arg0, GLint arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETTEXLEVELPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glGetTexLevelParameteriv, "glGetTexLevelParameteriv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glLighti(GLenum arg0, GLenum arg1, GLint arg2) {
+	((PFNGLLIGHTIPROC)glad_lazy_resolve((void**)&glad_glLighti, "glLighti"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLMULTITEXCOORDP4UIVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoordP4uiv, "glMultiTexCoordP4uiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexArrayVertexBuffer(GLuint arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizei arg4) {
+	((PFNGLVERTEXARRAYVERTEXBUFFERPROC)glad_lazy_resolve((void**)&glad_glVertexArrayVertexBuffer, "glVertexArrayVertexBuffer"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glLightf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLLIGHTFPROC)glad_lazy_resolve((void**)&glad_glLightf, "glLightf"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glBindVertexBuffers(GLuint arg0, GLsizei arg1, const GLuint * arg2, const GLintptr * arg3, const GLsizei * arg4) {
+	((PFNGLBINDVERTEXBUFFERSPROC)glad_lazy_resolve((void**)&glad_glBindVertexBuffers, "glBindVertexBuffers"))(arg0, arg1, arg2, arg3, arg4);
+}
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint arg0, const GLchar * arg1) {
+	return ((PFNGLGETATTRIBLOCATIONPROC)glad_lazy_resolve((void**)&glad_glGetAttribLocation, "glGetAttribLocation"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTexStorage3DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+	((PFNGLTEXSTORAGE3DMULTISAMPLEPROC)glad_lazy_resolve((void**)&glad_glTexStorage3DMultisample, "glTexStorage3DMultisample"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum arg0, GLenum arg1, GLint arg2, GLuint arg3) {
+	((PFNGLSTENCILFUNCSEPARATEPROC)glad_lazy_resolve((void**)&glad_glStencilFuncSeparate, "glStencilFuncSeparate"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glDisableVertexArrayAttrib(GLuint arg0, GLuint arg1) {
+	((PFNGLDISABLEVERTEXARRAYATTRIBPROC)glad_lazy_resolve((void**)&glad_glDisableVertexArrayAttrib, "glDisableVertexArrayAttrib"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENSAMPLERSPROC)glad_lazy_resolve((void**)&glad_glGenSamplers, "glGenSamplers"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glClampColor(GLenum arg0, GLenum arg1) {
+	((PFNGLCLAMPCOLORPROC)glad_lazy_resolve((void**)&glad_glClampColor, "glClampColor"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glUniform4iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	((PFNGLUNIFORM4IVPROC)glad_lazy_resolve((void**)&glad_glUniform4iv, "glUniform4iv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glClearStencil(GLint arg0) {
+	((PFNGLCLEARSTENCILPROC)glad_lazy_resolve((void**)&glad_glClearStencil, "glClearStencil"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLTEXCOORDP1UIVPROC)glad_lazy_resolve((void**)&glad_glTexCoordP1uiv, "glTexCoordP1uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetNamedRenderbufferParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glGetNamedRenderbufferParameteriv, "glGetNamedRenderbufferParameteriv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackInstanced(GLenum arg0, GLuint arg1, GLsizei arg2) {
+	((PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)glad_lazy_resolve((void**)&glad_glDrawTransformFeedbackInstanced, "glDrawTransformFeedbackInstanced"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glSpecializeShader(GLuint arg0, const GLchar * arg1, GLuint arg2, const GLuint * arg3, const GLuint * arg4) {
+	((PFNGLSPECIALIZESHADERPROC)glad_lazy_resolve((void**)&glad_glSpecializeShader, "glSpecializeShader"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3fv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLMULTITEXCOORD3FVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord3fv, "glMultiTexCoord3fv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetPixelMapuiv(GLenum arg0, GLuint * arg1) {
+	((PFNGLGETPIXELMAPUIVPROC)glad_lazy_resolve((void**)&glad_glGetPixelMapuiv, "glGetPixelMapuiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGenTextures(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENTEXTURESPROC)glad_lazy_resolve((void**)&glad_glGenTextures, "glGenTextures"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTexCoord4iv(const GLint * arg0) {
+	((PFNGLTEXCOORD4IVPROC)glad_lazy_resolve((void**)&glad_glTexCoord4iv, "glTexCoord4iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedback(GLenum arg0, GLuint arg1) {
+	((PFNGLDRAWTRANSFORMFEEDBACKPROC)glad_lazy_resolve((void**)&glad_glDrawTransformFeedback, "glDrawTransformFeedback"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glUniform1dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	((PFNGLUNIFORM1DVPROC)glad_lazy_resolve((void**)&glad_glUniform1dv, "glUniform1dv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum arg0, GLenum arg1, GLuint * arg2) {
+	((PFNGLGETTEXPARAMETERIUIVPROC)glad_lazy_resolve((void**)&glad_glGetTexParameterIuiv, "glGetTexParameterIuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbacki_v(GLuint arg0, GLenum arg1, GLuint arg2, GLint * arg3) {
+	((PFNGLGETTRANSFORMFEEDBACKI_VPROC)glad_lazy_resolve((void**)&glad_glGetTransformFeedbacki_v, "glGetTransformFeedbacki_v"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glIndexPointer(GLenum arg0, GLsizei arg1, const GLvoid * arg2) {
+	((PFNGLINDEXPOINTERPROC)glad_lazy_resolve((void**)&glad_glIndexPointer, "glIndexPointer"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetnPolygonStipple(GLsizei arg0, GLubyte * arg1) {
+	((PFNGLGETNPOLYGONSTIPPLEPROC)glad_lazy_resolve((void**)&glad_glGetnPolygonStipple, "glGetnPolygonStipple"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint arg0, const GLbyte * arg1) {
+	((PFNGLVERTEXATTRIB4NBVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4Nbv, "glVertexAttrib4Nbv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferuiv(GLuint arg0, GLenum arg1, GLint arg2, const GLuint * arg3) {
+	((PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)glad_lazy_resolve((void**)&glad_glClearNamedFramebufferuiv, "glClearNamedFramebufferuiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayIndexediv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETVERTEXARRAYINDEXEDIVPROC)glad_lazy_resolve((void**)&glad_glGetVertexArrayIndexediv, "glGetVertexArrayIndexediv"))(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync arg0) {
+	return ((PFNGLISSYNCPROC)glad_lazy_resolve((void**)&glad_glIsSync, "glIsSync"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertex2f(GLfloat arg0, GLfloat arg1) {
+	((PFNGLVERTEX2FPROC)glad_lazy_resolve((void**)&glad_glVertex2f, "glVertex2f"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertex2d(GLdouble arg0, GLdouble arg1) {
+	((PFNGLVERTEX2DPROC)glad_lazy_resolve((void**)&glad_glVertex2d, "glVertex2d"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETERENDERBUFFERSPROC)glad_lazy_resolve((void**)&glad_glDeleteRenderbuffers, "glDeleteRenderbuffers"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glUniform2i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLUNIFORM2IPROC)glad_lazy_resolve((void**)&glad_glUniform2i, "glUniform2i"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMapGrid2d(GLint arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLdouble arg4, GLdouble arg5) {
+	((PFNGLMAPGRID2DPROC)glad_lazy_resolve((void**)&glad_glMapGrid2d, "glMapGrid2d"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glMapGrid2f(GLint arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLfloat arg4, GLfloat arg5) {
+	((PFNGLMAPGRID2FPROC)glad_lazy_resolve((void**)&glad_glMapGrid2f, "glMapGrid2f"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum arg0, GLuint arg1) {
+	((PFNGLTEXCOORDP4UIPROC)glad_lazy_resolve((void**)&glad_glTexCoordP4ui, "glTexCoordP4ui"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertex2i(GLint arg0, GLint arg1) {
+	((PFNGLVERTEX2IPROC)glad_lazy_resolve((void**)&glad_glVertex2i, "glVertex2i"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint arg0, GLint arg1, GLenum arg2, GLboolean arg3, GLsizei arg4, const void * arg5) {
+	((PFNGLVERTEXATTRIBPOINTERPROC)glad_lazy_resolve((void**)&glad_glVertexAttribPointer, "glVertexAttribPointer"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glProgramUniform1ui(GLuint arg0, GLint arg1, GLuint arg2) {
+	((PFNGLPROGRAMUNIFORM1UIPROC)glad_lazy_resolve((void**)&glad_glProgramUniform1ui, "glProgramUniform1ui"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum arg0, GLenum arg1, GLuint arg2, GLint arg3, GLint arg4) {
+	((PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_resolve((void**)&glad_glFramebufferTextureLayer, "glFramebufferTextureLayer"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glVertex2s(GLshort arg0, GLshort arg1) {
+	((PFNGLVERTEX2SPROC)glad_lazy_resolve((void**)&glad_glVertex2s, "glVertex2s"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetObjectPtrLabel(const void * arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	((PFNGLGETOBJECTPTRLABELPROC)glad_lazy_resolve((void**)&glad_glGetObjectPtrLabel, "glGetObjectPtrLabel"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glTextureParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	((PFNGLTEXTUREPARAMETERIPROC)glad_lazy_resolve((void**)&glad_glTextureParameteri, "glTextureParameteri"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glNormal3bv(const GLbyte * arg0) {
+	((PFNGLNORMAL3BVPROC)glad_lazy_resolve((void**)&glad_glNormal3bv, "glNormal3bv"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint arg0, const GLuint * arg1) {
+	((PFNGLVERTEXATTRIB4NUIVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4Nuiv, "glVertexAttrib4Nuiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum arg0, GLintptr arg1, GLsizeiptr arg2) {
+	((PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_lazy_resolve((void**)&glad_glFlushMappedBufferRange, "glFlushMappedBufferRange"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniform2fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	((PFNGLPROGRAMUNIFORM2FVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform2fv, "glProgramUniform2fv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX2X3DVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix2x3dv, "glUniformMatrix2x3dv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX4DVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix4dv, "glProgramUniformMatrix4dv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3sv(const GLshort * arg0) {
+	((PFNGLSECONDARYCOLOR3SVPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3sv, "glSecondaryColor3sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix2x4dv, "glProgramUniformMatrix2x4dv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glDispatchCompute(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLDISPATCHCOMPUTEPROC)glad_lazy_resolve((void**)&glad_glDispatchCompute, "glDispatchCompute"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertex3sv(const GLshort * arg0) {
+	((PFNGLVERTEX3SVPROC)glad_lazy_resolve((void**)&glad_glVertex3sv, "glVertex3sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glGenQueries(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENQUERIESPROC)glad_lazy_resolve((void**)&glad_glGenQueries, "glGenQueries"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetPixelMapfv(GLenum arg0, GLfloat * arg1) {
+	((PFNGLGETPIXELMAPFVPROC)glad_lazy_resolve((void**)&glad_glGetPixelMapfv, "glGetPixelMapfv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTexEnvf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLTEXENVFPROC)glad_lazy_resolve((void**)&glad_glTexEnvf, "glTexEnvf"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBP1UIPROC)glad_lazy_resolve((void**)&glad_glVertexAttribP1ui, "glVertexAttribP1ui"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+	((PFNGLTEXSUBIMAGE3DPROC)glad_lazy_resolve((void**)&glad_glTexSubImage3D, "glTexSubImage3D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum arg0, GLuint arg1, GLint64 * arg2) {
+	((PFNGLGETINTEGER64I_VPROC)glad_lazy_resolve((void**)&glad_glGetInteger64i_v, "glGetInteger64i_v"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glFogCoordd(GLdouble arg0) {
+	((PFNGLFOGCOORDDPROC)glad_lazy_resolve((void**)&glad_glFogCoordd, "glFogCoordd"))(arg0);
+}
+static void APIENTRY glad_lazy_glFogCoordf(GLfloat arg0) {
+	((PFNGLFOGCOORDFPROC)glad_lazy_resolve((void**)&glad_glFogCoordf, "glFogCoordf"))(arg0);
+}
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum arg0, GLint arg1, GLenum arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLint arg7) {
+	((PFNGLCOPYTEXIMAGE2DPROC)glad_lazy_resolve((void**)&glad_glCopyTexImage2D, "glCopyTexImage2D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_lazy_glTexEnvi(GLenum arg0, GLenum arg1, GLint arg2) {
+	((PFNGLTEXENVIPROC)glad_lazy_resolve((void**)&glad_glTexEnvi, "glTexEnvi"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1iv(GLenum arg0, const GLint * arg1) {
+	((PFNGLMULTITEXCOORD1IVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord1iv, "glMultiTexCoord1iv"))(arg0, arg1);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum arg0, GLuint arg1) {
+	return ((PFNGLISENABLEDIPROC)glad_lazy_resolve((void**)&glad_glIsEnabledi, "glIsEnabledi"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glBindBuffersRange(GLenum arg0, GLuint arg1, GLsizei arg2, const GLuint * arg3, const GLintptr * arg4, const GLsizeiptr * arg5) {
+	((PFNGLBINDBUFFERSRANGEPROC)glad_lazy_resolve((void**)&glad_glBindBuffersRange, "glBindBuffersRange"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum arg0, GLuint arg1) {
+	((PFNGLSECONDARYCOLORP3UIPROC)glad_lazy_resolve((void**)&glad_glSecondaryColorP3ui, "glSecondaryColorP3ui"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint arg0, GLint arg1, GLint arg2) {
+	((PFNGLVERTEXATTRIBI2IPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI2i, "glVertexAttribI2i"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint arg0, GLuint arg1, GLuint arg2, const GLchar * arg3) {
+	((PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_lazy_resolve((void**)&glad_glBindFragDataLocationIndexed, "glBindFragDataLocationIndexed"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glCopyImageSubData(GLuint arg0, GLenum arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLuint arg6, GLenum arg7, GLint arg8, GLint arg9, GLint arg10, GLint arg11, GLsizei arg12, GLsizei arg13, GLsizei arg14) {
+	((PFNGLCOPYIMAGESUBDATAPROC)glad_lazy_resolve((void**)&glad_glCopyImageSubData, "glCopyImageSubData"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2dv(GLenum arg0, const GLdouble * arg1) {
+	((PFNGLMULTITEXCOORD2DVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord2dv, "glMultiTexCoord2dv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glUniform2iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	((PFNGLUNIFORM2IVPROC)glad_lazy_resolve((void**)&glad_glUniform2iv, "glUniform2iv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint arg0, const GLfloat * arg1) {
+	((PFNGLVERTEXATTRIB1FVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib1fv, "glVertexAttrib1fv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetInternalformativ(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, GLint * arg4) {
+	((PFNGLGETINTERNALFORMATIVPROC)glad_lazy_resolve((void**)&glad_glGetInternalformativ, "glGetInternalformativ"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glUniform4uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLUNIFORM4UIVPROC)glad_lazy_resolve((void**)&glad_glUniform4uiv, "glUniform4uiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMatrixMode(GLenum arg0) {
+	((PFNGLMATRIXMODEPROC)glad_lazy_resolve((void**)&glad_glMatrixMode, "glMatrixMode"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetTextureImage(GLuint arg0, GLint arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	((PFNGLGETTEXTUREIMAGEPROC)glad_lazy_resolve((void**)&glad_glGetTextureImage, "glGetTextureImage"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glFeedbackBuffer(GLsizei arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLFEEDBACKBUFFERPROC)glad_lazy_resolve((void**)&glad_glFeedbackBuffer, "glFeedbackBuffer"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniform2dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	((PFNGLPROGRAMUNIFORM2DVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform2dv, "glProgramUniform2dv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glEndQueryIndexed(GLenum arg0, GLuint arg1) {
+	((PFNGLENDQUERYINDEXEDPROC)glad_lazy_resolve((void**)&glad_glEndQueryIndexed, "glEndQueryIndexed"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetMapiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETMAPIVPROC)glad_lazy_resolve((void**)&glad_glGetMapiv, "glGetMapiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTextureSubImage3D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+	((PFNGLTEXTURESUBIMAGE3DPROC)glad_lazy_resolve((void**)&glad_glTextureSubImage3D, "glTextureSubImage3D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4) {
+	((PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_lazy_resolve((void**)&glad_glFramebufferTexture1D, "glFramebufferTexture1D"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glUniform4d(GLint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	((PFNGLUNIFORM4DPROC)glad_lazy_resolve((void**)&glad_glUniform4d, "glUniform4d"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETSHADERIVPROC)glad_lazy_resolve((void**)&glad_glGetShaderiv, "glGetShaderiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2d(GLenum arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLMULTITEXCOORD2DPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord2d, "glMultiTexCoord2d"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2f(GLenum arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLMULTITEXCOORD2FPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord2f, "glMultiTexCoord2f"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX3FVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix3fv, "glProgramUniformMatrix3fv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glObjectPtrLabel(const void * arg0, GLsizei arg1, const GLchar * arg2) {
+	((PFNGLOBJECTPTRLABELPROC)glad_lazy_resolve((void**)&glad_glObjectPtrLabel, "glObjectPtrLabel"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glInvalidateFramebuffer(GLenum arg0, GLsizei arg1, const GLenum * arg2) {
+	((PFNGLINVALIDATEFRAMEBUFFERPROC)glad_lazy_resolve((void**)&glad_glInvalidateFramebuffer, "glInvalidateFramebuffer"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glBindTextures(GLuint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLBINDTEXTURESPROC)glad_lazy_resolve((void**)&glad_glBindTextures, "glBindTextures"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint arg0, GLuint arg1, const GLchar * arg2) {
+	((PFNGLBINDFRAGDATALOCATIONPROC)glad_lazy_resolve((void**)&glad_glBindFragDataLocation, "glBindFragDataLocation"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glNamedBufferStorage(GLuint arg0, GLsizeiptr arg1, const void * arg2, GLbitfield arg3) {
+	((PFNGLNAMEDBUFFERSTORAGEPROC)glad_lazy_resolve((void**)&glad_glNamedBufferStorage, "glNamedBufferStorage"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glScissorArrayv(GLuint arg0, GLsizei arg1, const GLint * arg2) {
+	((PFNGLSCISSORARRAYVPROC)glad_lazy_resolve((void**)&glad_glScissorArrayv, "glScissorArrayv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glPrioritizeTextures(GLsizei arg0, const GLuint * arg1, const GLclampf * arg2) {
+	((PFNGLPRIORITIZETEXTURESPROC)glad_lazy_resolve((void**)&glad_glPrioritizeTextures, "glPrioritizeTextures"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glCallList(GLuint arg0) {
+	((PFNGLCALLLISTPROC)glad_lazy_resolve((void**)&glad_glCallList, "glCallList"))(arg0);
+}
+static void APIENTRY glad_lazy_glPatchParameterfv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLPATCHPARAMETERFVPROC)glad_lazy_resolve((void**)&glad_glPatchParameterfv, "glPatchParameterfv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ubv(const GLubyte * arg0) {
+	((PFNGLSECONDARYCOLOR3UBVPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3ubv, "glSecondaryColor3ubv"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetDoublev(GLenum arg0, GLdouble * arg1) {
+	((PFNGLGETDOUBLEVPROC)glad_lazy_resolve((void**)&glad_glGetDoublev, "glGetDoublev"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3iv(GLenum arg0, const GLint * arg1) {
+	((PFNGLMULTITEXCOORD3IVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord3iv, "glMultiTexCoord3iv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint arg0, GLdouble arg1) {
+	((PFNGLVERTEXATTRIB1DPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib1d, "glVertexAttrib1d"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glUniform4dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	((PFNGLUNIFORM4DVPROC)glad_lazy_resolve((void**)&glad_glUniform4dv, "glUniform4dv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glLightModelf(GLenum arg0, GLfloat arg1) {
+	((PFNGLLIGHTMODELFPROC)glad_lazy_resolve((void**)&glad_glLightModelf, "glLightModelf"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint arg0, GLint arg1, GLint * arg2) {
+	((PFNGLGETUNIFORMIVPROC)glad_lazy_resolve((void**)&glad_glGetUniformiv, "glGetUniformiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glInvalidateBufferData(GLuint arg0) {
+	((PFNGLINVALIDATEBUFFERDATAPROC)glad_lazy_resolve((void**)&glad_glInvalidateBufferData, "glInvalidateBufferData"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertex2sv(const GLshort * arg0) {
+	((PFNGLVERTEX2SVPROC)glad_lazy_resolve((void**)&glad_glVertex2sv, "glVertex2sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexArrayVertexBuffers(GLuint arg0, GLuint arg1, GLsizei arg2, const GLuint * arg3, const GLintptr * arg4, const GLsizei * arg5) {
+	((PFNGLVERTEXARRAYVERTEXBUFFERSPROC)glad_lazy_resolve((void**)&glad_glVertexArrayVertexBuffers, "glVertexArrayVertexBuffers"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage1D(GLuint arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLsizei arg5, const void * arg6) {
+	((PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)glad_lazy_resolve((void**)&glad_glCompressedTextureSubImage1D, "glCompressedTextureSubImage1D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glLightModeli(GLenum arg0, GLint arg1) {
+	((PFNGLLIGHTMODELIPROC)glad_lazy_resolve((void**)&glad_glLightModeli, "glLightModeli"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glWindowPos3iv(const GLint * arg0) {
+	((PFNGLWINDOWPOS3IVPROC)glad_lazy_resolve((void**)&glad_glWindowPos3iv, "glWindowPos3iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLMULTITEXCOORDP1UIVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoordP1uiv, "glMultiTexCoordP1uiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glUniform3fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	((PFNGLUNIFORM3FVPROC)glad_lazy_resolve((void**)&glad_glUniform3fv, "glUniform3fv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glPixelStorei(GLenum arg0, GLint arg1) {
+	((PFNGLPIXELSTOREIPROC)glad_lazy_resolve((void**)&glad_glPixelStorei, "glPixelStorei"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetProgramPipelineInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	((PFNGLGETPROGRAMPIPELINEINFOLOGPROC)glad_lazy_resolve((void**)&glad_glGetProgramPipelineInfoLog, "glGetProgramPipelineInfoLog"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glCallLists(GLsizei arg0, GLenum arg1, const GLvoid * arg2) {
+	((PFNGLCALLLISTSPROC)glad_lazy_resolve((void**)&glad_glCallLists, "glCallLists"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix3x4fv, "glProgramUniformMatrix3x4fv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glInvalidateSubFramebuffer(GLenum arg0, GLsizei arg1, const GLenum * arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6) {
+	((PFNGLINVALIDATESUBFRAMEBUFFERPROC)glad_lazy_resolve((void**)&glad_glInvalidateSubFramebuffer, "glInvalidateSubFramebuffer"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum arg0, GLenum arg1) {
+	return ((PFNGLMAPBUFFERPROC)glad_lazy_resolve((void**)&glad_glMapBuffer, "glMapBuffer"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLSECONDARYCOLOR3DPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3d, "glSecondaryColor3d"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexCoord3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLTEXCOORD3IPROC)glad_lazy_resolve((void**)&glad_glTexCoord3i, "glTexCoord3i"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4fv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLMULTITEXCOORD4FVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord4fv, "glMultiTexCoord4fv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glRasterPos3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLRASTERPOS3IPROC)glad_lazy_resolve((void**)&glad_glRasterPos3i, "glRasterPos3i"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+	((PFNGLSECONDARYCOLOR3BPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3b, "glSecondaryColor3b"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glRasterPos3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLRASTERPOS3DPROC)glad_lazy_resolve((void**)&glad_glRasterPos3d, "glRasterPos3d"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glRasterPos3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLRASTERPOS3FPROC)glad_lazy_resolve((void**)&glad_glRasterPos3f, "glRasterPos3f"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLint arg6, GLsizei arg7, const void * arg8) {
+	((PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_lazy_resolve((void**)&glad_glCompressedTexImage3D, "glCompressedTexImage3D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_lazy_glTexCoord3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLTEXCOORD3FPROC)glad_lazy_resolve((void**)&glad_glTexCoord3f, "glTexCoord3f"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glDeleteSync(GLsync arg0) {
+	((PFNGLDELETESYNCPROC)glad_lazy_resolve((void**)&glad_glDeleteSync, "glDeleteSync"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexCoord3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLTEXCOORD3DPROC)glad_lazy_resolve((void**)&glad_glTexCoord3d, "glTexCoord3d"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbacki64_v(GLuint arg0, GLenum arg1, GLuint arg2, GLint64 * arg3) {
+	((PFNGLGETTRANSFORMFEEDBACKI64_VPROC)glad_lazy_resolve((void**)&glad_glGetTransformFeedbacki64_v, "glGetTransformFeedbacki64_v"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX4DVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix4dv, "glUniformMatrix4dv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+	((PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_lazy_resolve((void**)&glad_glTexImage2DMultisample, "glTexImage2DMultisample"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETVERTEXATTRIBIVPROC)glad_lazy_resolve((void**)&glad_glGetVertexAttribiv, "glGetVertexAttribiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX4X2DVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix4x2dv, "glUniformMatrix4x2dv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum arg0, const GLsizei * arg1, GLenum arg2, const void *const* arg3, GLsizei arg4) {
+	((PFNGLMULTIDRAWELEMENTSPROC)glad_lazy_resolve((void**)&glad_glMultiDrawElements, "glMultiDrawElements"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint arg0, const GLfloat * arg1) {
+	((PFNGLVERTEXATTRIB3FVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib3fv, "glVertexAttrib3fv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTexCoord3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLTEXCOORD3SPROC)glad_lazy_resolve((void**)&glad_glTexCoord3s, "glTexCoord3s"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glUniform3iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	((PFNGLUNIFORM3IVPROC)glad_lazy_resolve((void**)&glad_glUniform3iv, "glUniform3iv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glRasterPos3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLRASTERPOS3SPROC)glad_lazy_resolve((void**)&glad_glRasterPos3s, "glRasterPos3s"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glPolygonMode(GLenum arg0, GLenum arg1) {
+	((PFNGLPOLYGONMODEPROC)glad_lazy_resolve((void**)&glad_glPolygonMode, "glPolygonMode"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei arg0, const GLenum * arg1) {
+	((PFNGLDRAWBUFFERSPROC)glad_lazy_resolve((void**)&glad_glDrawBuffers, "glDrawBuffers"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetnHistogram(GLenum arg0, GLboolean arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	((PFNGLGETNHISTOGRAMPROC)glad_lazy_resolve((void**)&glad_glGetnHistogram, "glGetnHistogram"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_lazy_resolve((void**)&glad_glGetActiveUniformBlockiv, "glGetActiveUniformBlockiv"))(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_lazy_glAreTexturesResident(GLsizei arg0, const GLuint * arg1, GLboolean * arg2) {
+	return ((PFNGLARETEXTURESRESIDENTPROC)glad_lazy_resolve((void**)&glad_glAreTexturesResident, "glAreTexturesResident"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniform2d(GLuint arg0, GLint arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLPROGRAMUNIFORM2DPROC)glad_lazy_resolve((void**)&glad_glProgramUniform2d, "glProgramUniform2d"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix4x3dv, "glProgramUniformMatrix4x3dv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static GLboolean APIENTRY glad_lazy_glIsList(GLuint arg0) {
+	return ((PFNGLISLISTPROC)glad_lazy_resolve((void**)&glad_glIsList, "glIsList"))(arg0);
+}
+static void APIENTRY glad_lazy_glProgramUniform4iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	((PFNGLPROGRAMUNIFORM4IVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform4iv, "glProgramUniform4iv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glRasterPos2sv(const GLshort * arg0) {
+	((PFNGLRASTERPOS2SVPROC)glad_lazy_resolve((void**)&glad_glRasterPos2sv, "glRasterPos2sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glRasterPos4sv(const GLshort * arg0) {
+	((PFNGLRASTERPOS4SVPROC)glad_lazy_resolve((void**)&glad_glRasterPos4sv, "glRasterPos4sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glColor4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLCOLOR4SPROC)glad_lazy_resolve((void**)&glad_glColor4s, "glColor4s"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetProgramBinary(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLenum * arg3, void * arg4) {
+	((PFNGLGETPROGRAMBINARYPROC)glad_lazy_resolve((void**)&glad_glGetProgramBinary, "glGetProgramBinary"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glUseProgram(GLuint arg0) {
+	((PFNGLUSEPROGRAMPROC)glad_lazy_resolve((void**)&glad_glUseProgram, "glUseProgram"))(arg0);
+}
+static void APIENTRY glad_lazy_glLineStipple(GLint arg0, GLushort arg1) {
+	((PFNGLLINESTIPPLEPROC)glad_lazy_resolve((void**)&glad_glLineStipple, "glLineStipple"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1sv(GLenum arg0, const GLshort * arg1) {
+	((PFNGLMULTITEXCOORD1SVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord1sv, "glMultiTexCoord1sv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	((PFNGLGETPROGRAMINFOLOGPROC)glad_lazy_resolve((void**)&glad_glGetProgramInfoLog, "glGetProgramInfoLog"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glClearTexImage(GLuint arg0, GLint arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	((PFNGLCLEARTEXIMAGEPROC)glad_lazy_resolve((void**)&glad_glClearTexImage, "glClearTexImage"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETBUFFERPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glGetBufferParameteriv, "glGetBufferParameteriv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2iv(GLenum arg0, const GLint * arg1) {
+	((PFNGLMULTITEXCOORD2IVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord2iv, "glMultiTexCoord2iv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX2X4FVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix2x4fv, "glUniformMatrix2x4fv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint arg0) {
+	((PFNGLBINDVERTEXARRAYPROC)glad_lazy_resolve((void**)&glad_glBindVertexArray, "glBindVertexArray"))(arg0);
+}
+static void APIENTRY glad_lazy_glColor4b(GLbyte arg0, GLbyte arg1, GLbyte arg2, GLbyte arg3) {
+	((PFNGLCOLOR4BPROC)glad_lazy_resolve((void**)&glad_glColor4b, "glColor4b"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLSECONDARYCOLOR3FPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3f, "glSecondaryColor3f"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glColor4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLCOLOR4FPROC)glad_lazy_resolve((void**)&glad_glColor4f, "glColor4f"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glColor4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLCOLOR4DPROC)glad_lazy_resolve((void**)&glad_glColor4d, "glColor4d"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glColor4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLCOLOR4IPROC)glad_lazy_resolve((void**)&glad_glColor4i, "glColor4i"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLSAMPLERPARAMETERIIVPROC)glad_lazy_resolve((void**)&glad_glSamplerParameterIiv, "glSamplerParameterIiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum arg0, const GLsizei * arg1, GLenum arg2, const void *const* arg3, GLsizei arg4, const GLint * arg5) {
+	((PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve((void**)&glad_glMultiDrawElementsBaseVertex, "glMultiDrawElementsBaseVertex"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glVertexAttribLFormat(GLuint arg0, GLint arg1, GLenum arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBLFORMATPROC)glad_lazy_resolve((void**)&glad_glVertexAttribLFormat, "glVertexAttribLFormat"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glRasterPos3iv(const GLint * arg0) {
+	((PFNGLRASTERPOS3IVPROC)glad_lazy_resolve((void**)&glad_glRasterPos3iv, "glRasterPos3iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glTextureStorage2D(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLTEXTURESTORAGE2DPROC)glad_lazy_resolve((void**)&glad_glTextureStorage2D, "glTextureStorage2D"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGenerateTextureMipmap(GLuint arg0) {
+	((PFNGLGENERATETEXTUREMIPMAPPROC)glad_lazy_resolve((void**)&glad_glGenerateTextureMipmap, "glGenerateTextureMipmap"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertex2dv(const GLdouble * arg0) {
+	((PFNGLVERTEX2DVPROC)glad_lazy_resolve((void**)&glad_glVertex2dv, "glVertex2dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexCoord4sv(const GLshort * arg0) {
+	((PFNGLTEXCOORD4SVPROC)glad_lazy_resolve((void**)&glad_glTexCoord4sv, "glTexCoord4sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glUniform2uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLUNIFORM2UIVPROC)glad_lazy_resolve((void**)&glad_glUniform2uiv, "glUniform2uiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLsizei arg5, const void * arg6) {
+	((PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_lazy_resolve((void**)&glad_glCompressedTexSubImage1D, "glCompressedTexSubImage1D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glFinish(void) {
+	((PFNGLFINISHPROC)glad_lazy_resolve((void**)&glad_glFinish, "glFinish"))();
+}
+static void APIENTRY glad_lazy_glDepthRangeIndexed(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLDEPTHRANGEINDEXEDPROC)glad_lazy_resolve((void**)&glad_glDepthRangeIndexed, "glDepthRangeIndexed"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum arg0, GLboolean * arg1) {
+	((PFNGLGETBOOLEANVPROC)glad_lazy_resolve((void**)&glad_glGetBooleanv, "glGetBooleanv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glDeleteShader(GLuint arg0) {
+	((PFNGLDELETESHADERPROC)glad_lazy_resolve((void**)&glad_glDeleteShader, "glDeleteShader"))(arg0);
+}
+static void APIENTRY glad_lazy_glDrawElements(GLenum arg0, GLsizei arg1, GLenum arg2, const GLvoid * arg3) {
+	((PFNGLDRAWELEMENTSPROC)glad_lazy_resolve((void**)&glad_glDrawElements, "glDrawElements"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetInternalformati64v(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, GLint64 * arg4) {
+	((PFNGLGETINTERNALFORMATI64VPROC)glad_lazy_resolve((void**)&glad_glGetInternalformati64v, "glGetInternalformati64v"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glRasterPos2s(GLshort arg0, GLshort arg1) {
+	((PFNGLRASTERPOS2SPROC)glad_lazy_resolve((void**)&glad_glRasterPos2s, "glRasterPos2s"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage1D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5) {
+	((PFNGLCOPYTEXTURESUBIMAGE1DPROC)glad_lazy_resolve((void**)&glad_glCopyTextureSubImage1D, "glCopyTextureSubImage1D"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glGetMapdv(GLenum arg0, GLenum arg1, GLdouble * arg2) {
+	((PFNGLGETMAPDVPROC)glad_lazy_resolve((void**)&glad_glGetMapdv, "glGetMapdv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint arg0, const GLshort * arg1) {
+	((PFNGLVERTEXATTRIB4NSVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4Nsv, "glVertexAttrib4Nsv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glMaterialfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLMATERIALFVPROC)glad_lazy_resolve((void**)&glad_glMaterialfv, "glMaterialfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTextureParameterIuiv(GLuint arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLTEXTUREPARAMETERIUIVPROC)glad_lazy_resolve((void**)&glad_glTextureParameterIuiv, "glTextureParameterIuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glViewport(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+	((PFNGLVIEWPORTPROC)glad_lazy_resolve((void**)&glad_glViewport, "glViewport"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniform1uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLUNIFORM1UIVPROC)glad_lazy_resolve((void**)&glad_glUniform1uiv, "glUniform1uiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint arg0, GLsizei arg1, const GLchar *const* arg2, GLenum arg3) {
+	((PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_lazy_resolve((void**)&glad_glTransformFeedbackVaryings, "glTransformFeedbackVaryings"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glIndexdv(const GLdouble * arg0) {
+	((PFNGLINDEXDVPROC)glad_lazy_resolve((void**)&glad_glIndexdv, "glIndexdv"))(arg0);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLsizei arg7, GLsizei arg8) {
+	((PFNGLCOPYTEXSUBIMAGE3DPROC)glad_lazy_resolve((void**)&glad_glCopyTexSubImage3D, "glCopyTexSubImage3D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_lazy_glTexCoord3iv(const GLint * arg0) {
+	((PFNGLTEXCOORD3IVPROC)glad_lazy_resolve((void**)&glad_glTexCoord3iv, "glTexCoord3iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glDebugMessageCallback(GLDEBUGPROC arg0, const void * arg1) {
+	((PFNGLDEBUGMESSAGECALLBACKPROC)glad_lazy_resolve((void**)&glad_glDebugMessageCallback, "glDebugMessageCallback"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLVERTEXATTRIBI3IPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI3i, "glVertexAttribI3i"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glInvalidateTexImage(GLuint arg0, GLint arg1) {
+	((PFNGLINVALIDATETEXIMAGEPROC)glad_lazy_resolve((void**)&glad_glInvalidateTexImage, "glInvalidateTexImage"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttribFormat(GLuint arg0, GLint arg1, GLenum arg2, GLboolean arg3, GLuint arg4) {
+	((PFNGLVERTEXATTRIBFORMATPROC)glad_lazy_resolve((void**)&glad_glVertexAttribFormat, "glVertexAttribFormat"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glClearDepth(GLclampd arg0) {
+	((PFNGLCLEARDEPTHPROC)glad_lazy_resolve((void**)&glad_glClearDepth, "glClearDepth"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint arg0, const GLushort * arg1) {
+	((PFNGLVERTEXATTRIBI4USVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI4usv, "glVertexAttribI4usv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTexParameterf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLTEXPARAMETERFPROC)glad_lazy_resolve((void**)&glad_glTexParameterf, "glTexParameterf"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttribBinding(GLuint arg0, GLuint arg1) {
+	((PFNGLVERTEXATTRIBBINDINGPROC)glad_lazy_resolve((void**)&glad_glVertexAttribBinding, "glVertexAttribBinding"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTexParameteri(GLenum arg0, GLenum arg1, GLint arg2) {
+	((PFNGLTEXPARAMETERIPROC)glad_lazy_resolve((void**)&glad_glTexParameteri, "glTexParameteri"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformiv(GLuint arg0, GLenum arg1, GLuint arg2, GLenum arg3, GLint * arg4) {
+	((PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)glad_lazy_resolve((void**)&glad_glGetActiveSubroutineUniformiv, "glGetActiveSubroutineUniformiv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	((PFNGLGETSHADERSOURCEPROC)glad_lazy_resolve((void**)&glad_glGetShaderSource, "glGetShaderSource"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glCreateTransformFeedbacks(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATETRANSFORMFEEDBACKSPROC)glad_lazy_resolve((void**)&glad_glCreateTransformFeedbacks, "glCreateTransformFeedbacks"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetnTexImage(GLenum arg0, GLint arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	((PFNGLGETNTEXIMAGEPROC)glad_lazy_resolve((void**)&glad_glGetnTexImage, "glGetnTexImage"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glTexBuffer(GLenum arg0, GLenum arg1, GLuint arg2) {
+	((PFNGLTEXBUFFERPROC)glad_lazy_resolve((void**)&glad_glTexBuffer, "glTexBuffer"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glPopName(void) {
+	((PFNGLPOPNAMEPROC)glad_lazy_resolve((void**)&glad_glPopName, "glPopName"))();
+}
+static void APIENTRY glad_lazy_glValidateProgram(GLuint arg0) {
+	((PFNGLVALIDATEPROGRAMPROC)glad_lazy_resolve((void**)&glad_glValidateProgram, "glValidateProgram"))(arg0);
+}
+static void APIENTRY glad_lazy_glPixelStoref(GLenum arg0, GLfloat arg1) {
+	((PFNGLPIXELSTOREFPROC)glad_lazy_resolve((void**)&glad_glPixelStoref, "glPixelStoref"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glUniform3uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLUNIFORM3UIVPROC)glad_lazy_resolve((void**)&glad_glUniform3uiv, "glUniform3uiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glViewportIndexedf(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	((PFNGLVIEWPORTINDEXEDFPROC)glad_lazy_resolve((void**)&glad_glViewportIndexedf, "glViewportIndexedf"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glRasterPos4fv(const GLfloat * arg0) {
+	((PFNGLRASTERPOS4FVPROC)glad_lazy_resolve((void**)&glad_glRasterPos4fv, "glRasterPos4fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glEvalCoord1dv(const GLdouble * arg0) {
+	((PFNGLEVALCOORD1DVPROC)glad_lazy_resolve((void**)&glad_glEvalCoord1dv, "glEvalCoord1dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLMULTITEXCOORDP2UIVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoordP2uiv, "glMultiTexCoordP2uiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGenProgramPipelines(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENPROGRAMPIPELINESPROC)glad_lazy_resolve((void**)&glad_glGenProgramPipelines, "glGenProgramPipelines"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glRecti(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLRECTIPROC)glad_lazy_resolve((void**)&glad_glRecti, "glRecti"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glColor4ub(GLubyte arg0, GLubyte arg1, GLubyte arg2, GLubyte arg3) {
+	((PFNGLCOLOR4UBPROC)glad_lazy_resolve((void**)&glad_glColor4ub, "glColor4ub"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glMultTransposeMatrixf(const GLfloat * arg0) {
+	((PFNGLMULTTRANSPOSEMATRIXFPROC)glad_lazy_resolve((void**)&glad_glMultTransposeMatrixf, "glMultTransposeMatrixf"))(arg0);
+}
+static void APIENTRY glad_lazy_glRectf(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLRECTFPROC)glad_lazy_resolve((void**)&glad_glRectf, "glRectf"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glRectd(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLRECTDPROC)glad_lazy_resolve((void**)&glad_glRectd, "glRectd"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glNormal3sv(const GLshort * arg0) {
+	((PFNGLNORMAL3SVPROC)glad_lazy_resolve((void**)&glad_glNormal3sv, "glNormal3sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glNewList(GLuint arg0, GLenum arg1) {
+	((PFNGLNEWLISTPROC)glad_lazy_resolve((void**)&glad_glNewList, "glNewList"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix2x3dv, "glProgramUniformMatrix2x3dv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glColor4us(GLushort arg0, GLushort arg1, GLushort arg2, GLushort arg3) {
+	((PFNGLCOLOR4USPROC)glad_lazy_resolve((void**)&glad_glColor4us, "glColor4us"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	((PFNGLVERTEXATTRIBP1UIVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribP1uiv, "glVertexAttribP1uiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glLinkProgram(GLuint arg0) {
+	((PFNGLLINKPROGRAMPROC)glad_lazy_resolve((void**)&glad_glLinkProgram, "glLinkProgram"))(arg0);
+}
+static void APIENTRY glad_lazy_glHint(GLenum arg0, GLenum arg1) {
+	((PFNGLHINTPROC)glad_lazy_resolve((void**)&glad_glHint, "glHint"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glRects(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLRECTSPROC)glad_lazy_resolve((void**)&glad_glRects, "glRects"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glTexCoord2dv(const GLdouble * arg0) {
+	((PFNGLTEXCOORD2DVPROC)glad_lazy_resolve((void**)&glad_glTexCoord2dv, "glTexCoord2dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glRasterPos4iv(const GLint * arg0) {
+	((PFNGLRASTERPOS4IVPROC)glad_lazy_resolve((void**)&glad_glRasterPos4iv, "glRasterPos4iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetObjectLabel(GLenum arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+	((PFNGLGETOBJECTLABELPROC)glad_lazy_resolve((void**)&glad_glGetObjectLabel, "glGetObjectLabel"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glProgramUniform2f(GLuint arg0, GLint arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLPROGRAMUNIFORM2FPROC)glad_lazy_resolve((void**)&glad_glProgramUniform2f, "glProgramUniform2f"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	((PFNGLVERTEXATTRIBP2UIVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribP2uiv, "glVertexAttribP2uiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glEdgeFlagv(const GLboolean * arg0) {
+	((PFNGLEDGEFLAGVPROC)glad_lazy_resolve((void**)&glad_glEdgeFlagv, "glEdgeFlagv"))(arg0);
+}
+static void APIENTRY glad_lazy_glDetachShader(GLuint arg0, GLuint arg1) {
+	((PFNGLDETACHSHADERPROC)glad_lazy_resolve((void**)&glad_glDetachShader, "glDetachShader"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glProgramUniform3i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	((PFNGLPROGRAMUNIFORM3IPROC)glad_lazy_resolve((void**)&glad_glProgramUniform3i, "glProgramUniform3i"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glScalef(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLSCALEFPROC)glad_lazy_resolve((void**)&glad_glScalef, "glScalef"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glEndQuery(GLenum arg0) {
+	((PFNGLENDQUERYPROC)glad_lazy_resolve((void**)&glad_glEndQuery, "glEndQuery"))(arg0);
+}
+static void APIENTRY glad_lazy_glScaled(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLSCALEDPROC)glad_lazy_resolve((void**)&glad_glScaled, "glScaled"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glEdgeFlagPointer(GLsizei arg0, const GLvoid * arg1) {
+	((PFNGLEDGEFLAGPOINTERPROC)glad_lazy_resolve((void**)&glad_glEdgeFlagPointer, "glEdgeFlagPointer"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glFramebufferParameteri(GLenum arg0, GLenum arg1, GLint arg2) {
+	((PFNGLFRAMEBUFFERPARAMETERIPROC)glad_lazy_resolve((void**)&glad_glFramebufferParameteri, "glFramebufferParameteri"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetProgramResourceName(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, GLsizei * arg4, GLchar * arg5) {
+	((PFNGLGETPROGRAMRESOURCENAMEPROC)glad_lazy_resolve((void**)&glad_glGetProgramResourceName, "glGetProgramResourceName"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX4X3DVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix4x3dv, "glUniformMatrix4x3dv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glDepthRangeArrayv(GLuint arg0, GLsizei arg1, const GLdouble * arg2) {
+	((PFNGLDEPTHRANGEARRAYVPROC)glad_lazy_resolve((void**)&glad_glDepthRangeArrayv, "glDepthRangeArrayv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glCopyPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4) {
+	((PFNGLCOPYPIXELSPROC)glad_lazy_resolve((void**)&glad_glCopyPixels, "glCopyPixels"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLVERTEXATTRIBI2UIPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI2ui, "glVertexAttribI2ui"))(arg0, arg1, arg2);
+}
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocation(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	return ((PFNGLGETPROGRAMRESOURCELOCATIONPROC)glad_lazy_resolve((void**)&glad_glGetProgramResourceLocation, "glGetProgramResourceLocation"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glPopAttrib(void) {
+	((PFNGLPOPATTRIBPROC)glad_lazy_resolve((void**)&glad_glPopAttrib, "glPopAttrib"))();
+}
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETETEXTURESPROC)glad_lazy_resolve((void**)&glad_glDeleteTextures, "glDeleteTextures"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetActiveAtomicCounterBufferiv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)glad_lazy_resolve((void**)&glad_glGetActiveAtomicCounterBufferiv, "glGetActiveAtomicCounterBufferiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3) {
+	((PFNGLSTENCILOPSEPARATEPROC)glad_lazy_resolve((void**)&glad_glStencilOpSeparate, "glStencilOpSeparate"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetTextureParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTEXTUREPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glGetTextureParameteriv, "glGetTextureParameteriv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETEQUERIESPROC)glad_lazy_resolve((void**)&glad_glDeleteQueries, "glDeleteQueries"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLNORMALP3UIVPROC)glad_lazy_resolve((void**)&glad_glNormalP3uiv, "glNormalP3uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	((PFNGLVERTEXATTRIB4FPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4f, "glVertexAttrib4f"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	((PFNGLVERTEXATTRIB4DPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4d, "glVertexAttrib4d"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glViewportIndexedfv(GLuint arg0, const GLfloat * arg1) {
+	((PFNGLVIEWPORTINDEXEDFVPROC)glad_lazy_resolve((void**)&glad_glViewportIndexedfv, "glViewportIndexedfv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glInitNames(void) {
+	((PFNGLINITNAMESPROC)glad_lazy_resolve((void**)&glad_glInitNames, "glInitNames"))();
+}
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum arg0, GLenum arg1, GLint64 * arg2) {
+	((PFNGLGETBUFFERPARAMETERI64VPROC)glad_lazy_resolve((void**)&glad_glGetBufferParameteri64v, "glGetBufferParameteri64v"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glColor3dv(const GLdouble * arg0) {
+	((PFNGLCOLOR3DVPROC)glad_lazy_resolve((void**)&glad_glColor3dv, "glColor3dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint arg0, GLint arg1) {
+	((PFNGLVERTEXATTRIBI1IPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI1i, "glVertexAttribI1i"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTEXPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glGetTexParameteriv, "glGetTexParameteriv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glWaitSync(GLsync arg0, GLbitfield arg1, GLuint64 arg2) {
+	((PFNGLWAITSYNCPROC)glad_lazy_resolve((void**)&glad_glWaitSync, "glWaitSync"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glCreateVertexArrays(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATEVERTEXARRAYSPROC)glad_lazy_resolve((void**)&glad_glCreateVertexArrays, "glCreateVertexArrays"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glProgramUniform1dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	((PFNGLPROGRAMUNIFORM1DVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform1dv, "glProgramUniform1dv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint arg0, GLshort arg1, GLshort arg2, GLshort arg3, GLshort arg4) {
+	((PFNGLVERTEXATTRIB4SPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4s, "glVertexAttrib4s"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glColorMaterial(GLenum arg0, GLenum arg1) {
+	((PFNGLCOLORMATERIALPROC)glad_lazy_resolve((void**)&glad_glColorMaterial, "glColorMaterial"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat arg0, GLboolean arg1) {
+	((PFNGLSAMPLECOVERAGEPROC)glad_lazy_resolve((void**)&glad_glSampleCoverage, "glSampleCoverage"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	((PFNGLSAMPLERPARAMETERIPROC)glad_lazy_resolve((void**)&glad_glSamplerParameteri, "glSamplerParameteri"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glClearBufferSubData(GLenum arg0, GLenum arg1, GLintptr arg2, GLsizeiptr arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	((PFNGLCLEARBUFFERSUBDATAPROC)glad_lazy_resolve((void**)&glad_glClearBufferSubData, "glClearBufferSubData"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLSAMPLERPARAMETERFPROC)glad_lazy_resolve((void**)&glad_glSamplerParameterf, "glSamplerParameterf"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexStorage1D(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3) {
+	((PFNGLTEXSTORAGE1DPROC)glad_lazy_resolve((void**)&glad_glTexStorage1D, "glTexStorage1D"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniform1f(GLint arg0, GLfloat arg1) {
+	((PFNGLUNIFORM1FPROC)glad_lazy_resolve((void**)&glad_glUniform1f, "glUniform1f"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETVERTEXATTRIBFVPROC)glad_lazy_resolve((void**)&glad_glGetVertexAttribfv, "glGetVertexAttribfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glUniform1d(GLint arg0, GLdouble arg1) {
+	((PFNGLUNIFORM1DPROC)glad_lazy_resolve((void**)&glad_glUniform1d, "glUniform1d"))(arg0, arg1);
+}
+static GLint APIENTRY glad_lazy_glRenderMode(GLenum arg0) {
+	return ((PFNGLRENDERMODEPROC)glad_lazy_resolve((void**)&glad_glRenderMode, "glRenderMode"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum arg0, GLint arg1, void * arg2) {
+	((PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_lazy_resolve((void**)&glad_glGetCompressedTexImage, "glGetCompressedTexImage"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetnCompressedTexImage(GLenum arg0, GLint arg1, GLsizei arg2, void * arg3) {
+	((PFNGLGETNCOMPRESSEDTEXIMAGEPROC)glad_lazy_resolve((void**)&glad_glGetnCompressedTexImage, "glGetnCompressedTexImage"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glWindowPos2dv(const GLdouble * arg0) {
+	((PFNGLWINDOWPOS2DVPROC)glad_lazy_resolve((void**)&glad_glWindowPos2dv, "glWindowPos2dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glUniform1i(GLint arg0, GLint arg1) {
+	((PFNGLUNIFORM1IPROC)glad_lazy_resolve((void**)&glad_glUniform1i, "glUniform1i"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4, GLenum * arg5, GLchar * arg6) {
+	((PFNGLGETACTIVEATTRIBPROC)glad_lazy_resolve((void**)&glad_glGetActiveAttrib, "glGetActiveAttrib"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glUniform3i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLUNIFORM3IPROC)glad_lazy_resolve((void**)&glad_glUniform3i, "glUniform3i"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glPixelTransferi(GLenum arg0, GLint arg1) {
+	((PFNGLPIXELTRANSFERIPROC)glad_lazy_resolve((void**)&glad_glPixelTransferi, "glPixelTransferi"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLenum arg7, const GLvoid * arg8) {
+	((PFNGLTEXSUBIMAGE2DPROC)glad_lazy_resolve((void**)&glad_glTexSubImage2D, "glTexSubImage2D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_lazy_glDisable(GLenum arg0) {
+	((PFNGLDISABLEPROC)glad_lazy_resolve((void**)&glad_glDisable, "glDisable"))(arg0);
+}
+static void APIENTRY glad_lazy_glLogicOp(GLenum arg0) {
+	((PFNGLLOGICOPPROC)glad_lazy_resolve((void**)&glad_glLogicOp, "glLogicOp"))(arg0);
+}
+static void APIENTRY glad_lazy_glEvalPoint2(GLint arg0, GLint arg1) {
+	((PFNGLEVALPOINT2PROC)glad_lazy_resolve((void**)&glad_glEvalPoint2, "glEvalPoint2"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glPixelTransferf(GLenum arg0, GLfloat arg1) {
+	((PFNGLPIXELTRANSFERFPROC)glad_lazy_resolve((void**)&glad_glPixelTransferf, "glPixelTransferf"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirectCount(GLenum arg0, const void * arg1, GLintptr arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)glad_lazy_resolve((void**)&glad_glMultiDrawArraysIndirectCount, "glMultiDrawArraysIndirectCount"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLSECONDARYCOLOR3IPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3i, "glSecondaryColor3i"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniform4uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	((PFNGLPROGRAMUNIFORM4UIVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform4uiv, "glProgramUniform4uiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniform4ui(GLint arg0, GLuint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+	((PFNGLUNIFORM4UIPROC)glad_lazy_resolve((void**)&glad_glUniform4ui, "glUniform4ui"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glColor3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLCOLOR3FPROC)glad_lazy_resolve((void**)&glad_glColor3f, "glColor3f"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferReadBuffer(GLuint arg0, GLenum arg1) {
+	((PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)glad_lazy_resolve((void**)&glad_glNamedFramebufferReadBuffer, "glNamedFramebufferReadBuffer"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum arg0, GLuint arg1) {
+	((PFNGLBINDFRAMEBUFFERPROC)glad_lazy_resolve((void**)&glad_glBindFramebuffer, "glBindFramebuffer"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetTexEnvfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETTEXENVFVPROC)glad_lazy_resolve((void**)&glad_glGetTexEnvfv, "glGetTexEnvfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glRectfv(const GLfloat * arg0, const GLfloat * arg1) {
+	((PFNGLRECTFVPROC)glad_lazy_resolve((void**)&glad_glRectfv, "glRectfv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glCullFace(GLenum arg0) {
+	((PFNGLCULLFACEPROC)glad_lazy_resolve((void**)&glad_glCullFace, "glCullFace"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetLightfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETLIGHTFVPROC)glad_lazy_resolve((void**)&glad_glGetLightfv, "glGetLightfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetnUniformiv(GLuint arg0, GLint arg1, GLsizei arg2, GLint * arg3) {
+	((PFNGLGETNUNIFORMIVPROC)glad_lazy_resolve((void**)&glad_glGetnUniformiv, "glGetnUniformiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glColor3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLCOLOR3DPROC)glad_lazy_resolve((void**)&glad_glColor3d, "glColor3d"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniform4i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5) {
+	((PFNGLPROGRAMUNIFORM4IPROC)glad_lazy_resolve((void**)&glad_glProgramUniform4i, "glProgramUniform4i"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glTexGend(GLenum arg0, GLenum arg1, GLdouble arg2) {
+	((PFNGLTEXGENDPROC)glad_lazy_resolve((void**)&glad_glTexGend, "glTexGend"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniform4f(GLuint arg0, GLint arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4, GLfloat arg5) {
+	((PFNGLPROGRAMUNIFORM4FPROC)glad_lazy_resolve((void**)&glad_glProgramUniform4f, "glProgramUniform4f"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glTexGeni(GLenum arg0, GLenum arg1, GLint arg2) {
+	((PFNGLTEXGENIPROC)glad_lazy_resolve((void**)&glad_glTexGeni, "glTexGeni"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniform4d(GLuint arg0, GLint arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+	((PFNGLPROGRAMUNIFORM4DPROC)glad_lazy_resolve((void**)&glad_glProgramUniform4d, "glProgramUniform4d"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glTextureParameterIiv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLTEXTUREPARAMETERIIVPROC)glad_lazy_resolve((void**)&glad_glTextureParameterIiv, "glTextureParameterIiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3s(GLenum arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLMULTITEXCOORD3SPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord3s, "glMultiTexCoord3s"))(arg0, arg1, arg2, arg3);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum arg0, GLuint arg1) {
+	return ((PFNGLGETSTRINGIPROC)glad_lazy_resolve((void**)&glad_glGetStringi, "glGetStringi"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETTEXTUREPARAMETERFVPROC)glad_lazy_resolve((void**)&glad_glGetTextureParameterfv, "glGetTextureParameterfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTextureSubImage2D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLenum arg7, const void * arg8) {
+	((PFNGLTEXTURESUBIMAGE2DPROC)glad_lazy_resolve((void**)&glad_glTextureSubImage2D, "glTextureSubImage2D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3i(GLenum arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLMULTITEXCOORD3IPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord3i, "glMultiTexCoord3i"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLMULTITEXCOORD3FPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord3f, "glMultiTexCoord3f"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStream(GLenum arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)glad_lazy_resolve((void**)&glad_glDrawTransformFeedbackStream, "glDrawTransformFeedbackStream"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLMULTITEXCOORD3DPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord3d, "glMultiTexCoord3d"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glAttachShader(GLuint arg0, GLuint arg1) {
+	((PFNGLATTACHSHADERPROC)glad_lazy_resolve((void**)&glad_glAttachShader, "glAttachShader"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glFogCoorddv(const GLdouble * arg0) {
+	((PFNGLFOGCOORDDVPROC)glad_lazy_resolve((void**)&glad_glFogCoorddv, "glFogCoorddv"))(arg0);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX2X3FVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix2x3fv, "glUniformMatrix2x3fv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetTexGenfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETTEXGENFVPROC)glad_lazy_resolve((void**)&glad_glGetTexGenfv, "glGetTexGenfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glQueryCounter(GLuint arg0, GLenum arg1) {
+	((PFNGLQUERYCOUNTERPROC)glad_lazy_resolve((void**)&glad_glQueryCounter, "glQueryCounter"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glFogCoordPointer(GLenum arg0, GLsizei arg1, const void * arg2) {
+	((PFNGLFOGCOORDPOINTERPROC)glad_lazy_resolve((void**)&glad_glFogCoordPointer, "glFogCoordPointer"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX3DVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix3dv, "glProgramUniformMatrix3dv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum arg0) {
+	((PFNGLPROVOKINGVERTEXPROC)glad_lazy_resolve((void**)&glad_glProvokingVertex, "glProvokingVertex"))(arg0);
+}
+static void APIENTRY glad_lazy_glShaderBinary(GLsizei arg0, const GLuint * arg1, GLenum arg2, const void * arg3, GLsizei arg4) {
+	((PFNGLSHADERBINARYPROC)glad_lazy_resolve((void**)&glad_glShaderBinary, "glShaderBinary"))(arg0, arg1, arg2, arg3, arg4);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapNamedBuffer(GLuint arg0) {
+	return ((PFNGLUNMAPNAMEDBUFFERPROC)glad_lazy_resolve((void**)&glad_glUnmapNamedBuffer, "glUnmapNamedBuffer"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetnColorTable(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, void * arg4) {
+	((PFNGLGETNCOLORTABLEPROC)glad_lazy_resolve((void**)&glad_glGetnColorTable, "glGetnColorTable"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4, GLint arg5) {
+	((PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_lazy_resolve((void**)&glad_glFramebufferTexture3D, "glFramebufferTexture3D"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glTexGeniv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLTEXGENIVPROC)glad_lazy_resolve((void**)&glad_glTexGeniv, "glTexGeniv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glRasterPos2dv(const GLdouble * arg0) {
+	((PFNGLRASTERPOS2DVPROC)glad_lazy_resolve((void**)&glad_glRasterPos2dv, "glRasterPos2dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3dv(const GLdouble * arg0) {
+	((PFNGLSECONDARYCOLOR3DVPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3dv, "glSecondaryColor3dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glClientActiveTexture(GLenum arg0) {
+	((PFNGLCLIENTACTIVETEXTUREPROC)glad_lazy_resolve((void**)&glad_glClientActiveTexture, "glClientActiveTexture"))(arg0);
+}
+static void APIENTRY glad_lazy_glNamedRenderbufferStorageMultisample(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_resolve((void**)&glad_glNamedRenderbufferStorageMultisample, "glNamedRenderbufferStorageMultisample"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint arg0, const GLshort * arg1) {
+	((PFNGLVERTEXATTRIBI4SVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI4sv, "glVertexAttribI4sv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glClearNamedBufferData(GLuint arg0, GLenum arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	((PFNGLCLEARNAMEDBUFFERDATAPROC)glad_lazy_resolve((void**)&glad_glClearNamedBufferData, "glClearNamedBufferData"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3us(GLushort arg0, GLushort arg1, GLushort arg2) {
+	((PFNGLSECONDARYCOLOR3USPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3us, "glSecondaryColor3us"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum arg0, GLuint arg1) {
+	((PFNGLNORMALP3UIPROC)glad_lazy_resolve((void**)&glad_glNormalP3ui, "glNormalP3ui"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTexEnvfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLTEXENVFVPROC)glad_lazy_resolve((void**)&glad_glTexEnvfv, "glTexEnvfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glReadBuffer(GLenum arg0) {
+	((PFNGLREADBUFFERPROC)glad_lazy_resolve((void**)&glad_glReadBuffer, "glReadBuffer"))(arg0);
+}
+static void APIENTRY glad_lazy_glViewportArrayv(GLuint arg0, GLsizei arg1, const GLfloat * arg2) {
+	((PFNGLVIEWPORTARRAYVPROC)glad_lazy_resolve((void**)&glad_glViewportArrayv, "glViewportArrayv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLTEXPARAMETERIUIVPROC)glad_lazy_resolve((void**)&glad_glTexParameterIuiv, "glTexParameterIuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+	((PFNGLDRAWARRAYSINSTANCEDPROC)glad_lazy_resolve((void**)&glad_glDrawArraysInstanced, "glDrawArraysInstanced"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum arg0) {
+	((PFNGLGENERATEMIPMAPPROC)glad_lazy_resolve((void**)&glad_glGenerateMipmap, "glGenerateMipmap"))(arg0);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage2D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLsizei arg7, const void * arg8) {
+	((PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)glad_lazy_resolve((void**)&glad_glCompressedTextureSubImage2D, "glCompressedTextureSubImage2D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX2FVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix2fv, "glProgramUniformMatrix2fv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glWindowPos3fv(const GLfloat * arg0) {
+	((PFNGLWINDOWPOS3FVPROC)glad_lazy_resolve((void**)&glad_glWindowPos3fv, "glWindowPos3fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX3X4DVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix3x4dv, "glUniformMatrix3x4dv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glLightModelfv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLLIGHTMODELFVPROC)glad_lazy_resolve((void**)&glad_glLightModelfv, "glLightModelfv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLSAMPLERPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glSamplerParameteriv, "glSamplerParameteriv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glDeleteLists(GLuint arg0, GLsizei arg1) {
+	((PFNGLDELETELISTSPROC)glad_lazy_resolve((void**)&glad_glDeleteLists, "glDeleteLists"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetClipPlane(GLenum arg0, GLdouble * arg1) {
+	((PFNGLGETCLIPPLANEPROC)glad_lazy_resolve((void**)&glad_glGetClipPlane, "glGetClipPlane"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertex4dv(const GLdouble * arg0) {
+	((PFNGLVERTEX4DVPROC)glad_lazy_resolve((void**)&glad_glVertex4dv, "glVertex4dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexCoord2d(GLdouble arg0, GLdouble arg1) {
+	((PFNGLTEXCOORD2DPROC)glad_lazy_resolve((void**)&glad_glTexCoord2d, "glTexCoord2d"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glPopMatrix(void) {
+	((PFNGLPOPMATRIXPROC)glad_lazy_resolve((void**)&glad_glPopMatrix, "glPopMatrix"))();
+}
+static void APIENTRY glad_lazy_glTexCoord2f(GLfloat arg0, GLfloat arg1) {
+	((PFNGLTEXCOORD2FPROC)glad_lazy_resolve((void**)&glad_glTexCoord2f, "glTexCoord2f"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glColor4iv(const GLint * arg0) {
+	((PFNGLCOLOR4IVPROC)glad_lazy_resolve((void**)&glad_glColor4iv, "glColor4iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glIndexubv(const GLubyte * arg0) {
+	((PFNGLINDEXUBVPROC)glad_lazy_resolve((void**)&glad_glIndexubv, "glIndexubv"))(arg0);
+}
+static GLenum APIENTRY glad_lazy_glCheckNamedFramebufferStatus(GLuint arg0, GLenum arg1) {
+	return ((PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)glad_lazy_resolve((void**)&glad_glCheckNamedFramebufferStatus, "glCheckNamedFramebufferStatus"))(arg0, arg1);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum arg0) {
+	return ((PFNGLUNMAPBUFFERPROC)glad_lazy_resolve((void**)&glad_glUnmapBuffer, "glUnmapBuffer"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexCoord2i(GLint arg0, GLint arg1) {
+	((PFNGLTEXCOORD2IPROC)glad_lazy_resolve((void**)&glad_glTexCoord2i, "glTexCoord2i"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glRasterPos4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLRASTERPOS4DPROC)glad_lazy_resolve((void**)&glad_glRasterPos4d, "glRasterPos4d"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glRasterPos4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLRASTERPOS4FPROC)glad_lazy_resolve((void**)&glad_glRasterPos4f, "glRasterPos4f"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glProgramUniform1iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	((PFNGLPROGRAMUNIFORM1IVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform1iv, "glProgramUniform1iv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETVERTEXARRAYIVPROC)glad_lazy_resolve((void**)&glad_glGetVertexArrayiv, "glGetVertexArrayiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage2D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLsizei arg6, GLsizei arg7) {
+	((PFNGLCOPYTEXTURESUBIMAGE2DPROC)glad_lazy_resolve((void**)&glad_glCopyTextureSubImage2D, "glCopyTextureSubImage2D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLVERTEXATTRIB3SPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib3s, "glVertexAttrib3s"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glTexCoord2s(GLshort arg0, GLshort arg1) {
+	((PFNGLTEXCOORD2SPROC)glad_lazy_resolve((void**)&glad_glTexCoord2s, "glTexCoord2s"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum arg0, GLuint arg1) {
+	((PFNGLBINDRENDERBUFFERPROC)glad_lazy_resolve((void**)&glad_glBindRenderbuffer, "glBindRenderbuffer"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertex3fv(const GLfloat * arg0) {
+	((PFNGLVERTEX3FVPROC)glad_lazy_resolve((void**)&glad_glVertex3fv, "glVertex3fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexCoord4dv(const GLdouble * arg0) {
+	((PFNGLTEXCOORD4DVPROC)glad_lazy_resolve((void**)&glad_glTexCoord4dv, "glTexCoord4dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glMaterialiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLMATERIALIVPROC)glad_lazy_resolve((void**)&glad_glMaterialiv, "glMaterialiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	((PFNGLVERTEXATTRIBP4UIVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribP4uiv, "glVertexAttribP4uiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetProgramStageiv(GLuint arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETPROGRAMSTAGEIVPROC)glad_lazy_resolve((void**)&glad_glGetProgramStageiv, "glGetProgramStageiv"))(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint arg0) {
+	return ((PFNGLISPROGRAMPROC)glad_lazy_resolve((void**)&glad_glIsProgram, "glIsProgram"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint arg0, const GLbyte * arg1) {
+	((PFNGLVERTEXATTRIB4BVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4bv, "glVertexAttrib4bv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertex4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLVERTEX4SPROC)glad_lazy_resolve((void**)&glad_glVertex4s, "glVertex4s"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX3X2DVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix3x2dv, "glUniformMatrix3x2dv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint arg0, const GLfloat * arg1) {
+	((PFNGLVERTEXATTRIB4FVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4fv, "glVertexAttrib4fv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glNormal3dv(const GLdouble * arg0) {
+	((PFNGLNORMAL3DVPROC)glad_lazy_resolve((void**)&glad_glNormal3dv, "glNormal3dv"))(arg0);
+}
+static GLboolean APIENTRY glad_lazy_glIsTransformFeedback(GLuint arg0) {
+	return ((PFNGLISTRANSFORMFEEDBACKPROC)glad_lazy_resolve((void**)&glad_glIsTransformFeedback, "glIsTransformFeedback"))(arg0);
+}
+static void APIENTRY glad_lazy_glUniform4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	((PFNGLUNIFORM4IPROC)glad_lazy_resolve((void**)&glad_glUniform4i, "glUniform4i"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glActiveTexture(GLenum arg0) {
+	((PFNGLACTIVETEXTUREPROC)glad_lazy_resolve((void**)&glad_glActiveTexture, "glActiveTexture"))(arg0);
+}
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint arg0) {
+	((PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve((void**)&glad_glEnableVertexAttribArray, "glEnableVertexAttribArray"))(arg0);
+}
+static void APIENTRY glad_lazy_glRotated(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLROTATEDPROC)glad_lazy_resolve((void**)&glad_glRotated, "glRotated"))(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgramPipeline(GLuint arg0) {
+	return ((PFNGLISPROGRAMPIPELINEPROC)glad_lazy_resolve((void**)&glad_glIsProgramPipeline, "glIsProgramPipeline"))(arg0);
+}
+static void APIENTRY glad_lazy_glRotatef(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLROTATEFPROC)glad_lazy_resolve((void**)&glad_glRotatef, "glRotatef"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertex4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLVERTEX4IPROC)glad_lazy_resolve((void**)&glad_glVertex4i, "glVertex4i"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glReadPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4, GLenum arg5, GLvoid * arg6) {
+	((PFNGLREADPIXELSPROC)glad_lazy_resolve((void**)&glad_glReadPixels, "glReadPixels"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint arg0, const GLint * arg1) {
+	((PFNGLVERTEXATTRIBI3IVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI3iv, "glVertexAttribI3iv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glLoadName(GLuint arg0) {
+	((PFNGLLOADNAMEPROC)glad_lazy_resolve((void**)&glad_glLoadName, "glLoadName"))(arg0);
+}
+static void APIENTRY glad_lazy_glUniform4f(GLint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	((PFNGLUNIFORM4FPROC)glad_lazy_resolve((void**)&glad_glUniform4f, "glUniform4f"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_resolve((void**)&glad_glRenderbufferStorageMultisample, "glRenderbufferStorageMultisample"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glCreateProgramPipelines(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATEPROGRAMPIPELINESPROC)glad_lazy_resolve((void**)&glad_glCreateProgramPipelines, "glCreateProgramPipelines"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENVERTEXARRAYSPROC)glad_lazy_resolve((void**)&glad_glGenVertexArrays, "glGenVertexArrays"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glShadeModel(GLenum arg0) {
+	((PFNGLSHADEMODELPROC)glad_lazy_resolve((void**)&glad_glShadeModel, "glShadeModel"))(arg0);
+}
+static void APIENTRY glad_lazy_glMapGrid1d(GLint arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLMAPGRID1DPROC)glad_lazy_resolve((void**)&glad_glMapGrid1d, "glMapGrid1d"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint arg0, GLint arg1, GLfloat * arg2) {
+	((PFNGLGETUNIFORMFVPROC)glad_lazy_resolve((void**)&glad_glGetUniformfv, "glGetUniformfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMapGrid1f(GLint arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLMAPGRID1FPROC)glad_lazy_resolve((void**)&glad_glMapGrid1f, "glMapGrid1f"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLSAMPLERPARAMETERFVPROC)glad_lazy_resolve((void**)&glad_glSamplerParameterfv, "glSamplerParameterfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttribLPointer(GLuint arg0, GLint arg1, GLenum arg2, GLsizei arg3, const void * arg4) {
+	((PFNGLVERTEXATTRIBLPOINTERPROC)glad_lazy_resolve((void**)&glad_glVertexAttribLPointer, "glVertexAttribLPointer"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glDisableClientState(GLenum arg0) {
+	((PFNGLDISABLECLIENTSTATEPROC)glad_lazy_resolve((void**)&glad_glDisableClientState, "glDisableClientState"))(arg0);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3sv(GLenum arg0, const GLshort * arg1) {
+	((PFNGLMULTITEXCOORD3SVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord3sv, "glMultiTexCoord3sv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetnUniformfv(GLuint arg0, GLint arg1, GLsizei arg2, GLfloat * arg3) {
+	((PFNGLGETNUNIFORMFVPROC)glad_lazy_resolve((void**)&glad_glGetnUniformfv, "glGetnUniformfv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLint arg5) {
+	((PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_lazy_resolve((void**)&glad_glDrawElementsInstancedBaseVertex, "glDrawElementsInstancedBaseVertex"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glVertexAttribL2dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIBL2DVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribL2dv, "glVertexAttribL2dv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirect(GLenum arg0, GLenum arg1, const void * arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLMULTIDRAWELEMENTSINDIRECTPROC)glad_lazy_resolve((void**)&glad_glMultiDrawElementsIndirect, "glMultiDrawElementsIndirect"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glEnableVertexArrayAttrib(GLuint arg0, GLuint arg1) {
+	((PFNGLENABLEVERTEXARRAYATTRIBPROC)glad_lazy_resolve((void**)&glad_glEnableVertexArrayAttrib, "glEnableVertexArrayAttrib"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glSecondaryColorPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+	((PFNGLSECONDARYCOLORPOINTERPROC)glad_lazy_resolve((void**)&glad_glSecondaryColorPointer, "glSecondaryColorPointer"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glAlphaFunc(GLenum arg0, GLclampf arg1) {
+	((PFNGLALPHAFUNCPROC)glad_lazy_resolve((void**)&glad_glAlphaFunc, "glAlphaFunc"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glUniform1iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	((PFNGLUNIFORM1IVPROC)glad_lazy_resolve((void**)&glad_glUniform1iv, "glUniform1iv"))(arg0, arg1, arg2);
+}
+static GLuint APIENTRY glad_lazy_glCreateShaderProgramv(GLenum arg0, GLsizei arg1, const GLchar *const* arg2) {
+	return ((PFNGLCREATESHADERPROGRAMVPROC)glad_lazy_resolve((void**)&glad_glCreateShaderProgramv, "glCreateShaderProgramv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineName(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, GLsizei * arg4, GLchar * arg5) {
+	((PFNGLGETACTIVESUBROUTINENAMEPROC)glad_lazy_resolve((void**)&glad_glGetActiveSubroutineName, "glGetActiveSubroutineName"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4iv(GLenum arg0, const GLint * arg1) {
+	((PFNGLMULTITEXCOORD4IVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord4iv, "glMultiTexCoord4iv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttribL2d(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLVERTEXATTRIBL2DPROC)glad_lazy_resolve((void**)&glad_glVertexAttribL2d, "glVertexAttribL2d"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETQUERYOBJECTIVPROC)glad_lazy_resolve((void**)&glad_glGetQueryObjectiv, "glGetQueryObjectiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glStencilFunc(GLenum arg0, GLint arg1, GLuint arg2) {
+	((PFNGLSTENCILFUNCPROC)glad_lazy_resolve((void**)&glad_glStencilFunc, "glStencilFunc"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glInvalidateNamedFramebufferData(GLuint arg0, GLsizei arg1, const GLenum * arg2) {
+	((PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)glad_lazy_resolve((void**)&glad_glInvalidateNamedFramebufferData, "glInvalidateNamedFramebufferData"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord1fv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLMULTITEXCOORD1FVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord1fv, "glMultiTexCoord1fv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLUNIFORMBLOCKBINDINGPROC)glad_lazy_resolve((void**)&glad_glUniformBlockBinding, "glUniformBlockBinding"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glColor4uiv(const GLuint * arg0) {
+	((PFNGLCOLOR4UIVPROC)glad_lazy_resolve((void**)&glad_glColor4uiv, "glColor4uiv"))(arg0);
+}
+static void APIENTRY glad_lazy_glRectiv(const GLint * arg0, const GLint * arg1) {
+	((PFNGLRECTIVPROC)glad_lazy_resolve((void**)&glad_glRectiv, "glRectiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glColorP4ui(GLenum arg0, GLuint arg1) {
+	((PFNGLCOLORP4UIPROC)glad_lazy_resolve((void**)&glad_glColorP4ui, "glColorP4ui"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glUseProgramStages(GLuint arg0, GLbitfield arg1, GLuint arg2) {
+	((PFNGLUSEPROGRAMSTAGESPROC)glad_lazy_resolve((void**)&glad_glUseProgramStages, "glUseProgramStages"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glRasterPos3dv(const GLdouble * arg0) {
+	((PFNGLRASTERPOS3DVPROC)glad_lazy_resolve((void**)&glad_glRasterPos3dv, "glRasterPos3dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glEvalMesh2(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	((PFNGLEVALMESH2PROC)glad_lazy_resolve((void**)&glad_glEvalMesh2, "glEvalMesh2"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glEvalMesh1(GLenum arg0, GLint arg1, GLint arg2) {
+	((PFNGLEVALMESH1PROC)glad_lazy_resolve((void**)&glad_glEvalMesh1, "glEvalMesh1"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexCoordPointer(GLint arg0, GLenum arg1, GLsizei arg2, const GLvoid * arg3) {
+	((PFNGLTEXCOORDPOINTERPROC)glad_lazy_resolve((void**)&glad_glTexCoordPointer, "glTexCoordPointer"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glProgramUniform3f(GLuint arg0, GLint arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	((PFNGLPROGRAMUNIFORM3FPROC)glad_lazy_resolve((void**)&glad_glProgramUniform3f, "glProgramUniform3f"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glProgramUniform3d(GLuint arg0, GLint arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	((PFNGLPROGRAMUNIFORM3DPROC)glad_lazy_resolve((void**)&glad_glProgramUniform3d, "glProgramUniform3d"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint arg0, const GLubyte * arg1) {
+	((PFNGLVERTEXATTRIB4NUBVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4Nubv, "glVertexAttrib4Nubv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint arg0, const GLint * arg1) {
+	((PFNGLVERTEXATTRIBI4IVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI4iv, "glVertexAttribI4iv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetProgramPipelineiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETPROGRAMPIPELINEIVPROC)glad_lazy_resolve((void**)&glad_glGetProgramPipelineiv, "glGetProgramPipelineiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexStorage3D(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5) {
+	((PFNGLTEXSTORAGE3DPROC)glad_lazy_resolve((void**)&glad_glTexStorage3D, "glTexStorage3D"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glEvalCoord2fv(const GLfloat * arg0) {
+	((PFNGLEVALCOORD2FVPROC)glad_lazy_resolve((void**)&glad_glEvalCoord2fv, "glEvalCoord2fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferDrawBuffer(GLuint arg0, GLenum arg1) {
+	((PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)glad_lazy_resolve((void**)&glad_glNamedFramebufferDrawBuffer, "glNamedFramebufferDrawBuffer"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetQueryIndexediv(GLenum arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETQUERYINDEXEDIVPROC)glad_lazy_resolve((void**)&glad_glGetQueryIndexediv, "glGetQueryIndexediv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glColor4ubv(const GLubyte * arg0) {
+	((PFNGLCOLOR4UBVPROC)glad_lazy_resolve((void**)&glad_glColor4ubv, "glColor4ubv"))(arg0);
+}
+static void APIENTRY glad_lazy_glLoadTransposeMatrixd(const GLdouble * arg0) {
+	((PFNGLLOADTRANSPOSEMATRIXDPROC)glad_lazy_resolve((void**)&glad_glLoadTransposeMatrixd, "glLoadTransposeMatrixd"))(arg0);
+}
+static void APIENTRY glad_lazy_glLoadTransposeMatrixf(const GLfloat * arg0) {
+	((PFNGLLOADTRANSPOSEMATRIXFPROC)glad_lazy_resolve((void**)&glad_glLoadTransposeMatrixf, "glLoadTransposeMatrixf"))(arg0);
+}
+static void APIENTRY glad_lazy_glTextureParameteriv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLTEXTUREPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glTextureParameteriv, "glTextureParameteriv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glObjectLabel(GLenum arg0, GLuint arg1, GLsizei arg2, const GLchar * arg3) {
+	((PFNGLOBJECTLABELPROC)glad_lazy_resolve((void**)&glad_glObjectLabel, "glObjectLabel"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	((PFNGLVERTEXATTRIBI4IPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI4i, "glVertexAttribI4i"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glRasterPos2iv(const GLint * arg0) {
+	((PFNGLRASTERPOS2IVPROC)glad_lazy_resolve((void**)&glad_glRasterPos2iv, "glRasterPos2iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, void * arg3) {
+	((PFNGLGETBUFFERSUBDATAPROC)glad_lazy_resolve((void**)&glad_glGetBufferSubData, "glGetBufferSubData"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribLdv(GLuint arg0, GLenum arg1, GLdouble * arg2) {
+	((PFNGLGETVERTEXATTRIBLDVPROC)glad_lazy_resolve((void**)&glad_glGetVertexAttribLdv, "glGetVertexAttribLdv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetnUniformuiv(GLuint arg0, GLint arg1, GLsizei arg2, GLuint * arg3) {
+	((PFNGLGETNUNIFORMUIVPROC)glad_lazy_resolve((void**)&glad_glGetnUniformuiv, "glGetnUniformuiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectiv(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	((PFNGLGETQUERYBUFFEROBJECTIVPROC)glad_lazy_resolve((void**)&glad_glGetQueryBufferObjectiv, "glGetQueryBufferObjectiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glTexEnviv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLTEXENVIVPROC)glad_lazy_resolve((void**)&glad_glTexEnviv, "glTexEnviv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum arg0, GLenum arg1) {
+	((PFNGLBLENDEQUATIONSEPARATEPROC)glad_lazy_resolve((void**)&glad_glBlendEquationSeparate, "glBlendEquationSeparate"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint arg0, GLuint arg1) {
+	((PFNGLVERTEXATTRIBI1UIPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI1ui, "glVertexAttribI1ui"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENBUFFERSPROC)glad_lazy_resolve((void**)&glad_glGenBuffers, "glGenBuffers"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glSelectBuffer(GLsizei arg0, GLuint * arg1) {
+	((PFNGLSELECTBUFFERPROC)glad_lazy_resolve((void**)&glad_glSelectBuffer, "glSelectBuffer"))(arg0, arg1);
+}
+static GLuint APIENTRY glad_lazy_glGetSubroutineIndex(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	return ((PFNGLGETSUBROUTINEINDEXPROC)glad_lazy_resolve((void**)&glad_glGetSubroutineIndex, "glGetSubroutineIndex"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint arg0, const GLshort * arg1) {
+	((PFNGLVERTEXATTRIB2SVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib2sv, "glVertexAttrib2sv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glScissorIndexedv(GLuint arg0, const GLint * arg1) {
+	((PFNGLSCISSORINDEXEDVPROC)glad_lazy_resolve((void**)&glad_glScissorIndexedv, "glScissorIndexedv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glPushAttrib(GLbitfield arg0) {
+	((PFNGLPUSHATTRIBPROC)glad_lazy_resolve((void**)&glad_glPushAttrib, "glPushAttrib"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint arg0, GLint arg1, GLenum arg2, GLsizei arg3, const void * arg4) {
+	((PFNGLVERTEXATTRIBIPOINTERPROC)glad_lazy_resolve((void**)&glad_glVertexAttribIPointer, "glVertexAttribIPointer"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glBlendFunc(GLenum arg0, GLenum arg1) {
+	((PFNGLBLENDFUNCPROC)glad_lazy_resolve((void**)&glad_glBlendFunc, "glBlendFunc"))(arg0, arg1);
+}
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) {
+	return ((PFNGLCREATEPROGRAMPROC)glad_lazy_resolve((void**)&glad_glCreateProgram, "glCreateProgram"))();
+}
+static void APIENTRY glad_lazy_glNamedBufferSubData(GLuint arg0, GLintptr arg1, GLsizeiptr arg2, const void * arg3) {
+	((PFNGLNAMEDBUFFERSUBDATAPROC)glad_lazy_resolve((void**)&glad_glNamedBufferSubData, "glNamedBufferSubData"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glTexImage3D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLint arg6, GLenum arg7, GLenum arg8, const void * arg9) {
+	((PFNGLTEXIMAGE3DPROC)glad_lazy_resolve((void**)&glad_glTexImage3D, "glTexImage3D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint arg0) {
+	return ((PFNGLISFRAMEBUFFERPROC)glad_lazy_resolve((void**)&glad_glIsFramebuffer, "glIsFramebuffer"))(arg0);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferfv(GLuint arg0, GLenum arg1, GLint arg2, const GLfloat * arg3) {
+	((PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)glad_lazy_resolve((void**)&glad_glClearNamedFramebufferfv, "glClearNamedFramebufferfv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glLightiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLLIGHTIVPROC)glad_lazy_resolve((void**)&glad_glLightiv, "glLightiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferSubData(GLuint arg0, GLintptr arg1, GLsizeiptr arg2, void * arg3) {
+	((PFNGLGETNAMEDBUFFERSUBDATAPROC)glad_lazy_resolve((void**)&glad_glGetNamedBufferSubData, "glGetNamedBufferSubData"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage3D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLsizei arg9, const void * arg10) {
+	((PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)glad_lazy_resolve((void**)&glad_glCompressedTextureSubImage3D, "glCompressedTextureSubImage3D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint arg0) {
+	((PFNGLPRIMITIVERESTARTINDEXPROC)glad_lazy_resolve((void**)&glad_glPrimitiveRestartIndex, "glPrimitiveRestartIndex"))(arg0);
+}
+static void APIENTRY glad_lazy_glFlushMappedNamedBufferRange(GLuint arg0, GLintptr arg1, GLsizeiptr arg2) {
+	((PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)glad_lazy_resolve((void**)&glad_glFlushMappedNamedBufferRange, "glFlushMappedNamedBufferRange"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glInvalidateTexSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7) {
+	((PFNGLINVALIDATETEXSUBIMAGEPROC)glad_lazy_resolve((void**)&glad_glInvalidateTexSubImage, "glInvalidateTexSubImage"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_lazy_glTexGenfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLTEXGENFVPROC)glad_lazy_resolve((void**)&glad_glTexGenfv, "glTexGenfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	((PFNGLGETTEXTUREPARAMETERIUIVPROC)glad_lazy_resolve((void**)&glad_glGetTextureParameterIuiv, "glGetTextureParameterIuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetnConvolutionFilter(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, void * arg4) {
+	((PFNGLGETNCONVOLUTIONFILTERPROC)glad_lazy_resolve((void**)&glad_glGetnConvolutionFilter, "glGetnConvolutionFilter"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glBindImageTextures(GLuint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLBINDIMAGETEXTURESPROC)glad_lazy_resolve((void**)&glad_glBindImageTextures, "glBindImageTextures"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glEnd(void) {
+	((PFNGLENDPROC)glad_lazy_resolve((void**)&glad_glEnd, "glEnd"))();
+}
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETEBUFFERSPROC)glad_lazy_resolve((void**)&glad_glDeleteBuffers, "glDeleteBuffers"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glBindProgramPipeline(GLuint arg0) {
+	((PFNGLBINDPROGRAMPIPELINEPROC)glad_lazy_resolve((void**)&glad_glBindProgramPipeline, "glBindProgramPipeline"))(arg0);
+}
+static void APIENTRY glad_lazy_glScissor(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+	((PFNGLSCISSORPROC)glad_lazy_resolve((void**)&glad_glScissor, "glScissor"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLTEXCOORDP4UIVPROC)glad_lazy_resolve((void**)&glad_glTexCoordP4uiv, "glTexCoordP4uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glClipPlane(GLenum arg0, const GLdouble * arg1) {
+	((PFNGLCLIPPLANEPROC)glad_lazy_resolve((void**)&glad_glClipPlane, "glClipPlane"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glPushName(GLuint arg0) {
+	((PFNGLPUSHNAMEPROC)glad_lazy_resolve((void**)&glad_glPushName, "glPushName"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexGendv(GLenum arg0, GLenum arg1, const GLdouble * arg2) {
+	((PFNGLTEXGENDVPROC)glad_lazy_resolve((void**)&glad_glTexGendv, "glTexGendv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glIndexub(GLubyte arg0) {
+	((PFNGLINDEXUBPROC)glad_lazy_resolve((void**)&glad_glIndexub, "glIndexub"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetNamedFramebufferAttachmentParameteriv(GLuint arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glGetNamedFramebufferAttachmentParameteriv, "glGetNamedFramebufferAttachmentParameteriv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferRenderbuffer(GLuint arg0, GLenum arg1, GLenum arg2, GLuint arg3) {
+	((PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_resolve((void**)&glad_glNamedFramebufferRenderbuffer, "glNamedFramebufferRenderbuffer"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLVERTEXP2UIVPROC)glad_lazy_resolve((void**)&glad_glVertexP2uiv, "glVertexP2uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3iv(const GLint * arg0) {
+	((PFNGLSECONDARYCOLOR3IVPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3iv, "glSecondaryColor3iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glRasterPos4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLRASTERPOS4IPROC)glad_lazy_resolve((void**)&glad_glRasterPos4i, "glRasterPos4i"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glMultTransposeMatrixd(const GLdouble * arg0) {
+	((PFNGLMULTTRANSPOSEMATRIXDPROC)glad_lazy_resolve((void**)&glad_glMultTransposeMatrixd, "glMultTransposeMatrixd"))(arg0);
+}
+static void APIENTRY glad_lazy_glClearColor(GLclampf arg0, GLclampf arg1, GLclampf arg2, GLclampf arg3) {
+	((PFNGLCLEARCOLORPROC)glad_lazy_resolve((void**)&glad_glClearColor, "glClearColor"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint arg0, const GLuint * arg1) {
+	((PFNGLVERTEXATTRIB4UIVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4uiv, "glVertexAttrib4uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glNormal3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLNORMAL3SPROC)glad_lazy_resolve((void**)&glad_glNormal3s, "glNormal3s"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint arg0, const GLint * arg1) {
+	((PFNGLVERTEXATTRIB4NIVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4Niv, "glVertexAttrib4Niv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix2x3fv, "glProgramUniformMatrix2x3fv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum arg0, GLint arg1, const GLint * arg2) {
+	((PFNGLCLEARBUFFERIVPROC)glad_lazy_resolve((void**)&glad_glClearBufferiv, "glClearBufferiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glPointParameteri(GLenum arg0, GLint arg1) {
+	((PFNGLPOINTPARAMETERIPROC)glad_lazy_resolve((void**)&glad_glPointParameteri, "glPointParameteri"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glProgramUniform4dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	((PFNGLPROGRAMUNIFORM4DVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform4dv, "glProgramUniform4dv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLCOLORP4UIVPROC)glad_lazy_resolve((void**)&glad_glColorP4uiv, "glColorP4uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glBlendColor(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLBLENDCOLORPROC)glad_lazy_resolve((void**)&glad_glBlendColor, "glBlendColor"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetnPixelMapuiv(GLenum arg0, GLsizei arg1, GLuint * arg2) {
+	((PFNGLGETNPIXELMAPUIVPROC)glad_lazy_resolve((void**)&glad_glGetnPixelMapuiv, "glGetnPixelMapuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetTextureLevelParameteriv(GLuint arg0, GLint arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETTEXTURELEVELPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glGetTextureLevelParameteriv, "glGetTextureLevelParameteriv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glWindowPos3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLWINDOWPOS3DPROC)glad_lazy_resolve((void**)&glad_glWindowPos3d, "glWindowPos3d"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	((PFNGLPROGRAMUNIFORM3FVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform3fv, "glProgramUniform3fv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint arg0, const GLuint * arg1) {
+	((PFNGLVERTEXATTRIBI2UIVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI2uiv, "glVertexAttribI2uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetNamedFramebufferParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glGetNamedFramebufferParameteriv, "glGetNamedFramebufferParameteriv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve((void**)&glad_glSamplerParameterIuiv, "glSamplerParameterIuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glUniform3ui(GLint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+	((PFNGLUNIFORM3UIPROC)glad_lazy_resolve((void**)&glad_glUniform3ui, "glUniform3ui"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glProgramUniform3uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	((PFNGLPROGRAMUNIFORM3UIVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform3uiv, "glProgramUniform3uiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glColor4dv(const GLdouble * arg0) {
+	((PFNGLCOLOR4DVPROC)glad_lazy_resolve((void**)&glad_glColor4dv, "glColor4dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint arg0, const GLuint * arg1) {
+	((PFNGLVERTEXATTRIBI4UIVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI4uiv, "glVertexAttribI4uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLPOINTPARAMETERFVPROC)glad_lazy_resolve((void**)&glad_glPointParameterfv, "glPointParameterfv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glResumeTransformFeedback(void) {
+	((PFNGLRESUMETRANSFORMFEEDBACKPROC)glad_lazy_resolve((void**)&glad_glResumeTransformFeedback, "glResumeTransformFeedback"))();
+}
+static void APIENTRY glad_lazy_glUniform2fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	((PFNGLUNIFORM2FVPROC)glad_lazy_resolve((void**)&glad_glUniform2fv, "glUniform2fv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformName(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, GLsizei * arg4, GLchar * arg5) {
+	((PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)glad_lazy_resolve((void**)&glad_glGetActiveSubroutineUniformName, "glGetActiveSubroutineUniformName"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static GLuint APIENTRY glad_lazy_glGetProgramResourceIndex(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	return ((PFNGLGETPROGRAMRESOURCEINDEXPROC)glad_lazy_resolve((void**)&glad_glGetProgramResourceIndex, "glGetProgramResourceIndex"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ub(GLubyte arg0, GLubyte arg1, GLubyte arg2) {
+	((PFNGLSECONDARYCOLOR3UBPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3ub, "glSecondaryColor3ub"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glDrawElementsIndirect(GLenum arg0, GLenum arg1, const void * arg2) {
+	((PFNGLDRAWELEMENTSINDIRECTPROC)glad_lazy_resolve((void**)&glad_glDrawElementsIndirect, "glDrawElementsIndirect"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetTextureLevelParameterfv(GLuint arg0, GLint arg1, GLenum arg2, GLfloat * arg3) {
+	((PFNGLGETTEXTURELEVELPARAMETERFVPROC)glad_lazy_resolve((void**)&glad_glGetTextureLevelParameterfv, "glGetTextureLevelParameterfv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glSecondaryColor3ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLSECONDARYCOLOR3UIPROC)glad_lazy_resolve((void**)&glad_glSecondaryColor3ui, "glSecondaryColor3ui"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexCoord3dv(const GLdouble * arg0) {
+	((PFNGLTEXCOORD3DVPROC)glad_lazy_resolve((void**)&glad_glTexCoord3dv, "glTexCoord3dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferPointerv(GLuint arg0, GLenum arg1, void ** arg2) {
+	((PFNGLGETNAMEDBUFFERPOINTERVPROC)glad_lazy_resolve((void**)&glad_glGetNamedBufferPointerv, "glGetNamedBufferPointerv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glDispatchComputeIndirect(GLintptr arg0) {
+	((PFNGLDISPATCHCOMPUTEINDIRECTPROC)glad_lazy_resolve((void**)&glad_glDispatchComputeIndirect, "glDispatchComputeIndirect"))(arg0);
+}
+static void APIENTRY glad_lazy_glInvalidateNamedFramebufferSubData(GLuint arg0, GLsizei arg1, const GLenum * arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6) {
+	((PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)glad_lazy_resolve((void**)&glad_glInvalidateNamedFramebufferSubData, "glInvalidateNamedFramebufferSubData"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	((PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve((void**)&glad_glGetSamplerParameterIuiv, "glGetSamplerParameterIuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	((PFNGLBINDBUFFERRANGEPROC)glad_lazy_resolve((void**)&glad_glBindBufferRange, "glBindBufferRange"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glNormal3iv(const GLint * arg0) {
+	((PFNGLNORMAL3IVPROC)glad_lazy_resolve((void**)&glad_glNormal3iv, "glNormal3iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glTextureSubImage1D(GLuint arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	((PFNGLTEXTURESUBIMAGE1DPROC)glad_lazy_resolve((void**)&glad_glTextureSubImage1D, "glTextureSubImage1D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glVertexAttribL3dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIBL3DVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribL3dv, "glVertexAttribL3dv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetUniformdv(GLuint arg0, GLint arg1, GLdouble * arg2) {
+	((PFNGLGETUNIFORMDVPROC)glad_lazy_resolve((void**)&glad_glGetUniformdv, "glGetUniformdv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glWindowPos3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLWINDOWPOS3SPROC)glad_lazy_resolve((void**)&glad_glWindowPos3s, "glWindowPos3s"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glPointParameterf(GLenum arg0, GLfloat arg1) {
+	((PFNGLPOINTPARAMETERFPROC)glad_lazy_resolve((void**)&glad_glPointParameterf, "glPointParameterf"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glClearDepthf(GLfloat arg0) {
+	((PFNGLCLEARDEPTHFPROC)glad_lazy_resolve((void**)&glad_glClearDepthf, "glClearDepthf"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	((PFNGLGETVERTEXATTRIBIUIVPROC)glad_lazy_resolve((void**)&glad_glGetVertexAttribIuiv, "glGetVertexAttribIuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glWindowPos3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLWINDOWPOS3IPROC)glad_lazy_resolve((void**)&glad_glWindowPos3i, "glWindowPos3i"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4s(GLenum arg0, GLshort arg1, GLshort arg2, GLshort arg3, GLshort arg4) {
+	((PFNGLMULTITEXCOORD4SPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord4s, "glMultiTexCoord4s"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetTextureSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, GLsizei arg10, void * arg11) {
+	((PFNGLGETTEXTURESUBIMAGEPROC)glad_lazy_resolve((void**)&glad_glGetTextureSubImage, "glGetTextureSubImage"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
+}
+static void APIENTRY glad_lazy_glWindowPos3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLWINDOWPOS3FPROC)glad_lazy_resolve((void**)&glad_glWindowPos3f, "glWindowPos3f"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGenTransformFeedbacks(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENTRANSFORMFEEDBACKSPROC)glad_lazy_resolve((void**)&glad_glGenTransformFeedbacks, "glGenTransformFeedbacks"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glColor3us(GLushort arg0, GLushort arg1, GLushort arg2) {
+	((PFNGLCOLOR3USPROC)glad_lazy_resolve((void**)&glad_glColor3us, "glColor3us"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glColor3uiv(const GLuint * arg0) {
+	((PFNGLCOLOR3UIVPROC)glad_lazy_resolve((void**)&glad_glColor3uiv, "glColor3uiv"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint arg0, const GLushort * arg1) {
+	((PFNGLVERTEXATTRIB4NUSVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4Nusv, "glVertexAttrib4Nusv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetLightiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETLIGHTIVPROC)glad_lazy_resolve((void**)&glad_glGetLightiv, "glGetLightiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glDepthFunc(GLenum arg0) {
+	((PFNGLDEPTHFUNCPROC)glad_lazy_resolve((void**)&glad_glDepthFunc, "glDepthFunc"))(arg0);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLsizei arg7, const void * arg8) {
+	((PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_lazy_resolve((void**)&glad_glCompressedTexSubImage2D, "glCompressedTexSubImage2D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_lazy_glListBase(GLuint arg0) {
+	((PFNGLLISTBASEPROC)glad_lazy_resolve((void**)&glad_glListBase, "glListBase"))(arg0);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	((PFNGLMULTITEXCOORD4FPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord4f, "glMultiTexCoord4f"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glColor3ub(GLubyte arg0, GLubyte arg1, GLubyte arg2) {
+	((PFNGLCOLOR3UBPROC)glad_lazy_resolve((void**)&glad_glColor3ub, "glColor3ub"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	((PFNGLMULTITEXCOORD4DPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord4d, "glMultiTexCoord4d"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint arg0, const GLbyte * arg1) {
+	((PFNGLVERTEXATTRIBI4BVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI4bv, "glVertexAttribI4bv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparatei(GLuint arg0, GLenum arg1, GLenum arg2) {
+	((PFNGLBLENDEQUATIONSEPARATEIPROC)glad_lazy_resolve((void**)&glad_glBlendEquationSeparatei, "glBlendEquationSeparatei"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETTEXPARAMETERFVPROC)glad_lazy_resolve((void**)&glad_glGetTexParameterfv, "glGetTexParameterfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glColor3ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLCOLOR3UIPROC)glad_lazy_resolve((void**)&glad_glColor3ui, "glColor3ui"))(arg0, arg1, arg2);
+}
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocationIndex(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	return ((PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)glad_lazy_resolve((void**)&glad_glGetProgramResourceLocationIndex, "glGetProgramResourceLocationIndex"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4i(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	((PFNGLMULTITEXCOORD4IPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord4i, "glMultiTexCoord4i"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glBufferStorage(GLenum arg0, GLsizeiptr arg1, const void * arg2, GLbitfield arg3) {
+	((PFNGLBUFFERSTORAGEPROC)glad_lazy_resolve((void**)&glad_glBufferStorage, "glBufferStorage"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetPolygonStipple(GLubyte * arg0) {
+	((PFNGLGETPOLYGONSTIPPLEPROC)glad_lazy_resolve((void**)&glad_glGetPolygonStipple, "glGetPolygonStipple"))(arg0);
+}
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync arg0, GLbitfield arg1, GLuint64 arg2) {
+	return ((PFNGLCLIENTWAITSYNCPROC)glad_lazy_resolve((void**)&glad_glClientWaitSync, "glClientWaitSync"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+	((PFNGLVERTEXATTRIBI4UIPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI4ui, "glVertexAttribI4ui"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetFloati_v(GLenum arg0, GLuint arg1, GLfloat * arg2) {
+	((PFNGLGETFLOATI_VPROC)glad_lazy_resolve((void**)&glad_glGetFloati_v, "glGetFloati_v"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord4dv(GLenum arg0, const GLdouble * arg1) {
+	((PFNGLMULTITEXCOORD4DVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord4dv, "glMultiTexCoord4dv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glColorMask(GLboolean arg0, GLboolean arg1, GLboolean arg2, GLboolean arg3) {
+	((PFNGLCOLORMASKPROC)glad_lazy_resolve((void**)&glad_glColorMask, "glColorMask"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glTextureBuffer(GLuint arg0, GLenum arg1, GLuint arg2) {
+	((PFNGLTEXTUREBUFFERPROC)glad_lazy_resolve((void**)&glad_glTextureBuffer, "glTextureBuffer"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLTEXPARAMETERIIVPROC)glad_lazy_resolve((void**)&glad_glTexParameterIiv, "glTexParameterIiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glBlendEquation(GLenum arg0) {
+	((PFNGLBLENDEQUATIONPROC)glad_lazy_resolve((void**)&glad_glBlendEquation, "glBlendEquation"))(arg0);
+}
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint arg0, const GLchar * arg1) {
+	return ((PFNGLGETUNIFORMLOCATIONPROC)glad_lazy_resolve((void**)&glad_glGetUniformLocation, "glGetUniformLocation"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETSAMPLERPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glGetSamplerParameteriv, "glGetSamplerParameteriv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribFormat(GLuint arg0, GLuint arg1, GLint arg2, GLenum arg3, GLboolean arg4, GLuint arg5) {
+	((PFNGLVERTEXARRAYATTRIBFORMATPROC)glad_lazy_resolve((void**)&glad_glVertexArrayAttribFormat, "glVertexArrayAttribFormat"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glReadnPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4, GLenum arg5, GLsizei arg6, void * arg7) {
+	((PFNGLREADNPIXELSPROC)glad_lazy_resolve((void**)&glad_glReadnPixels, "glReadnPixels"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_lazy_glRasterPos4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLRASTERPOS4SPROC)glad_lazy_resolve((void**)&glad_glRasterPos4s, "glRasterPos4s"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) {
+	((PFNGLENDTRANSFORMFEEDBACKPROC)glad_lazy_resolve((void**)&glad_glEndTransformFeedback, "glEndTransformFeedback"))();
+}
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint arg0, const GLushort * arg1) {
+	((PFNGLVERTEXATTRIB4USVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4usv, "glVertexAttrib4usv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetUniformSubroutineuiv(GLenum arg0, GLint arg1, GLuint * arg2) {
+	((PFNGLGETUNIFORMSUBROUTINEUIVPROC)glad_lazy_resolve((void**)&glad_glGetUniformSubroutineuiv, "glGetUniformSubroutineuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord3dv(GLenum arg0, const GLdouble * arg1) {
+	((PFNGLMULTITEXCOORD3DVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord3dv, "glMultiTexCoord3dv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glBindVertexBuffer(GLuint arg0, GLuint arg1, GLintptr arg2, GLsizei arg3) {
+	((PFNGLBINDVERTEXBUFFERPROC)glad_lazy_resolve((void**)&glad_glBindVertexBuffer, "glBindVertexBuffer"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glColor4sv(const GLshort * arg0) {
+	((PFNGLCOLOR4SVPROC)glad_lazy_resolve((void**)&glad_glColor4sv, "glColor4sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glDebugMessageInsert(GLenum arg0, GLenum arg1, GLuint arg2, GLenum arg3, GLsizei arg4, const GLchar * arg5) {
+	((PFNGLDEBUGMESSAGEINSERTPROC)glad_lazy_resolve((void**)&glad_glDebugMessageInsert, "glDebugMessageInsert"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glCreateSamplers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATESAMPLERSPROC)glad_lazy_resolve((void**)&glad_glCreateSamplers, "glCreateSamplers"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glPopClientAttrib(void) {
+	((PFNGLPOPCLIENTATTRIBPROC)glad_lazy_resolve((void**)&glad_glPopClientAttrib, "glPopClientAttrib"))();
+}
+static void APIENTRY glad_lazy_glClearBufferData(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	((PFNGLCLEARBUFFERDATAPROC)glad_lazy_resolve((void**)&glad_glClearBufferData, "glClearBufferData"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum arg0) {
+	((PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_lazy_resolve((void**)&glad_glBeginTransformFeedback, "glBeginTransformFeedback"))(arg0);
+}
+static void APIENTRY glad_lazy_glFogf(GLenum arg0, GLfloat arg1) {
+	((PFNGLFOGFPROC)glad_lazy_resolve((void**)&glad_glFogf, "glFogf"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint arg0, const GLint * arg1) {
+	((PFNGLVERTEXATTRIBI1IVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI1iv, "glVertexAttribI1iv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glProgramBinary(GLuint arg0, GLenum arg1, const void * arg2, GLsizei arg3) {
+	((PFNGLPROGRAMBINARYPROC)glad_lazy_resolve((void**)&glad_glProgramBinary, "glProgramBinary"))(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint arg0) {
+	return ((PFNGLISSAMPLERPROC)glad_lazy_resolve((void**)&glad_glIsSampler, "glIsSampler"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum arg0, GLuint arg1) {
+	((PFNGLVERTEXP3UIPROC)glad_lazy_resolve((void**)&glad_glVertexP3ui, "glVertexP3ui"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint arg0, GLuint arg1) {
+	((PFNGLVERTEXATTRIBDIVISORPROC)glad_lazy_resolve((void**)&glad_glVertexAttribDivisor, "glVertexAttribDivisor"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glBindSamplers(GLuint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLBINDSAMPLERSPROC)glad_lazy_resolve((void**)&glad_glBindSamplers, "glBindSamplers"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glColor3iv(const GLint * arg0) {
+	((PFNGLCOLOR3IVPROC)glad_lazy_resolve((void**)&glad_glColor3iv, "glColor3iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLint arg4, GLsizei arg5, const void * arg6) {
+	((PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_lazy_resolve((void**)&glad_glCompressedTexImage1D, "glCompressedTexImage1D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glDeleteTransformFeedbacks(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETETRANSFORMFEEDBACKSPROC)glad_lazy_resolve((void**)&glad_glDeleteTransformFeedbacks, "glDeleteTransformFeedbacks"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5) {
+	((PFNGLCOPYTEXSUBIMAGE1DPROC)glad_lazy_resolve((void**)&glad_glCopyTexSubImage1D, "glCopyTexSubImage1D"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glTexCoord1i(GLint arg0) {
+	((PFNGLTEXCOORD1IPROC)glad_lazy_resolve((void**)&glad_glTexCoord1i, "glTexCoord1i"))(arg0);
+}
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum arg0) {
+	return ((PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_lazy_resolve((void**)&glad_glCheckFramebufferStatus, "glCheckFramebufferStatus"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexCoord1d(GLdouble arg0) {
+	((PFNGLTEXCOORD1DPROC)glad_lazy_resolve((void**)&glad_glTexCoord1d, "glTexCoord1d"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexCoord1f(GLfloat arg0) {
+	((PFNGLTEXCOORD1FPROC)glad_lazy_resolve((void**)&glad_glTexCoord1f, "glTexCoord1f"))(arg0);
+}
+static void APIENTRY glad_lazy_glTextureStorage3D(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5) {
+	((PFNGLTEXTURESTORAGE3DPROC)glad_lazy_resolve((void**)&glad_glTextureStorage3D, "glTextureStorage3D"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glEndConditionalRender(void) {
+	((PFNGLENDCONDITIONALRENDERPROC)glad_lazy_resolve((void**)&glad_glEndConditionalRender, "glEndConditionalRender"))();
+}
+static void APIENTRY glad_lazy_glEnableClientState(GLenum arg0) {
+	((PFNGLENABLECLIENTSTATEPROC)glad_lazy_resolve((void**)&glad_glEnableClientState, "glEnableClientState"))(arg0);
+}
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint arg0, GLuint arg1, const GLchar * arg2) {
+	((PFNGLBINDATTRIBLOCATIONPROC)glad_lazy_resolve((void**)&glad_glBindAttribLocation, "glBindAttribLocation"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX4X2FVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix4x2fv, "glUniformMatrix4x2fv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX2DVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix2dv, "glUniformMatrix2dv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glBlendFunci(GLuint arg0, GLenum arg1, GLenum arg2) {
+	((PFNGLBLENDFUNCIPROC)glad_lazy_resolve((void**)&glad_glBlendFunci, "glBlendFunci"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2sv(GLenum arg0, const GLshort * arg1) {
+	((PFNGLMULTITEXCOORD2SVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord2sv, "glMultiTexCoord2sv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIB1DVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib1dv, "glVertexAttrib1dv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3, GLenum arg4, const void * arg5) {
+	((PFNGLDRAWRANGEELEMENTSPROC)glad_lazy_resolve((void**)&glad_glDrawRangeElements, "glDrawRangeElements"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glTexCoord1s(GLshort arg0) {
+	((PFNGLTEXCOORD1SPROC)glad_lazy_resolve((void**)&glad_glTexCoord1s, "glTexCoord1s"))(arg0);
+}
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLBINDBUFFERBASEPROC)glad_lazy_resolve((void**)&glad_glBindBufferBase, "glBindBufferBase"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glBufferSubData(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, const void * arg3) {
+	((PFNGLBUFFERSUBDATAPROC)glad_lazy_resolve((void**)&glad_glBufferSubData, "glBufferSubData"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint arg0, const GLint * arg1) {
+	((PFNGLVERTEXATTRIB4IVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4iv, "glVertexAttrib4iv"))(arg0, arg1);
+}
+static GLuint APIENTRY glad_lazy_glGenLists(GLsizei arg0) {
+	return ((PFNGLGENLISTSPROC)glad_lazy_resolve((void**)&glad_glGenLists, "glGenLists"))(arg0);
+}
+static void APIENTRY glad_lazy_glColor3bv(const GLbyte * arg0) {
+	((PFNGLCOLOR3BVPROC)glad_lazy_resolve((void**)&glad_glColor3bv, "glColor3bv"))(arg0);
+}
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, GLbitfield arg3) {
+	return ((PFNGLMAPBUFFERRANGEPROC)glad_lazy_resolve((void**)&glad_glMapBufferRange, "glMapBufferRange"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum arg0, GLenum arg1, GLuint arg2, GLint arg3) {
+	((PFNGLFRAMEBUFFERTEXTUREPROC)glad_lazy_resolve((void**)&glad_glFramebufferTexture, "glFramebufferTexture"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparatei(GLuint arg0, GLenum arg1, GLenum arg2, GLenum arg3, GLenum arg4) {
+	((PFNGLBLENDFUNCSEPARATEIPROC)glad_lazy_resolve((void**)&glad_glBlendFuncSeparatei, "glBlendFuncSeparatei"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix4x2fv, "glProgramUniformMatrix4x2fv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glVertexAttribL1d(GLuint arg0, GLdouble arg1) {
+	((PFNGLVERTEXATTRIBL1DPROC)glad_lazy_resolve((void**)&glad_glVertexAttribL1d, "glVertexAttribL1d"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetTexGendv(GLenum arg0, GLenum arg1, GLdouble * arg2) {
+	((PFNGLGETTEXGENDVPROC)glad_lazy_resolve((void**)&glad_glGetTexGendv, "glGetTexGendv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferiv(GLuint arg0, GLenum arg1, GLint arg2, const GLint * arg3) {
+	((PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)glad_lazy_resolve((void**)&glad_glClearNamedFramebufferiv, "glClearNamedFramebufferiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum arg0, const GLint * arg1, const GLsizei * arg2, GLsizei arg3) {
+	((PFNGLMULTIDRAWARRAYSPROC)glad_lazy_resolve((void**)&glad_glMultiDrawArrays, "glMultiDrawArrays"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glEndList(void) {
+	((PFNGLENDLISTPROC)glad_lazy_resolve((void**)&glad_glEndList, "glEndList"))();
+}
+static void APIENTRY glad_lazy_glScissorIndexed(GLuint arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLSCISSORINDEXEDPROC)glad_lazy_resolve((void**)&glad_glScissorIndexed, "glScissorIndexed"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLVERTEXP4UIVPROC)glad_lazy_resolve((void**)&glad_glVertexP4uiv, "glVertexP4uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glUniform2ui(GLint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLUNIFORM2UIPROC)glad_lazy_resolve((void**)&glad_glUniform2ui, "glUniform2ui"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint arg0, const GLint * arg1) {
+	((PFNGLVERTEXATTRIBI2IVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI2iv, "glVertexAttribI2iv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetnMapdv(GLenum arg0, GLenum arg1, GLsizei arg2, GLdouble * arg3) {
+	((PFNGLGETNMAPDVPROC)glad_lazy_resolve((void**)&glad_glGetnMapdv, "glGetnMapdv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glColor3usv(const GLushort * arg0) {
+	((PFNGLCOLOR3USVPROC)glad_lazy_resolve((void**)&glad_glColor3usv, "glColor3usv"))(arg0);
+}
+static void APIENTRY glad_lazy_glWindowPos2fv(const GLfloat * arg0) {
+	((PFNGLWINDOWPOS2FVPROC)glad_lazy_resolve((void**)&glad_glWindowPos2fv, "glWindowPos2fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glTextureView(GLuint arg0, GLenum arg1, GLuint arg2, GLenum arg3, GLuint arg4, GLuint arg5, GLuint arg6, GLuint arg7) {
+	((PFNGLTEXTUREVIEWPROC)glad_lazy_resolve((void**)&glad_glTextureView, "glTextureView"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_lazy_glDisablei(GLenum arg0, GLuint arg1) {
+	((PFNGLDISABLEIPROC)glad_lazy_resolve((void**)&glad_glDisablei, "glDisablei"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix2x4fv, "glProgramUniformMatrix2x4fv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glCreateRenderbuffers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATERENDERBUFFERSPROC)glad_lazy_resolve((void**)&glad_glCreateRenderbuffers, "glCreateRenderbuffers"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glIndexMask(GLuint arg0) {
+	((PFNGLINDEXMASKPROC)glad_lazy_resolve((void**)&glad_glIndexMask, "glIndexMask"))(arg0);
+}
+static void APIENTRY glad_lazy_glPushClientAttrib(GLbitfield arg0) {
+	((PFNGLPUSHCLIENTATTRIBPROC)glad_lazy_resolve((void**)&glad_glPushClientAttrib, "glPushClientAttrib"))(arg0);
+}
+static void APIENTRY glad_lazy_glShaderSource(GLuint arg0, GLsizei arg1, const GLchar *const* arg2, const GLint * arg3) {
+	((PFNGLSHADERSOURCEPROC)glad_lazy_resolve((void**)&glad_glShaderSource, "glShaderSource"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetnSeparableFilter(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, void * arg4, GLsizei arg5, void * arg6, void * arg7) {
+	((PFNGLGETNSEPARABLEFILTERPROC)glad_lazy_resolve((void**)&glad_glGetnSeparableFilter, "glGetnSeparableFilter"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+	((PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_lazy_resolve((void**)&glad_glGetActiveUniformBlockName, "glGetActiveUniformBlockName"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint arg0, const GLuint * arg1) {
+	((PFNGLVERTEXATTRIBI3UIVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI3uiv, "glVertexAttribI3uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glReleaseShaderCompiler(void) {
+	((PFNGLRELEASESHADERCOMPILERPROC)glad_lazy_resolve((void**)&glad_glReleaseShaderCompiler, "glReleaseShaderCompiler"))();
+}
+static void APIENTRY glad_lazy_glVertexAttribIFormat(GLuint arg0, GLint arg1, GLenum arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBIFORMATPROC)glad_lazy_resolve((void**)&glad_glVertexAttribIFormat, "glVertexAttribIFormat"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glCreateFramebuffers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATEFRAMEBUFFERSPROC)glad_lazy_resolve((void**)&glad_glCreateFramebuffers, "glCreateFramebuffers"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glClearAccum(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLCLEARACCUMPROC)glad_lazy_resolve((void**)&glad_glClearAccum, "glClearAccum"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetSynciv(GLsync arg0, GLenum arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4) {
+	((PFNGLGETSYNCIVPROC)glad_lazy_resolve((void**)&glad_glGetSynciv, "glGetSynciv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glProgramUniform2uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	((PFNGLPROGRAMUNIFORM2UIVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform2uiv, "glProgramUniform2uiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetnPixelMapfv(GLenum arg0, GLsizei arg1, GLfloat * arg2) {
+	((PFNGLGETNPIXELMAPFVPROC)glad_lazy_resolve((void**)&glad_glGetnPixelMapfv, "glGetnPixelMapfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLTEXCOORDP2UIVPROC)glad_lazy_resolve((void**)&glad_glTexCoordP2uiv, "glTexCoordP2uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glPatchParameteri(GLenum arg0, GLint arg1) {
+	((PFNGLPATCHPARAMETERIPROC)glad_lazy_resolve((void**)&glad_glPatchParameteri, "glPatchParameteri"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLPROGRAMUNIFORM2IPROC)glad_lazy_resolve((void**)&glad_glProgramUniform2i, "glProgramUniform2i"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniform2f(GLint arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLUNIFORM2FPROC)glad_lazy_resolve((void**)&glad_glUniform2f, "glUniform2f"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferParameteri64v(GLuint arg0, GLenum arg1, GLint64 * arg2) {
+	((PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)glad_lazy_resolve((void**)&glad_glGetNamedBufferParameteri64v, "glGetNamedBufferParameteri64v"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glBeginQuery(GLenum arg0, GLuint arg1) {
+	((PFNGLBEGINQUERYPROC)glad_lazy_resolve((void**)&glad_glBeginQuery, "glBeginQuery"))(arg0, arg1);
+}
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint arg0, const GLchar * arg1) {
+	return ((PFNGLGETUNIFORMBLOCKINDEXPROC)glad_lazy_resolve((void**)&glad_glGetUniformBlockIndex, "glGetUniformBlockIndex"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glBindBuffer(GLenum arg0, GLuint arg1) {
+	((PFNGLBINDBUFFERPROC)glad_lazy_resolve((void**)&glad_glBindBuffer, "glBindBuffer"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glMap2d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLint arg4, GLdouble arg5, GLdouble arg6, GLint arg7, GLint arg8, const GLdouble * arg9) {
+	((PFNGLMAP2DPROC)glad_lazy_resolve((void**)&glad_glMap2d, "glMap2d"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static void APIENTRY glad_lazy_glMap2f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLint arg4, GLfloat arg5, GLfloat arg6, GLint arg7, GLint arg8, const GLfloat * arg9) {
+	((PFNGLMAP2FPROC)glad_lazy_resolve((void**)&glad_glMap2f, "glMap2f"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static void APIENTRY glad_lazy_glTexStorage2DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+	((PFNGLTEXSTORAGE2DMULTISAMPLEPROC)glad_lazy_resolve((void**)&glad_glTexStorage2DMultisample, "glTexStorage2DMultisample"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glUniform2d(GLint arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLUNIFORM2DPROC)glad_lazy_resolve((void**)&glad_glUniform2d, "glUniform2d"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertex4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLVERTEX4DPROC)glad_lazy_resolve((void**)&glad_glVertex4d, "glVertex4d"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX2FVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix2fv, "glUniformMatrix2fv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glTexCoord1sv(const GLshort * arg0) {
+	((PFNGLTEXCOORD1SVPROC)glad_lazy_resolve((void**)&glad_glTexCoord1sv, "glTexCoord1sv"))(arg0);
+}
+static void APIENTRY glad_lazy_glBufferData(GLenum arg0, GLsizeiptr arg1, const void * arg2, GLenum arg3) {
+	((PFNGLBUFFERDATAPROC)glad_lazy_resolve((void**)&glad_glBufferData, "glBufferData"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glEvalPoint1(GLint arg0) {
+	((PFNGLEVALPOINT1PROC)glad_lazy_resolve((void**)&glad_glEvalPoint1, "glEvalPoint1"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTEXPARAMETERIIVPROC)glad_lazy_resolve((void**)&glad_glGetTexParameterIiv, "glGetTexParameterIiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectui64v(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	((PFNGLGETQUERYBUFFEROBJECTUI64VPROC)glad_lazy_resolve((void**)&glad_glGetQueryBufferObjectui64v, "glGetQueryBufferObjectui64v"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glTexCoord1dv(const GLdouble * arg0) {
+	((PFNGLTEXCOORD1DVPROC)glad_lazy_resolve((void**)&glad_glTexCoord1dv, "glTexCoord1dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum arg0, GLuint arg1) {
+	((PFNGLTEXCOORDP1UIPROC)glad_lazy_resolve((void**)&glad_glTexCoordP1ui, "glTexCoordP1ui"))(arg0, arg1);
+}
+static GLenum APIENTRY glad_lazy_glGetError(void) {
+	return ((PFNGLGETERRORPROC)glad_lazy_resolve((void**)&glad_glGetError, "glGetError"))();
+}
+static void APIENTRY glad_lazy_glGetTexEnviv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTEXENVIVPROC)glad_lazy_resolve((void**)&glad_glGetTexEnviv, "glGetTexEnviv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETPROGRAMIVPROC)glad_lazy_resolve((void**)&glad_glGetProgramiv, "glGetProgramiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBP2UIPROC)glad_lazy_resolve((void**)&glad_glVertexAttribP2ui, "glVertexAttribP2ui"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetFloatv(GLenum arg0, GLfloat * arg1) {
+	((PFNGLGETFLOATVPROC)glad_lazy_resolve((void**)&glad_glGetFloatv, "glGetFloatv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLenum arg5, const GLvoid * arg6) {
+	((PFNGLTEXSUBIMAGE1DPROC)glad_lazy_resolve((void**)&glad_glTexSubImage1D, "glTexSubImage1D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glMultiTexCoord2fv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLMULTITEXCOORD2FVPROC)glad_lazy_resolve((void**)&glad_glMultiTexCoord2fv, "glMultiTexCoord2fv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX2X4DVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix2x4dv, "glUniformMatrix2x4dv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint arg0, const GLfloat * arg1) {
+	((PFNGLVERTEXATTRIB2FVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib2fv, "glVertexAttrib2fv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glEvalCoord1d(GLdouble arg0) {
+	((PFNGLEVALCOORD1DPROC)glad_lazy_resolve((void**)&glad_glEvalCoord1d, "glEvalCoord1d"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum arg0, GLint arg1, GLenum arg2, GLfloat * arg3) {
+	((PFNGLGETTEXLEVELPARAMETERFVPROC)glad_lazy_resolve((void**)&glad_glGetTexLevelParameterfv, "glGetTexLevelParameterfv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glEvalCoord1f(GLfloat arg0) {
+	((PFNGLEVALCOORD1FPROC)glad_lazy_resolve((void**)&glad_glEvalCoord1f, "glEvalCoord1f"))(arg0);
+}
+static void APIENTRY glad_lazy_glPixelMapfv(GLenum arg0, GLsizei arg1, const GLfloat * arg2) {
+	((PFNGLPIXELMAPFVPROC)glad_lazy_resolve((void**)&glad_glPixelMapfv, "glPixelMapfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	((PFNGLVERTEXATTRIBP3UIVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribP3uiv, "glVertexAttribP3uiv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetPixelMapusv(GLenum arg0, GLushort * arg1) {
+	((PFNGLGETPIXELMAPUSVPROC)glad_lazy_resolve((void**)&glad_glGetPixelMapusv, "glGetPixelMapusv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLSECONDARYCOLORP3UIVPROC)glad_lazy_resolve((void**)&glad_glSecondaryColorP3uiv, "glSecondaryColorP3uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum arg0, GLint * arg1) {
+	((PFNGLGETINTEGERVPROC)glad_lazy_resolve((void**)&glad_glGetIntegerv, "glGetIntegerv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glAccum(GLenum arg0, GLfloat arg1) {
+	((PFNGLACCUMPROC)glad_lazy_resolve((void**)&glad_glAccum, "glAccum"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayIndexed64iv(GLuint arg0, GLuint arg1, GLenum arg2, GLint64 * arg3) {
+	((PFNGLGETVERTEXARRAYINDEXED64IVPROC)glad_lazy_resolve((void**)&glad_glGetVertexArrayIndexed64iv, "glGetVertexArrayIndexed64iv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum arg0, GLenum arg1, void ** arg2) {
+	((PFNGLGETBUFFERPOINTERVPROC)glad_lazy_resolve((void**)&glad_glGetBufferPointerv, "glGetBufferPointerv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETVERTEXATTRIBIIVPROC)glad_lazy_resolve((void**)&glad_glGetVertexAttribIiv, "glGetVertexAttribIiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glRasterPos4dv(const GLdouble * arg0) {
+	((PFNGLRASTERPOS4DVPROC)glad_lazy_resolve((void**)&glad_glRasterPos4dv, "glRasterPos4dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glProgramUniform4fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	((PFNGLPROGRAMUNIFORM4FVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform4fv, "glProgramUniform4fv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glTexCoord2iv(const GLint * arg0) {
+	((PFNGLTEXCOORD2IVPROC)glad_lazy_resolve((void**)&glad_glTexCoord2iv, "glTexCoord2iv"))(arg0);
+}
+static void APIENTRY glad_lazy_glTextureBarrier(void) {
+	((PFNGLTEXTUREBARRIERPROC)glad_lazy_resolve((void**)&glad_glTextureBarrier, "glTextureBarrier"))();
+}
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint arg0) {
+	return ((PFNGLISQUERYPROC)glad_lazy_resolve((void**)&glad_glIsQuery, "glIsQuery"))(arg0);
+}
+static void APIENTRY glad_lazy_glProgramUniform2ui(GLuint arg0, GLint arg1, GLuint arg2, GLuint arg3) {
+	((PFNGLPROGRAMUNIFORM2UIPROC)glad_lazy_resolve((void**)&glad_glProgramUniform2ui, "glProgramUniform2ui"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4ui(GLuint arg0, GLint arg1, GLuint arg2, GLuint arg3, GLuint arg4, GLuint arg5) {
+	((PFNGLPROGRAMUNIFORM4UIPROC)glad_lazy_resolve((void**)&glad_glProgramUniform4ui, "glProgramUniform4ui"))(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint arg0, const GLshort * arg1) {
+	((PFNGLVERTEXATTRIB4SVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib4sv, "glVertexAttrib4sv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glWindowPos3dv(const GLdouble * arg0) {
+	((PFNGLWINDOWPOS3DVPROC)glad_lazy_resolve((void**)&glad_glWindowPos3dv, "glWindowPos3dv"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexImage2D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4, GLint arg5, GLenum arg6, GLenum arg7, const GLvoid * arg8) {
+	((PFNGLTEXIMAGE2DPROC)glad_lazy_resolve((void**)&glad_glTexImage2D, "glTexImage2D"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_lazy_glStencilMask(GLuint arg0) {
+	((PFNGLSTENCILMASKPROC)glad_lazy_resolve((void**)&glad_glStencilMask, "glStencilMask"))(arg0);
+}
+static void APIENTRY glad_lazy_glDrawPixels(GLsizei arg0, GLsizei arg1, GLenum arg2, GLenum arg3, const GLvoid * arg4) {
+	((PFNGLDRAWPIXELSPROC)glad_lazy_resolve((void**)&glad_glDrawPixels, "glDrawPixels"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glMultMatrixd(const GLdouble * arg0) {
+	((PFNGLMULTMATRIXDPROC)glad_lazy_resolve((void**)&glad_glMultMatrixd, "glMultMatrixd"))(arg0);
+}
+static void APIENTRY glad_lazy_glMultMatrixf(const GLfloat * arg0) {
+	((PFNGLMULTMATRIXFPROC)glad_lazy_resolve((void**)&glad_glMultMatrixf, "glMultMatrixf"))(arg0);
+}
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint arg0) {
+	return ((PFNGLISTEXTUREPROC)glad_lazy_resolve((void**)&glad_glIsTexture, "glIsTexture"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetMaterialiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETMATERIALIVPROC)glad_lazy_resolve((void**)&glad_glGetMaterialiv, "glGetMaterialiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glNamedBufferData(GLuint arg0, GLsizeiptr arg1, const void * arg2, GLenum arg3) {
+	((PFNGLNAMEDBUFFERDATAPROC)glad_lazy_resolve((void**)&glad_glNamedBufferData, "glNamedBufferData"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniform1fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	((PFNGLUNIFORM1FVPROC)glad_lazy_resolve((void**)&glad_glUniform1fv, "glUniform1fv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glLoadMatrixf(const GLfloat * arg0) {
+	((PFNGLLOADMATRIXFPROC)glad_lazy_resolve((void**)&glad_glLoadMatrixf, "glLoadMatrixf"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexStorage2D(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLTEXSTORAGE2DPROC)glad_lazy_resolve((void**)&glad_glTexStorage2D, "glTexStorage2D"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glLoadMatrixd(const GLdouble * arg0) {
+	((PFNGLLOADMATRIXDPROC)glad_lazy_resolve((void**)&glad_glLoadMatrixd, "glLoadMatrixd"))(arg0);
+}
+static void APIENTRY glad_lazy_glClearNamedBufferSubData(GLuint arg0, GLenum arg1, GLintptr arg2, GLsizeiptr arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	((PFNGLCLEARNAMEDBUFFERSUBDATAPROC)glad_lazy_resolve((void**)&glad_glClearNamedBufferSubData, "glClearNamedBufferSubData"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void * APIENTRY glad_lazy_glMapNamedBufferRange(GLuint arg0, GLintptr arg1, GLsizeiptr arg2, GLbitfield arg3) {
+	return ((PFNGLMAPNAMEDBUFFERRANGEPROC)glad_lazy_resolve((void**)&glad_glMapNamedBufferRange, "glMapNamedBufferRange"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferTextureLayer(GLuint arg0, GLenum arg1, GLuint arg2, GLint arg3, GLint arg4) {
+	((PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_resolve((void**)&glad_glNamedFramebufferTextureLayer, "glNamedFramebufferTextureLayer"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLTEXPARAMETERFVPROC)glad_lazy_resolve((void**)&glad_glTexParameterfv, "glTexParameterfv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX3FVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix3fv, "glUniformMatrix3fv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glVertex4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLVERTEX4FPROC)glad_lazy_resolve((void**)&glad_glVertex4f, "glVertex4f"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glRectsv(const GLshort * arg0, const GLshort * arg1) {
+	((PFNGLRECTSVPROC)glad_lazy_resolve((void**)&glad_glRectsv, "glRectsv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glColor4usv(const GLushort * arg0) {
+	((PFNGLCOLOR4USVPROC)glad_lazy_resolve((void**)&glad_glColor4usv, "glColor4usv"))(arg0);
+}
+static void APIENTRY glad_lazy_glUniform3dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	((PFNGLUNIFORM3DVPROC)glad_lazy_resolve((void**)&glad_glUniform3dv, "glUniform3dv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)glad_lazy_resolve((void**)&glad_glProgramUniformMatrix4x3fv, "glProgramUniformMatrix4x3fv"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glPolygonStipple(const GLubyte * arg0) {
+	((PFNGLPOLYGONSTIPPLEPROC)glad_lazy_resolve((void**)&glad_glPolygonStipple, "glPolygonStipple"))(arg0);
+}
+static void APIENTRY glad_lazy_glBindBuffersBase(GLenum arg0, GLuint arg1, GLsizei arg2, const GLuint * arg3) {
+	((PFNGLBINDBUFFERSBASEPROC)glad_lazy_resolve((void**)&glad_glBindBuffersBase, "glBindBuffersBase"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glInterleavedArrays(GLenum arg0, GLsizei arg1, const GLvoid * arg2) {
+	((PFNGLINTERLEAVEDARRAYSPROC)glad_lazy_resolve((void**)&glad_glInterleavedArrays, "glInterleavedArrays"))(arg0, arg1, arg2);
+}
+static GLint APIENTRY glad_lazy_glGetSubroutineUniformLocation(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	return ((PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)glad_lazy_resolve((void**)&glad_glGetSubroutineUniformLocation, "glGetSubroutineUniformLocation"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glNormal3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLNORMAL3IPROC)glad_lazy_resolve((void**)&glad_glNormal3i, "glNormal3i"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glNormal3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLNORMAL3FPROC)glad_lazy_resolve((void**)&glad_glNormal3f, "glNormal3f"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glNormal3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLNORMAL3DPROC)glad_lazy_resolve((void**)&glad_glNormal3d, "glNormal3d"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glNormal3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+	((PFNGLNORMAL3BPROC)glad_lazy_resolve((void**)&glad_glNormal3b, "glNormal3b"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetFramebufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETFRAMEBUFFERPARAMETERIVPROC)glad_lazy_resolve((void**)&glad_glGetFramebufferParameteriv, "glGetFramebufferParameteriv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glPixelMapusv(GLenum arg0, GLsizei arg1, const GLushort * arg2) {
+	((PFNGLPIXELMAPUSVPROC)glad_lazy_resolve((void**)&glad_glPixelMapusv, "glPixelMapusv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetTexGeniv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTEXGENIVPROC)glad_lazy_resolve((void**)&glad_glGetTexGeniv, "glGetTexGeniv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glArrayElement(GLint arg0) {
+	((PFNGLARRAYELEMENTPROC)glad_lazy_resolve((void**)&glad_glArrayElement, "glArrayElement"))(arg0);
+}
+static void APIENTRY glad_lazy_glGetCompressedTextureSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLsizei arg8, void * arg9) {
+	((PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)glad_lazy_resolve((void**)&glad_glGetCompressedTextureSubImage, "glGetCompressedTextureSubImage"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum arg0, GLenum arg1, GLintptr arg2, GLintptr arg3, GLsizeiptr arg4) {
+	((PFNGLCOPYBUFFERSUBDATAPROC)glad_lazy_resolve((void**)&glad_glCopyBufferSubData, "glCopyBufferSubData"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint arg0, const GLuint * arg1) {
+	((PFNGLVERTEXATTRIBI1UIVPROC)glad_lazy_resolve((void**)&glad_glVertexAttribI1uiv, "glVertexAttribI1uiv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLVERTEXATTRIB2DPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib2d, "glVertexAttrib2d"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glBindTransformFeedback(GLenum arg0, GLuint arg1) {
+	((PFNGLBINDTRANSFORMFEEDBACKPROC)glad_lazy_resolve((void**)&glad_glBindTransformFeedback, "glBindTransformFeedback"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLVERTEXATTRIB2FPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib2f, "glVertexAttrib2f"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIB3DVPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib3dv, "glVertexAttrib3dv"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint arg0, GLenum arg1, GLuint64 * arg2) {
+	((PFNGLGETQUERYOBJECTUI64VPROC)glad_lazy_resolve((void**)&glad_glGetQueryObjectui64v, "glGetQueryObjectui64v"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glDepthMask(GLboolean arg0) {
+	((PFNGLDEPTHMASKPROC)glad_lazy_resolve((void**)&glad_glDepthMask, "glDepthMask"))(arg0);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLVERTEXATTRIB2SPROC)glad_lazy_resolve((void**)&glad_glVertexAttrib2s, "glVertexAttrib2s"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glColor3fv(const GLfloat * arg0) {
+	((PFNGLCOLOR3FVPROC)glad_lazy_resolve((void**)&glad_glColor3fv, "glColor3fv"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+	((PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_lazy_resolve((void**)&glad_glTexImage3DMultisample, "glTexImage3DMultisample"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glProgramUniform1fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	((PFNGLPROGRAMUNIFORM1FVPROC)glad_lazy_resolve((void**)&glad_glProgramUniform1fv, "glProgramUniform1fv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX4FVPROC)glad_lazy_resolve((void**)&glad_glUniformMatrix4fv, "glUniformMatrix4fv"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glUniform4fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	((PFNGLUNIFORM4FVPROC)glad_lazy_resolve((void**)&glad_glUniform4fv, "glUniform4fv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4, GLenum * arg5, GLchar * arg6) {
+	((PFNGLGETACTIVEUNIFORMPROC)glad_lazy_resolve((void**)&glad_glGetActiveUniform, "glGetActiveUniform"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_lazy_glColorPointer(GLint arg0, GLenum arg1, GLsizei arg2, const GLvoid * arg3) {
+	((PFNGLCOLORPOINTERPROC)glad_lazy_resolve((void**)&glad_glColorPointer, "glColorPointer"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glFrontFace(GLenum arg0) {
+	((PFNGLFRONTFACEPROC)glad_lazy_resolve((void**)&glad_glFrontFace, "glFrontFace"))(arg0);
+}
+static void APIENTRY glad_lazy_glTexBufferRange(GLenum arg0, GLenum arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	((PFNGLTEXBUFFERRANGEPROC)glad_lazy_resolve((void**)&glad_glTexBufferRange, "glTexBufferRange"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glCreateBuffers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATEBUFFERSPROC)glad_lazy_resolve((void**)&glad_glCreateBuffers, "glCreateBuffers"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	((PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)glad_lazy_resolve((void**)&glad_glNamedFramebufferParameteri, "glNamedFramebufferParameteri"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstancedBaseInstance(GLenum arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLuint arg4) {
+	((PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)glad_lazy_resolve((void**)&glad_glDrawArraysInstancedBaseInstance, "glDrawArraysInstancedBaseInstance"))(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum arg0, GLuint arg1, GLboolean * arg2) {
+	((PFNGLGETBOOLEANI_VPROC)glad_lazy_resolve((void**)&glad_glGetBooleani_v, "glGetBooleani_v"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glVertexAttribL3d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLVERTEXATTRIBL3DPROC)glad_lazy_resolve((void**)&glad_glVertexAttribL3d, "glVertexAttribL3d"))(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_lazy_glDeleteProgramPipelines(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETEPROGRAMPIPELINESPROC)glad_lazy_resolve((void**)&glad_glDeleteProgramPipelines, "glDeleteProgramPipelines"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum arg0, GLint arg1, const GLuint * arg2) {
+	((PFNGLCLEARBUFFERUIVPROC)glad_lazy_resolve((void**)&glad_glClearBufferuiv, "glClearBufferuiv"))(arg0, arg1, arg2);
+}
+static void APIENTRY glad_lazy_glClipControl(GLenum arg0, GLenum arg1) {
+	((PFNGLCLIPCONTROLPROC)glad_lazy_resolve((void**)&glad_glClipControl, "glClipControl"))(arg0, arg1);
+}
+static void APIENTRY glad_lazy_glGetProgramResourceiv(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, const GLenum * arg4, GLsizei arg5, GLsizei * arg6, GLint * arg7) {
+	((PFNGLGETPROGRAMRESOURCEIVPROC)glad_lazy_resolve((void**)&glad_glGetProgramResourceiv, "glGetProgramResourceiv"))(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+/* Per-context dispatch: each GladGLContext owns a full table of entry points,
+ * its version and its extension set, and the thread's current table is kept
+ * in a thread local. Dispatch is switched on explicitly and exactly once
+ * (gladEnableGLContextDispatch); from then on the global pointers are the
+ * glad_ctx_* stubs below, which forward through the current thread's table.
+ * Threads without a table of their own fall back to the default context,
+ * which holds whatever gladLoadGLLoader(Lazy) loaded. Until dispatch is
+ * switched on the globals point straight at the driver. */
+#if defined(_MSC_VER)
+#define GLAD_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define GLAD_THREAD_LOCAL __thread
+#else
+#define GLAD_THREAD_LOCAL _Thread_local
+#endif
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#define GLAD_GL_NUM_PROCS 1048
+
+struct GladGLContext {
+    unsigned int id; /* new for every load, so callers can cache per-context answers */
+    struct gladGLversionStruct version;
+    struct gladExtSet exts;
+    void* procs[GLAD_GL_NUM_PROCS];
+};
+
+struct gladProcEntry {
+    const char *name;
+    void **slot;
+    void *dispatch;
+    void *lazy;     /* what gladLoadGLLoaderLazy() puts in the slot until the first call */
+    int version; /* major * 10 + minor of the core version that added it */
+};
+
+static struct GladGLContext glad_default_context;
+static GLAD_THREAD_LOCAL struct GladGLContext *glad_current_context = &glad_default_context;
+static int glad_context_dispatch;
+static volatile long glad_context_ids;
+
+static unsigned int next_context_id(void) {
+#if defined(_MSC_VER)
+    return (unsigned int)InterlockedIncrement(&glad_context_ids);
+#else
+    return (unsigned int)__sync_add_and_fetch(&glad_context_ids, 1);
+#endif
+}
+
+static void APIENTRY glad_ctx_glCopyTexImage1D(GLenum arg0, GLint arg1, GLenum arg2, GLint arg3, GLint arg4, GLsizei arg5, GLint arg6) {
+	((PFNGLCOPYTEXIMAGE1DPROC)glad_current_context->procs[0])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glTextureParameterf(GLuint arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLTEXTUREPARAMETERFPROC)glad_current_context->procs[1])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttribI3ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBI3UIPROC)glad_current_context->procs[2])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertexArrayElementBuffer(GLuint arg0, GLuint arg1) {
+	((PFNGLVERTEXARRAYELEMENTBUFFERPROC)glad_current_context->procs[3])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glWindowPos2s(GLshort arg0, GLshort arg1) {
+	((PFNGLWINDOWPOS2SPROC)glad_current_context->procs[4])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTextureStorage3DMultisample(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+	((PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)glad_current_context->procs[5])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glTextureParameterfv(GLuint arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLTEXTUREPARAMETERFVPROC)glad_current_context->procs[6])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glWindowPos2i(GLint arg0, GLint arg1) {
+	((PFNGLWINDOWPOS2IPROC)glad_current_context->procs[7])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glWindowPos2f(GLfloat arg0, GLfloat arg1) {
+	((PFNGLWINDOWPOS2FPROC)glad_current_context->procs[8])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glWindowPos2d(GLdouble arg0, GLdouble arg1) {
+	((PFNGLWINDOWPOS2DPROC)glad_current_context->procs[9])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertex2fv(const GLfloat * arg0) {
+	((PFNGLVERTEX2FVPROC)glad_current_context->procs[10])(arg0);
+}
+static void APIENTRY glad_ctx_glIndexi(GLint arg0) {
+	((PFNGLINDEXIPROC)glad_current_context->procs[11])(arg0);
+}
+static void APIENTRY glad_ctx_glFramebufferRenderbuffer(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3) {
+	((PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_current_context->procs[12])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniformSubroutinesuiv(GLenum arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLUNIFORMSUBROUTINESUIVPROC)glad_current_context->procs[13])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glRectdv(const GLdouble * arg0, const GLdouble * arg1) {
+	((PFNGLRECTDVPROC)glad_current_context->procs[14])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glCompressedTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLsizei arg9, const void * arg10) {
+	((PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_current_context->procs[15])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static void APIENTRY glad_ctx_glEvalCoord2d(GLdouble arg0, GLdouble arg1) {
+	((PFNGLEVALCOORD2DPROC)glad_current_context->procs[16])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glEvalCoord2f(GLfloat arg0, GLfloat arg1) {
+	((PFNGLEVALCOORD2FPROC)glad_current_context->procs[17])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetDoublei_v(GLenum arg0, GLuint arg1, GLdouble * arg2) {
+	((PFNGLGETDOUBLEI_VPROC)glad_current_context->procs[18])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glIndexd(GLdouble arg0) {
+	((PFNGLINDEXDPROC)glad_current_context->procs[19])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexAttrib1sv(GLuint arg0, const GLshort * arg1) {
+	((PFNGLVERTEXATTRIB1SVPROC)glad_current_context->procs[20])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glIndexf(GLfloat arg0) {
+	((PFNGLINDEXFPROC)glad_current_context->procs[21])(arg0);
+}
+static void APIENTRY glad_ctx_glBindSampler(GLuint arg0, GLuint arg1) {
+	((PFNGLBINDSAMPLERPROC)glad_current_context->procs[22])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glLineWidth(GLfloat arg0) {
+	((PFNGLLINEWIDTHPROC)glad_current_context->procs[23])(arg0);
+}
+static void APIENTRY glad_ctx_glColorP3uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLCOLORP3UIVPROC)glad_current_context->procs[24])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetIntegeri_v(GLenum arg0, GLuint arg1, GLint * arg2) {
+	((PFNGLGETINTEGERI_VPROC)glad_current_context->procs[25])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetMapfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETMAPFVPROC)glad_current_context->procs[26])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glIndexs(GLshort arg0) {
+	((PFNGLINDEXSPROC)glad_current_context->procs[27])(arg0);
+}
+static void APIENTRY glad_ctx_glCompileShader(GLuint arg0) {
+	((PFNGLCOMPILESHADERPROC)glad_current_context->procs[28])(arg0);
+}
+static void APIENTRY glad_ctx_glGetTransformFeedbackVarying(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLsizei * arg4, GLenum * arg5, GLchar * arg6) {
+	((PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_current_context->procs[29])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glWindowPos2iv(const GLint * arg0) {
+	((PFNGLWINDOWPOS2IVPROC)glad_current_context->procs[30])(arg0);
+}
+static void APIENTRY glad_ctx_glDrawTransformFeedbackStreamInstanced(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3) {
+	((PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)glad_current_context->procs[31])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glIndexfv(const GLfloat * arg0) {
+	((PFNGLINDEXFVPROC)glad_current_context->procs[32])(arg0);
+}
+static void APIENTRY glad_ctx_glGetCompressedTextureImage(GLuint arg0, GLint arg1, GLsizei arg2, void * arg3) {
+	((PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)glad_current_context->procs[33])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetnMapfv(GLenum arg0, GLenum arg1, GLsizei arg2, GLfloat * arg3) {
+	((PFNGLGETNMAPFVPROC)glad_current_context->procs[34])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glFogiv(GLenum arg0, const GLint * arg1) {
+	((PFNGLFOGIVPROC)glad_current_context->procs[35])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glStencilMaskSeparate(GLenum arg0, GLuint arg1) {
+	((PFNGLSTENCILMASKSEPARATEPROC)glad_current_context->procs[36])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glRasterPos2fv(const GLfloat * arg0) {
+	((PFNGLRASTERPOS2FVPROC)glad_current_context->procs[37])(arg0);
+}
+static void APIENTRY glad_ctx_glLightModeliv(GLenum arg0, const GLint * arg1) {
+	((PFNGLLIGHTMODELIVPROC)glad_current_context->procs[38])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glDepthRangef(GLfloat arg0, GLfloat arg1) {
+	((PFNGLDEPTHRANGEFPROC)glad_current_context->procs[39])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glMultiDrawElementsIndirectCount(GLenum arg0, GLenum arg1, const void * arg2, GLintptr arg3, GLsizei arg4, GLsizei arg5) {
+	((PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)glad_current_context->procs[40])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glColor4ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+	((PFNGLCOLOR4UIPROC)glad_current_context->procs[41])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3fv(const GLfloat * arg0) {
+	((PFNGLSECONDARYCOLOR3FVPROC)glad_current_context->procs[42])(arg0);
+}
+static void APIENTRY glad_ctx_glMultiTexCoordP3ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	((PFNGLMULTITEXCOORDP3UIPROC)glad_current_context->procs[43])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMemoryBarrierByRegion(GLbitfield arg0) {
+	((PFNGLMEMORYBARRIERBYREGIONPROC)glad_current_context->procs[44])(arg0);
+}
+static void APIENTRY glad_ctx_glGetNamedBufferParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETNAMEDBUFFERPARAMETERIVPROC)glad_current_context->procs[45])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glFogfv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLFOGFVPROC)glad_current_context->procs[46])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexP4ui(GLenum arg0, GLuint arg1) {
+	((PFNGLVERTEXP4UIPROC)glad_current_context->procs[47])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glDrawElementsInstancedBaseInstance(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLuint arg5) {
+	((PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)glad_current_context->procs[48])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glEnablei(GLenum arg0, GLuint arg1) {
+	((PFNGLENABLEIPROC)glad_current_context->procs[49])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glProgramUniform3dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	((PFNGLPROGRAMUNIFORM3DVPROC)glad_current_context->procs[50])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertex4iv(const GLint * arg0) {
+	((PFNGLVERTEX4IVPROC)glad_current_context->procs[51])(arg0);
+}
+static void APIENTRY glad_ctx_glEvalCoord1fv(const GLfloat * arg0) {
+	((PFNGLEVALCOORD1FVPROC)glad_current_context->procs[52])(arg0);
+}
+static void APIENTRY glad_ctx_glWindowPos2sv(const GLshort * arg0) {
+	((PFNGLWINDOWPOS2SVPROC)glad_current_context->procs[53])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexAttribP4ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBP4UIPROC)glad_current_context->procs[54])(arg0, arg1, arg2, arg3);
+}
+static GLuint APIENTRY glad_ctx_glCreateShader(GLenum arg0) {
+	return ((PFNGLCREATESHADERPROC)glad_current_context->procs[55])(arg0);
+}
+static GLboolean APIENTRY glad_ctx_glIsBuffer(GLuint arg0) {
+	return ((PFNGLISBUFFERPROC)glad_current_context->procs[56])(arg0);
+}
+static void APIENTRY glad_ctx_glGetMultisamplefv(GLenum arg0, GLuint arg1, GLfloat * arg2) {
+	((PFNGLGETMULTISAMPLEFVPROC)glad_current_context->procs[57])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix2dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX2DVPROC)glad_current_context->procs[58])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGenRenderbuffers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENRENDERBUFFERSPROC)glad_current_context->procs[59])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glCopyTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLsizei arg6, GLsizei arg7) {
+	((PFNGLCOPYTEXSUBIMAGE2DPROC)glad_current_context->procs[60])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_ctx_glCompressedTexImage2D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLint arg5, GLsizei arg6, const void * arg7) {
+	((PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_current_context->procs[61])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_ctx_glVertexAttrib1f(GLuint arg0, GLfloat arg1) {
+	((PFNGLVERTEXATTRIB1FPROC)glad_current_context->procs[62])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glBlendFuncSeparate(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3) {
+	((PFNGLBLENDFUNCSEPARATEPROC)glad_current_context->procs[63])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertex4fv(const GLfloat * arg0) {
+	((PFNGLVERTEX4FVPROC)glad_current_context->procs[64])(arg0);
+}
+static void APIENTRY glad_ctx_glMinSampleShading(GLfloat arg0) {
+	((PFNGLMINSAMPLESHADINGPROC)glad_current_context->procs[65])(arg0);
+}
+static void APIENTRY glad_ctx_glClearNamedFramebufferfi(GLuint arg0, GLenum arg1, GLint arg2, GLfloat arg3, GLint arg4) {
+	((PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)glad_current_context->procs[66])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetQueryBufferObjectuiv(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	((PFNGLGETQUERYBUFFEROBJECTUIVPROC)glad_current_context->procs[67])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glBindTexture(GLenum arg0, GLuint arg1) {
+	((PFNGLBINDTEXTUREPROC)glad_current_context->procs[68])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttrib1s(GLuint arg0, GLshort arg1) {
+	((PFNGLVERTEXATTRIB1SPROC)glad_current_context->procs[69])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTexCoord2fv(const GLfloat * arg0) {
+	((PFNGLTEXCOORD2FVPROC)glad_current_context->procs[70])(arg0);
+}
+static void APIENTRY glad_ctx_glSampleMaski(GLuint arg0, GLbitfield arg1) {
+	((PFNGLSAMPLEMASKIPROC)glad_current_context->procs[71])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexP2ui(GLenum arg0, GLuint arg1) {
+	((PFNGLVERTEXP2UIPROC)glad_current_context->procs[72])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glDrawRangeElementsBaseVertex(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3, GLenum arg4, const void * arg5, GLint arg6) {
+	((PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_current_context->procs[73])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glTexCoord4fv(const GLfloat * arg0) {
+	((PFNGLTEXCOORD4FVPROC)glad_current_context->procs[74])(arg0);
+}
+static void APIENTRY glad_ctx_glUniformMatrix3x2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX3X2FVPROC)glad_current_context->procs[75])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glDebugMessageControl(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, const GLuint * arg4, GLboolean arg5) {
+	((PFNGLDEBUGMESSAGECONTROLPROC)glad_current_context->procs[76])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glPointSize(GLfloat arg0) {
+	((PFNGLPOINTSIZEPROC)glad_current_context->procs[77])(arg0);
+}
+static void APIENTRY glad_ctx_glBindTextureUnit(GLuint arg0, GLuint arg1) {
+	((PFNGLBINDTEXTUREUNITPROC)glad_current_context->procs[78])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttrib2dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIB2DVPROC)glad_current_context->procs[79])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glDeleteProgram(GLuint arg0) {
+	((PFNGLDELETEPROGRAMPROC)glad_current_context->procs[80])(arg0);
+}
+static void APIENTRY glad_ctx_glColor4bv(const GLbyte * arg0) {
+	((PFNGLCOLOR4BVPROC)glad_current_context->procs[81])(arg0);
+}
+static void APIENTRY glad_ctx_glRasterPos2f(GLfloat arg0, GLfloat arg1) {
+	((PFNGLRASTERPOS2FPROC)glad_current_context->procs[82])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glRasterPos2d(GLdouble arg0, GLdouble arg1) {
+	((PFNGLRASTERPOS2DPROC)glad_current_context->procs[83])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glLoadIdentity(void) {
+	((PFNGLLOADIDENTITYPROC)glad_current_context->procs[84])();
+}
+static void APIENTRY glad_ctx_glRasterPos2i(GLint arg0, GLint arg1) {
+	((PFNGLRASTERPOS2IPROC)glad_current_context->procs[85])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glMultiDrawArraysIndirect(GLenum arg0, const void * arg1, GLsizei arg2, GLsizei arg3) {
+	((PFNGLMULTIDRAWARRAYSINDIRECTPROC)glad_current_context->procs[86])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glRenderbufferStorage(GLenum arg0, GLenum arg1, GLsizei arg2, GLsizei arg3) {
+	((PFNGLRENDERBUFFERSTORAGEPROC)glad_current_context->procs[87])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniformMatrix4x3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX4X3FVPROC)glad_current_context->procs[88])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glColor3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+	((PFNGLCOLOR3BPROC)glad_current_context->procs[89])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glClearBufferfv(GLenum arg0, GLint arg1, const GLfloat * arg2) {
+	((PFNGLCLEARBUFFERFVPROC)glad_current_context->procs[90])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glEdgeFlag(GLboolean arg0) {
+	((PFNGLEDGEFLAGPROC)glad_current_context->procs[91])(arg0);
+}
+static void APIENTRY glad_ctx_glDeleteSamplers(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETESAMPLERSPROC)glad_current_context->procs[92])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertex3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLVERTEX3DPROC)glad_current_context->procs[93])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertex3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLVERTEX3FPROC)glad_current_context->procs[94])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetnMapiv(GLenum arg0, GLenum arg1, GLsizei arg2, GLint * arg3) {
+	((PFNGLGETNMAPIVPROC)glad_current_context->procs[95])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertex3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLVERTEX3IPROC)glad_current_context->procs[96])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glColor3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLCOLOR3IPROC)glad_current_context->procs[97])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glUniform3d(GLint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLUNIFORM3DPROC)glad_current_context->procs[98])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniform3f(GLint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLUNIFORM3FPROC)glad_current_context->procs[99])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4ubv(GLuint arg0, const GLubyte * arg1) {
+	((PFNGLVERTEXATTRIB4UBVPROC)glad_current_context->procs[100])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glColor3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLCOLOR3SPROC)glad_current_context->procs[101])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertex3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLVERTEX3SPROC)glad_current_context->procs[102])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexCoordP2ui(GLenum arg0, GLuint arg1) {
+	((PFNGLTEXCOORDP2UIPROC)glad_current_context->procs[103])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glColorMaski(GLuint arg0, GLboolean arg1, GLboolean arg2, GLboolean arg3, GLboolean arg4) {
+	((PFNGLCOLORMASKIPROC)glad_current_context->procs[104])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glClearBufferfi(GLenum arg0, GLint arg1, GLfloat arg2, GLint arg3) {
+	((PFNGLCLEARBUFFERFIPROC)glad_current_context->procs[105])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glDrawArraysIndirect(GLenum arg0, const void * arg1) {
+	((PFNGLDRAWARRAYSINDIRECTPROC)glad_current_context->procs[106])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTexCoord1iv(const GLint * arg0) {
+	((PFNGLTEXCOORD1IVPROC)glad_current_context->procs[107])(arg0);
+}
+static void APIENTRY glad_ctx_glBlitFramebuffer(GLint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLint arg7, GLbitfield arg8, GLenum arg9) {
+	((PFNGLBLITFRAMEBUFFERPROC)glad_current_context->procs[108])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static void APIENTRY glad_ctx_glPauseTransformFeedback(void) {
+	((PFNGLPAUSETRANSFORMFEEDBACKPROC)glad_current_context->procs[109])();
+}
+static void APIENTRY glad_ctx_glMultiTexCoordP2ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	((PFNGLMULTITEXCOORDP2UIPROC)glad_current_context->procs[110])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix3x2dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)glad_current_context->procs[111])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glCopyNamedBufferSubData(GLuint arg0, GLuint arg1, GLintptr arg2, GLintptr arg3, GLsizeiptr arg4) {
+	((PFNGLCOPYNAMEDBUFFERSUBDATAPROC)glad_current_context->procs[112])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glNamedFramebufferTexture(GLuint arg0, GLenum arg1, GLuint arg2, GLint arg3) {
+	((PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)glad_current_context->procs[113])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix3x2fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)glad_current_context->procs[114])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetSamplerParameterIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETSAMPLERPARAMETERIIVPROC)glad_current_context->procs[115])(arg0, arg1, arg2);
+}
+static GLint APIENTRY glad_ctx_glGetFragDataIndex(GLuint arg0, const GLchar * arg1) {
+	return ((PFNGLGETFRAGDATAINDEXPROC)glad_current_context->procs[116])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttribL4d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	((PFNGLVERTEXATTRIBL4DPROC)glad_current_context->procs[117])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glBindImageTexture(GLuint arg0, GLuint arg1, GLint arg2, GLboolean arg3, GLint arg4, GLenum arg5, GLenum arg6) {
+	((PFNGLBINDIMAGETEXTUREPROC)glad_current_context->procs[118])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glVertexAttrib3f(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLVERTEXATTRIB3FPROC)glad_current_context->procs[119])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix4fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX4FVPROC)glad_current_context->procs[120])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glVertex2iv(const GLint * arg0) {
+	((PFNGLVERTEX2IVPROC)glad_current_context->procs[121])(arg0);
+}
+static void APIENTRY glad_ctx_glGetQueryBufferObjecti64v(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	((PFNGLGETQUERYBUFFEROBJECTI64VPROC)glad_current_context->procs[122])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glColor3sv(const GLshort * arg0) {
+	((PFNGLCOLOR3SVPROC)glad_current_context->procs[123])(arg0);
+}
+static void APIENTRY glad_ctx_glGetVertexAttribdv(GLuint arg0, GLenum arg1, GLdouble * arg2) {
+	((PFNGLGETVERTEXATTRIBDVPROC)glad_current_context->procs[124])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glActiveShaderProgram(GLuint arg0, GLuint arg1) {
+	((PFNGLACTIVESHADERPROGRAMPROC)glad_current_context->procs[125])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glUniformMatrix3x4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX3X4FVPROC)glad_current_context->procs[126])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniformMatrix3dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX3DVPROC)glad_current_context->procs[127])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glNormalPointer(GLenum arg0, GLsizei arg1, const GLvoid * arg2) {
+	((PFNGLNORMALPOINTERPROC)glad_current_context->procs[128])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexCoordP3uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLTEXCOORDP3UIVPROC)glad_current_context->procs[129])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertex4sv(const GLshort * arg0) {
+	((PFNGLVERTEX4SVPROC)glad_current_context->procs[130])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexArrayAttribLFormat(GLuint arg0, GLuint arg1, GLint arg2, GLenum arg3, GLuint arg4) {
+	((PFNGLVERTEXARRAYATTRIBLFORMATPROC)glad_current_context->procs[131])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glInvalidateBufferSubData(GLuint arg0, GLintptr arg1, GLsizeiptr arg2) {
+	((PFNGLINVALIDATEBUFFERSUBDATAPROC)glad_current_context->procs[132])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glPassThrough(GLfloat arg0) {
+	((PFNGLPASSTHROUGHPROC)glad_current_context->procs[133])(arg0);
+}
+static void APIENTRY glad_ctx_glMultiTexCoordP4ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	((PFNGLMULTITEXCOORDP4UIPROC)glad_current_context->procs[134])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glFogi(GLenum arg0, GLint arg1) {
+	((PFNGLFOGIPROC)glad_current_context->procs[135])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glBegin(GLenum arg0) {
+	((PFNGLBEGINPROC)glad_current_context->procs[136])(arg0);
+}
+static void APIENTRY glad_ctx_glEvalCoord2dv(const GLdouble * arg0) {
+	((PFNGLEVALCOORD2DVPROC)glad_current_context->procs[137])(arg0);
+}
+static void APIENTRY glad_ctx_glColor3ubv(const GLubyte * arg0) {
+	((PFNGLCOLOR3UBVPROC)glad_current_context->procs[138])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexPointer(GLint arg0, GLenum arg1, GLsizei arg2, const GLvoid * arg3) {
+	((PFNGLVERTEXPOINTERPROC)glad_current_context->procs[139])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3uiv(const GLuint * arg0) {
+	((PFNGLSECONDARYCOLOR3UIVPROC)glad_current_context->procs[140])(arg0);
+}
+static void APIENTRY glad_ctx_glDeleteFramebuffers(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETEFRAMEBUFFERSPROC)glad_current_context->procs[141])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glDrawArrays(GLenum arg0, GLint arg1, GLsizei arg2) {
+	((PFNGLDRAWARRAYSPROC)glad_current_context->procs[142])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glUniform1ui(GLint arg0, GLuint arg1) {
+	((PFNGLUNIFORM1UIPROC)glad_current_context->procs[143])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetTransformFeedbackiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTRANSFORMFEEDBACKIVPROC)glad_current_context->procs[144])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord1d(GLenum arg0, GLdouble arg1) {
+	((PFNGLMULTITEXCOORD1DPROC)glad_current_context->procs[145])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord1f(GLenum arg0, GLfloat arg1) {
+	((PFNGLMULTITEXCOORD1FPROC)glad_current_context->procs[146])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glProgramParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	((PFNGLPROGRAMPARAMETERIPROC)glad_current_context->procs[147])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glLightfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLLIGHTFVPROC)glad_current_context->procs[148])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexCoordP3ui(GLenum arg0, GLuint arg1) {
+	((PFNGLTEXCOORDP3UIPROC)glad_current_context->procs[149])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttrib3d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLVERTEXATTRIB3DPROC)glad_current_context->procs[150])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glClear(GLbitfield arg0) {
+	((PFNGLCLEARPROC)glad_current_context->procs[151])(arg0);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord1i(GLenum arg0, GLint arg1) {
+	((PFNGLMULTITEXCOORD1IPROC)glad_current_context->procs[152])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetActiveUniformName(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+	((PFNGLGETACTIVEUNIFORMNAMEPROC)glad_current_context->procs[153])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glMemoryBarrier(GLbitfield arg0) {
+	((PFNGLMEMORYBARRIERPROC)glad_current_context->procs[154])(arg0);
+}
+static GLenum APIENTRY glad_ctx_glGetGraphicsResetStatus(void) {
+	return ((PFNGLGETGRAPHICSRESETSTATUSPROC)glad_current_context->procs[155])();
+}
+static void APIENTRY glad_ctx_glMultiTexCoord1s(GLenum arg0, GLshort arg1) {
+	((PFNGLMULTITEXCOORD1SPROC)glad_current_context->procs[156])(arg0, arg1);
+}
+static GLboolean APIENTRY glad_ctx_glIsEnabled(GLenum arg0) {
+	return ((PFNGLISENABLEDPROC)glad_current_context->procs[157])(arg0);
+}
+static void APIENTRY glad_ctx_glStencilOp(GLenum arg0, GLenum arg1, GLenum arg2) {
+	((PFNGLSTENCILOPPROC)glad_current_context->procs[158])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetQueryObjectuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	((PFNGLGETQUERYOBJECTUIVPROC)glad_current_context->procs[159])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glFramebufferTexture2D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4) {
+	((PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_current_context->procs[160])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetFramebufferAttachmentParameteriv(GLenum arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_current_context->procs[161])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glTranslatef(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLTRANSLATEFPROC)glad_current_context->procs[162])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4Nub(GLuint arg0, GLubyte arg1, GLubyte arg2, GLubyte arg3, GLubyte arg4) {
+	((PFNGLVERTEXATTRIB4NUBPROC)glad_current_context->procs[163])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glTranslated(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLTRANSLATEDPROC)glad_current_context->procs[164])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexCoord3sv(const GLshort * arg0) {
+	((PFNGLTEXCOORD3SVPROC)glad_current_context->procs[165])(arg0);
+}
+static GLint APIENTRY glad_ctx_glGetFragDataLocation(GLuint arg0, const GLchar * arg1) {
+	return ((PFNGLGETFRAGDATALOCATIONPROC)glad_current_context->procs[166])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetTextureParameterIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTEXTUREPARAMETERIIVPROC)glad_current_context->procs[167])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLint arg4, GLenum arg5, GLenum arg6, const GLvoid * arg7) {
+	((PFNGLTEXIMAGE1DPROC)glad_current_context->procs[168])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_ctx_glCopyTextureSubImage3D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLsizei arg7, GLsizei arg8) {
+	((PFNGLCOPYTEXTURESUBIMAGE3DPROC)glad_current_context->procs[169])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_ctx_glVertexP3uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLVERTEXP3UIVPROC)glad_current_context->procs[170])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTexParameteriv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLTEXPARAMETERIVPROC)glad_current_context->procs[171])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexArrayAttribIFormat(GLuint arg0, GLuint arg1, GLint arg2, GLenum arg3, GLuint arg4) {
+	((PFNGLVERTEXARRAYATTRIBIFORMATPROC)glad_current_context->procs[172])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3bv(const GLbyte * arg0) {
+	((PFNGLSECONDARYCOLOR3BVPROC)glad_current_context->procs[173])(arg0);
+}
+static void APIENTRY glad_ctx_glGetMaterialfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETMATERIALFVPROC)glad_current_context->procs[174])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetTexImage(GLenum arg0, GLint arg1, GLenum arg2, GLenum arg3, GLvoid * arg4) {
+	((PFNGLGETTEXIMAGEPROC)glad_current_context->procs[175])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glFogCoordfv(const GLfloat * arg0) {
+	((PFNGLFOGCOORDFVPROC)glad_current_context->procs[176])(arg0);
+}
+static void APIENTRY glad_ctx_glPixelMapuiv(GLenum arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLPIXELMAPUIVPROC)glad_current_context->procs[177])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetShaderInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	((PFNGLGETSHADERINFOLOGPROC)glad_current_context->procs[178])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetQueryObjecti64v(GLuint arg0, GLenum arg1, GLint64 * arg2) {
+	((PFNGLGETQUERYOBJECTI64VPROC)glad_current_context->procs[179])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGenFramebuffers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENFRAMEBUFFERSPROC)glad_current_context->procs[180])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glCreateTextures(GLenum arg0, GLsizei arg1, GLuint * arg2) {
+	((PFNGLCREATETEXTURESPROC)glad_current_context->procs[181])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTransformFeedbackBufferBase(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)glad_current_context->procs[182])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glIndexsv(const GLshort * arg0) {
+	((PFNGLINDEXSVPROC)glad_current_context->procs[183])(arg0);
+}
+static void APIENTRY glad_ctx_glClearTexSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+	((PFNGLCLEARTEXSUBIMAGEPROC)glad_current_context->procs[184])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix3x4dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)glad_current_context->procs[185])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetAttachedShaders(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLuint * arg3) {
+	((PFNGLGETATTACHEDSHADERSPROC)glad_current_context->procs[186])(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_ctx_glIsRenderbuffer(GLuint arg0) {
+	return ((PFNGLISRENDERBUFFERPROC)glad_current_context->procs[187])(arg0);
+}
+static void APIENTRY glad_ctx_glVertex3iv(const GLint * arg0) {
+	((PFNGLVERTEX3IVPROC)glad_current_context->procs[188])(arg0);
+}
+static void APIENTRY glad_ctx_glBitmap(GLsizei arg0, GLsizei arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4, GLfloat arg5, const GLubyte * arg6) {
+	((PFNGLBITMAPPROC)glad_current_context->procs[189])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static GLuint APIENTRY glad_ctx_glGetDebugMessageLog(GLuint arg0, GLsizei arg1, GLenum * arg2, GLenum * arg3, GLuint * arg4, GLenum * arg5, GLsizei * arg6, GLchar * arg7) {
+	return ((PFNGLGETDEBUGMESSAGELOGPROC)glad_current_context->procs[190])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_ctx_glProgramUniform1uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	((PFNGLPROGRAMUNIFORM1UIVPROC)glad_current_context->procs[191])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glMateriali(GLenum arg0, GLenum arg1, GLint arg2) {
+	((PFNGLMATERIALIPROC)glad_current_context->procs[192])(arg0, arg1, arg2);
+}
+static GLboolean APIENTRY glad_ctx_glIsVertexArray(GLuint arg0) {
+	return ((PFNGLISVERTEXARRAYPROC)glad_current_context->procs[193])(arg0);
+}
+static void APIENTRY glad_ctx_glDisableVertexAttribArray(GLuint arg0) {
+	((PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_current_context->procs[194])(arg0);
+}
+static void APIENTRY glad_ctx_glProgramUniform2iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	((PFNGLPROGRAMUNIFORM2IVPROC)glad_current_context->procs[195])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetQueryiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETQUERYIVPROC)glad_current_context->procs[196])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexCoord4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLTEXCOORD4FPROC)glad_current_context->procs[197])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glBlitNamedFramebuffer(GLuint arg0, GLuint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLint arg7, GLint arg8, GLint arg9, GLbitfield arg10, GLenum arg11) {
+	((PFNGLBLITNAMEDFRAMEBUFFERPROC)glad_current_context->procs[198])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
+}
+static void APIENTRY glad_ctx_glTexCoord4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLTEXCOORD4DPROC)glad_current_context->procs[199])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glCreateQueries(GLenum arg0, GLsizei arg1, GLuint * arg2) {
+	((PFNGLCREATEQUERIESPROC)glad_current_context->procs[200])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetSamplerParameterfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETSAMPLERPARAMETERFVPROC)glad_current_context->procs[201])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexCoord4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLTEXCOORD4IPROC)glad_current_context->procs[202])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glShaderStorageBlockBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLSHADERSTORAGEBLOCKBINDINGPROC)glad_current_context->procs[203])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMaterialf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLMATERIALFPROC)glad_current_context->procs[204])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexCoord4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLTEXCOORD4SPROC)glad_current_context->procs[205])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix4x2dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)glad_current_context->procs[206])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetUniformIndices(GLuint arg0, GLsizei arg1, const GLchar *const* arg2, GLuint * arg3) {
+	((PFNGLGETUNIFORMINDICESPROC)glad_current_context->procs[207])(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_ctx_glIsShader(GLuint arg0) {
+	return ((PFNGLISSHADERPROC)glad_current_context->procs[208])(arg0);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord2s(GLenum arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLMULTITEXCOORD2SPROC)glad_current_context->procs[209])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttribI4ubv(GLuint arg0, const GLubyte * arg1) {
+	((PFNGLVERTEXATTRIBI4UBVPROC)glad_current_context->procs[210])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertex3dv(const GLdouble * arg0) {
+	((PFNGLVERTEX3DVPROC)glad_current_context->procs[211])(arg0);
+}
+static void APIENTRY glad_ctx_glGetInteger64v(GLenum arg0, GLint64 * arg1) {
+	((PFNGLGETINTEGER64VPROC)glad_current_context->procs[212])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glPointParameteriv(GLenum arg0, const GLint * arg1) {
+	((PFNGLPOINTPARAMETERIVPROC)glad_current_context->procs[213])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetnMinmax(GLenum arg0, GLboolean arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	((PFNGLGETNMINMAXPROC)glad_current_context->procs[214])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glEnable(GLenum arg0) {
+	((PFNGLENABLEPROC)glad_current_context->procs[215])(arg0);
+}
+static void APIENTRY glad_ctx_glGetActiveUniformsiv(GLuint arg0, GLsizei arg1, const GLuint * arg2, GLenum arg3, GLint * arg4) {
+	((PFNGLGETACTIVEUNIFORMSIVPROC)glad_current_context->procs[216])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glColor4fv(const GLfloat * arg0) {
+	((PFNGLCOLOR4FVPROC)glad_current_context->procs[217])(arg0);
+}
+static void APIENTRY glad_ctx_glTexCoord1fv(const GLfloat * arg0) {
+	((PFNGLTEXCOORD1FVPROC)glad_current_context->procs[218])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexArrayAttribBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLVERTEXARRAYATTRIBBINDINGPROC)glad_current_context->procs[219])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTextureStorage1D(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3) {
+	((PFNGLTEXTURESTORAGE1DPROC)glad_current_context->procs[220])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glPopDebugGroup(void) {
+	((PFNGLPOPDEBUGGROUPPROC)glad_current_context->procs[221])();
+}
+static void APIENTRY glad_ctx_glBlendEquationi(GLuint arg0, GLenum arg1) {
+	((PFNGLBLENDEQUATIONIPROC)glad_current_context->procs[222])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTexCoord2sv(const GLshort * arg0) {
+	((PFNGLTEXCOORD2SVPROC)glad_current_context->procs[223])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIB4DVPROC)glad_current_context->procs[224])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord1dv(GLenum arg0, const GLdouble * arg1) {
+	((PFNGLMULTITEXCOORD1DVPROC)glad_current_context->procs[225])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetProgramInterfaceiv(GLuint arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETPROGRAMINTERFACEIVPROC)glad_current_context->procs[226])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord2i(GLenum arg0, GLint arg1, GLint arg2) {
+	((PFNGLMULTITEXCOORD2IPROC)glad_current_context->procs[227])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexCoord3fv(const GLfloat * arg0) {
+	((PFNGLTEXCOORD3FVPROC)glad_current_context->procs[228])(arg0);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3usv(const GLushort * arg0) {
+	((PFNGLSECONDARYCOLOR3USVPROC)glad_current_context->procs[229])(arg0);
+}
+static void APIENTRY glad_ctx_glTexGenf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLTEXGENFPROC)glad_current_context->procs[230])(arg0, arg1, arg2);
+}
+static void * APIENTRY glad_ctx_glMapNamedBuffer(GLuint arg0, GLenum arg1) {
+	return ((PFNGLMAPNAMEDBUFFERPROC)glad_current_context->procs[231])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glMultiTexCoordP3uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLMULTITEXCOORDP3UIVPROC)glad_current_context->procs[232])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttribP3ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBP3UIPROC)glad_current_context->procs[233])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertexAttribL1dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIBL1DVPROC)glad_current_context->procs[234])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTextureBufferRange(GLuint arg0, GLenum arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	((PFNGLTEXTUREBUFFERRANGEPROC)glad_current_context->procs[235])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetnUniformdv(GLuint arg0, GLint arg1, GLsizei arg2, GLdouble * arg3) {
+	((PFNGLGETNUNIFORMDVPROC)glad_current_context->procs[236])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glMultiTexCoordP1ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	((PFNGLMULTITEXCOORDP1UIPROC)glad_current_context->procs[237])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniform3ui(GLuint arg0, GLint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+	((PFNGLPROGRAMUNIFORM3UIPROC)glad_current_context->procs[238])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glTransformFeedbackBufferRange(GLuint arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	((PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)glad_current_context->procs[239])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetPointerv(GLenum arg0, GLvoid ** arg1) {
+	((PFNGLGETPOINTERVPROC)glad_current_context->procs[240])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexBindingDivisor(GLuint arg0, GLuint arg1) {
+	((PFNGLVERTEXBINDINGDIVISORPROC)glad_current_context->procs[241])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glPolygonOffset(GLfloat arg0, GLfloat arg1) {
+	((PFNGLPOLYGONOFFSETPROC)glad_current_context->procs[242])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetUniformuiv(GLuint arg0, GLint arg1, GLuint * arg2) {
+	((PFNGLGETUNIFORMUIVPROC)glad_current_context->procs[243])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glNormal3fv(const GLfloat * arg0) {
+	((PFNGLNORMAL3FVPROC)glad_current_context->procs[244])(arg0);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLSECONDARYCOLOR3SPROC)glad_current_context->procs[245])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glNamedFramebufferDrawBuffers(GLuint arg0, GLsizei arg1, const GLenum * arg2) {
+	((PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)glad_current_context->procs[246])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glDepthRange(GLclampd arg0, GLclampd arg1) {
+	((PFNGLDEPTHRANGEPROC)glad_current_context->procs[247])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glFrustum(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+	((PFNGLFRUSTUMPROC)glad_current_context->procs[248])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord4sv(GLenum arg0, const GLshort * arg1) {
+	((PFNGLMULTITEXCOORD4SVPROC)glad_current_context->procs[249])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexArrayBindingDivisor(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLVERTEXARRAYBINDINGDIVISORPROC)glad_current_context->procs[250])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glDrawBuffer(GLenum arg0) {
+	((PFNGLDRAWBUFFERPROC)glad_current_context->procs[251])(arg0);
+}
+static void APIENTRY glad_ctx_glPushMatrix(void) {
+	((PFNGLPUSHMATRIXPROC)glad_current_context->procs[252])();
+}
+static void APIENTRY glad_ctx_glGetnPixelMapusv(GLenum arg0, GLsizei arg1, GLushort * arg2) {
+	((PFNGLGETNPIXELMAPUSVPROC)glad_current_context->procs[253])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glRasterPos3fv(const GLfloat * arg0) {
+	((PFNGLRASTERPOS3FVPROC)glad_current_context->procs[254])(arg0);
+}
+static void APIENTRY glad_ctx_glOrtho(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+	((PFNGLORTHOPROC)glad_current_context->procs[255])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glDrawElementsInstanced(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4) {
+	((PFNGLDRAWELEMENTSINSTANCEDPROC)glad_current_context->procs[256])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glWindowPos3sv(const GLshort * arg0) {
+	((PFNGLWINDOWPOS3SVPROC)glad_current_context->procs[257])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexAttribL4dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIBL4DVPROC)glad_current_context->procs[258])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glProgramUniform1i(GLuint arg0, GLint arg1, GLint arg2) {
+	((PFNGLPROGRAMUNIFORM1IPROC)glad_current_context->procs[259])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glUniform2dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	((PFNGLUNIFORM2DVPROC)glad_current_context->procs[260])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniform1d(GLuint arg0, GLint arg1, GLdouble arg2) {
+	((PFNGLPROGRAMUNIFORM1DPROC)glad_current_context->procs[261])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniform1f(GLuint arg0, GLint arg1, GLfloat arg2) {
+	((PFNGLPROGRAMUNIFORM1FPROC)glad_current_context->procs[262])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glClearIndex(GLfloat arg0) {
+	((PFNGLCLEARINDEXPROC)glad_current_context->procs[263])(arg0);
+}
+static void APIENTRY glad_ctx_glMap1d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLint arg4, const GLdouble * arg5) {
+	((PFNGLMAP1DPROC)glad_current_context->procs[264])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glMap1f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLint arg4, const GLfloat * arg5) {
+	((PFNGLMAP1FPROC)glad_current_context->procs[265])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glFlush(void) {
+	((PFNGLFLUSHPROC)glad_current_context->procs[266])();
+}
+static void APIENTRY glad_ctx_glGetRenderbufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_current_context->procs[267])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glBeginQueryIndexed(GLenum arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLBEGINQUERYINDEXEDPROC)glad_current_context->procs[268])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniform3iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	((PFNGLPROGRAMUNIFORM3IVPROC)glad_current_context->procs[269])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glIndexiv(const GLint * arg0) {
+	((PFNGLINDEXIVPROC)glad_current_context->procs[270])(arg0);
+}
+static void APIENTRY glad_ctx_glNamedRenderbufferStorage(GLuint arg0, GLenum arg1, GLsizei arg2, GLsizei arg3) {
+	((PFNGLNAMEDRENDERBUFFERSTORAGEPROC)glad_current_context->procs[271])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glRasterPos3sv(const GLshort * arg0) {
+	((PFNGLRASTERPOS3SVPROC)glad_current_context->procs[272])(arg0);
+}
+static void APIENTRY glad_ctx_glGetVertexAttribPointerv(GLuint arg0, GLenum arg1, void ** arg2) {
+	((PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_current_context->procs[273])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glPixelZoom(GLfloat arg0, GLfloat arg1) {
+	((PFNGLPIXELZOOMPROC)glad_current_context->procs[274])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glPolygonOffsetClamp(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLPOLYGONOFFSETCLAMPPROC)glad_current_context->procs[275])(arg0, arg1, arg2);
+}
+static GLsync APIENTRY glad_ctx_glFenceSync(GLenum arg0, GLbitfield arg1) {
+	return ((PFNGLFENCESYNCPROC)glad_current_context->procs[276])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glDeleteVertexArrays(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETEVERTEXARRAYSPROC)glad_current_context->procs[277])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glColorP3ui(GLenum arg0, GLuint arg1) {
+	((PFNGLCOLORP3UIPROC)glad_current_context->procs[278])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glDrawElementsInstancedBaseVertexBaseInstance(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLint arg5, GLuint arg6) {
+	((PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)glad_current_context->procs[279])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glTextureStorage2DMultisample(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+	((PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)glad_current_context->procs[280])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glVertexAttrib3sv(GLuint arg0, const GLshort * arg1) {
+	((PFNGLVERTEXATTRIB3SVPROC)glad_current_context->procs[281])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glBeginConditionalRender(GLuint arg0, GLenum arg1) {
+	((PFNGLBEGINCONDITIONALRENDERPROC)glad_current_context->procs[282])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glPushDebugGroup(GLenum arg0, GLuint arg1, GLsizei arg2, const GLchar * arg3) {
+	((PFNGLPUSHDEBUGGROUPPROC)glad_current_context->procs[283])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetShaderPrecisionFormat(GLenum arg0, GLenum arg1, GLint * arg2, GLint * arg3) {
+	((PFNGLGETSHADERPRECISIONFORMATPROC)glad_current_context->procs[284])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glValidateProgramPipeline(GLuint arg0) {
+	((PFNGLVALIDATEPROGRAMPIPELINEPROC)glad_current_context->procs[285])(arg0);
+}
+static void APIENTRY glad_ctx_glDrawElementsBaseVertex(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLint arg4) {
+	((PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_current_context->procs[286])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetTexLevelParameteriv(GLenum arg0, GLint arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETTEXLEVELPARAMETERIVPROC)glad_current_context->procs[287])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glLighti(GLenum arg0, GLenum arg1, GLint arg2) {
+	((PFNGLLIGHTIPROC)glad_current_context->procs[288])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoordP4uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLMULTITEXCOORDP4UIVPROC)glad_current_context->procs[289])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexArrayVertexBuffer(GLuint arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizei arg4) {
+	((PFNGLVERTEXARRAYVERTEXBUFFERPROC)glad_current_context->procs[290])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glLightf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLLIGHTFPROC)glad_current_context->procs[291])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glBindVertexBuffers(GLuint arg0, GLsizei arg1, const GLuint * arg2, const GLintptr * arg3, const GLsizei * arg4) {
+	((PFNGLBINDVERTEXBUFFERSPROC)glad_current_context->procs[292])(arg0, arg1, arg2, arg3, arg4);
+}
+static GLint APIENTRY glad_ctx_glGetAttribLocation(GLuint arg0, const GLchar * arg1) {
+	return ((PFNGLGETATTRIBLOCATIONPROC)glad_current_context->procs[293])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTexStorage3DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+	((PFNGLTEXSTORAGE3DMULTISAMPLEPROC)glad_current_context->procs[294])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glStencilFuncSeparate(GLenum arg0, GLenum arg1, GLint arg2, GLuint arg3) {
+	((PFNGLSTENCILFUNCSEPARATEPROC)glad_current_context->procs[295])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glDisableVertexArrayAttrib(GLuint arg0, GLuint arg1) {
+	((PFNGLDISABLEVERTEXARRAYATTRIBPROC)glad_current_context->procs[296])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGenSamplers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENSAMPLERSPROC)glad_current_context->procs[297])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glClampColor(GLenum arg0, GLenum arg1) {
+	((PFNGLCLAMPCOLORPROC)glad_current_context->procs[298])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glUniform4iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	((PFNGLUNIFORM4IVPROC)glad_current_context->procs[299])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glClearStencil(GLint arg0) {
+	((PFNGLCLEARSTENCILPROC)glad_current_context->procs[300])(arg0);
+}
+static void APIENTRY glad_ctx_glTexCoordP1uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLTEXCOORDP1UIVPROC)glad_current_context->procs[301])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetNamedRenderbufferParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)glad_current_context->procs[302])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glDrawTransformFeedbackInstanced(GLenum arg0, GLuint arg1, GLsizei arg2) {
+	((PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)glad_current_context->procs[303])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glSpecializeShader(GLuint arg0, const GLchar * arg1, GLuint arg2, const GLuint * arg3, const GLuint * arg4) {
+	((PFNGLSPECIALIZESHADERPROC)glad_current_context->procs[304])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord3fv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLMULTITEXCOORD3FVPROC)glad_current_context->procs[305])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetPixelMapuiv(GLenum arg0, GLuint * arg1) {
+	((PFNGLGETPIXELMAPUIVPROC)glad_current_context->procs[306])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGenTextures(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENTEXTURESPROC)glad_current_context->procs[307])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTexCoord4iv(const GLint * arg0) {
+	((PFNGLTEXCOORD4IVPROC)glad_current_context->procs[308])(arg0);
+}
+static void APIENTRY glad_ctx_glDrawTransformFeedback(GLenum arg0, GLuint arg1) {
+	((PFNGLDRAWTRANSFORMFEEDBACKPROC)glad_current_context->procs[309])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glUniform1dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	((PFNGLUNIFORM1DVPROC)glad_current_context->procs[310])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetTexParameterIuiv(GLenum arg0, GLenum arg1, GLuint * arg2) {
+	((PFNGLGETTEXPARAMETERIUIVPROC)glad_current_context->procs[311])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetTransformFeedbacki_v(GLuint arg0, GLenum arg1, GLuint arg2, GLint * arg3) {
+	((PFNGLGETTRANSFORMFEEDBACKI_VPROC)glad_current_context->procs[312])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glIndexPointer(GLenum arg0, GLsizei arg1, const GLvoid * arg2) {
+	((PFNGLINDEXPOINTERPROC)glad_current_context->procs[313])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetnPolygonStipple(GLsizei arg0, GLubyte * arg1) {
+	((PFNGLGETNPOLYGONSTIPPLEPROC)glad_current_context->procs[314])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4Nbv(GLuint arg0, const GLbyte * arg1) {
+	((PFNGLVERTEXATTRIB4NBVPROC)glad_current_context->procs[315])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glClearNamedFramebufferuiv(GLuint arg0, GLenum arg1, GLint arg2, const GLuint * arg3) {
+	((PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)glad_current_context->procs[316])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetVertexArrayIndexediv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETVERTEXARRAYINDEXEDIVPROC)glad_current_context->procs[317])(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_ctx_glIsSync(GLsync arg0) {
+	return ((PFNGLISSYNCPROC)glad_current_context->procs[318])(arg0);
+}
+static void APIENTRY glad_ctx_glVertex2f(GLfloat arg0, GLfloat arg1) {
+	((PFNGLVERTEX2FPROC)glad_current_context->procs[319])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertex2d(GLdouble arg0, GLdouble arg1) {
+	((PFNGLVERTEX2DPROC)glad_current_context->procs[320])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glDeleteRenderbuffers(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETERENDERBUFFERSPROC)glad_current_context->procs[321])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glUniform2i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLUNIFORM2IPROC)glad_current_context->procs[322])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMapGrid2d(GLint arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLdouble arg4, GLdouble arg5) {
+	((PFNGLMAPGRID2DPROC)glad_current_context->procs[323])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glMapGrid2f(GLint arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLfloat arg4, GLfloat arg5) {
+	((PFNGLMAPGRID2FPROC)glad_current_context->procs[324])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glTexCoordP4ui(GLenum arg0, GLuint arg1) {
+	((PFNGLTEXCOORDP4UIPROC)glad_current_context->procs[325])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertex2i(GLint arg0, GLint arg1) {
+	((PFNGLVERTEX2IPROC)glad_current_context->procs[326])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttribPointer(GLuint arg0, GLint arg1, GLenum arg2, GLboolean arg3, GLsizei arg4, const void * arg5) {
+	((PFNGLVERTEXATTRIBPOINTERPROC)glad_current_context->procs[327])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glProgramUniform1ui(GLuint arg0, GLint arg1, GLuint arg2) {
+	((PFNGLPROGRAMUNIFORM1UIPROC)glad_current_context->procs[328])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glFramebufferTextureLayer(GLenum arg0, GLenum arg1, GLuint arg2, GLint arg3, GLint arg4) {
+	((PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_current_context->procs[329])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glVertex2s(GLshort arg0, GLshort arg1) {
+	((PFNGLVERTEX2SPROC)glad_current_context->procs[330])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetObjectPtrLabel(const void * arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	((PFNGLGETOBJECTPTRLABELPROC)glad_current_context->procs[331])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glTextureParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	((PFNGLTEXTUREPARAMETERIPROC)glad_current_context->procs[332])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glNormal3bv(const GLbyte * arg0) {
+	((PFNGLNORMAL3BVPROC)glad_current_context->procs[333])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4Nuiv(GLuint arg0, const GLuint * arg1) {
+	((PFNGLVERTEXATTRIB4NUIVPROC)glad_current_context->procs[334])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glFlushMappedBufferRange(GLenum arg0, GLintptr arg1, GLsizeiptr arg2) {
+	((PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_current_context->procs[335])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniform2fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	((PFNGLPROGRAMUNIFORM2FVPROC)glad_current_context->procs[336])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniformMatrix2x3dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX2X3DVPROC)glad_current_context->procs[337])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix4dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX4DVPROC)glad_current_context->procs[338])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3sv(const GLshort * arg0) {
+	((PFNGLSECONDARYCOLOR3SVPROC)glad_current_context->procs[339])(arg0);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix2x4dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)glad_current_context->procs[340])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glDispatchCompute(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLDISPATCHCOMPUTEPROC)glad_current_context->procs[341])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertex3sv(const GLshort * arg0) {
+	((PFNGLVERTEX3SVPROC)glad_current_context->procs[342])(arg0);
+}
+static void APIENTRY glad_ctx_glGenQueries(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENQUERIESPROC)glad_current_context->procs[343])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetPixelMapfv(GLenum arg0, GLfloat * arg1) {
+	((PFNGLGETPIXELMAPFVPROC)glad_current_context->procs[344])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTexEnvf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLTEXENVFPROC)glad_current_context->procs[345])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttribP1ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBP1UIPROC)glad_current_context->procs[346])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+	((PFNGLTEXSUBIMAGE3DPROC)glad_current_context->procs[347])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static void APIENTRY glad_ctx_glGetInteger64i_v(GLenum arg0, GLuint arg1, GLint64 * arg2) {
+	((PFNGLGETINTEGER64I_VPROC)glad_current_context->procs[348])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glFogCoordd(GLdouble arg0) {
+	((PFNGLFOGCOORDDPROC)glad_current_context->procs[349])(arg0);
+}
+static void APIENTRY glad_ctx_glFogCoordf(GLfloat arg0) {
+	((PFNGLFOGCOORDFPROC)glad_current_context->procs[350])(arg0);
+}
+static void APIENTRY glad_ctx_glCopyTexImage2D(GLenum arg0, GLint arg1, GLenum arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLint arg7) {
+	((PFNGLCOPYTEXIMAGE2DPROC)glad_current_context->procs[351])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_ctx_glTexEnvi(GLenum arg0, GLenum arg1, GLint arg2) {
+	((PFNGLTEXENVIPROC)glad_current_context->procs[352])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord1iv(GLenum arg0, const GLint * arg1) {
+	((PFNGLMULTITEXCOORD1IVPROC)glad_current_context->procs[353])(arg0, arg1);
+}
+static GLboolean APIENTRY glad_ctx_glIsEnabledi(GLenum arg0, GLuint arg1) {
+	return ((PFNGLISENABLEDIPROC)glad_current_context->procs[354])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glBindBuffersRange(GLenum arg0, GLuint arg1, GLsizei arg2, const GLuint * arg3, const GLintptr * arg4, const GLsizeiptr * arg5) {
+	((PFNGLBINDBUFFERSRANGEPROC)glad_current_context->procs[355])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glSecondaryColorP3ui(GLenum arg0, GLuint arg1) {
+	((PFNGLSECONDARYCOLORP3UIPROC)glad_current_context->procs[356])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttribI2i(GLuint arg0, GLint arg1, GLint arg2) {
+	((PFNGLVERTEXATTRIBI2IPROC)glad_current_context->procs[357])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glBindFragDataLocationIndexed(GLuint arg0, GLuint arg1, GLuint arg2, const GLchar * arg3) {
+	((PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_current_context->procs[358])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glCopyImageSubData(GLuint arg0, GLenum arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLuint arg6, GLenum arg7, GLint arg8, GLint arg9, GLint arg10, GLint arg11, GLsizei arg12, GLsizei arg13, GLsizei arg14) {
+	((PFNGLCOPYIMAGESUBDATAPROC)glad_current_context->procs[359])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord2dv(GLenum arg0, const GLdouble * arg1) {
+	((PFNGLMULTITEXCOORD2DVPROC)glad_current_context->procs[360])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glUniform2iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	((PFNGLUNIFORM2IVPROC)glad_current_context->procs[361])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttrib1fv(GLuint arg0, const GLfloat * arg1) {
+	((PFNGLVERTEXATTRIB1FVPROC)glad_current_context->procs[362])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetInternalformativ(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, GLint * arg4) {
+	((PFNGLGETINTERNALFORMATIVPROC)glad_current_context->procs[363])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glUniform4uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLUNIFORM4UIVPROC)glad_current_context->procs[364])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMatrixMode(GLenum arg0) {
+	((PFNGLMATRIXMODEPROC)glad_current_context->procs[365])(arg0);
+}
+static void APIENTRY glad_ctx_glGetTextureImage(GLuint arg0, GLint arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	((PFNGLGETTEXTUREIMAGEPROC)glad_current_context->procs[366])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glFeedbackBuffer(GLsizei arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLFEEDBACKBUFFERPROC)glad_current_context->procs[367])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniform2dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	((PFNGLPROGRAMUNIFORM2DVPROC)glad_current_context->procs[368])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glEndQueryIndexed(GLenum arg0, GLuint arg1) {
+	((PFNGLENDQUERYINDEXEDPROC)glad_current_context->procs[369])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetMapiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETMAPIVPROC)glad_current_context->procs[370])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTextureSubImage3D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+	((PFNGLTEXTURESUBIMAGE3DPROC)glad_current_context->procs[371])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static void APIENTRY glad_ctx_glFramebufferTexture1D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4) {
+	((PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_current_context->procs[372])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glUniform4d(GLint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	((PFNGLUNIFORM4DPROC)glad_current_context->procs[373])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetShaderiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETSHADERIVPROC)glad_current_context->procs[374])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord2d(GLenum arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLMULTITEXCOORD2DPROC)glad_current_context->procs[375])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord2f(GLenum arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLMULTITEXCOORD2FPROC)glad_current_context->procs[376])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix3fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX3FVPROC)glad_current_context->procs[377])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glObjectPtrLabel(const void * arg0, GLsizei arg1, const GLchar * arg2) {
+	((PFNGLOBJECTPTRLABELPROC)glad_current_context->procs[378])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glInvalidateFramebuffer(GLenum arg0, GLsizei arg1, const GLenum * arg2) {
+	((PFNGLINVALIDATEFRAMEBUFFERPROC)glad_current_context->procs[379])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glBindTextures(GLuint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLBINDTEXTURESPROC)glad_current_context->procs[380])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glBindFragDataLocation(GLuint arg0, GLuint arg1, const GLchar * arg2) {
+	((PFNGLBINDFRAGDATALOCATIONPROC)glad_current_context->procs[381])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glNamedBufferStorage(GLuint arg0, GLsizeiptr arg1, const void * arg2, GLbitfield arg3) {
+	((PFNGLNAMEDBUFFERSTORAGEPROC)glad_current_context->procs[382])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glScissorArrayv(GLuint arg0, GLsizei arg1, const GLint * arg2) {
+	((PFNGLSCISSORARRAYVPROC)glad_current_context->procs[383])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glPrioritizeTextures(GLsizei arg0, const GLuint * arg1, const GLclampf * arg2) {
+	((PFNGLPRIORITIZETEXTURESPROC)glad_current_context->procs[384])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glCallList(GLuint arg0) {
+	((PFNGLCALLLISTPROC)glad_current_context->procs[385])(arg0);
+}
+static void APIENTRY glad_ctx_glPatchParameterfv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLPATCHPARAMETERFVPROC)glad_current_context->procs[386])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3ubv(const GLubyte * arg0) {
+	((PFNGLSECONDARYCOLOR3UBVPROC)glad_current_context->procs[387])(arg0);
+}
+static void APIENTRY glad_ctx_glGetDoublev(GLenum arg0, GLdouble * arg1) {
+	((PFNGLGETDOUBLEVPROC)glad_current_context->procs[388])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord3iv(GLenum arg0, const GLint * arg1) {
+	((PFNGLMULTITEXCOORD3IVPROC)glad_current_context->procs[389])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttrib1d(GLuint arg0, GLdouble arg1) {
+	((PFNGLVERTEXATTRIB1DPROC)glad_current_context->procs[390])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glUniform4dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	((PFNGLUNIFORM4DVPROC)glad_current_context->procs[391])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glLightModelf(GLenum arg0, GLfloat arg1) {
+	((PFNGLLIGHTMODELFPROC)glad_current_context->procs[392])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetUniformiv(GLuint arg0, GLint arg1, GLint * arg2) {
+	((PFNGLGETUNIFORMIVPROC)glad_current_context->procs[393])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glInvalidateBufferData(GLuint arg0) {
+	((PFNGLINVALIDATEBUFFERDATAPROC)glad_current_context->procs[394])(arg0);
+}
+static void APIENTRY glad_ctx_glVertex2sv(const GLshort * arg0) {
+	((PFNGLVERTEX2SVPROC)glad_current_context->procs[395])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexArrayVertexBuffers(GLuint arg0, GLuint arg1, GLsizei arg2, const GLuint * arg3, const GLintptr * arg4, const GLsizei * arg5) {
+	((PFNGLVERTEXARRAYVERTEXBUFFERSPROC)glad_current_context->procs[396])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glCompressedTextureSubImage1D(GLuint arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLsizei arg5, const void * arg6) {
+	((PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)glad_current_context->procs[397])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glLightModeli(GLenum arg0, GLint arg1) {
+	((PFNGLLIGHTMODELIPROC)glad_current_context->procs[398])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glWindowPos3iv(const GLint * arg0) {
+	((PFNGLWINDOWPOS3IVPROC)glad_current_context->procs[399])(arg0);
+}
+static void APIENTRY glad_ctx_glMultiTexCoordP1uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLMULTITEXCOORDP1UIVPROC)glad_current_context->procs[400])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glUniform3fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	((PFNGLUNIFORM3FVPROC)glad_current_context->procs[401])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glPixelStorei(GLenum arg0, GLint arg1) {
+	((PFNGLPIXELSTOREIPROC)glad_current_context->procs[402])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetProgramPipelineInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	((PFNGLGETPROGRAMPIPELINEINFOLOGPROC)glad_current_context->procs[403])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glCallLists(GLsizei arg0, GLenum arg1, const GLvoid * arg2) {
+	((PFNGLCALLLISTSPROC)glad_current_context->procs[404])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix3x4fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)glad_current_context->procs[405])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glInvalidateSubFramebuffer(GLenum arg0, GLsizei arg1, const GLenum * arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6) {
+	((PFNGLINVALIDATESUBFRAMEBUFFERPROC)glad_current_context->procs[406])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void * APIENTRY glad_ctx_glMapBuffer(GLenum arg0, GLenum arg1) {
+	return ((PFNGLMAPBUFFERPROC)glad_current_context->procs[407])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLSECONDARYCOLOR3DPROC)glad_current_context->procs[408])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexCoord3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLTEXCOORD3IPROC)glad_current_context->procs[409])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord4fv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLMULTITEXCOORD4FVPROC)glad_current_context->procs[410])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glRasterPos3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLRASTERPOS3IPROC)glad_current_context->procs[411])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+	((PFNGLSECONDARYCOLOR3BPROC)glad_current_context->procs[412])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glRasterPos3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLRASTERPOS3DPROC)glad_current_context->procs[413])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glRasterPos3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLRASTERPOS3FPROC)glad_current_context->procs[414])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glCompressedTexImage3D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLint arg6, GLsizei arg7, const void * arg8) {
+	((PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_current_context->procs[415])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_ctx_glTexCoord3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLTEXCOORD3FPROC)glad_current_context->procs[416])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glDeleteSync(GLsync arg0) {
+	((PFNGLDELETESYNCPROC)glad_current_context->procs[417])(arg0);
+}
+static void APIENTRY glad_ctx_glTexCoord3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLTEXCOORD3DPROC)glad_current_context->procs[418])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetTransformFeedbacki64_v(GLuint arg0, GLenum arg1, GLuint arg2, GLint64 * arg3) {
+	((PFNGLGETTRANSFORMFEEDBACKI64_VPROC)glad_current_context->procs[419])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniformMatrix4dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX4DVPROC)glad_current_context->procs[420])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glTexImage2DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+	((PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_current_context->procs[421])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glGetVertexAttribiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETVERTEXATTRIBIVPROC)glad_current_context->procs[422])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glUniformMatrix4x2dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX4X2DVPROC)glad_current_context->procs[423])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glMultiDrawElements(GLenum arg0, const GLsizei * arg1, GLenum arg2, const void *const* arg3, GLsizei arg4) {
+	((PFNGLMULTIDRAWELEMENTSPROC)glad_current_context->procs[424])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glVertexAttrib3fv(GLuint arg0, const GLfloat * arg1) {
+	((PFNGLVERTEXATTRIB3FVPROC)glad_current_context->procs[425])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTexCoord3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLTEXCOORD3SPROC)glad_current_context->procs[426])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glUniform3iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	((PFNGLUNIFORM3IVPROC)glad_current_context->procs[427])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glRasterPos3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLRASTERPOS3SPROC)glad_current_context->procs[428])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glPolygonMode(GLenum arg0, GLenum arg1) {
+	((PFNGLPOLYGONMODEPROC)glad_current_context->procs[429])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glDrawBuffers(GLsizei arg0, const GLenum * arg1) {
+	((PFNGLDRAWBUFFERSPROC)glad_current_context->procs[430])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetnHistogram(GLenum arg0, GLboolean arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	((PFNGLGETNHISTOGRAMPROC)glad_current_context->procs[431])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glGetActiveUniformBlockiv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_current_context->procs[432])(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_ctx_glAreTexturesResident(GLsizei arg0, const GLuint * arg1, GLboolean * arg2) {
+	return ((PFNGLARETEXTURESRESIDENTPROC)glad_current_context->procs[433])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniform2d(GLuint arg0, GLint arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLPROGRAMUNIFORM2DPROC)glad_current_context->procs[434])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix4x3dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)glad_current_context->procs[435])(arg0, arg1, arg2, arg3, arg4);
+}
+static GLboolean APIENTRY glad_ctx_glIsList(GLuint arg0) {
+	return ((PFNGLISLISTPROC)glad_current_context->procs[436])(arg0);
+}
+static void APIENTRY glad_ctx_glProgramUniform4iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	((PFNGLPROGRAMUNIFORM4IVPROC)glad_current_context->procs[437])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glRasterPos2sv(const GLshort * arg0) {
+	((PFNGLRASTERPOS2SVPROC)glad_current_context->procs[438])(arg0);
+}
+static void APIENTRY glad_ctx_glRasterPos4sv(const GLshort * arg0) {
+	((PFNGLRASTERPOS4SVPROC)glad_current_context->procs[439])(arg0);
+}
+static void APIENTRY glad_ctx_glColor4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLCOLOR4SPROC)glad_current_context->procs[440])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetProgramBinary(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLenum * arg3, void * arg4) {
+	((PFNGLGETPROGRAMBINARYPROC)glad_current_context->procs[441])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glUseProgram(GLuint arg0) {
+	((PFNGLUSEPROGRAMPROC)glad_current_context->procs[442])(arg0);
+}
+static void APIENTRY glad_ctx_glLineStipple(GLint arg0, GLushort arg1) {
+	((PFNGLLINESTIPPLEPROC)glad_current_context->procs[443])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord1sv(GLenum arg0, const GLshort * arg1) {
+	((PFNGLMULTITEXCOORD1SVPROC)glad_current_context->procs[444])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetProgramInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	((PFNGLGETPROGRAMINFOLOGPROC)glad_current_context->procs[445])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glClearTexImage(GLuint arg0, GLint arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	((PFNGLCLEARTEXIMAGEPROC)glad_current_context->procs[446])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetBufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETBUFFERPARAMETERIVPROC)glad_current_context->procs[447])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord2iv(GLenum arg0, const GLint * arg1) {
+	((PFNGLMULTITEXCOORD2IVPROC)glad_current_context->procs[448])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glUniformMatrix2x4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX2X4FVPROC)glad_current_context->procs[449])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glBindVertexArray(GLuint arg0) {
+	((PFNGLBINDVERTEXARRAYPROC)glad_current_context->procs[450])(arg0);
+}
+static void APIENTRY glad_ctx_glColor4b(GLbyte arg0, GLbyte arg1, GLbyte arg2, GLbyte arg3) {
+	((PFNGLCOLOR4BPROC)glad_current_context->procs[451])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLSECONDARYCOLOR3FPROC)glad_current_context->procs[452])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glColor4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLCOLOR4FPROC)glad_current_context->procs[453])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glColor4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLCOLOR4DPROC)glad_current_context->procs[454])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glColor4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLCOLOR4IPROC)glad_current_context->procs[455])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glSamplerParameterIiv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLSAMPLERPARAMETERIIVPROC)glad_current_context->procs[456])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiDrawElementsBaseVertex(GLenum arg0, const GLsizei * arg1, GLenum arg2, const void *const* arg3, GLsizei arg4, const GLint * arg5) {
+	((PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_current_context->procs[457])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glVertexAttribLFormat(GLuint arg0, GLint arg1, GLenum arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBLFORMATPROC)glad_current_context->procs[458])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glRasterPos3iv(const GLint * arg0) {
+	((PFNGLRASTERPOS3IVPROC)glad_current_context->procs[459])(arg0);
+}
+static void APIENTRY glad_ctx_glTextureStorage2D(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLTEXTURESTORAGE2DPROC)glad_current_context->procs[460])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGenerateTextureMipmap(GLuint arg0) {
+	((PFNGLGENERATETEXTUREMIPMAPPROC)glad_current_context->procs[461])(arg0);
+}
+static void APIENTRY glad_ctx_glVertex2dv(const GLdouble * arg0) {
+	((PFNGLVERTEX2DVPROC)glad_current_context->procs[462])(arg0);
+}
+static void APIENTRY glad_ctx_glTexCoord4sv(const GLshort * arg0) {
+	((PFNGLTEXCOORD4SVPROC)glad_current_context->procs[463])(arg0);
+}
+static void APIENTRY glad_ctx_glUniform2uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLUNIFORM2UIVPROC)glad_current_context->procs[464])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glCompressedTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLsizei arg5, const void * arg6) {
+	((PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_current_context->procs[465])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glFinish(void) {
+	((PFNGLFINISHPROC)glad_current_context->procs[466])();
+}
+static void APIENTRY glad_ctx_glDepthRangeIndexed(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLDEPTHRANGEINDEXEDPROC)glad_current_context->procs[467])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetBooleanv(GLenum arg0, GLboolean * arg1) {
+	((PFNGLGETBOOLEANVPROC)glad_current_context->procs[468])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glDeleteShader(GLuint arg0) {
+	((PFNGLDELETESHADERPROC)glad_current_context->procs[469])(arg0);
+}
+static void APIENTRY glad_ctx_glDrawElements(GLenum arg0, GLsizei arg1, GLenum arg2, const GLvoid * arg3) {
+	((PFNGLDRAWELEMENTSPROC)glad_current_context->procs[470])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetInternalformati64v(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, GLint64 * arg4) {
+	((PFNGLGETINTERNALFORMATI64VPROC)glad_current_context->procs[471])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glRasterPos2s(GLshort arg0, GLshort arg1) {
+	((PFNGLRASTERPOS2SPROC)glad_current_context->procs[472])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glCopyTextureSubImage1D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5) {
+	((PFNGLCOPYTEXTURESUBIMAGE1DPROC)glad_current_context->procs[473])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glGetMapdv(GLenum arg0, GLenum arg1, GLdouble * arg2) {
+	((PFNGLGETMAPDVPROC)glad_current_context->procs[474])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4Nsv(GLuint arg0, const GLshort * arg1) {
+	((PFNGLVERTEXATTRIB4NSVPROC)glad_current_context->procs[475])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glMaterialfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLMATERIALFVPROC)glad_current_context->procs[476])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTextureParameterIuiv(GLuint arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLTEXTUREPARAMETERIUIVPROC)glad_current_context->procs[477])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glViewport(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+	((PFNGLVIEWPORTPROC)glad_current_context->procs[478])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniform1uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLUNIFORM1UIVPROC)glad_current_context->procs[479])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTransformFeedbackVaryings(GLuint arg0, GLsizei arg1, const GLchar *const* arg2, GLenum arg3) {
+	((PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_current_context->procs[480])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glIndexdv(const GLdouble * arg0) {
+	((PFNGLINDEXDVPROC)glad_current_context->procs[481])(arg0);
+}
+static void APIENTRY glad_ctx_glCopyTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLsizei arg7, GLsizei arg8) {
+	((PFNGLCOPYTEXSUBIMAGE3DPROC)glad_current_context->procs[482])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_ctx_glTexCoord3iv(const GLint * arg0) {
+	((PFNGLTEXCOORD3IVPROC)glad_current_context->procs[483])(arg0);
+}
+static void APIENTRY glad_ctx_glDebugMessageCallback(GLDEBUGPROC arg0, const void * arg1) {
+	((PFNGLDEBUGMESSAGECALLBACKPROC)glad_current_context->procs[484])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttribI3i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLVERTEXATTRIBI3IPROC)glad_current_context->procs[485])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glInvalidateTexImage(GLuint arg0, GLint arg1) {
+	((PFNGLINVALIDATETEXIMAGEPROC)glad_current_context->procs[486])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttribFormat(GLuint arg0, GLint arg1, GLenum arg2, GLboolean arg3, GLuint arg4) {
+	((PFNGLVERTEXATTRIBFORMATPROC)glad_current_context->procs[487])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glClearDepth(GLclampd arg0) {
+	((PFNGLCLEARDEPTHPROC)glad_current_context->procs[488])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexAttribI4usv(GLuint arg0, const GLushort * arg1) {
+	((PFNGLVERTEXATTRIBI4USVPROC)glad_current_context->procs[489])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTexParameterf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLTEXPARAMETERFPROC)glad_current_context->procs[490])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttribBinding(GLuint arg0, GLuint arg1) {
+	((PFNGLVERTEXATTRIBBINDINGPROC)glad_current_context->procs[491])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTexParameteri(GLenum arg0, GLenum arg1, GLint arg2) {
+	((PFNGLTEXPARAMETERIPROC)glad_current_context->procs[492])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetActiveSubroutineUniformiv(GLuint arg0, GLenum arg1, GLuint arg2, GLenum arg3, GLint * arg4) {
+	((PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)glad_current_context->procs[493])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetShaderSource(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	((PFNGLGETSHADERSOURCEPROC)glad_current_context->procs[494])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glCreateTransformFeedbacks(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATETRANSFORMFEEDBACKSPROC)glad_current_context->procs[495])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetnTexImage(GLenum arg0, GLint arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	((PFNGLGETNTEXIMAGEPROC)glad_current_context->procs[496])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glTexBuffer(GLenum arg0, GLenum arg1, GLuint arg2) {
+	((PFNGLTEXBUFFERPROC)glad_current_context->procs[497])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glPopName(void) {
+	((PFNGLPOPNAMEPROC)glad_current_context->procs[498])();
+}
+static void APIENTRY glad_ctx_glValidateProgram(GLuint arg0) {
+	((PFNGLVALIDATEPROGRAMPROC)glad_current_context->procs[499])(arg0);
+}
+static void APIENTRY glad_ctx_glPixelStoref(GLenum arg0, GLfloat arg1) {
+	((PFNGLPIXELSTOREFPROC)glad_current_context->procs[500])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glUniform3uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLUNIFORM3UIVPROC)glad_current_context->procs[501])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glViewportIndexedf(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	((PFNGLVIEWPORTINDEXEDFPROC)glad_current_context->procs[502])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glRasterPos4fv(const GLfloat * arg0) {
+	((PFNGLRASTERPOS4FVPROC)glad_current_context->procs[503])(arg0);
+}
+static void APIENTRY glad_ctx_glEvalCoord1dv(const GLdouble * arg0) {
+	((PFNGLEVALCOORD1DVPROC)glad_current_context->procs[504])(arg0);
+}
+static void APIENTRY glad_ctx_glMultiTexCoordP2uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLMULTITEXCOORDP2UIVPROC)glad_current_context->procs[505])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGenProgramPipelines(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENPROGRAMPIPELINESPROC)glad_current_context->procs[506])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glRecti(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLRECTIPROC)glad_current_context->procs[507])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glColor4ub(GLubyte arg0, GLubyte arg1, GLubyte arg2, GLubyte arg3) {
+	((PFNGLCOLOR4UBPROC)glad_current_context->procs[508])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glMultTransposeMatrixf(const GLfloat * arg0) {
+	((PFNGLMULTTRANSPOSEMATRIXFPROC)glad_current_context->procs[509])(arg0);
+}
+static void APIENTRY glad_ctx_glRectf(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLRECTFPROC)glad_current_context->procs[510])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glRectd(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLRECTDPROC)glad_current_context->procs[511])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glNormal3sv(const GLshort * arg0) {
+	((PFNGLNORMAL3SVPROC)glad_current_context->procs[512])(arg0);
+}
+static void APIENTRY glad_ctx_glNewList(GLuint arg0, GLenum arg1) {
+	((PFNGLNEWLISTPROC)glad_current_context->procs[513])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix2x3dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)glad_current_context->procs[514])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glColor4us(GLushort arg0, GLushort arg1, GLushort arg2, GLushort arg3) {
+	((PFNGLCOLOR4USPROC)glad_current_context->procs[515])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertexAttribP1uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	((PFNGLVERTEXATTRIBP1UIVPROC)glad_current_context->procs[516])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glLinkProgram(GLuint arg0) {
+	((PFNGLLINKPROGRAMPROC)glad_current_context->procs[517])(arg0);
+}
+static void APIENTRY glad_ctx_glHint(GLenum arg0, GLenum arg1) {
+	((PFNGLHINTPROC)glad_current_context->procs[518])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glRects(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLRECTSPROC)glad_current_context->procs[519])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glTexCoord2dv(const GLdouble * arg0) {
+	((PFNGLTEXCOORD2DVPROC)glad_current_context->procs[520])(arg0);
+}
+static void APIENTRY glad_ctx_glRasterPos4iv(const GLint * arg0) {
+	((PFNGLRASTERPOS4IVPROC)glad_current_context->procs[521])(arg0);
+}
+static void APIENTRY glad_ctx_glGetObjectLabel(GLenum arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+	((PFNGLGETOBJECTLABELPROC)glad_current_context->procs[522])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glProgramUniform2f(GLuint arg0, GLint arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLPROGRAMUNIFORM2FPROC)glad_current_context->procs[523])(arg0, arg1, arg2, arg3);
+}
+static const GLubyte * APIENTRY glad_ctx_glGetString(GLenum arg0) {
+	return ((PFNGLGETSTRINGPROC)glad_current_context->procs[524])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexAttribP2uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	((PFNGLVERTEXATTRIBP2UIVPROC)glad_current_context->procs[525])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glEdgeFlagv(const GLboolean * arg0) {
+	((PFNGLEDGEFLAGVPROC)glad_current_context->procs[526])(arg0);
+}
+static void APIENTRY glad_ctx_glDetachShader(GLuint arg0, GLuint arg1) {
+	((PFNGLDETACHSHADERPROC)glad_current_context->procs[527])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glProgramUniform3i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	((PFNGLPROGRAMUNIFORM3IPROC)glad_current_context->procs[528])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glScalef(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLSCALEFPROC)glad_current_context->procs[529])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glEndQuery(GLenum arg0) {
+	((PFNGLENDQUERYPROC)glad_current_context->procs[530])(arg0);
+}
+static void APIENTRY glad_ctx_glScaled(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLSCALEDPROC)glad_current_context->procs[531])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glEdgeFlagPointer(GLsizei arg0, const GLvoid * arg1) {
+	((PFNGLEDGEFLAGPOINTERPROC)glad_current_context->procs[532])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glFramebufferParameteri(GLenum arg0, GLenum arg1, GLint arg2) {
+	((PFNGLFRAMEBUFFERPARAMETERIPROC)glad_current_context->procs[533])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetProgramResourceName(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, GLsizei * arg4, GLchar * arg5) {
+	((PFNGLGETPROGRAMRESOURCENAMEPROC)glad_current_context->procs[534])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glUniformMatrix4x3dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX4X3DVPROC)glad_current_context->procs[535])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glDepthRangeArrayv(GLuint arg0, GLsizei arg1, const GLdouble * arg2) {
+	((PFNGLDEPTHRANGEARRAYVPROC)glad_current_context->procs[536])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glCopyPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4) {
+	((PFNGLCOPYPIXELSPROC)glad_current_context->procs[537])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glVertexAttribI2ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLVERTEXATTRIBI2UIPROC)glad_current_context->procs[538])(arg0, arg1, arg2);
+}
+static GLint APIENTRY glad_ctx_glGetProgramResourceLocation(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	return ((PFNGLGETPROGRAMRESOURCELOCATIONPROC)glad_current_context->procs[539])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glPopAttrib(void) {
+	((PFNGLPOPATTRIBPROC)glad_current_context->procs[540])();
+}
+static void APIENTRY glad_ctx_glDeleteTextures(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETETEXTURESPROC)glad_current_context->procs[541])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetActiveAtomicCounterBufferiv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)glad_current_context->procs[542])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glStencilOpSeparate(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3) {
+	((PFNGLSTENCILOPSEPARATEPROC)glad_current_context->procs[543])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetTextureParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTEXTUREPARAMETERIVPROC)glad_current_context->procs[544])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glDeleteQueries(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETEQUERIESPROC)glad_current_context->procs[545])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glNormalP3uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLNORMALP3UIVPROC)glad_current_context->procs[546])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4f(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	((PFNGLVERTEXATTRIB4FPROC)glad_current_context->procs[547])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	((PFNGLVERTEXATTRIB4DPROC)glad_current_context->procs[548])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glViewportIndexedfv(GLuint arg0, const GLfloat * arg1) {
+	((PFNGLVIEWPORTINDEXEDFVPROC)glad_current_context->procs[549])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glInitNames(void) {
+	((PFNGLINITNAMESPROC)glad_current_context->procs[550])();
+}
+static void APIENTRY glad_ctx_glGetBufferParameteri64v(GLenum arg0, GLenum arg1, GLint64 * arg2) {
+	((PFNGLGETBUFFERPARAMETERI64VPROC)glad_current_context->procs[551])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glColor3dv(const GLdouble * arg0) {
+	((PFNGLCOLOR3DVPROC)glad_current_context->procs[552])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexAttribI1i(GLuint arg0, GLint arg1) {
+	((PFNGLVERTEXATTRIBI1IPROC)glad_current_context->procs[553])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetTexParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTEXPARAMETERIVPROC)glad_current_context->procs[554])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glWaitSync(GLsync arg0, GLbitfield arg1, GLuint64 arg2) {
+	((PFNGLWAITSYNCPROC)glad_current_context->procs[555])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glCreateVertexArrays(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATEVERTEXARRAYSPROC)glad_current_context->procs[556])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glProgramUniform1dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	((PFNGLPROGRAMUNIFORM1DVPROC)glad_current_context->procs[557])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4s(GLuint arg0, GLshort arg1, GLshort arg2, GLshort arg3, GLshort arg4) {
+	((PFNGLVERTEXATTRIB4SPROC)glad_current_context->procs[558])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glColorMaterial(GLenum arg0, GLenum arg1) {
+	((PFNGLCOLORMATERIALPROC)glad_current_context->procs[559])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glSampleCoverage(GLfloat arg0, GLboolean arg1) {
+	((PFNGLSAMPLECOVERAGEPROC)glad_current_context->procs[560])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glSamplerParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	((PFNGLSAMPLERPARAMETERIPROC)glad_current_context->procs[561])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glClearBufferSubData(GLenum arg0, GLenum arg1, GLintptr arg2, GLsizeiptr arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	((PFNGLCLEARBUFFERSUBDATAPROC)glad_current_context->procs[562])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glSamplerParameterf(GLuint arg0, GLenum arg1, GLfloat arg2) {
+	((PFNGLSAMPLERPARAMETERFPROC)glad_current_context->procs[563])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexStorage1D(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3) {
+	((PFNGLTEXSTORAGE1DPROC)glad_current_context->procs[564])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniform1f(GLint arg0, GLfloat arg1) {
+	((PFNGLUNIFORM1FPROC)glad_current_context->procs[565])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetVertexAttribfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETVERTEXATTRIBFVPROC)glad_current_context->procs[566])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glUniform1d(GLint arg0, GLdouble arg1) {
+	((PFNGLUNIFORM1DPROC)glad_current_context->procs[567])(arg0, arg1);
+}
+static GLint APIENTRY glad_ctx_glRenderMode(GLenum arg0) {
+	return ((PFNGLRENDERMODEPROC)glad_current_context->procs[568])(arg0);
+}
+static void APIENTRY glad_ctx_glGetCompressedTexImage(GLenum arg0, GLint arg1, void * arg2) {
+	((PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_current_context->procs[569])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetnCompressedTexImage(GLenum arg0, GLint arg1, GLsizei arg2, void * arg3) {
+	((PFNGLGETNCOMPRESSEDTEXIMAGEPROC)glad_current_context->procs[570])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glWindowPos2dv(const GLdouble * arg0) {
+	((PFNGLWINDOWPOS2DVPROC)glad_current_context->procs[571])(arg0);
+}
+static void APIENTRY glad_ctx_glUniform1i(GLint arg0, GLint arg1) {
+	((PFNGLUNIFORM1IPROC)glad_current_context->procs[572])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetActiveAttrib(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4, GLenum * arg5, GLchar * arg6) {
+	((PFNGLGETACTIVEATTRIBPROC)glad_current_context->procs[573])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glUniform3i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLUNIFORM3IPROC)glad_current_context->procs[574])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glPixelTransferi(GLenum arg0, GLint arg1) {
+	((PFNGLPIXELTRANSFERIPROC)glad_current_context->procs[575])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLenum arg7, const GLvoid * arg8) {
+	((PFNGLTEXSUBIMAGE2DPROC)glad_current_context->procs[576])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_ctx_glDisable(GLenum arg0) {
+	((PFNGLDISABLEPROC)glad_current_context->procs[577])(arg0);
+}
+static void APIENTRY glad_ctx_glLogicOp(GLenum arg0) {
+	((PFNGLLOGICOPPROC)glad_current_context->procs[578])(arg0);
+}
+static void APIENTRY glad_ctx_glEvalPoint2(GLint arg0, GLint arg1) {
+	((PFNGLEVALPOINT2PROC)glad_current_context->procs[579])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glPixelTransferf(GLenum arg0, GLfloat arg1) {
+	((PFNGLPIXELTRANSFERFPROC)glad_current_context->procs[580])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glMultiDrawArraysIndirectCount(GLenum arg0, const void * arg1, GLintptr arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)glad_current_context->procs[581])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLSECONDARYCOLOR3IPROC)glad_current_context->procs[582])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniform4uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	((PFNGLPROGRAMUNIFORM4UIVPROC)glad_current_context->procs[583])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniform4ui(GLint arg0, GLuint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+	((PFNGLUNIFORM4UIPROC)glad_current_context->procs[584])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glColor3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLCOLOR3FPROC)glad_current_context->procs[585])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glNamedFramebufferReadBuffer(GLuint arg0, GLenum arg1) {
+	((PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)glad_current_context->procs[586])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glBindFramebuffer(GLenum arg0, GLuint arg1) {
+	((PFNGLBINDFRAMEBUFFERPROC)glad_current_context->procs[587])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetTexEnvfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETTEXENVFVPROC)glad_current_context->procs[588])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glRectfv(const GLfloat * arg0, const GLfloat * arg1) {
+	((PFNGLRECTFVPROC)glad_current_context->procs[589])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glCullFace(GLenum arg0) {
+	((PFNGLCULLFACEPROC)glad_current_context->procs[590])(arg0);
+}
+static void APIENTRY glad_ctx_glGetLightfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETLIGHTFVPROC)glad_current_context->procs[591])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetnUniformiv(GLuint arg0, GLint arg1, GLsizei arg2, GLint * arg3) {
+	((PFNGLGETNUNIFORMIVPROC)glad_current_context->procs[592])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glColor3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLCOLOR3DPROC)glad_current_context->procs[593])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniform4i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5) {
+	((PFNGLPROGRAMUNIFORM4IPROC)glad_current_context->procs[594])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glTexGend(GLenum arg0, GLenum arg1, GLdouble arg2) {
+	((PFNGLTEXGENDPROC)glad_current_context->procs[595])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniform4f(GLuint arg0, GLint arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4, GLfloat arg5) {
+	((PFNGLPROGRAMUNIFORM4FPROC)glad_current_context->procs[596])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glTexGeni(GLenum arg0, GLenum arg1, GLint arg2) {
+	((PFNGLTEXGENIPROC)glad_current_context->procs[597])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniform4d(GLuint arg0, GLint arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+	((PFNGLPROGRAMUNIFORM4DPROC)glad_current_context->procs[598])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glTextureParameterIiv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLTEXTUREPARAMETERIIVPROC)glad_current_context->procs[599])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord3s(GLenum arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLMULTITEXCOORD3SPROC)glad_current_context->procs[600])(arg0, arg1, arg2, arg3);
+}
+static const GLubyte * APIENTRY glad_ctx_glGetStringi(GLenum arg0, GLuint arg1) {
+	return ((PFNGLGETSTRINGIPROC)glad_current_context->procs[601])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetTextureParameterfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETTEXTUREPARAMETERFVPROC)glad_current_context->procs[602])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTextureSubImage2D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLenum arg7, const void * arg8) {
+	((PFNGLTEXTURESUBIMAGE2DPROC)glad_current_context->procs[603])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord3i(GLenum arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLMULTITEXCOORD3IPROC)glad_current_context->procs[604])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord3f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLMULTITEXCOORD3FPROC)glad_current_context->procs[605])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glDrawTransformFeedbackStream(GLenum arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)glad_current_context->procs[606])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord3d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLMULTITEXCOORD3DPROC)glad_current_context->procs[607])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glAttachShader(GLuint arg0, GLuint arg1) {
+	((PFNGLATTACHSHADERPROC)glad_current_context->procs[608])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glFogCoorddv(const GLdouble * arg0) {
+	((PFNGLFOGCOORDDVPROC)glad_current_context->procs[609])(arg0);
+}
+static void APIENTRY glad_ctx_glUniformMatrix2x3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX2X3FVPROC)glad_current_context->procs[610])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetTexGenfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETTEXGENFVPROC)glad_current_context->procs[611])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glQueryCounter(GLuint arg0, GLenum arg1) {
+	((PFNGLQUERYCOUNTERPROC)glad_current_context->procs[612])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glFogCoordPointer(GLenum arg0, GLsizei arg1, const void * arg2) {
+	((PFNGLFOGCOORDPOINTERPROC)glad_current_context->procs[613])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix3dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX3DVPROC)glad_current_context->procs[614])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glProvokingVertex(GLenum arg0) {
+	((PFNGLPROVOKINGVERTEXPROC)glad_current_context->procs[615])(arg0);
+}
+static void APIENTRY glad_ctx_glShaderBinary(GLsizei arg0, const GLuint * arg1, GLenum arg2, const void * arg3, GLsizei arg4) {
+	((PFNGLSHADERBINARYPROC)glad_current_context->procs[616])(arg0, arg1, arg2, arg3, arg4);
+}
+static GLboolean APIENTRY glad_ctx_glUnmapNamedBuffer(GLuint arg0) {
+	return ((PFNGLUNMAPNAMEDBUFFERPROC)glad_current_context->procs[617])(arg0);
+}
+static void APIENTRY glad_ctx_glGetnColorTable(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, void * arg4) {
+	((PFNGLGETNCOLORTABLEPROC)glad_current_context->procs[618])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glFramebufferTexture3D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4, GLint arg5) {
+	((PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_current_context->procs[619])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glTexGeniv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLTEXGENIVPROC)glad_current_context->procs[620])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glRasterPos2dv(const GLdouble * arg0) {
+	((PFNGLRASTERPOS2DVPROC)glad_current_context->procs[621])(arg0);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3dv(const GLdouble * arg0) {
+	((PFNGLSECONDARYCOLOR3DVPROC)glad_current_context->procs[622])(arg0);
+}
+static void APIENTRY glad_ctx_glClientActiveTexture(GLenum arg0) {
+	((PFNGLCLIENTACTIVETEXTUREPROC)glad_current_context->procs[623])(arg0);
+}
+static void APIENTRY glad_ctx_glNamedRenderbufferStorageMultisample(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_current_context->procs[624])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glVertexAttribI4sv(GLuint arg0, const GLshort * arg1) {
+	((PFNGLVERTEXATTRIBI4SVPROC)glad_current_context->procs[625])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glClearNamedBufferData(GLuint arg0, GLenum arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	((PFNGLCLEARNAMEDBUFFERDATAPROC)glad_current_context->procs[626])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3us(GLushort arg0, GLushort arg1, GLushort arg2) {
+	((PFNGLSECONDARYCOLOR3USPROC)glad_current_context->procs[627])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glNormalP3ui(GLenum arg0, GLuint arg1) {
+	((PFNGLNORMALP3UIPROC)glad_current_context->procs[628])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTexEnvfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLTEXENVFVPROC)glad_current_context->procs[629])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glReadBuffer(GLenum arg0) {
+	((PFNGLREADBUFFERPROC)glad_current_context->procs[630])(arg0);
+}
+static void APIENTRY glad_ctx_glViewportArrayv(GLuint arg0, GLsizei arg1, const GLfloat * arg2) {
+	((PFNGLVIEWPORTARRAYVPROC)glad_current_context->procs[631])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexParameterIuiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLTEXPARAMETERIUIVPROC)glad_current_context->procs[632])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glDrawArraysInstanced(GLenum arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+	((PFNGLDRAWARRAYSINSTANCEDPROC)glad_current_context->procs[633])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGenerateMipmap(GLenum arg0) {
+	((PFNGLGENERATEMIPMAPPROC)glad_current_context->procs[634])(arg0);
+}
+static void APIENTRY glad_ctx_glCompressedTextureSubImage2D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLsizei arg7, const void * arg8) {
+	((PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)glad_current_context->procs[635])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix2fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX2FVPROC)glad_current_context->procs[636])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glWindowPos3fv(const GLfloat * arg0) {
+	((PFNGLWINDOWPOS3FVPROC)glad_current_context->procs[637])(arg0);
+}
+static void APIENTRY glad_ctx_glUniformMatrix3x4dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX3X4DVPROC)glad_current_context->procs[638])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glLightModelfv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLLIGHTMODELFVPROC)glad_current_context->procs[639])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glSamplerParameteriv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLSAMPLERPARAMETERIVPROC)glad_current_context->procs[640])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glDeleteLists(GLuint arg0, GLsizei arg1) {
+	((PFNGLDELETELISTSPROC)glad_current_context->procs[641])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetClipPlane(GLenum arg0, GLdouble * arg1) {
+	((PFNGLGETCLIPPLANEPROC)glad_current_context->procs[642])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertex4dv(const GLdouble * arg0) {
+	((PFNGLVERTEX4DVPROC)glad_current_context->procs[643])(arg0);
+}
+static void APIENTRY glad_ctx_glTexCoord2d(GLdouble arg0, GLdouble arg1) {
+	((PFNGLTEXCOORD2DPROC)glad_current_context->procs[644])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glPopMatrix(void) {
+	((PFNGLPOPMATRIXPROC)glad_current_context->procs[645])();
+}
+static void APIENTRY glad_ctx_glTexCoord2f(GLfloat arg0, GLfloat arg1) {
+	((PFNGLTEXCOORD2FPROC)glad_current_context->procs[646])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glColor4iv(const GLint * arg0) {
+	((PFNGLCOLOR4IVPROC)glad_current_context->procs[647])(arg0);
+}
+static void APIENTRY glad_ctx_glIndexubv(const GLubyte * arg0) {
+	((PFNGLINDEXUBVPROC)glad_current_context->procs[648])(arg0);
+}
+static GLenum APIENTRY glad_ctx_glCheckNamedFramebufferStatus(GLuint arg0, GLenum arg1) {
+	return ((PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)glad_current_context->procs[649])(arg0, arg1);
+}
+static GLboolean APIENTRY glad_ctx_glUnmapBuffer(GLenum arg0) {
+	return ((PFNGLUNMAPBUFFERPROC)glad_current_context->procs[650])(arg0);
+}
+static void APIENTRY glad_ctx_glTexCoord2i(GLint arg0, GLint arg1) {
+	((PFNGLTEXCOORD2IPROC)glad_current_context->procs[651])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glRasterPos4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLRASTERPOS4DPROC)glad_current_context->procs[652])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glRasterPos4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLRASTERPOS4FPROC)glad_current_context->procs[653])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glProgramUniform1iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	((PFNGLPROGRAMUNIFORM1IVPROC)glad_current_context->procs[654])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetVertexArrayiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETVERTEXARRAYIVPROC)glad_current_context->procs[655])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glCopyTextureSubImage2D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLsizei arg6, GLsizei arg7) {
+	((PFNGLCOPYTEXTURESUBIMAGE2DPROC)glad_current_context->procs[656])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_ctx_glVertexAttrib3s(GLuint arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLVERTEXATTRIB3SPROC)glad_current_context->procs[657])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glTexCoord2s(GLshort arg0, GLshort arg1) {
+	((PFNGLTEXCOORD2SPROC)glad_current_context->procs[658])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glBindRenderbuffer(GLenum arg0, GLuint arg1) {
+	((PFNGLBINDRENDERBUFFERPROC)glad_current_context->procs[659])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertex3fv(const GLfloat * arg0) {
+	((PFNGLVERTEX3FVPROC)glad_current_context->procs[660])(arg0);
+}
+static void APIENTRY glad_ctx_glTexCoord4dv(const GLdouble * arg0) {
+	((PFNGLTEXCOORD4DVPROC)glad_current_context->procs[661])(arg0);
+}
+static void APIENTRY glad_ctx_glMaterialiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLMATERIALIVPROC)glad_current_context->procs[662])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttribP4uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	((PFNGLVERTEXATTRIBP4UIVPROC)glad_current_context->procs[663])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetProgramStageiv(GLuint arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETPROGRAMSTAGEIVPROC)glad_current_context->procs[664])(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_ctx_glIsProgram(GLuint arg0) {
+	return ((PFNGLISPROGRAMPROC)glad_current_context->procs[665])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4bv(GLuint arg0, const GLbyte * arg1) {
+	((PFNGLVERTEXATTRIB4BVPROC)glad_current_context->procs[666])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertex4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLVERTEX4SPROC)glad_current_context->procs[667])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniformMatrix3x2dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX3X2DVPROC)glad_current_context->procs[668])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4fv(GLuint arg0, const GLfloat * arg1) {
+	((PFNGLVERTEXATTRIB4FVPROC)glad_current_context->procs[669])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glNormal3dv(const GLdouble * arg0) {
+	((PFNGLNORMAL3DVPROC)glad_current_context->procs[670])(arg0);
+}
+static GLboolean APIENTRY glad_ctx_glIsTransformFeedback(GLuint arg0) {
+	return ((PFNGLISTRANSFORMFEEDBACKPROC)glad_current_context->procs[671])(arg0);
+}
+static void APIENTRY glad_ctx_glUniform4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	((PFNGLUNIFORM4IPROC)glad_current_context->procs[672])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glActiveTexture(GLenum arg0) {
+	((PFNGLACTIVETEXTUREPROC)glad_current_context->procs[673])(arg0);
+}
+static void APIENTRY glad_ctx_glEnableVertexAttribArray(GLuint arg0) {
+	((PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_current_context->procs[674])(arg0);
+}
+static void APIENTRY glad_ctx_glRotated(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLROTATEDPROC)glad_current_context->procs[675])(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_ctx_glIsProgramPipeline(GLuint arg0) {
+	return ((PFNGLISPROGRAMPIPELINEPROC)glad_current_context->procs[676])(arg0);
+}
+static void APIENTRY glad_ctx_glRotatef(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLROTATEFPROC)glad_current_context->procs[677])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertex4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLVERTEX4IPROC)glad_current_context->procs[678])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glReadPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4, GLenum arg5, GLvoid * arg6) {
+	((PFNGLREADPIXELSPROC)glad_current_context->procs[679])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glVertexAttribI3iv(GLuint arg0, const GLint * arg1) {
+	((PFNGLVERTEXATTRIBI3IVPROC)glad_current_context->procs[680])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glLoadName(GLuint arg0) {
+	((PFNGLLOADNAMEPROC)glad_current_context->procs[681])(arg0);
+}
+static void APIENTRY glad_ctx_glUniform4f(GLint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	((PFNGLUNIFORM4FPROC)glad_current_context->procs[682])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glRenderbufferStorageMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_current_context->procs[683])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glCreateProgramPipelines(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATEPROGRAMPIPELINESPROC)glad_current_context->procs[684])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGenVertexArrays(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENVERTEXARRAYSPROC)glad_current_context->procs[685])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glShadeModel(GLenum arg0) {
+	((PFNGLSHADEMODELPROC)glad_current_context->procs[686])(arg0);
+}
+static void APIENTRY glad_ctx_glMapGrid1d(GLint arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLMAPGRID1DPROC)glad_current_context->procs[687])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetUniformfv(GLuint arg0, GLint arg1, GLfloat * arg2) {
+	((PFNGLGETUNIFORMFVPROC)glad_current_context->procs[688])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMapGrid1f(GLint arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLMAPGRID1FPROC)glad_current_context->procs[689])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glSamplerParameterfv(GLuint arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLSAMPLERPARAMETERFVPROC)glad_current_context->procs[690])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttribLPointer(GLuint arg0, GLint arg1, GLenum arg2, GLsizei arg3, const void * arg4) {
+	((PFNGLVERTEXATTRIBLPOINTERPROC)glad_current_context->procs[691])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glDisableClientState(GLenum arg0) {
+	((PFNGLDISABLECLIENTSTATEPROC)glad_current_context->procs[692])(arg0);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord3sv(GLenum arg0, const GLshort * arg1) {
+	((PFNGLMULTITEXCOORD3SVPROC)glad_current_context->procs[693])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetnUniformfv(GLuint arg0, GLint arg1, GLsizei arg2, GLfloat * arg3) {
+	((PFNGLGETNUNIFORMFVPROC)glad_current_context->procs[694])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glDrawElementsInstancedBaseVertex(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLint arg5) {
+	((PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_current_context->procs[695])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glVertexAttribL2dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIBL2DVPROC)glad_current_context->procs[696])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glMultiDrawElementsIndirect(GLenum arg0, GLenum arg1, const void * arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLMULTIDRAWELEMENTSINDIRECTPROC)glad_current_context->procs[697])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glEnableVertexArrayAttrib(GLuint arg0, GLuint arg1) {
+	((PFNGLENABLEVERTEXARRAYATTRIBPROC)glad_current_context->procs[698])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glSecondaryColorPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+	((PFNGLSECONDARYCOLORPOINTERPROC)glad_current_context->procs[699])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glAlphaFunc(GLenum arg0, GLclampf arg1) {
+	((PFNGLALPHAFUNCPROC)glad_current_context->procs[700])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glUniform1iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	((PFNGLUNIFORM1IVPROC)glad_current_context->procs[701])(arg0, arg1, arg2);
+}
+static GLuint APIENTRY glad_ctx_glCreateShaderProgramv(GLenum arg0, GLsizei arg1, const GLchar *const* arg2) {
+	return ((PFNGLCREATESHADERPROGRAMVPROC)glad_current_context->procs[702])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetActiveSubroutineName(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, GLsizei * arg4, GLchar * arg5) {
+	((PFNGLGETACTIVESUBROUTINENAMEPROC)glad_current_context->procs[703])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord4iv(GLenum arg0, const GLint * arg1) {
+	((PFNGLMULTITEXCOORD4IVPROC)glad_current_context->procs[704])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttribL2d(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLVERTEXATTRIBL2DPROC)glad_current_context->procs[705])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetQueryObjectiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETQUERYOBJECTIVPROC)glad_current_context->procs[706])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glStencilFunc(GLenum arg0, GLint arg1, GLuint arg2) {
+	((PFNGLSTENCILFUNCPROC)glad_current_context->procs[707])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glInvalidateNamedFramebufferData(GLuint arg0, GLsizei arg1, const GLenum * arg2) {
+	((PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)glad_current_context->procs[708])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord1fv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLMULTITEXCOORD1FVPROC)glad_current_context->procs[709])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glUniformBlockBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLUNIFORMBLOCKBINDINGPROC)glad_current_context->procs[710])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glColor4uiv(const GLuint * arg0) {
+	((PFNGLCOLOR4UIVPROC)glad_current_context->procs[711])(arg0);
+}
+static void APIENTRY glad_ctx_glRectiv(const GLint * arg0, const GLint * arg1) {
+	((PFNGLRECTIVPROC)glad_current_context->procs[712])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glColorP4ui(GLenum arg0, GLuint arg1) {
+	((PFNGLCOLORP4UIPROC)glad_current_context->procs[713])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glUseProgramStages(GLuint arg0, GLbitfield arg1, GLuint arg2) {
+	((PFNGLUSEPROGRAMSTAGESPROC)glad_current_context->procs[714])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glRasterPos3dv(const GLdouble * arg0) {
+	((PFNGLRASTERPOS3DVPROC)glad_current_context->procs[715])(arg0);
+}
+static void APIENTRY glad_ctx_glEvalMesh2(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	((PFNGLEVALMESH2PROC)glad_current_context->procs[716])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glEvalMesh1(GLenum arg0, GLint arg1, GLint arg2) {
+	((PFNGLEVALMESH1PROC)glad_current_context->procs[717])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexCoordPointer(GLint arg0, GLenum arg1, GLsizei arg2, const GLvoid * arg3) {
+	((PFNGLTEXCOORDPOINTERPROC)glad_current_context->procs[718])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glProgramUniform3f(GLuint arg0, GLint arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	((PFNGLPROGRAMUNIFORM3FPROC)glad_current_context->procs[719])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glProgramUniform3d(GLuint arg0, GLint arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	((PFNGLPROGRAMUNIFORM3DPROC)glad_current_context->procs[720])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4Nubv(GLuint arg0, const GLubyte * arg1) {
+	((PFNGLVERTEXATTRIB4NUBVPROC)glad_current_context->procs[721])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttribI4iv(GLuint arg0, const GLint * arg1) {
+	((PFNGLVERTEXATTRIBI4IVPROC)glad_current_context->procs[722])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetProgramPipelineiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETPROGRAMPIPELINEIVPROC)glad_current_context->procs[723])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexStorage3D(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5) {
+	((PFNGLTEXSTORAGE3DPROC)glad_current_context->procs[724])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glEvalCoord2fv(const GLfloat * arg0) {
+	((PFNGLEVALCOORD2FVPROC)glad_current_context->procs[725])(arg0);
+}
+static void APIENTRY glad_ctx_glNamedFramebufferDrawBuffer(GLuint arg0, GLenum arg1) {
+	((PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)glad_current_context->procs[726])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetQueryIndexediv(GLenum arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETQUERYINDEXEDIVPROC)glad_current_context->procs[727])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glColor4ubv(const GLubyte * arg0) {
+	((PFNGLCOLOR4UBVPROC)glad_current_context->procs[728])(arg0);
+}
+static void APIENTRY glad_ctx_glLoadTransposeMatrixd(const GLdouble * arg0) {
+	((PFNGLLOADTRANSPOSEMATRIXDPROC)glad_current_context->procs[729])(arg0);
+}
+static void APIENTRY glad_ctx_glLoadTransposeMatrixf(const GLfloat * arg0) {
+	((PFNGLLOADTRANSPOSEMATRIXFPROC)glad_current_context->procs[730])(arg0);
+}
+static void APIENTRY glad_ctx_glTextureParameteriv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLTEXTUREPARAMETERIVPROC)glad_current_context->procs[731])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glObjectLabel(GLenum arg0, GLuint arg1, GLsizei arg2, const GLchar * arg3) {
+	((PFNGLOBJECTLABELPROC)glad_current_context->procs[732])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertexAttribI4i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	((PFNGLVERTEXATTRIBI4IPROC)glad_current_context->procs[733])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glRasterPos2iv(const GLint * arg0) {
+	((PFNGLRASTERPOS2IVPROC)glad_current_context->procs[734])(arg0);
+}
+static void APIENTRY glad_ctx_glGetBufferSubData(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, void * arg3) {
+	((PFNGLGETBUFFERSUBDATAPROC)glad_current_context->procs[735])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetVertexAttribLdv(GLuint arg0, GLenum arg1, GLdouble * arg2) {
+	((PFNGLGETVERTEXATTRIBLDVPROC)glad_current_context->procs[736])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetnUniformuiv(GLuint arg0, GLint arg1, GLsizei arg2, GLuint * arg3) {
+	((PFNGLGETNUNIFORMUIVPROC)glad_current_context->procs[737])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetQueryBufferObjectiv(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	((PFNGLGETQUERYBUFFEROBJECTIVPROC)glad_current_context->procs[738])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glTexEnviv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLTEXENVIVPROC)glad_current_context->procs[739])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glBlendEquationSeparate(GLenum arg0, GLenum arg1) {
+	((PFNGLBLENDEQUATIONSEPARATEPROC)glad_current_context->procs[740])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttribI1ui(GLuint arg0, GLuint arg1) {
+	((PFNGLVERTEXATTRIBI1UIPROC)glad_current_context->procs[741])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGenBuffers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENBUFFERSPROC)glad_current_context->procs[742])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glSelectBuffer(GLsizei arg0, GLuint * arg1) {
+	((PFNGLSELECTBUFFERPROC)glad_current_context->procs[743])(arg0, arg1);
+}
+static GLuint APIENTRY glad_ctx_glGetSubroutineIndex(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	return ((PFNGLGETSUBROUTINEINDEXPROC)glad_current_context->procs[744])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttrib2sv(GLuint arg0, const GLshort * arg1) {
+	((PFNGLVERTEXATTRIB2SVPROC)glad_current_context->procs[745])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glScissorIndexedv(GLuint arg0, const GLint * arg1) {
+	((PFNGLSCISSORINDEXEDVPROC)glad_current_context->procs[746])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glPushAttrib(GLbitfield arg0) {
+	((PFNGLPUSHATTRIBPROC)glad_current_context->procs[747])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexAttribIPointer(GLuint arg0, GLint arg1, GLenum arg2, GLsizei arg3, const void * arg4) {
+	((PFNGLVERTEXATTRIBIPOINTERPROC)glad_current_context->procs[748])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glBlendFunc(GLenum arg0, GLenum arg1) {
+	((PFNGLBLENDFUNCPROC)glad_current_context->procs[749])(arg0, arg1);
+}
+static GLuint APIENTRY glad_ctx_glCreateProgram(void) {
+	return ((PFNGLCREATEPROGRAMPROC)glad_current_context->procs[750])();
+}
+static void APIENTRY glad_ctx_glNamedBufferSubData(GLuint arg0, GLintptr arg1, GLsizeiptr arg2, const void * arg3) {
+	((PFNGLNAMEDBUFFERSUBDATAPROC)glad_current_context->procs[751])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glTexImage3D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLint arg6, GLenum arg7, GLenum arg8, const void * arg9) {
+	((PFNGLTEXIMAGE3DPROC)glad_current_context->procs[752])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static GLboolean APIENTRY glad_ctx_glIsFramebuffer(GLuint arg0) {
+	return ((PFNGLISFRAMEBUFFERPROC)glad_current_context->procs[753])(arg0);
+}
+static void APIENTRY glad_ctx_glClearNamedFramebufferfv(GLuint arg0, GLenum arg1, GLint arg2, const GLfloat * arg3) {
+	((PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)glad_current_context->procs[754])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glLightiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLLIGHTIVPROC)glad_current_context->procs[755])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetNamedBufferSubData(GLuint arg0, GLintptr arg1, GLsizeiptr arg2, void * arg3) {
+	((PFNGLGETNAMEDBUFFERSUBDATAPROC)glad_current_context->procs[756])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glCompressedTextureSubImage3D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLsizei arg9, const void * arg10) {
+	((PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)glad_current_context->procs[757])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static void APIENTRY glad_ctx_glPrimitiveRestartIndex(GLuint arg0) {
+	((PFNGLPRIMITIVERESTARTINDEXPROC)glad_current_context->procs[758])(arg0);
+}
+static void APIENTRY glad_ctx_glFlushMappedNamedBufferRange(GLuint arg0, GLintptr arg1, GLsizeiptr arg2) {
+	((PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)glad_current_context->procs[759])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glInvalidateTexSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7) {
+	((PFNGLINVALIDATETEXSUBIMAGEPROC)glad_current_context->procs[760])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_ctx_glTexGenfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLTEXGENFVPROC)glad_current_context->procs[761])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetTextureParameterIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	((PFNGLGETTEXTUREPARAMETERIUIVPROC)glad_current_context->procs[762])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetnConvolutionFilter(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, void * arg4) {
+	((PFNGLGETNCONVOLUTIONFILTERPROC)glad_current_context->procs[763])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glBindImageTextures(GLuint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLBINDIMAGETEXTURESPROC)glad_current_context->procs[764])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glEnd(void) {
+	((PFNGLENDPROC)glad_current_context->procs[765])();
+}
+static void APIENTRY glad_ctx_glDeleteBuffers(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETEBUFFERSPROC)glad_current_context->procs[766])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glBindProgramPipeline(GLuint arg0) {
+	((PFNGLBINDPROGRAMPIPELINEPROC)glad_current_context->procs[767])(arg0);
+}
+static void APIENTRY glad_ctx_glScissor(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+	((PFNGLSCISSORPROC)glad_current_context->procs[768])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glTexCoordP4uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLTEXCOORDP4UIVPROC)glad_current_context->procs[769])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glClipPlane(GLenum arg0, const GLdouble * arg1) {
+	((PFNGLCLIPPLANEPROC)glad_current_context->procs[770])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glPushName(GLuint arg0) {
+	((PFNGLPUSHNAMEPROC)glad_current_context->procs[771])(arg0);
+}
+static void APIENTRY glad_ctx_glTexGendv(GLenum arg0, GLenum arg1, const GLdouble * arg2) {
+	((PFNGLTEXGENDVPROC)glad_current_context->procs[772])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glIndexub(GLubyte arg0) {
+	((PFNGLINDEXUBPROC)glad_current_context->procs[773])(arg0);
+}
+static void APIENTRY glad_ctx_glGetNamedFramebufferAttachmentParameteriv(GLuint arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_current_context->procs[774])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glNamedFramebufferRenderbuffer(GLuint arg0, GLenum arg1, GLenum arg2, GLuint arg3) {
+	((PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)glad_current_context->procs[775])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertexP2uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLVERTEXP2UIVPROC)glad_current_context->procs[776])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3iv(const GLint * arg0) {
+	((PFNGLSECONDARYCOLOR3IVPROC)glad_current_context->procs[777])(arg0);
+}
+static void APIENTRY glad_ctx_glRasterPos4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLRASTERPOS4IPROC)glad_current_context->procs[778])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glMultTransposeMatrixd(const GLdouble * arg0) {
+	((PFNGLMULTTRANSPOSEMATRIXDPROC)glad_current_context->procs[779])(arg0);
+}
+static void APIENTRY glad_ctx_glClearColor(GLclampf arg0, GLclampf arg1, GLclampf arg2, GLclampf arg3) {
+	((PFNGLCLEARCOLORPROC)glad_current_context->procs[780])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4uiv(GLuint arg0, const GLuint * arg1) {
+	((PFNGLVERTEXATTRIB4UIVPROC)glad_current_context->procs[781])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glNormal3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLNORMAL3SPROC)glad_current_context->procs[782])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4Niv(GLuint arg0, const GLint * arg1) {
+	((PFNGLVERTEXATTRIB4NIVPROC)glad_current_context->procs[783])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix2x3fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)glad_current_context->procs[784])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glClearBufferiv(GLenum arg0, GLint arg1, const GLint * arg2) {
+	((PFNGLCLEARBUFFERIVPROC)glad_current_context->procs[785])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glPointParameteri(GLenum arg0, GLint arg1) {
+	((PFNGLPOINTPARAMETERIPROC)glad_current_context->procs[786])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glProgramUniform4dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	((PFNGLPROGRAMUNIFORM4DVPROC)glad_current_context->procs[787])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glColorP4uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLCOLORP4UIVPROC)glad_current_context->procs[788])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glBlendColor(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLBLENDCOLORPROC)glad_current_context->procs[789])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetnPixelMapuiv(GLenum arg0, GLsizei arg1, GLuint * arg2) {
+	((PFNGLGETNPIXELMAPUIVPROC)glad_current_context->procs[790])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetTextureLevelParameteriv(GLuint arg0, GLint arg1, GLenum arg2, GLint * arg3) {
+	((PFNGLGETTEXTURELEVELPARAMETERIVPROC)glad_current_context->procs[791])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glWindowPos3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLWINDOWPOS3DPROC)glad_current_context->procs[792])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniform3fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	((PFNGLPROGRAMUNIFORM3FVPROC)glad_current_context->procs[793])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertexAttribI2uiv(GLuint arg0, const GLuint * arg1) {
+	((PFNGLVERTEXATTRIBI2UIVPROC)glad_current_context->procs[794])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetNamedFramebufferParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)glad_current_context->procs[795])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glSamplerParameterIuiv(GLuint arg0, GLenum arg1, const GLuint * arg2) {
+	((PFNGLSAMPLERPARAMETERIUIVPROC)glad_current_context->procs[796])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glUniform3ui(GLint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+	((PFNGLUNIFORM3UIPROC)glad_current_context->procs[797])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glProgramUniform3uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	((PFNGLPROGRAMUNIFORM3UIVPROC)glad_current_context->procs[798])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glColor4dv(const GLdouble * arg0) {
+	((PFNGLCOLOR4DVPROC)glad_current_context->procs[799])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexAttribI4uiv(GLuint arg0, const GLuint * arg1) {
+	((PFNGLVERTEXATTRIBI4UIVPROC)glad_current_context->procs[800])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glPointParameterfv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLPOINTPARAMETERFVPROC)glad_current_context->procs[801])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glResumeTransformFeedback(void) {
+	((PFNGLRESUMETRANSFORMFEEDBACKPROC)glad_current_context->procs[802])();
+}
+static void APIENTRY glad_ctx_glUniform2fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	((PFNGLUNIFORM2FVPROC)glad_current_context->procs[803])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetActiveSubroutineUniformName(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, GLsizei * arg4, GLchar * arg5) {
+	((PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)glad_current_context->procs[804])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static GLuint APIENTRY glad_ctx_glGetProgramResourceIndex(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	return ((PFNGLGETPROGRAMRESOURCEINDEXPROC)glad_current_context->procs[805])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3ub(GLubyte arg0, GLubyte arg1, GLubyte arg2) {
+	((PFNGLSECONDARYCOLOR3UBPROC)glad_current_context->procs[806])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glDrawElementsIndirect(GLenum arg0, GLenum arg1, const void * arg2) {
+	((PFNGLDRAWELEMENTSINDIRECTPROC)glad_current_context->procs[807])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetTextureLevelParameterfv(GLuint arg0, GLint arg1, GLenum arg2, GLfloat * arg3) {
+	((PFNGLGETTEXTURELEVELPARAMETERFVPROC)glad_current_context->procs[808])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glSecondaryColor3ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLSECONDARYCOLOR3UIPROC)glad_current_context->procs[809])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexCoord3dv(const GLdouble * arg0) {
+	((PFNGLTEXCOORD3DVPROC)glad_current_context->procs[810])(arg0);
+}
+static void APIENTRY glad_ctx_glGetNamedBufferPointerv(GLuint arg0, GLenum arg1, void ** arg2) {
+	((PFNGLGETNAMEDBUFFERPOINTERVPROC)glad_current_context->procs[811])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glDispatchComputeIndirect(GLintptr arg0) {
+	((PFNGLDISPATCHCOMPUTEINDIRECTPROC)glad_current_context->procs[812])(arg0);
+}
+static void APIENTRY glad_ctx_glInvalidateNamedFramebufferSubData(GLuint arg0, GLsizei arg1, const GLenum * arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6) {
+	((PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)glad_current_context->procs[813])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glGetSamplerParameterIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	((PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_current_context->procs[814])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glBindBufferRange(GLenum arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	((PFNGLBINDBUFFERRANGEPROC)glad_current_context->procs[815])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glNormal3iv(const GLint * arg0) {
+	((PFNGLNORMAL3IVPROC)glad_current_context->procs[816])(arg0);
+}
+static void APIENTRY glad_ctx_glTextureSubImage1D(GLuint arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	((PFNGLTEXTURESUBIMAGE1DPROC)glad_current_context->procs[817])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glVertexAttribL3dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIBL3DVPROC)glad_current_context->procs[818])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetUniformdv(GLuint arg0, GLint arg1, GLdouble * arg2) {
+	((PFNGLGETUNIFORMDVPROC)glad_current_context->procs[819])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glWindowPos3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLWINDOWPOS3SPROC)glad_current_context->procs[820])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glPointParameterf(GLenum arg0, GLfloat arg1) {
+	((PFNGLPOINTPARAMETERFPROC)glad_current_context->procs[821])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glClearDepthf(GLfloat arg0) {
+	((PFNGLCLEARDEPTHFPROC)glad_current_context->procs[822])(arg0);
+}
+static void APIENTRY glad_ctx_glGetVertexAttribIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	((PFNGLGETVERTEXATTRIBIUIVPROC)glad_current_context->procs[823])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glWindowPos3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLWINDOWPOS3IPROC)glad_current_context->procs[824])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord4s(GLenum arg0, GLshort arg1, GLshort arg2, GLshort arg3, GLshort arg4) {
+	((PFNGLMULTITEXCOORD4SPROC)glad_current_context->procs[825])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetTextureSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, GLsizei arg10, void * arg11) {
+	((PFNGLGETTEXTURESUBIMAGEPROC)glad_current_context->procs[826])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
+}
+static void APIENTRY glad_ctx_glWindowPos3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLWINDOWPOS3FPROC)glad_current_context->procs[827])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGenTransformFeedbacks(GLsizei arg0, GLuint * arg1) {
+	((PFNGLGENTRANSFORMFEEDBACKSPROC)glad_current_context->procs[828])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glColor3us(GLushort arg0, GLushort arg1, GLushort arg2) {
+	((PFNGLCOLOR3USPROC)glad_current_context->procs[829])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glColor3uiv(const GLuint * arg0) {
+	((PFNGLCOLOR3UIVPROC)glad_current_context->procs[830])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4Nusv(GLuint arg0, const GLushort * arg1) {
+	((PFNGLVERTEXATTRIB4NUSVPROC)glad_current_context->procs[831])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetLightiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETLIGHTIVPROC)glad_current_context->procs[832])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glDepthFunc(GLenum arg0) {
+	((PFNGLDEPTHFUNCPROC)glad_current_context->procs[833])(arg0);
+}
+static void APIENTRY glad_ctx_glCompressedTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLsizei arg7, const void * arg8) {
+	((PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_current_context->procs[834])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_ctx_glListBase(GLuint arg0) {
+	((PFNGLLISTBASEPROC)glad_current_context->procs[835])(arg0);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord4f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	((PFNGLMULTITEXCOORD4FPROC)glad_current_context->procs[836])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glColor3ub(GLubyte arg0, GLubyte arg1, GLubyte arg2) {
+	((PFNGLCOLOR3UBPROC)glad_current_context->procs[837])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord4d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	((PFNGLMULTITEXCOORD4DPROC)glad_current_context->procs[838])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glVertexAttribI4bv(GLuint arg0, const GLbyte * arg1) {
+	((PFNGLVERTEXATTRIBI4BVPROC)glad_current_context->procs[839])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glBlendEquationSeparatei(GLuint arg0, GLenum arg1, GLenum arg2) {
+	((PFNGLBLENDEQUATIONSEPARATEIPROC)glad_current_context->procs[840])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetTexParameterfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	((PFNGLGETTEXPARAMETERFVPROC)glad_current_context->procs[841])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glColor3ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLCOLOR3UIPROC)glad_current_context->procs[842])(arg0, arg1, arg2);
+}
+static GLint APIENTRY glad_ctx_glGetProgramResourceLocationIndex(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	return ((PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)glad_current_context->procs[843])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord4i(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	((PFNGLMULTITEXCOORD4IPROC)glad_current_context->procs[844])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glBufferStorage(GLenum arg0, GLsizeiptr arg1, const void * arg2, GLbitfield arg3) {
+	((PFNGLBUFFERSTORAGEPROC)glad_current_context->procs[845])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetPolygonStipple(GLubyte * arg0) {
+	((PFNGLGETPOLYGONSTIPPLEPROC)glad_current_context->procs[846])(arg0);
+}
+static GLenum APIENTRY glad_ctx_glClientWaitSync(GLsync arg0, GLbitfield arg1, GLuint64 arg2) {
+	return ((PFNGLCLIENTWAITSYNCPROC)glad_current_context->procs[847])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttribI4ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+	((PFNGLVERTEXATTRIBI4UIPROC)glad_current_context->procs[848])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetFloati_v(GLenum arg0, GLuint arg1, GLfloat * arg2) {
+	((PFNGLGETFLOATI_VPROC)glad_current_context->procs[849])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord4dv(GLenum arg0, const GLdouble * arg1) {
+	((PFNGLMULTITEXCOORD4DVPROC)glad_current_context->procs[850])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glColorMask(GLboolean arg0, GLboolean arg1, GLboolean arg2, GLboolean arg3) {
+	((PFNGLCOLORMASKPROC)glad_current_context->procs[851])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glTextureBuffer(GLuint arg0, GLenum arg1, GLuint arg2) {
+	((PFNGLTEXTUREBUFFERPROC)glad_current_context->procs[852])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexParameterIiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	((PFNGLTEXPARAMETERIIVPROC)glad_current_context->procs[853])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glBlendEquation(GLenum arg0) {
+	((PFNGLBLENDEQUATIONPROC)glad_current_context->procs[854])(arg0);
+}
+static GLint APIENTRY glad_ctx_glGetUniformLocation(GLuint arg0, const GLchar * arg1) {
+	return ((PFNGLGETUNIFORMLOCATIONPROC)glad_current_context->procs[855])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetSamplerParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETSAMPLERPARAMETERIVPROC)glad_current_context->procs[856])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexArrayAttribFormat(GLuint arg0, GLuint arg1, GLint arg2, GLenum arg3, GLboolean arg4, GLuint arg5) {
+	((PFNGLVERTEXARRAYATTRIBFORMATPROC)glad_current_context->procs[857])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glReadnPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4, GLenum arg5, GLsizei arg6, void * arg7) {
+	((PFNGLREADNPIXELSPROC)glad_current_context->procs[858])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_ctx_glRasterPos4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	((PFNGLRASTERPOS4SPROC)glad_current_context->procs[859])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glEndTransformFeedback(void) {
+	((PFNGLENDTRANSFORMFEEDBACKPROC)glad_current_context->procs[860])();
+}
+static void APIENTRY glad_ctx_glVertexAttrib4usv(GLuint arg0, const GLushort * arg1) {
+	((PFNGLVERTEXATTRIB4USVPROC)glad_current_context->procs[861])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetUniformSubroutineuiv(GLenum arg0, GLint arg1, GLuint * arg2) {
+	((PFNGLGETUNIFORMSUBROUTINEUIVPROC)glad_current_context->procs[862])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord3dv(GLenum arg0, const GLdouble * arg1) {
+	((PFNGLMULTITEXCOORD3DVPROC)glad_current_context->procs[863])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glBindVertexBuffer(GLuint arg0, GLuint arg1, GLintptr arg2, GLsizei arg3) {
+	((PFNGLBINDVERTEXBUFFERPROC)glad_current_context->procs[864])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glColor4sv(const GLshort * arg0) {
+	((PFNGLCOLOR4SVPROC)glad_current_context->procs[865])(arg0);
+}
+static void APIENTRY glad_ctx_glDebugMessageInsert(GLenum arg0, GLenum arg1, GLuint arg2, GLenum arg3, GLsizei arg4, const GLchar * arg5) {
+	((PFNGLDEBUGMESSAGEINSERTPROC)glad_current_context->procs[866])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glCreateSamplers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATESAMPLERSPROC)glad_current_context->procs[867])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glPopClientAttrib(void) {
+	((PFNGLPOPCLIENTATTRIBPROC)glad_current_context->procs[868])();
+}
+static void APIENTRY glad_ctx_glClearBufferData(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	((PFNGLCLEARBUFFERDATAPROC)glad_current_context->procs[869])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glBeginTransformFeedback(GLenum arg0) {
+	((PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_current_context->procs[870])(arg0);
+}
+static void APIENTRY glad_ctx_glFogf(GLenum arg0, GLfloat arg1) {
+	((PFNGLFOGFPROC)glad_current_context->procs[871])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttribI1iv(GLuint arg0, const GLint * arg1) {
+	((PFNGLVERTEXATTRIBI1IVPROC)glad_current_context->procs[872])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glProgramBinary(GLuint arg0, GLenum arg1, const void * arg2, GLsizei arg3) {
+	((PFNGLPROGRAMBINARYPROC)glad_current_context->procs[873])(arg0, arg1, arg2, arg3);
+}
+static GLboolean APIENTRY glad_ctx_glIsSampler(GLuint arg0) {
+	return ((PFNGLISSAMPLERPROC)glad_current_context->procs[874])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexP3ui(GLenum arg0, GLuint arg1) {
+	((PFNGLVERTEXP3UIPROC)glad_current_context->procs[875])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttribDivisor(GLuint arg0, GLuint arg1) {
+	((PFNGLVERTEXATTRIBDIVISORPROC)glad_current_context->procs[876])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glBindSamplers(GLuint arg0, GLsizei arg1, const GLuint * arg2) {
+	((PFNGLBINDSAMPLERSPROC)glad_current_context->procs[877])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glColor3iv(const GLint * arg0) {
+	((PFNGLCOLOR3IVPROC)glad_current_context->procs[878])(arg0);
+}
+static void APIENTRY glad_ctx_glCompressedTexImage1D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLint arg4, GLsizei arg5, const void * arg6) {
+	((PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_current_context->procs[879])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glDeleteTransformFeedbacks(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETETRANSFORMFEEDBACKSPROC)glad_current_context->procs[880])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glCopyTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5) {
+	((PFNGLCOPYTEXSUBIMAGE1DPROC)glad_current_context->procs[881])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glTexCoord1i(GLint arg0) {
+	((PFNGLTEXCOORD1IPROC)glad_current_context->procs[882])(arg0);
+}
+static GLenum APIENTRY glad_ctx_glCheckFramebufferStatus(GLenum arg0) {
+	return ((PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_current_context->procs[883])(arg0);
+}
+static void APIENTRY glad_ctx_glTexCoord1d(GLdouble arg0) {
+	((PFNGLTEXCOORD1DPROC)glad_current_context->procs[884])(arg0);
+}
+static void APIENTRY glad_ctx_glTexCoord1f(GLfloat arg0) {
+	((PFNGLTEXCOORD1FPROC)glad_current_context->procs[885])(arg0);
+}
+static void APIENTRY glad_ctx_glTextureStorage3D(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5) {
+	((PFNGLTEXTURESTORAGE3DPROC)glad_current_context->procs[886])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glEndConditionalRender(void) {
+	((PFNGLENDCONDITIONALRENDERPROC)glad_current_context->procs[887])();
+}
+static void APIENTRY glad_ctx_glEnableClientState(GLenum arg0) {
+	((PFNGLENABLECLIENTSTATEPROC)glad_current_context->procs[888])(arg0);
+}
+static void APIENTRY glad_ctx_glBindAttribLocation(GLuint arg0, GLuint arg1, const GLchar * arg2) {
+	((PFNGLBINDATTRIBLOCATIONPROC)glad_current_context->procs[889])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glUniformMatrix4x2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX4X2FVPROC)glad_current_context->procs[890])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniformMatrix2dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX2DVPROC)glad_current_context->procs[891])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glBlendFunci(GLuint arg0, GLenum arg1, GLenum arg2) {
+	((PFNGLBLENDFUNCIPROC)glad_current_context->procs[892])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord2sv(GLenum arg0, const GLshort * arg1) {
+	((PFNGLMULTITEXCOORD2SVPROC)glad_current_context->procs[893])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttrib1dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIB1DVPROC)glad_current_context->procs[894])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glDrawRangeElements(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3, GLenum arg4, const void * arg5) {
+	((PFNGLDRAWRANGEELEMENTSPROC)glad_current_context->procs[895])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glTexCoord1s(GLshort arg0) {
+	((PFNGLTEXCOORD1SPROC)glad_current_context->procs[896])(arg0);
+}
+static void APIENTRY glad_ctx_glBindBufferBase(GLenum arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLBINDBUFFERBASEPROC)glad_current_context->procs[897])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glBufferSubData(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, const void * arg3) {
+	((PFNGLBUFFERSUBDATAPROC)glad_current_context->procs[898])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4iv(GLuint arg0, const GLint * arg1) {
+	((PFNGLVERTEXATTRIB4IVPROC)glad_current_context->procs[899])(arg0, arg1);
+}
+static GLuint APIENTRY glad_ctx_glGenLists(GLsizei arg0) {
+	return ((PFNGLGENLISTSPROC)glad_current_context->procs[900])(arg0);
+}
+static void APIENTRY glad_ctx_glColor3bv(const GLbyte * arg0) {
+	((PFNGLCOLOR3BVPROC)glad_current_context->procs[901])(arg0);
+}
+static void * APIENTRY glad_ctx_glMapBufferRange(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, GLbitfield arg3) {
+	return ((PFNGLMAPBUFFERRANGEPROC)glad_current_context->procs[902])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glFramebufferTexture(GLenum arg0, GLenum arg1, GLuint arg2, GLint arg3) {
+	((PFNGLFRAMEBUFFERTEXTUREPROC)glad_current_context->procs[903])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glBlendFuncSeparatei(GLuint arg0, GLenum arg1, GLenum arg2, GLenum arg3, GLenum arg4) {
+	((PFNGLBLENDFUNCSEPARATEIPROC)glad_current_context->procs[904])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix4x2fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)glad_current_context->procs[905])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glVertexAttribL1d(GLuint arg0, GLdouble arg1) {
+	((PFNGLVERTEXATTRIBL1DPROC)glad_current_context->procs[906])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetTexGendv(GLenum arg0, GLenum arg1, GLdouble * arg2) {
+	((PFNGLGETTEXGENDVPROC)glad_current_context->procs[907])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glClearNamedFramebufferiv(GLuint arg0, GLenum arg1, GLint arg2, const GLint * arg3) {
+	((PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)glad_current_context->procs[908])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glMultiDrawArrays(GLenum arg0, const GLint * arg1, const GLsizei * arg2, GLsizei arg3) {
+	((PFNGLMULTIDRAWARRAYSPROC)glad_current_context->procs[909])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glEndList(void) {
+	((PFNGLENDLISTPROC)glad_current_context->procs[910])();
+}
+static void APIENTRY glad_ctx_glScissorIndexed(GLuint arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLSCISSORINDEXEDPROC)glad_current_context->procs[911])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glVertexP4uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLVERTEXP4UIVPROC)glad_current_context->procs[912])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glUniform2ui(GLint arg0, GLuint arg1, GLuint arg2) {
+	((PFNGLUNIFORM2UIPROC)glad_current_context->procs[913])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttribI2iv(GLuint arg0, const GLint * arg1) {
+	((PFNGLVERTEXATTRIBI2IVPROC)glad_current_context->procs[914])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetnMapdv(GLenum arg0, GLenum arg1, GLsizei arg2, GLdouble * arg3) {
+	((PFNGLGETNMAPDVPROC)glad_current_context->procs[915])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glColor3usv(const GLushort * arg0) {
+	((PFNGLCOLOR3USVPROC)glad_current_context->procs[916])(arg0);
+}
+static void APIENTRY glad_ctx_glWindowPos2fv(const GLfloat * arg0) {
+	((PFNGLWINDOWPOS2FVPROC)glad_current_context->procs[917])(arg0);
+}
+static void APIENTRY glad_ctx_glTextureView(GLuint arg0, GLenum arg1, GLuint arg2, GLenum arg3, GLuint arg4, GLuint arg5, GLuint arg6, GLuint arg7) {
+	((PFNGLTEXTUREVIEWPROC)glad_current_context->procs[918])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_ctx_glDisablei(GLenum arg0, GLuint arg1) {
+	((PFNGLDISABLEIPROC)glad_current_context->procs[919])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix2x4fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)glad_current_context->procs[920])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glCreateRenderbuffers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATERENDERBUFFERSPROC)glad_current_context->procs[921])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glIndexMask(GLuint arg0) {
+	((PFNGLINDEXMASKPROC)glad_current_context->procs[922])(arg0);
+}
+static void APIENTRY glad_ctx_glPushClientAttrib(GLbitfield arg0) {
+	((PFNGLPUSHCLIENTATTRIBPROC)glad_current_context->procs[923])(arg0);
+}
+static void APIENTRY glad_ctx_glShaderSource(GLuint arg0, GLsizei arg1, const GLchar *const* arg2, const GLint * arg3) {
+	((PFNGLSHADERSOURCEPROC)glad_current_context->procs[924])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetnSeparableFilter(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, void * arg4, GLsizei arg5, void * arg6, void * arg7) {
+	((PFNGLGETNSEPARABLEFILTERPROC)glad_current_context->procs[925])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static void APIENTRY glad_ctx_glGetActiveUniformBlockName(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+	((PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_current_context->procs[926])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glVertexAttribI3uiv(GLuint arg0, const GLuint * arg1) {
+	((PFNGLVERTEXATTRIBI3UIVPROC)glad_current_context->procs[927])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glReleaseShaderCompiler(void) {
+	((PFNGLRELEASESHADERCOMPILERPROC)glad_current_context->procs[928])();
+}
+static void APIENTRY glad_ctx_glVertexAttribIFormat(GLuint arg0, GLint arg1, GLenum arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBIFORMATPROC)glad_current_context->procs[929])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glCreateFramebuffers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATEFRAMEBUFFERSPROC)glad_current_context->procs[930])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glClearAccum(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLCLEARACCUMPROC)glad_current_context->procs[931])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetSynciv(GLsync arg0, GLenum arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4) {
+	((PFNGLGETSYNCIVPROC)glad_current_context->procs[932])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glProgramUniform2uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	((PFNGLPROGRAMUNIFORM2UIVPROC)glad_current_context->procs[933])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetnPixelMapfv(GLenum arg0, GLsizei arg1, GLfloat * arg2) {
+	((PFNGLGETNPIXELMAPFVPROC)glad_current_context->procs[934])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glTexCoordP2uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLTEXCOORDP2UIVPROC)glad_current_context->procs[935])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glPatchParameteri(GLenum arg0, GLint arg1) {
+	((PFNGLPATCHPARAMETERIPROC)glad_current_context->procs[936])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glProgramUniform2i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	((PFNGLPROGRAMUNIFORM2IPROC)glad_current_context->procs[937])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniform2f(GLint arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLUNIFORM2FPROC)glad_current_context->procs[938])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetNamedBufferParameteri64v(GLuint arg0, GLenum arg1, GLint64 * arg2) {
+	((PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)glad_current_context->procs[939])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glBeginQuery(GLenum arg0, GLuint arg1) {
+	((PFNGLBEGINQUERYPROC)glad_current_context->procs[940])(arg0, arg1);
+}
+static GLuint APIENTRY glad_ctx_glGetUniformBlockIndex(GLuint arg0, const GLchar * arg1) {
+	return ((PFNGLGETUNIFORMBLOCKINDEXPROC)glad_current_context->procs[941])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glBindBuffer(GLenum arg0, GLuint arg1) {
+	((PFNGLBINDBUFFERPROC)glad_current_context->procs[942])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glMap2d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLint arg4, GLdouble arg5, GLdouble arg6, GLint arg7, GLint arg8, const GLdouble * arg9) {
+	((PFNGLMAP2DPROC)glad_current_context->procs[943])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static void APIENTRY glad_ctx_glMap2f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLint arg4, GLfloat arg5, GLfloat arg6, GLint arg7, GLint arg8, const GLfloat * arg9) {
+	((PFNGLMAP2FPROC)glad_current_context->procs[944])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static void APIENTRY glad_ctx_glTexStorage2DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+	((PFNGLTEXSTORAGE2DMULTISAMPLEPROC)glad_current_context->procs[945])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glUniform2d(GLint arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLUNIFORM2DPROC)glad_current_context->procs[946])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertex4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLVERTEX4DPROC)glad_current_context->procs[947])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniformMatrix2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX2FVPROC)glad_current_context->procs[948])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glTexCoord1sv(const GLshort * arg0) {
+	((PFNGLTEXCOORD1SVPROC)glad_current_context->procs[949])(arg0);
+}
+static void APIENTRY glad_ctx_glBufferData(GLenum arg0, GLsizeiptr arg1, const void * arg2, GLenum arg3) {
+	((PFNGLBUFFERDATAPROC)glad_current_context->procs[950])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glEvalPoint1(GLint arg0) {
+	((PFNGLEVALPOINT1PROC)glad_current_context->procs[951])(arg0);
+}
+static void APIENTRY glad_ctx_glGetTexParameterIiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTEXPARAMETERIIVPROC)glad_current_context->procs[952])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetQueryBufferObjectui64v(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	((PFNGLGETQUERYBUFFEROBJECTUI64VPROC)glad_current_context->procs[953])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glTexCoord1dv(const GLdouble * arg0) {
+	((PFNGLTEXCOORD1DVPROC)glad_current_context->procs[954])(arg0);
+}
+static void APIENTRY glad_ctx_glTexCoordP1ui(GLenum arg0, GLuint arg1) {
+	((PFNGLTEXCOORDP1UIPROC)glad_current_context->procs[955])(arg0, arg1);
+}
+static GLenum APIENTRY glad_ctx_glGetError(void) {
+	return ((PFNGLGETERRORPROC)glad_current_context->procs[956])();
+}
+static void APIENTRY glad_ctx_glGetTexEnviv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTEXENVIVPROC)glad_current_context->procs[957])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetProgramiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETPROGRAMIVPROC)glad_current_context->procs[958])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttribP2ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	((PFNGLVERTEXATTRIBP2UIPROC)glad_current_context->procs[959])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetFloatv(GLenum arg0, GLfloat * arg1) {
+	((PFNGLGETFLOATVPROC)glad_current_context->procs[960])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLenum arg5, const GLvoid * arg6) {
+	((PFNGLTEXSUBIMAGE1DPROC)glad_current_context->procs[961])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glMultiTexCoord2fv(GLenum arg0, const GLfloat * arg1) {
+	((PFNGLMULTITEXCOORD2FVPROC)glad_current_context->procs[962])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glUniformMatrix2x4dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	((PFNGLUNIFORMMATRIX2X4DVPROC)glad_current_context->procs[963])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertexAttrib2fv(GLuint arg0, const GLfloat * arg1) {
+	((PFNGLVERTEXATTRIB2FVPROC)glad_current_context->procs[964])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glEvalCoord1d(GLdouble arg0) {
+	((PFNGLEVALCOORD1DPROC)glad_current_context->procs[965])(arg0);
+}
+static void APIENTRY glad_ctx_glGetTexLevelParameterfv(GLenum arg0, GLint arg1, GLenum arg2, GLfloat * arg3) {
+	((PFNGLGETTEXLEVELPARAMETERFVPROC)glad_current_context->procs[966])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glEvalCoord1f(GLfloat arg0) {
+	((PFNGLEVALCOORD1FPROC)glad_current_context->procs[967])(arg0);
+}
+static void APIENTRY glad_ctx_glPixelMapfv(GLenum arg0, GLsizei arg1, const GLfloat * arg2) {
+	((PFNGLPIXELMAPFVPROC)glad_current_context->procs[968])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttribP3uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	((PFNGLVERTEXATTRIBP3UIVPROC)glad_current_context->procs[969])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetPixelMapusv(GLenum arg0, GLushort * arg1) {
+	((PFNGLGETPIXELMAPUSVPROC)glad_current_context->procs[970])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glSecondaryColorP3uiv(GLenum arg0, const GLuint * arg1) {
+	((PFNGLSECONDARYCOLORP3UIVPROC)glad_current_context->procs[971])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetIntegerv(GLenum arg0, GLint * arg1) {
+	((PFNGLGETINTEGERVPROC)glad_current_context->procs[972])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glAccum(GLenum arg0, GLfloat arg1) {
+	((PFNGLACCUMPROC)glad_current_context->procs[973])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetVertexArrayIndexed64iv(GLuint arg0, GLuint arg1, GLenum arg2, GLint64 * arg3) {
+	((PFNGLGETVERTEXARRAYINDEXED64IVPROC)glad_current_context->procs[974])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glGetBufferPointerv(GLenum arg0, GLenum arg1, void ** arg2) {
+	((PFNGLGETBUFFERPOINTERVPROC)glad_current_context->procs[975])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetVertexAttribIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETVERTEXATTRIBIIVPROC)glad_current_context->procs[976])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glRasterPos4dv(const GLdouble * arg0) {
+	((PFNGLRASTERPOS4DVPROC)glad_current_context->procs[977])(arg0);
+}
+static void APIENTRY glad_ctx_glProgramUniform4fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	((PFNGLPROGRAMUNIFORM4FVPROC)glad_current_context->procs[978])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glTexCoord2iv(const GLint * arg0) {
+	((PFNGLTEXCOORD2IVPROC)glad_current_context->procs[979])(arg0);
+}
+static void APIENTRY glad_ctx_glTextureBarrier(void) {
+	((PFNGLTEXTUREBARRIERPROC)glad_current_context->procs[980])();
+}
+static GLboolean APIENTRY glad_ctx_glIsQuery(GLuint arg0) {
+	return ((PFNGLISQUERYPROC)glad_current_context->procs[981])(arg0);
+}
+static void APIENTRY glad_ctx_glProgramUniform2ui(GLuint arg0, GLint arg1, GLuint arg2, GLuint arg3) {
+	((PFNGLPROGRAMUNIFORM2UIPROC)glad_current_context->procs[982])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glProgramUniform4ui(GLuint arg0, GLint arg1, GLuint arg2, GLuint arg3, GLuint arg4, GLuint arg5) {
+	((PFNGLPROGRAMUNIFORM4UIPROC)glad_current_context->procs[983])(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static void APIENTRY glad_ctx_glVertexAttrib4sv(GLuint arg0, const GLshort * arg1) {
+	((PFNGLVERTEXATTRIB4SVPROC)glad_current_context->procs[984])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glWindowPos3dv(const GLdouble * arg0) {
+	((PFNGLWINDOWPOS3DVPROC)glad_current_context->procs[985])(arg0);
+}
+static void APIENTRY glad_ctx_glTexImage2D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4, GLint arg5, GLenum arg6, GLenum arg7, const GLvoid * arg8) {
+	((PFNGLTEXIMAGE2DPROC)glad_current_context->procs[986])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static void APIENTRY glad_ctx_glStencilMask(GLuint arg0) {
+	((PFNGLSTENCILMASKPROC)glad_current_context->procs[987])(arg0);
+}
+static void APIENTRY glad_ctx_glDrawPixels(GLsizei arg0, GLsizei arg1, GLenum arg2, GLenum arg3, const GLvoid * arg4) {
+	((PFNGLDRAWPIXELSPROC)glad_current_context->procs[988])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glMultMatrixd(const GLdouble * arg0) {
+	((PFNGLMULTMATRIXDPROC)glad_current_context->procs[989])(arg0);
+}
+static void APIENTRY glad_ctx_glMultMatrixf(const GLfloat * arg0) {
+	((PFNGLMULTMATRIXFPROC)glad_current_context->procs[990])(arg0);
+}
+static GLboolean APIENTRY glad_ctx_glIsTexture(GLuint arg0) {
+	return ((PFNGLISTEXTUREPROC)glad_current_context->procs[991])(arg0);
+}
+static void APIENTRY glad_ctx_glGetMaterialiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETMATERIALIVPROC)glad_current_context->procs[992])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glNamedBufferData(GLuint arg0, GLsizeiptr arg1, const void * arg2, GLenum arg3) {
+	((PFNGLNAMEDBUFFERDATAPROC)glad_current_context->procs[993])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniform1fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	((PFNGLUNIFORM1FVPROC)glad_current_context->procs[994])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glLoadMatrixf(const GLfloat * arg0) {
+	((PFNGLLOADMATRIXFPROC)glad_current_context->procs[995])(arg0);
+}
+static void APIENTRY glad_ctx_glTexStorage2D(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	((PFNGLTEXSTORAGE2DPROC)glad_current_context->procs[996])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glLoadMatrixd(const GLdouble * arg0) {
+	((PFNGLLOADMATRIXDPROC)glad_current_context->procs[997])(arg0);
+}
+static void APIENTRY glad_ctx_glClearNamedBufferSubData(GLuint arg0, GLenum arg1, GLintptr arg2, GLsizeiptr arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	((PFNGLCLEARNAMEDBUFFERSUBDATAPROC)glad_current_context->procs[998])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void * APIENTRY glad_ctx_glMapNamedBufferRange(GLuint arg0, GLintptr arg1, GLsizeiptr arg2, GLbitfield arg3) {
+	return ((PFNGLMAPNAMEDBUFFERRANGEPROC)glad_current_context->procs[999])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glNamedFramebufferTextureLayer(GLuint arg0, GLenum arg1, GLuint arg2, GLint arg3, GLint arg4) {
+	((PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)glad_current_context->procs[1000])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glTexParameterfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	((PFNGLTEXPARAMETERFVPROC)glad_current_context->procs[1001])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glUniformMatrix3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX3FVPROC)glad_current_context->procs[1002])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glVertex4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	((PFNGLVERTEX4FPROC)glad_current_context->procs[1003])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glRectsv(const GLshort * arg0, const GLshort * arg1) {
+	((PFNGLRECTSVPROC)glad_current_context->procs[1004])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glColor4usv(const GLushort * arg0) {
+	((PFNGLCOLOR4USVPROC)glad_current_context->procs[1005])(arg0);
+}
+static void APIENTRY glad_ctx_glUniform3dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	((PFNGLUNIFORM3DVPROC)glad_current_context->procs[1006])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glProgramUniformMatrix4x3fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	((PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)glad_current_context->procs[1007])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glPolygonStipple(const GLubyte * arg0) {
+	((PFNGLPOLYGONSTIPPLEPROC)glad_current_context->procs[1008])(arg0);
+}
+static void APIENTRY glad_ctx_glBindBuffersBase(GLenum arg0, GLuint arg1, GLsizei arg2, const GLuint * arg3) {
+	((PFNGLBINDBUFFERSBASEPROC)glad_current_context->procs[1009])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glInterleavedArrays(GLenum arg0, GLsizei arg1, const GLvoid * arg2) {
+	((PFNGLINTERLEAVEDARRAYSPROC)glad_current_context->procs[1010])(arg0, arg1, arg2);
+}
+static GLint APIENTRY glad_ctx_glGetSubroutineUniformLocation(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	return ((PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)glad_current_context->procs[1011])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glNormal3i(GLint arg0, GLint arg1, GLint arg2) {
+	((PFNGLNORMAL3IPROC)glad_current_context->procs[1012])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glNormal3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLNORMAL3FPROC)glad_current_context->procs[1013])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glNormal3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLNORMAL3DPROC)glad_current_context->procs[1014])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glNormal3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+	((PFNGLNORMAL3BPROC)glad_current_context->procs[1015])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetFramebufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETFRAMEBUFFERPARAMETERIVPROC)glad_current_context->procs[1016])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glPixelMapusv(GLenum arg0, GLsizei arg1, const GLushort * arg2) {
+	((PFNGLPIXELMAPUSVPROC)glad_current_context->procs[1017])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetTexGeniv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	((PFNGLGETTEXGENIVPROC)glad_current_context->procs[1018])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glArrayElement(GLint arg0) {
+	((PFNGLARRAYELEMENTPROC)glad_current_context->procs[1019])(arg0);
+}
+static void APIENTRY glad_ctx_glGetCompressedTextureSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLsizei arg8, void * arg9) {
+	((PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)glad_current_context->procs[1020])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static void APIENTRY glad_ctx_glCopyBufferSubData(GLenum arg0, GLenum arg1, GLintptr arg2, GLintptr arg3, GLsizeiptr arg4) {
+	((PFNGLCOPYBUFFERSUBDATAPROC)glad_current_context->procs[1021])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glVertexAttribI1uiv(GLuint arg0, const GLuint * arg1) {
+	((PFNGLVERTEXATTRIBI1UIVPROC)glad_current_context->procs[1022])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttrib2d(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+	((PFNGLVERTEXATTRIB2DPROC)glad_current_context->procs[1023])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glBindTransformFeedback(GLenum arg0, GLuint arg1) {
+	((PFNGLBINDTRANSFORMFEEDBACKPROC)glad_current_context->procs[1024])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glVertexAttrib2f(GLuint arg0, GLfloat arg1, GLfloat arg2) {
+	((PFNGLVERTEXATTRIB2FPROC)glad_current_context->procs[1025])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttrib3dv(GLuint arg0, const GLdouble * arg1) {
+	((PFNGLVERTEXATTRIB3DVPROC)glad_current_context->procs[1026])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetQueryObjectui64v(GLuint arg0, GLenum arg1, GLuint64 * arg2) {
+	((PFNGLGETQUERYOBJECTUI64VPROC)glad_current_context->procs[1027])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glDepthMask(GLboolean arg0) {
+	((PFNGLDEPTHMASKPROC)glad_current_context->procs[1028])(arg0);
+}
+static void APIENTRY glad_ctx_glVertexAttrib2s(GLuint arg0, GLshort arg1, GLshort arg2) {
+	((PFNGLVERTEXATTRIB2SPROC)glad_current_context->procs[1029])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glColor3fv(const GLfloat * arg0) {
+	((PFNGLCOLOR3FVPROC)glad_current_context->procs[1030])(arg0);
+}
+static void APIENTRY glad_ctx_glTexImage3DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+	((PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_current_context->procs[1031])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glProgramUniform1fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	((PFNGLPROGRAMUNIFORM1FVPROC)glad_current_context->procs[1032])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniformMatrix4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	((PFNGLUNIFORMMATRIX4FVPROC)glad_current_context->procs[1033])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glUniform4fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	((PFNGLUNIFORM4FVPROC)glad_current_context->procs[1034])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glGetActiveUniform(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4, GLenum * arg5, GLchar * arg6) {
+	((PFNGLGETACTIVEUNIFORMPROC)glad_current_context->procs[1035])(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static void APIENTRY glad_ctx_glColorPointer(GLint arg0, GLenum arg1, GLsizei arg2, const GLvoid * arg3) {
+	((PFNGLCOLORPOINTERPROC)glad_current_context->procs[1036])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glFrontFace(GLenum arg0) {
+	((PFNGLFRONTFACEPROC)glad_current_context->procs[1037])(arg0);
+}
+static void APIENTRY glad_ctx_glTexBufferRange(GLenum arg0, GLenum arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	((PFNGLTEXBUFFERRANGEPROC)glad_current_context->procs[1038])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glCreateBuffers(GLsizei arg0, GLuint * arg1) {
+	((PFNGLCREATEBUFFERSPROC)glad_current_context->procs[1039])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glNamedFramebufferParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	((PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)glad_current_context->procs[1040])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glDrawArraysInstancedBaseInstance(GLenum arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLuint arg4) {
+	((PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)glad_current_context->procs[1041])(arg0, arg1, arg2, arg3, arg4);
+}
+static void APIENTRY glad_ctx_glGetBooleani_v(GLenum arg0, GLuint arg1, GLboolean * arg2) {
+	((PFNGLGETBOOLEANI_VPROC)glad_current_context->procs[1042])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glVertexAttribL3d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	((PFNGLVERTEXATTRIBL3DPROC)glad_current_context->procs[1043])(arg0, arg1, arg2, arg3);
+}
+static void APIENTRY glad_ctx_glDeleteProgramPipelines(GLsizei arg0, const GLuint * arg1) {
+	((PFNGLDELETEPROGRAMPIPELINESPROC)glad_current_context->procs[1044])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glClearBufferuiv(GLenum arg0, GLint arg1, const GLuint * arg2) {
+	((PFNGLCLEARBUFFERUIVPROC)glad_current_context->procs[1045])(arg0, arg1, arg2);
+}
+static void APIENTRY glad_ctx_glClipControl(GLenum arg0, GLenum arg1) {
+	((PFNGLCLIPCONTROLPROC)glad_current_context->procs[1046])(arg0, arg1);
+}
+static void APIENTRY glad_ctx_glGetProgramResourceiv(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, const GLenum * arg4, GLsizei arg5, GLsizei * arg6, GLint * arg7) {
+	((PFNGLGETPROGRAMRESOURCEIVPROC)glad_current_context->procs[1047])(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static const struct gladProcEntry glad_gl_procs[GLAD_GL_NUM_PROCS] = {
+	{ "glCopyTexImage1D", (void**)&glad_glCopyTexImage1D, (void*)glad_ctx_glCopyTexImage1D, (void*)glad_lazy_glCopyTexImage1D, 11 },
+	{ "glTextureParameterf", (void**)&glad_glTextureParameterf, (void*)glad_ctx_glTextureParameterf, (void*)glad_lazy_glTextureParameterf, 45 },
+	{ "glVertexAttribI3ui", (void**)&glad_glVertexAttribI3ui, (void*)glad_ctx_glVertexAttribI3ui, (void*)glad_lazy_glVertexAttribI3ui, 30 },
+	{ "glVertexArrayElementBuffer", (void**)&glad_glVertexArrayElementBuffer, (void*)glad_ctx_glVertexArrayElementBuffer, (void*)glad_lazy_glVertexArrayElementBuffer, 45 },
+	{ "glWindowPos2s", (void**)&glad_glWindowPos2s, (void*)glad_ctx_glWindowPos2s, (void*)glad_lazy_glWindowPos2s, 14 },
+	{ "glTextureStorage3DMultisample", (void**)&glad_glTextureStorage3DMultisample, (void*)glad_ctx_glTextureStorage3DMultisample, (void*)glad_lazy_glTextureStorage3DMultisample, 45 },
+	{ "glTextureParameterfv", (void**)&glad_glTextureParameterfv, (void*)glad_ctx_glTextureParameterfv, (void*)glad_lazy_glTextureParameterfv, 45 },
+	{ "glWindowPos2i", (void**)&glad_glWindowPos2i, (void*)glad_ctx_glWindowPos2i, (void*)glad_lazy_glWindowPos2i, 14 },
+	{ "glWindowPos2f", (void**)&glad_glWindowPos2f, (void*)glad_ctx_glWindowPos2f, (void*)glad_lazy_glWindowPos2f, 14 },
+	{ "glWindowPos2d", (void**)&glad_glWindowPos2d, (void*)glad_ctx_glWindowPos2d, (void*)glad_lazy_glWindowPos2d, 14 },
+	{ "glVertex2fv", (void**)&glad_glVertex2fv, (void*)glad_ctx_glVertex2fv, (void*)glad_lazy_glVertex2fv, 10 },
+	{ "glIndexi", (void**)&glad_glIndexi, (void*)glad_ctx_glIndexi, (void*)glad_lazy_glIndexi, 10 },
+	{ "glFramebufferRenderbuffer", (void**)&glad_glFramebufferRenderbuffer, (void*)glad_ctx_glFramebufferRenderbuffer, (void*)glad_lazy_glFramebufferRenderbuffer, 30 },
+	{ "glUniformSubroutinesuiv", (void**)&glad_glUniformSubroutinesuiv, (void*)glad_ctx_glUniformSubroutinesuiv, (void*)glad_lazy_glUniformSubroutinesuiv, 40 },
+	{ "glRectdv", (void**)&glad_glRectdv, (void*)glad_ctx_glRectdv, (void*)glad_lazy_glRectdv, 10 },
+	{ "glCompressedTexSubImage3D", (void**)&glad_glCompressedTexSubImage3D, (void*)glad_ctx_glCompressedTexSubImage3D, (void*)glad_lazy_glCompressedTexSubImage3D, 13 },
+	{ "glEvalCoord2d", (void**)&glad_glEvalCoord2d, (void*)glad_ctx_glEvalCoord2d, (void*)glad_lazy_glEvalCoord2d, 10 },
+	{ "glEvalCoord2f", (void**)&glad_glEvalCoord2f, (void*)glad_ctx_glEvalCoord2f, (void*)glad_lazy_glEvalCoord2f, 10 },
+	{ "glGetDoublei_v", (void**)&glad_glGetDoublei_v, (void*)glad_ctx_glGetDoublei_v, (void*)glad_lazy_glGetDoublei_v, 41 },
+	{ "glIndexd", (void**)&glad_glIndexd, (void*)glad_ctx_glIndexd, (void*)glad_lazy_glIndexd, 10 },
+	{ "glVertexAttrib1sv", (void**)&glad_glVertexAttrib1sv, (void*)glad_ctx_glVertexAttrib1sv, (void*)glad_lazy_glVertexAttrib1sv, 20 },
+	{ "glIndexf", (void**)&glad_glIndexf, (void*)glad_ctx_glIndexf, (void*)glad_lazy_glIndexf, 10 },
+	{ "glBindSampler", (void**)&glad_glBindSampler, (void*)glad_ctx_glBindSampler, (void*)glad_lazy_glBindSampler, 33 },
+	{ "glLineWidth", (void**)&glad_glLineWidth, (void*)glad_ctx_glLineWidth, (void*)glad_lazy_glLineWidth, 10 },
+	{ "glColorP3uiv", (void**)&glad_glColorP3uiv, (void*)glad_ctx_glColorP3uiv, (void*)glad_lazy_glColorP3uiv, 33 },
+	{ "glGetIntegeri_v", (void**)&glad_glGetIntegeri_v, (void*)glad_ctx_glGetIntegeri_v, (void*)glad_lazy_glGetIntegeri_v, 30 },
+	{ "glGetMapfv", (void**)&glad_glGetMapfv, (void*)glad_ctx_glGetMapfv, (void*)glad_lazy_glGetMapfv, 10 },
+	{ "glIndexs", (void**)&glad_glIndexs, (void*)glad_ctx_glIndexs, (void*)glad_lazy_glIndexs, 10 },
+	{ "glCompileShader", (void**)&glad_glCompileShader, (void*)glad_ctx_glCompileShader, (void*)glad_lazy_glCompileShader, 20 },
+	{ "glGetTransformFeedbackVarying", (void**)&glad_glGetTransformFeedbackVarying, (void*)glad_ctx_glGetTransformFeedbackVarying, (void*)glad_lazy_glGetTransformFeedbackVarying, 30 },
+	{ "glWindowPos2iv", (void**)&glad_glWindowPos2iv, (void*)glad_ctx_glWindowPos2iv, (void*)glad_lazy_glWindowPos2iv, 14 },
+	{ "glDrawTransformFeedbackStreamInstanced", (void**)&glad_glDrawTransformFeedbackStreamInstanced, (void*)glad_ctx_glDrawTransformFeedbackStreamInstanced, (void*)glad_lazy_glDrawTransformFeedbackStreamInstanced, 42 },
+	{ "glIndexfv", (void**)&glad_glIndexfv, (void*)glad_ctx_glIndexfv, (void*)glad_lazy_glIndexfv, 10 },
+	{ "glGetCompressedTextureImage", (void**)&glad_glGetCompressedTextureImage, (void*)glad_ctx_glGetCompressedTextureImage, (void*)glad_lazy_glGetCompressedTextureImage, 45 },
+	{ "glGetnMapfv", (void**)&glad_glGetnMapfv, (void*)glad_ctx_glGetnMapfv, (void*)glad_lazy_glGetnMapfv, 45 },
+	{ "glFogiv", (void**)&glad_glFogiv, (void*)glad_ctx_glFogiv, (void*)glad_lazy_glFogiv, 10 },
+	{ "glStencilMaskSeparate", (void**)&glad_glStencilMaskSeparate, (void*)glad_ctx_glStencilMaskSeparate, (void*)glad_lazy_glStencilMaskSeparate, 20 },
+	{ "glRasterPos2fv", (void**)&glad_glRasterPos2fv, (void*)glad_ctx_glRasterPos2fv, (void*)glad_lazy_glRasterPos2fv, 10 },
+	{ "glLightModeliv", (void**)&glad_glLightModeliv, (void*)glad_ctx_glLightModeliv, (void*)glad_lazy_glLightModeliv, 10 },
+	{ "glDepthRangef", (void**)&glad_glDepthRangef, (void*)glad_ctx_glDepthRangef, (void*)glad_lazy_glDepthRangef, 41 },
+	{ "glMultiDrawElementsIndirectCount", (void**)&glad_glMultiDrawElementsIndirectCount, (void*)glad_ctx_glMultiDrawElementsIndirectCount, (void*)glad_lazy_glMultiDrawElementsIndirectCount, 46 },
+	{ "glColor4ui", (void**)&glad_glColor4ui, (void*)glad_ctx_glColor4ui, (void*)glad_lazy_glColor4ui, 10 },
+	{ "glSecondaryColor3fv", (void**)&glad_glSecondaryColor3fv, (void*)glad_ctx_glSecondaryColor3fv, (void*)glad_lazy_glSecondaryColor3fv, 14 },
+	{ "glMultiTexCoordP3ui", (void**)&glad_glMultiTexCoordP3ui, (void*)glad_ctx_glMultiTexCoordP3ui, (void*)glad_lazy_glMultiTexCoordP3ui, 33 },
+	{ "glMemoryBarrierByRegion", (void**)&glad_glMemoryBarrierByRegion, (void*)glad_ctx_glMemoryBarrierByRegion, (void*)glad_lazy_glMemoryBarrierByRegion, 45 },
+	{ "glGetNamedBufferParameteriv", (void**)&glad_glGetNamedBufferParameteriv, (void*)glad_ctx_glGetNamedBufferParameteriv, (void*)glad_lazy_glGetNamedBufferParameteriv, 45 },
+	{ "glFogfv", (void**)&glad_glFogfv, (void*)glad_ctx_glFogfv, (void*)glad_lazy_glFogfv, 10 },
+	{ "glVertexP4ui", (void**)&glad_glVertexP4ui, (void*)glad_ctx_glVertexP4ui, (void*)glad_lazy_glVertexP4ui, 33 },
+	{ "glDrawElementsInstancedBaseInstance", (void**)&glad_glDrawElementsInstancedBaseInstance, (void*)glad_ctx_glDrawElementsInstancedBaseInstance, (void*)glad_lazy_glDrawElementsInstancedBaseInstance, 42 },
+	{ "glEnablei", (void**)&glad_glEnablei, (void*)glad_ctx_glEnablei, (void*)glad_lazy_glEnablei, 30 },
+	{ "glProgramUniform3dv", (void**)&glad_glProgramUniform3dv, (void*)glad_ctx_glProgramUniform3dv, (void*)glad_lazy_glProgramUniform3dv, 41 },
+	{ "glVertex4iv", (void**)&glad_glVertex4iv, (void*)glad_ctx_glVertex4iv, (void*)glad_lazy_glVertex4iv, 10 },
+	{ "glEvalCoord1fv", (void**)&glad_glEvalCoord1fv, (void*)glad_ctx_glEvalCoord1fv, (void*)glad_lazy_glEvalCoord1fv, 10 },
+	{ "glWindowPos2sv", (void**)&glad_glWindowPos2sv, (void*)glad_ctx_glWindowPos2sv, (void*)glad_lazy_glWindowPos2sv, 14 },
+	{ "glVertexAttribP4ui", (void**)&glad_glVertexAttribP4ui, (void*)glad_ctx_glVertexAttribP4ui, (void*)glad_lazy_glVertexAttribP4ui, 33 },
+	{ "glCreateShader", (void**)&glad_glCreateShader, (void*)glad_ctx_glCreateShader, (void*)glad_lazy_glCreateShader, 20 },
+	{ "glIsBuffer", (void**)&glad_glIsBuffer, (void*)glad_ctx_glIsBuffer, (void*)glad_lazy_glIsBuffer, 15 },
+	{ "glGetMultisamplefv", (void**)&glad_glGetMultisamplefv, (void*)glad_ctx_glGetMultisamplefv, (void*)glad_lazy_glGetMultisamplefv, 32 },
+	{ "glProgramUniformMatrix2dv", (void**)&glad_glProgramUniformMatrix2dv, (void*)glad_ctx_glProgramUniformMatrix2dv, (void*)glad_lazy_glProgramUniformMatrix2dv, 41 },
+	{ "glGenRenderbuffers", (void**)&glad_glGenRenderbuffers, (void*)glad_ctx_glGenRenderbuffers, (void*)glad_lazy_glGenRenderbuffers, 30 },
+	{ "glCopyTexSubImage2D", (void**)&glad_glCopyTexSubImage2D, (void*)glad_ctx_glCopyTexSubImage2D, (void*)glad_lazy_glCopyTexSubImage2D, 11 },
+	{ "glCompressedTexImage2D", (void**)&glad_glCompressedTexImage2D, (void*)glad_ctx_glCompressedTexImage2D, (void*)glad_lazy_glCompressedTexImage2D, 13 },
+	{ "glVertexAttrib1f", (void**)&glad_glVertexAttrib1f, (void*)glad_ctx_glVertexAttrib1f, (void*)glad_lazy_glVertexAttrib1f, 20 },
+	{ "glBlendFuncSeparate", (void**)&glad_glBlendFuncSeparate, (void*)glad_ctx_glBlendFuncSeparate, (void*)glad_lazy_glBlendFuncSeparate, 14 },
+	{ "glVertex4fv", (void**)&glad_glVertex4fv, (void*)glad_ctx_glVertex4fv, (void*)glad_lazy_glVertex4fv, 10 },
+	{ "glMinSampleShading", (void**)&glad_glMinSampleShading, (void*)glad_ctx_glMinSampleShading, (void*)glad_lazy_glMinSampleShading, 40 },
+	{ "glClearNamedFramebufferfi", (void**)&glad_glClearNamedFramebufferfi, (void*)glad_ctx_glClearNamedFramebufferfi, (void*)glad_lazy_glClearNamedFramebufferfi, 45 },
+	{ "glGetQueryBufferObjectuiv", (void**)&glad_glGetQueryBufferObjectuiv, (void*)glad_ctx_glGetQueryBufferObjectuiv, (void*)glad_lazy_glGetQueryBufferObjectuiv, 45 },
+	{ "glBindTexture", (void**)&glad_glBindTexture, (void*)glad_ctx_glBindTexture, (void*)glad_lazy_glBindTexture, 11 },
+	{ "glVertexAttrib1s", (void**)&glad_glVertexAttrib1s, (void*)glad_ctx_glVertexAttrib1s, (void*)glad_lazy_glVertexAttrib1s, 20 },
+	{ "glTexCoord2fv", (void**)&glad_glTexCoord2fv, (void*)glad_ctx_glTexCoord2fv, (void*)glad_lazy_glTexCoord2fv, 10 },
+	{ "glSampleMaski", (void**)&glad_glSampleMaski, (void*)glad_ctx_glSampleMaski, (void*)glad_lazy_glSampleMaski, 32 },
+	{ "glVertexP2ui", (void**)&glad_glVertexP2ui, (void*)glad_ctx_glVertexP2ui, (void*)glad_lazy_glVertexP2ui, 33 },
+	{ "glDrawRangeElementsBaseVertex", (void**)&glad_glDrawRangeElementsBaseVertex, (void*)glad_ctx_glDrawRangeElementsBaseVertex, (void*)glad_lazy_glDrawRangeElementsBaseVertex, 32 },
+	{ "glTexCoord4fv", (void**)&glad_glTexCoord4fv, (void*)glad_ctx_glTexCoord4fv, (void*)glad_lazy_glTexCoord4fv, 10 },
+	{ "glUniformMatrix3x2fv", (void**)&glad_glUniformMatrix3x2fv, (void*)glad_ctx_glUniformMatrix3x2fv, (void*)glad_lazy_glUniformMatrix3x2fv, 21 },
+	{ "glDebugMessageControl", (void**)&glad_glDebugMessageControl, (void*)glad_ctx_glDebugMessageControl, (void*)glad_lazy_glDebugMessageControl, 43 },
+	{ "glPointSize", (void**)&glad_glPointSize, (void*)glad_ctx_glPointSize, (void*)glad_lazy_glPointSize, 10 },
+	{ "glBindTextureUnit", (void**)&glad_glBindTextureUnit, (void*)glad_ctx_glBindTextureUnit, (void*)glad_lazy_glBindTextureUnit, 45 },
+	{ "glVertexAttrib2dv", (void**)&glad_glVertexAttrib2dv, (void*)glad_ctx_glVertexAttrib2dv, (void*)glad_lazy_glVertexAttrib2dv, 20 },
+	{ "glDeleteProgram", (void**)&glad_glDeleteProgram, (void*)glad_ctx_glDeleteProgram, (void*)glad_lazy_glDeleteProgram, 20 },
+	{ "glColor4bv", (void**)&glad_glColor4bv, (void*)glad_ctx_glColor4bv, (void*)glad_lazy_glColor4bv, 10 },
+	{ "glRasterPos2f", (void**)&glad_glRasterPos2f, (void*)glad_ctx_glRasterPos2f, (void*)glad_lazy_glRasterPos2f, 10 },
+	{ "glRasterPos2d", (void**)&glad_glRasterPos2d, (void*)glad_ctx_glRasterPos2d, (void*)glad_lazy_glRasterPos2d, 10 },
+	{ "glLoadIdentity", (void**)&glad_glLoadIdentity, (void*)glad_ctx_glLoadIdentity, (void*)glad_lazy_glLoadIdentity, 10 },
+	{ "glRasterPos2i", (void**)&glad_glRasterPos2i, (void*)glad_ctx_glRasterPos2i, (void*)glad_lazy_glRasterPos2i, 10 },
+	{ "glMultiDrawArraysIndirect", (void**)&glad_glMultiDrawArraysIndirect, (void*)glad_ctx_glMultiDrawArraysIndirect, (void*)glad_lazy_glMultiDrawArraysIndirect, 43 },
+	{ "glRenderbufferStorage", (void**)&glad_glRenderbufferStorage, (void*)glad_ctx_glRenderbufferStorage, (void*)glad_lazy_glRenderbufferStorage, 30 },
+	{ "glUniformMatrix4x3fv", (void**)&glad_glUniformMatrix4x3fv, (void*)glad_ctx_glUniformMatrix4x3fv, (void*)glad_lazy_glUniformMatrix4x3fv, 21 },
+	{ "glColor3b", (void**)&glad_glColor3b, (void*)glad_ctx_glColor3b, (void*)glad_lazy_glColor3b, 10 },
+	{ "glClearBufferfv", (void**)&glad_glClearBufferfv, (void*)glad_ctx_glClearBufferfv, (void*)glad_lazy_glClearBufferfv, 30 },
+	{ "glEdgeFlag", (void**)&glad_glEdgeFlag, (void*)glad_ctx_glEdgeFlag, (void*)glad_lazy_glEdgeFlag, 10 },
+	{ "glDeleteSamplers", (void**)&glad_glDeleteSamplers, (void*)glad_ctx_glDeleteSamplers, (void*)glad_lazy_glDeleteSamplers, 33 },
+	{ "glVertex3d", (void**)&glad_glVertex3d, (void*)glad_ctx_glVertex3d, (void*)glad_lazy_glVertex3d, 10 },
+	{ "glVertex3f", (void**)&glad_glVertex3f, (void*)glad_ctx_glVertex3f, (void*)glad_lazy_glVertex3f, 10 },
+	{ "glGetnMapiv", (void**)&glad_glGetnMapiv, (void*)glad_ctx_glGetnMapiv, (void*)glad_lazy_glGetnMapiv, 45 },
+	{ "glVertex3i", (void**)&glad_glVertex3i, (void*)glad_ctx_glVertex3i, (void*)glad_lazy_glVertex3i, 10 },
+	{ "glColor3i", (void**)&glad_glColor3i, (void*)glad_ctx_glColor3i, (void*)glad_lazy_glColor3i, 10 },
+	{ "glUniform3d", (void**)&glad_glUniform3d, (void*)glad_ctx_glUniform3d, (void*)glad_lazy_glUniform3d, 40 },
+	{ "glUniform3f", (void**)&glad_glUniform3f, (void*)glad_ctx_glUniform3f, (void*)glad_lazy_glUniform3f, 20 },
+	{ "glVertexAttrib4ubv", (void**)&glad_glVertexAttrib4ubv, (void*)glad_ctx_glVertexAttrib4ubv, (void*)glad_lazy_glVertexAttrib4ubv, 20 },
+	{ "glColor3s", (void**)&glad_glColor3s, (void*)glad_ctx_glColor3s, (void*)glad_lazy_glColor3s, 10 },
+	{ "glVertex3s", (void**)&glad_glVertex3s, (void*)glad_ctx_glVertex3s, (void*)glad_lazy_glVertex3s, 10 },
+	{ "glTexCoordP2ui", (void**)&glad_glTexCoordP2ui, (void*)glad_ctx_glTexCoordP2ui, (void*)glad_lazy_glTexCoordP2ui, 33 },
+	{ "glColorMaski", (void**)&glad_glColorMaski, (void*)glad_ctx_glColorMaski, (void*)glad_lazy_glColorMaski, 30 },
+	{ "glClearBufferfi", (void**)&glad_glClearBufferfi, (void*)glad_ctx_glClearBufferfi, (void*)glad_lazy_glClearBufferfi, 30 },
+	{ "glDrawArraysIndirect", (void**)&glad_glDrawArraysIndirect, (void*)glad_ctx_glDrawArraysIndirect, (void*)glad_lazy_glDrawArraysIndirect, 40 },
+	{ "glTexCoord1iv", (void**)&glad_glTexCoord1iv, (void*)glad_ctx_glTexCoord1iv, (void*)glad_lazy_glTexCoord1iv, 10 },
+	{ "glBlitFramebuffer", (void**)&glad_glBlitFramebuffer, (void*)glad_ctx_glBlitFramebuffer, (void*)glad_lazy_glBlitFramebuffer, 30 },
+	{ "glPauseTransformFeedback", (void**)&glad_glPauseTransformFeedback, (void*)glad_ctx_glPauseTransformFeedback, (void*)glad_lazy_glPauseTransformFeedback, 40 },
+	{ "glMultiTexCoordP2ui", (void**)&glad_glMultiTexCoordP2ui, (void*)glad_ctx_glMultiTexCoordP2ui, (void*)glad_lazy_glMultiTexCoordP2ui, 33 },
+	{ "glProgramUniformMatrix3x2dv", (void**)&glad_glProgramUniformMatrix3x2dv, (void*)glad_ctx_glProgramUniformMatrix3x2dv, (void*)glad_lazy_glProgramUniformMatrix3x2dv, 41 },
+	{ "glCopyNamedBufferSubData", (void**)&glad_glCopyNamedBufferSubData, (void*)glad_ctx_glCopyNamedBufferSubData, (void*)glad_lazy_glCopyNamedBufferSubData, 45 },
+	{ "glNamedFramebufferTexture", (void**)&glad_glNamedFramebufferTexture, (void*)glad_ctx_glNamedFramebufferTexture, (void*)glad_lazy_glNamedFramebufferTexture, 45 },
+	{ "glProgramUniformMatrix3x2fv", (void**)&glad_glProgramUniformMatrix3x2fv, (void*)glad_ctx_glProgramUniformMatrix3x2fv, (void*)glad_lazy_glProgramUniformMatrix3x2fv, 41 },
+	{ "glGetSamplerParameterIiv", (void**)&glad_glGetSamplerParameterIiv, (void*)glad_ctx_glGetSamplerParameterIiv, (void*)glad_lazy_glGetSamplerParameterIiv, 33 },
+	{ "glGetFragDataIndex", (void**)&glad_glGetFragDataIndex, (void*)glad_ctx_glGetFragDataIndex, (void*)glad_lazy_glGetFragDataIndex, 33 },
+	{ "glVertexAttribL4d", (void**)&glad_glVertexAttribL4d, (void*)glad_ctx_glVertexAttribL4d, (void*)glad_lazy_glVertexAttribL4d, 41 },
+	{ "glBindImageTexture", (void**)&glad_glBindImageTexture, (void*)glad_ctx_glBindImageTexture, (void*)glad_lazy_glBindImageTexture, 42 },
+	{ "glVertexAttrib3f", (void**)&glad_glVertexAttrib3f, (void*)glad_ctx_glVertexAttrib3f, (void*)glad_lazy_glVertexAttrib3f, 20 },
+	{ "glProgramUniformMatrix4fv", (void**)&glad_glProgramUniformMatrix4fv, (void*)glad_ctx_glProgramUniformMatrix4fv, (void*)glad_lazy_glProgramUniformMatrix4fv, 41 },
+	{ "glVertex2iv", (void**)&glad_glVertex2iv, (void*)glad_ctx_glVertex2iv, (void*)glad_lazy_glVertex2iv, 10 },
+	{ "glGetQueryBufferObjecti64v", (void**)&glad_glGetQueryBufferObjecti64v, (void*)glad_ctx_glGetQueryBufferObjecti64v, (void*)glad_lazy_glGetQueryBufferObjecti64v, 45 },
+	{ "glColor3sv", (void**)&glad_glColor3sv, (void*)glad_ctx_glColor3sv, (void*)glad_lazy_glColor3sv, 10 },
+	{ "glGetVertexAttribdv", (void**)&glad_glGetVertexAttribdv, (void*)glad_ctx_glGetVertexAttribdv, (void*)glad_lazy_glGetVertexAttribdv, 20 },
+	{ "glActiveShaderProgram", (void**)&glad_glActiveShaderProgram, (void*)glad_ctx_glActiveShaderProgram, (void*)glad_lazy_glActiveShaderProgram, 41 },
+	{ "glUniformMatrix3x4fv", (void**)&glad_glUniformMatrix3x4fv, (void*)glad_ctx_glUniformMatrix3x4fv, (void*)glad_lazy_glUniformMatrix3x4fv, 21 },
+	{ "glUniformMatrix3dv", (void**)&glad_glUniformMatrix3dv, (void*)glad_ctx_glUniformMatrix3dv, (void*)glad_lazy_glUniformMatrix3dv, 40 },
+	{ "glNormalPointer", (void**)&glad_glNormalPointer, (void*)glad_ctx_glNormalPointer, (void*)glad_lazy_glNormalPointer, 11 },
+	{ "glTexCoordP3uiv", (void**)&glad_glTexCoordP3uiv, (void*)glad_ctx_glTexCoordP3uiv, (void*)glad_lazy_glTexCoordP3uiv, 33 },
+	{ "glVertex4sv", (void**)&glad_glVertex4sv, (void*)glad_ctx_glVertex4sv, (void*)glad_lazy_glVertex4sv, 10 },
+	{ "glVertexArrayAttribLFormat", (void**)&glad_glVertexArrayAttribLFormat, (void*)glad_ctx_glVertexArrayAttribLFormat, (void*)glad_lazy_glVertexArrayAttribLFormat, 45 },
+	{ "glInvalidateBufferSubData", (void**)&glad_glInvalidateBufferSubData, (void*)glad_ctx_glInvalidateBufferSubData, (void*)glad_lazy_glInvalidateBufferSubData, 43 },
+	{ "glPassThrough", (void**)&glad_glPassThrough, (void*)glad_ctx_glPassThrough, (void*)glad_lazy_glPassThrough, 10 },
+	{ "glMultiTexCoordP4ui", (void**)&glad_glMultiTexCoordP4ui, (void*)glad_ctx_glMultiTexCoordP4ui, (void*)glad_lazy_glMultiTexCoordP4ui, 33 },
+	{ "glFogi", (void**)&glad_glFogi, (void*)glad_ctx_glFogi, (void*)glad_lazy_glFogi, 10 },
+	{ "glBegin", (void**)&glad_glBegin, (void*)glad_ctx_glBegin, (void*)glad_lazy_glBegin, 10 },
+	{ "glEvalCoord2dv", (void**)&glad_glEvalCoord2dv, (void*)glad_ctx_glEvalCoord2dv, (void*)glad_lazy_glEvalCoord2dv, 10 },
+	{ "glColor3ubv", (void**)&glad_glColor3ubv, (void*)glad_ctx_glColor3ubv, (void*)glad_lazy_glColor3ubv, 10 },
+	{ "glVertexPointer", (void**)&glad_glVertexPointer, (void*)glad_ctx_glVertexPointer, (void*)glad_lazy_glVertexPointer, 11 },
+	{ "glSecondaryColor3uiv", (void**)&glad_glSecondaryColor3uiv, (void*)glad_ctx_glSecondaryColor3uiv, (void*)glad_lazy_glSecondaryColor3uiv, 14 },
+	{ "glDeleteFramebuffers", (void**)&glad_glDeleteFramebuffers, (void*)glad_ctx_glDeleteFramebuffers, (void*)glad_lazy_glDeleteFramebuffers, 30 },
+	{ "glDrawArrays", (void**)&glad_glDrawArrays, (void*)glad_ctx_glDrawArrays, (void*)glad_lazy_glDrawArrays, 11 },
+	{ "glUniform1ui", (void**)&glad_glUniform1ui, (void*)glad_ctx_glUniform1ui, (void*)glad_lazy_glUniform1ui, 30 },
+	{ "glGetTransformFeedbackiv", (void**)&glad_glGetTransformFeedbackiv, (void*)glad_ctx_glGetTransformFeedbackiv, (void*)glad_lazy_glGetTransformFeedbackiv, 45 },
+	{ "glMultiTexCoord1d", (void**)&glad_glMultiTexCoord1d, (void*)glad_ctx_glMultiTexCoord1d, (void*)glad_lazy_glMultiTexCoord1d, 13 },
+	{ "glMultiTexCoord1f", (void**)&glad_glMultiTexCoord1f, (void*)glad_ctx_glMultiTexCoord1f, (void*)glad_lazy_glMultiTexCoord1f, 13 },
+	{ "glProgramParameteri", (void**)&glad_glProgramParameteri, (void*)glad_ctx_glProgramParameteri, (void*)glad_lazy_glProgramParameteri, 41 },
+	{ "glLightfv", (void**)&glad_glLightfv, (void*)glad_ctx_glLightfv, (void*)glad_lazy_glLightfv, 10 },
+	{ "glTexCoordP3ui", (void**)&glad_glTexCoordP3ui, (void*)glad_ctx_glTexCoordP3ui, (void*)glad_lazy_glTexCoordP3ui, 33 },
+	{ "glVertexAttrib3d", (void**)&glad_glVertexAttrib3d, (void*)glad_ctx_glVertexAttrib3d, (void*)glad_lazy_glVertexAttrib3d, 20 },
+	{ "glClear", (void**)&glad_glClear, (void*)glad_ctx_glClear, (void*)glad_lazy_glClear, 10 },
+	{ "glMultiTexCoord1i", (void**)&glad_glMultiTexCoord1i, (void*)glad_ctx_glMultiTexCoord1i, (void*)glad_lazy_glMultiTexCoord1i, 13 },
+	{ "glGetActiveUniformName", (void**)&glad_glGetActiveUniformName, (void*)glad_ctx_glGetActiveUniformName, (void*)glad_lazy_glGetActiveUniformName, 31 },
+	{ "glMemoryBarrier", (void**)&glad_glMemoryBarrier, (void*)glad_ctx_glMemoryBarrier, (void*)glad_lazy_glMemoryBarrier, 42 },
+	{ "glGetGraphicsResetStatus", (void**)&glad_glGetGraphicsResetStatus, (void*)glad_ctx_glGetGraphicsResetStatus, (void*)glad_lazy_glGetGraphicsResetStatus, 45 },
+	{ "glMultiTexCoord1s", (void**)&glad_glMultiTexCoord1s, (void*)glad_ctx_glMultiTexCoord1s, (void*)glad_lazy_glMultiTexCoord1s, 13 },
+	{ "glIsEnabled", (void**)&glad_glIsEnabled, (void*)glad_ctx_glIsEnabled, (void*)glad_lazy_glIsEnabled, 10 },
+	{ "glStencilOp", (void**)&glad_glStencilOp, (void*)glad_ctx_glStencilOp, (void*)glad_lazy_glStencilOp, 10 },
+	{ "glGetQueryObjectuiv", (void**)&glad_glGetQueryObjectuiv, (void*)glad_ctx_glGetQueryObjectuiv, (void*)glad_lazy_glGetQueryObjectuiv, 15 },
+	{ "glFramebufferTexture2D", (void**)&glad_glFramebufferTexture2D, (void*)glad_ctx_glFramebufferTexture2D, (void*)glad_lazy_glFramebufferTexture2D, 30 },
+	{ "glGetFramebufferAttachmentParameteriv", (void**)&glad_glGetFramebufferAttachmentParameteriv, (void*)glad_ctx_glGetFramebufferAttachmentParameteriv, (void*)glad_lazy_glGetFramebufferAttachmentParameteriv, 30 },
+	{ "glTranslatef", (void**)&glad_glTranslatef, (void*)glad_ctx_glTranslatef, (void*)glad_lazy_glTranslatef, 10 },
+	{ "glVertexAttrib4Nub", (void**)&glad_glVertexAttrib4Nub, (void*)glad_ctx_glVertexAttrib4Nub, (void*)glad_lazy_glVertexAttrib4Nub, 20 },
+	{ "glTranslated", (void**)&glad_glTranslated, (void*)glad_ctx_glTranslated, (void*)glad_lazy_glTranslated, 10 },
+	{ "glTexCoord3sv", (void**)&glad_glTexCoord3sv, (void*)glad_ctx_glTexCoord3sv, (void*)glad_lazy_glTexCoord3sv, 10 },
+	{ "glGetFragDataLocation", (void**)&glad_glGetFragDataLocation, (void*)glad_ctx_glGetFragDataLocation, (void*)glad_lazy_glGetFragDataLocation, 30 },
+	{ "glGetTextureParameterIiv", (void**)&glad_glGetTextureParameterIiv, (void*)glad_ctx_glGetTextureParameterIiv, (void*)glad_lazy_glGetTextureParameterIiv, 45 },
+	{ "glTexImage1D", (void**)&glad_glTexImage1D, (void*)glad_ctx_glTexImage1D, (void*)glad_lazy_glTexImage1D, 10 },
+	{ "glCopyTextureSubImage3D", (void**)&glad_glCopyTextureSubImage3D, (void*)glad_ctx_glCopyTextureSubImage3D, (void*)glad_lazy_glCopyTextureSubImage3D, 45 },
+	{ "glVertexP3uiv", (void**)&glad_glVertexP3uiv, (void*)glad_ctx_glVertexP3uiv, (void*)glad_lazy_glVertexP3uiv, 33 },
+	{ "glTexParameteriv", (void**)&glad_glTexParameteriv, (void*)glad_ctx_glTexParameteriv, (void*)glad_lazy_glTexParameteriv, 10 },
+	{ "glVertexArrayAttribIFormat", (void**)&glad_glVertexArrayAttribIFormat, (void*)glad_ctx_glVertexArrayAttribIFormat, (void*)glad_lazy_glVertexArrayAttribIFormat, 45 },
+	{ "glSecondaryColor3bv", (void**)&glad_glSecondaryColor3bv, (void*)glad_ctx_glSecondaryColor3bv, (void*)glad_lazy_glSecondaryColor3bv, 14 },
+	{ "glGetMaterialfv", (void**)&glad_glGetMaterialfv, (void*)glad_ctx_glGetMaterialfv, (void*)glad_lazy_glGetMaterialfv, 10 },
+	{ "glGetTexImage", (void**)&glad_glGetTexImage, (void*)glad_ctx_glGetTexImage, (void*)glad_lazy_glGetTexImage, 10 },
+	{ "glFogCoordfv", (void**)&glad_glFogCoordfv, (void*)glad_ctx_glFogCoordfv, (void*)glad_lazy_glFogCoordfv, 14 },
+	{ "glPixelMapuiv", (void**)&glad_glPixelMapuiv, (void*)glad_ctx_glPixelMapuiv, (void*)glad_lazy_glPixelMapuiv, 10 },
+	{ "glGetShaderInfoLog", (void**)&glad_glGetShaderInfoLog, (void*)glad_ctx_glGetShaderInfoLog, (void*)glad_lazy_glGetShaderInfoLog, 20 },
+	{ "glGetQueryObjecti64v", (void**)&glad_glGetQueryObjecti64v, (void*)glad_ctx_glGetQueryObjecti64v, (void*)glad_lazy_glGetQueryObjecti64v, 33 },
+	{ "glGenFramebuffers", (void**)&glad_glGenFramebuffers, (void*)glad_ctx_glGenFramebuffers, (void*)glad_lazy_glGenFramebuffers, 30 },
+	{ "glCreateTextures", (void**)&glad_glCreateTextures, (void*)glad_ctx_glCreateTextures, (void*)glad_lazy_glCreateTextures, 45 },
+	{ "glTransformFeedbackBufferBase", (void**)&glad_glTransformFeedbackBufferBase, (void*)glad_ctx_glTransformFeedbackBufferBase, (void*)glad_lazy_glTransformFeedbackBufferBase, 45 },
+	{ "glIndexsv", (void**)&glad_glIndexsv, (void*)glad_ctx_glIndexsv, (void*)glad_lazy_glIndexsv, 10 },
+	{ "glClearTexSubImage", (void**)&glad_glClearTexSubImage, (void*)glad_ctx_glClearTexSubImage, (void*)glad_lazy_glClearTexSubImage, 44 },
+	{ "glProgramUniformMatrix3x4dv", (void**)&glad_glProgramUniformMatrix3x4dv, (void*)glad_ctx_glProgramUniformMatrix3x4dv, (void*)glad_lazy_glProgramUniformMatrix3x4dv, 41 },
+	{ "glGetAttachedShaders", (void**)&glad_glGetAttachedShaders, (void*)glad_ctx_glGetAttachedShaders, (void*)glad_lazy_glGetAttachedShaders, 20 },
+	{ "glIsRenderbuffer", (void**)&glad_glIsRenderbuffer, (void*)glad_ctx_glIsRenderbuffer, (void*)glad_lazy_glIsRenderbuffer, 30 },
+	{ "glVertex3iv", (void**)&glad_glVertex3iv, (void*)glad_ctx_glVertex3iv, (void*)glad_lazy_glVertex3iv, 10 },
+	{ "glBitmap", (void**)&glad_glBitmap, (void*)glad_ctx_glBitmap, (void*)glad_lazy_glBitmap, 10 },
+	{ "glGetDebugMessageLog", (void**)&glad_glGetDebugMessageLog, (void*)glad_ctx_glGetDebugMessageLog, (void*)glad_lazy_glGetDebugMessageLog, 43 },
+	{ "glProgramUniform1uiv", (void**)&glad_glProgramUniform1uiv, (void*)glad_ctx_glProgramUniform1uiv, (void*)glad_lazy_glProgramUniform1uiv, 41 },
+	{ "glMateriali", (void**)&glad_glMateriali, (void*)glad_ctx_glMateriali, (void*)glad_lazy_glMateriali, 10 },
+	{ "glIsVertexArray", (void**)&glad_glIsVertexArray, (void*)glad_ctx_glIsVertexArray, (void*)glad_lazy_glIsVertexArray, 30 },
+	{ "glDisableVertexAttribArray", (void**)&glad_glDisableVertexAttribArray, (void*)glad_ctx_glDisableVertexAttribArray, (void*)glad_lazy_glDisableVertexAttribArray, 20 },
+	{ "glProgramUniform2iv", (void**)&glad_glProgramUniform2iv, (void*)glad_ctx_glProgramUniform2iv, (void*)glad_lazy_glProgramUniform2iv, 41 },
+	{ "glGetQueryiv", (void**)&glad_glGetQueryiv, (void*)glad_ctx_glGetQueryiv, (void*)glad_lazy_glGetQueryiv, 15 },
+	{ "glTexCoord4f", (void**)&glad_glTexCoord4f, (void*)glad_ctx_glTexCoord4f, (void*)glad_lazy_glTexCoord4f, 10 },
+	{ "glBlitNamedFramebuffer", (void**)&glad_glBlitNamedFramebuffer, (void*)glad_ctx_glBlitNamedFramebuffer, (void*)glad_lazy_glBlitNamedFramebuffer, 45 },
+	{ "glTexCoord4d", (void**)&glad_glTexCoord4d, (void*)glad_ctx_glTexCoord4d, (void*)glad_lazy_glTexCoord4d, 10 },
+	{ "glCreateQueries", (void**)&glad_glCreateQueries, (void*)glad_ctx_glCreateQueries, (void*)glad_lazy_glCreateQueries, 45 },
+	{ "glGetSamplerParameterfv", (void**)&glad_glGetSamplerParameterfv, (void*)glad_ctx_glGetSamplerParameterfv, (void*)glad_lazy_glGetSamplerParameterfv, 33 },
+	{ "glTexCoord4i", (void**)&glad_glTexCoord4i, (void*)glad_ctx_glTexCoord4i, (void*)glad_lazy_glTexCoord4i, 10 },
+	{ "glShaderStorageBlockBinding", (void**)&glad_glShaderStorageBlockBinding, (void*)glad_ctx_glShaderStorageBlockBinding, (void*)glad_lazy_glShaderStorageBlockBinding, 43 },
+	{ "glMaterialf", (void**)&glad_glMaterialf, (void*)glad_ctx_glMaterialf, (void*)glad_lazy_glMaterialf, 10 },
+	{ "glTexCoord4s", (void**)&glad_glTexCoord4s, (void*)glad_ctx_glTexCoord4s, (void*)glad_lazy_glTexCoord4s, 10 },
+	{ "glProgramUniformMatrix4x2dv", (void**)&glad_glProgramUniformMatrix4x2dv, (void*)glad_ctx_glProgramUniformMatrix4x2dv, (void*)glad_lazy_glProgramUniformMatrix4x2dv, 41 },
+	{ "glGetUniformIndices", (void**)&glad_glGetUniformIndices, (void*)glad_ctx_glGetUniformIndices, (void*)glad_lazy_glGetUniformIndices, 31 },
+	{ "glIsShader", (void**)&glad_glIsShader, (void*)glad_ctx_glIsShader, (void*)glad_lazy_glIsShader, 20 },
+	{ "glMultiTexCoord2s", (void**)&glad_glMultiTexCoord2s, (void*)glad_ctx_glMultiTexCoord2s, (void*)glad_lazy_glMultiTexCoord2s, 13 },
+	{ "glVertexAttribI4ubv", (void**)&glad_glVertexAttribI4ubv, (void*)glad_ctx_glVertexAttribI4ubv, (void*)glad_lazy_glVertexAttribI4ubv, 30 },
+	{ "glVertex3dv", (void**)&glad_glVertex3dv, (void*)glad_ctx_glVertex3dv, (void*)glad_lazy_glVertex3dv, 10 },
+	{ "glGetInteger64v", (void**)&glad_glGetInteger64v, (void*)glad_ctx_glGetInteger64v, (void*)glad_lazy_glGetInteger64v, 32 },
+	{ "glPointParameteriv", (void**)&glad_glPointParameteriv, (void*)glad_ctx_glPointParameteriv, (void*)glad_lazy_glPointParameteriv, 14 },
+	{ "glGetnMinmax", (void**)&glad_glGetnMinmax, (void*)glad_ctx_glGetnMinmax, (void*)glad_lazy_glGetnMinmax, 45 },
+	{ "glEnable", (void**)&glad_glEnable, (void*)glad_ctx_glEnable, (void*)glad_lazy_glEnable, 10 },
+	{ "glGetActiveUniformsiv", (void**)&glad_glGetActiveUniformsiv, (void*)glad_ctx_glGetActiveUniformsiv, (void*)glad_lazy_glGetActiveUniformsiv, 31 },
+	{ "glColor4fv", (void**)&glad_glColor4fv, (void*)glad_ctx_glColor4fv, (void*)glad_lazy_glColor4fv, 10 },
+	{ "glTexCoord1fv", (void**)&glad_glTexCoord1fv, (void*)glad_ctx_glTexCoord1fv, (void*)glad_lazy_glTexCoord1fv, 10 },
+	{ "glVertexArrayAttribBinding", (void**)&glad_glVertexArrayAttribBinding, (void*)glad_ctx_glVertexArrayAttribBinding, (void*)glad_lazy_glVertexArrayAttribBinding, 45 },
+	{ "glTextureStorage1D", (void**)&glad_glTextureStorage1D, (void*)glad_ctx_glTextureStorage1D, (void*)glad_lazy_glTextureStorage1D, 45 },
+	{ "glPopDebugGroup", (void**)&glad_glPopDebugGroup, (void*)glad_ctx_glPopDebugGroup, (void*)glad_lazy_glPopDebugGroup, 43 },
+	{ "glBlendEquationi", (void**)&glad_glBlendEquationi, (void*)glad_ctx_glBlendEquationi, (void*)glad_lazy_glBlendEquationi, 40 },
+	{ "glTexCoord2sv", (void**)&glad_glTexCoord2sv, (void*)glad_ctx_glTexCoord2sv, (void*)glad_lazy_glTexCoord2sv, 10 },
+	{ "glVertexAttrib4dv", (void**)&glad_glVertexAttrib4dv, (void*)glad_ctx_glVertexAttrib4dv, (void*)glad_lazy_glVertexAttrib4dv, 20 },
+	{ "glMultiTexCoord1dv", (void**)&glad_glMultiTexCoord1dv, (void*)glad_ctx_glMultiTexCoord1dv, (void*)glad_lazy_glMultiTexCoord1dv, 13 },
+	{ "glGetProgramInterfaceiv", (void**)&glad_glGetProgramInterfaceiv, (void*)glad_ctx_glGetProgramInterfaceiv, (void*)glad_lazy_glGetProgramInterfaceiv, 43 },
+	{ "glMultiTexCoord2i", (void**)&glad_glMultiTexCoord2i, (void*)glad_ctx_glMultiTexCoord2i, (void*)glad_lazy_glMultiTexCoord2i, 13 },
+	{ "glTexCoord3fv", (void**)&glad_glTexCoord3fv, (void*)glad_ctx_glTexCoord3fv, (void*)glad_lazy_glTexCoord3fv, 10 },
+	{ "glSecondaryColor3usv", (void**)&glad_glSecondaryColor3usv, (void*)glad_ctx_glSecondaryColor3usv, (void*)glad_lazy_glSecondaryColor3usv, 14 },
+	{ "glTexGenf", (void**)&glad_glTexGenf, (void*)glad_ctx_glTexGenf, (void*)glad_lazy_glTexGenf, 10 },
+	{ "glMapNamedBuffer", (void**)&glad_glMapNamedBuffer, (void*)glad_ctx_glMapNamedBuffer, (void*)glad_lazy_glMapNamedBuffer, 45 },
+	{ "glMultiTexCoordP3uiv", (void**)&glad_glMultiTexCoordP3uiv, (void*)glad_ctx_glMultiTexCoordP3uiv, (void*)glad_lazy_glMultiTexCoordP3uiv, 33 },
+	{ "glVertexAttribP3ui", (void**)&glad_glVertexAttribP3ui, (void*)glad_ctx_glVertexAttribP3ui, (void*)glad_lazy_glVertexAttribP3ui, 33 },
+	{ "glVertexAttribL1dv", (void**)&glad_glVertexAttribL1dv, (void*)glad_ctx_glVertexAttribL1dv, (void*)glad_lazy_glVertexAttribL1dv, 41 },
+	{ "glTextureBufferRange", (void**)&glad_glTextureBufferRange, (void*)glad_ctx_glTextureBufferRange, (void*)glad_lazy_glTextureBufferRange, 45 },
+	{ "glGetnUniformdv", (void**)&glad_glGetnUniformdv, (void*)glad_ctx_glGetnUniformdv, (void*)glad_lazy_glGetnUniformdv, 45 },
+	{ "glMultiTexCoordP1ui", (void**)&glad_glMultiTexCoordP1ui, (void*)glad_ctx_glMultiTexCoordP1ui, (void*)glad_lazy_glMultiTexCoordP1ui, 33 },
+	{ "glProgramUniform3ui", (void**)&glad_glProgramUniform3ui, (void*)glad_ctx_glProgramUniform3ui, (void*)glad_lazy_glProgramUniform3ui, 41 },
+	{ "glTransformFeedbackBufferRange", (void**)&glad_glTransformFeedbackBufferRange, (void*)glad_ctx_glTransformFeedbackBufferRange, (void*)glad_lazy_glTransformFeedbackBufferRange, 45 },
+	{ "glGetPointerv", (void**)&glad_glGetPointerv, (void*)glad_ctx_glGetPointerv, (void*)glad_lazy_glGetPointerv, 11 },
+	{ "glVertexBindingDivisor", (void**)&glad_glVertexBindingDivisor, (void*)glad_ctx_glVertexBindingDivisor, (void*)glad_lazy_glVertexBindingDivisor, 43 },
+	{ "glPolygonOffset", (void**)&glad_glPolygonOffset, (void*)glad_ctx_glPolygonOffset, (void*)glad_lazy_glPolygonOffset, 11 },
+	{ "glGetUniformuiv", (void**)&glad_glGetUniformuiv, (void*)glad_ctx_glGetUniformuiv, (void*)glad_lazy_glGetUniformuiv, 30 },
+	{ "glNormal3fv", (void**)&glad_glNormal3fv, (void*)glad_ctx_glNormal3fv, (void*)glad_lazy_glNormal3fv, 10 },
+	{ "glSecondaryColor3s", (void**)&glad_glSecondaryColor3s, (void*)glad_ctx_glSecondaryColor3s, (void*)glad_lazy_glSecondaryColor3s, 14 },
+	{ "glNamedFramebufferDrawBuffers", (void**)&glad_glNamedFramebufferDrawBuffers, (void*)glad_ctx_glNamedFramebufferDrawBuffers, (void*)glad_lazy_glNamedFramebufferDrawBuffers, 45 },
+	{ "glDepthRange", (void**)&glad_glDepthRange, (void*)glad_ctx_glDepthRange, (void*)glad_lazy_glDepthRange, 10 },
+	{ "glFrustum", (void**)&glad_glFrustum, (void*)glad_ctx_glFrustum, (void*)glad_lazy_glFrustum, 10 },
+	{ "glMultiTexCoord4sv", (void**)&glad_glMultiTexCoord4sv, (void*)glad_ctx_glMultiTexCoord4sv, (void*)glad_lazy_glMultiTexCoord4sv, 13 },
+	{ "glVertexArrayBindingDivisor", (void**)&glad_glVertexArrayBindingDivisor, (void*)glad_ctx_glVertexArrayBindingDivisor, (void*)glad_lazy_glVertexArrayBindingDivisor, 45 },
+	{ "glDrawBuffer", (void**)&glad_glDrawBuffer, (void*)glad_ctx_glDrawBuffer, (void*)glad_lazy_glDrawBuffer, 10 },
+	{ "glPushMatrix", (void**)&glad_glPushMatrix, (void*)glad_ctx_glPushMatrix, (void*)glad_lazy_glPushMatrix, 10 },
+	{ "glGetnPixelMapusv", (void**)&glad_glGetnPixelMapusv, (void*)glad_ctx_glGetnPixelMapusv, (void*)glad_lazy_glGetnPixelMapusv, 45 },
+	{ "glRasterPos3fv", (void**)&glad_glRasterPos3fv, (void*)glad_ctx_glRasterPos3fv, (void*)glad_lazy_glRasterPos3fv, 10 },
+	{ "glOrtho", (void**)&glad_glOrtho, (void*)glad_ctx_glOrtho, (void*)glad_lazy_glOrtho, 10 },
+	{ "glDrawElementsInstanced", (void**)&glad_glDrawElementsInstanced, (void*)glad_ctx_glDrawElementsInstanced, (void*)glad_lazy_glDrawElementsInstanced, 31 },
+	{ "glWindowPos3sv", (void**)&glad_glWindowPos3sv, (void*)glad_ctx_glWindowPos3sv, (void*)glad_lazy_glWindowPos3sv, 14 },
+	{ "glVertexAttribL4dv", (void**)&glad_glVertexAttribL4dv, (void*)glad_ctx_glVertexAttribL4dv, (void*)glad_lazy_glVertexAttribL4dv, 41 },
+	{ "glProgramUniform1i", (void**)&glad_glProgramUniform1i, (void*)glad_ctx_glProgramUniform1i, (void*)glad_lazy_glProgramUniform1i, 41 },
+	{ "glUniform2dv", (void**)&glad_glUniform2dv, (void*)glad_ctx_glUniform2dv, (void*)glad_lazy_glUniform2dv, 40 },
+	{ "glProgramUniform1d", (void**)&glad_glProgramUniform1d, (void*)glad_ctx_glProgramUniform1d, (void*)glad_lazy_glProgramUniform1d, 41 },
+	{ "glProgramUniform1f", (void**)&glad_glProgramUniform1f, (void*)glad_ctx_glProgramUniform1f, (void*)glad_lazy_glProgramUniform1f, 41 },
+	{ "glClearIndex", (void**)&glad_glClearIndex, (void*)glad_ctx_glClearIndex, (void*)glad_lazy_glClearIndex, 10 },
+	{ "glMap1d", (void**)&glad_glMap1d, (void*)glad_ctx_glMap1d, (void*)glad_lazy_glMap1d, 10 },
+	{ "glMap1f", (void**)&glad_glMap1f, (void*)glad_ctx_glMap1f, (void*)glad_lazy_glMap1f, 10 },
+	{ "glFlush", (void**)&glad_glFlush, (void*)glad_ctx_glFlush, (void*)glad_lazy_glFlush, 10 },
+	{ "glGetRenderbufferParameteriv", (void**)&glad_glGetRenderbufferParameteriv, (void*)glad_ctx_glGetRenderbufferParameteriv, (void*)glad_lazy_glGetRenderbufferParameteriv, 30 },
+	{ "glBeginQueryIndexed", (void**)&glad_glBeginQueryIndexed, (void*)glad_ctx_glBeginQueryIndexed, (void*)glad_lazy_glBeginQueryIndexed, 40 },
+	{ "glProgramUniform3iv", (void**)&glad_glProgramUniform3iv, (void*)glad_ctx_glProgramUniform3iv, (void*)glad_lazy_glProgramUniform3iv, 41 },
+	{ "glIndexiv", (void**)&glad_glIndexiv, (void*)glad_ctx_glIndexiv, (void*)glad_lazy_glIndexiv, 10 },
+	{ "glNamedRenderbufferStorage", (void**)&glad_glNamedRenderbufferStorage, (void*)glad_ctx_glNamedRenderbufferStorage, (void*)glad_lazy_glNamedRenderbufferStorage, 45 },
+	{ "glRasterPos3sv", (void**)&glad_glRasterPos3sv, (void*)glad_ctx_glRasterPos3sv, (void*)glad_lazy_glRasterPos3sv, 10 },
+	{ "glGetVertexAttribPointerv", (void**)&glad_glGetVertexAttribPointerv, (void*)glad_ctx_glGetVertexAttribPointerv, (void*)glad_lazy_glGetVertexAttribPointerv, 20 },
+	{ "glPixelZoom", (void**)&glad_glPixelZoom, (void*)glad_ctx_glPixelZoom, (void*)glad_lazy_glPixelZoom, 10 },
+	{ "glPolygonOffsetClamp", (void**)&glad_glPolygonOffsetClamp, (void*)glad_ctx_glPolygonOffsetClamp, (void*)glad_lazy_glPolygonOffsetClamp, 46 },
+	{ "glFenceSync", (void**)&glad_glFenceSync, (void*)glad_ctx_glFenceSync, (void*)glad_lazy_glFenceSync, 32 },
+	{ "glDeleteVertexArrays", (void**)&glad_glDeleteVertexArrays, (void*)glad_ctx_glDeleteVertexArrays, (void*)glad_lazy_glDeleteVertexArrays, 30 },
+	{ "glColorP3ui", (void**)&glad_glColorP3ui, (void*)glad_ctx_glColorP3ui, (void*)glad_lazy_glColorP3ui, 33 },
+	{ "glDrawElementsInstancedBaseVertexBaseInstance", (void**)&glad_glDrawElementsInstancedBaseVertexBaseInstance, (void*)glad_ctx_glDrawElementsInstancedBaseVertexBaseInstance, (void*)glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance, 42 },
+	{ "glTextureStorage2DMultisample", (void**)&glad_glTextureStorage2DMultisample, (void*)glad_ctx_glTextureStorage2DMultisample, (void*)glad_lazy_glTextureStorage2DMultisample, 45 },
+	{ "glVertexAttrib3sv", (void**)&glad_glVertexAttrib3sv, (void*)glad_ctx_glVertexAttrib3sv, (void*)glad_lazy_glVertexAttrib3sv, 20 },
+	{ "glBeginConditionalRender", (void**)&glad_glBeginConditionalRender, (void*)glad_ctx_glBeginConditionalRender, (void*)glad_lazy_glBeginConditionalRender, 30 },
+	{ "glPushDebugGroup", (void**)&glad_glPushDebugGroup, (void*)glad_ctx_glPushDebugGroup, (void*)glad_lazy_glPushDebugGroup, 43 },
+	{ "glGetShaderPrecisionFormat", (void**)&glad_glGetShaderPrecisionFormat, (void*)glad_ctx_glGetShaderPrecisionFormat, (void*)glad_lazy_glGetShaderPrecisionFormat, 41 },
+	{ "glValidateProgramPipeline", (void**)&glad_glValidateProgramPipeline, (void*)glad_ctx_glValidateProgramPipeline, (void*)glad_lazy_glValidateProgramPipeline, 41 },
+	{ "glDrawElementsBaseVertex", (void**)&glad_glDrawElementsBaseVertex, (void*)glad_ctx_glDrawElementsBaseVertex, (void*)glad_lazy_glDrawElementsBaseVertex, 32 },
+	{ "glGetTexLevelParameteriv", (void**)&glad_glGetTexLevelParameteriv, (void*)glad_ctx_glGetTexLevelParameteriv, (void*)glad_lazy_glGetTexLevelParameteriv, 10 },
+	{ "glLighti", (void**)&glad_glLighti, (void*)glad_ctx_glLighti, (void*)glad_lazy_glLighti, 10 },
+	{ "glMultiTexCoordP4uiv", (void**)&glad_glMultiTexCoordP4uiv, (void*)glad_ctx_glMultiTexCoordP4uiv, (void*)glad_lazy_glMultiTexCoordP4uiv, 33 },
+	{ "glVertexArrayVertexBuffer", (void**)&glad_glVertexArrayVertexBuffer, (void*)glad_ctx_glVertexArrayVertexBuffer, (void*)glad_lazy_glVertexArrayVertexBuffer, 45 },
+	{ "glLightf", (void**)&glad_glLightf, (void*)glad_ctx_glLightf, (void*)glad_lazy_glLightf, 10 },
+	{ "glBindVertexBuffers", (void**)&glad_glBindVertexBuffers, (void*)glad_ctx_glBindVertexBuffers, (void*)glad_lazy_glBindVertexBuffers, 44 },
+	{ "glGetAttribLocation", (void**)&glad_glGetAttribLocation, (void*)glad_ctx_glGetAttribLocation, (void*)glad_lazy_glGetAttribLocation, 20 },
+	{ "glTexStorage3DMultisample", (void**)&glad_glTexStorage3DMultisample, (void*)glad_ctx_glTexStorage3DMultisample, (void*)glad_lazy_glTexStorage3DMultisample, 43 },
+	{ "glStencilFuncSeparate", (void**)&glad_glStencilFuncSeparate, (void*)glad_ctx_glStencilFuncSeparate, (void*)glad_lazy_glStencilFuncSeparate, 20 },
+	{ "glDisableVertexArrayAttrib", (void**)&glad_glDisableVertexArrayAttrib, (void*)glad_ctx_glDisableVertexArrayAttrib, (void*)glad_lazy_glDisableVertexArrayAttrib, 45 },
+	{ "glGenSamplers", (void**)&glad_glGenSamplers, (void*)glad_ctx_glGenSamplers, (void*)glad_lazy_glGenSamplers, 33 },
+	{ "glClampColor", (void**)&glad_glClampColor, (void*)glad_ctx_glClampColor, (void*)glad_lazy_glClampColor, 30 },
+	{ "glUniform4iv", (void**)&glad_glUniform4iv, (void*)glad_ctx_glUniform4iv, (void*)glad_lazy_glUniform4iv, 20 },
+	{ "glClearStencil", (void**)&glad_glClearStencil, (void*)glad_ctx_glClearStencil, (void*)glad_lazy_glClearStencil, 10 },
+	{ "glTexCoordP1uiv", (void**)&glad_glTexCoordP1uiv, (void*)glad_ctx_glTexCoordP1uiv, (void*)glad_lazy_glTexCoordP1uiv, 33 },
+	{ "glGetNamedRenderbufferParameteriv", (void**)&glad_glGetNamedRenderbufferParameteriv, (void*)glad_ctx_glGetNamedRenderbufferParameteriv, (void*)glad_lazy_glGetNamedRenderbufferParameteriv, 45 },
+	{ "glDrawTransformFeedbackInstanced", (void**)&glad_glDrawTransformFeedbackInstanced, (void*)glad_ctx_glDrawTransformFeedbackInstanced, (void*)glad_lazy_glDrawTransformFeedbackInstanced, 42 },
+	{ "glSpecializeShader", (void**)&glad_glSpecializeShader, (void*)glad_ctx_glSpecializeShader, (void*)glad_lazy_glSpecializeShader, 46 },
+	{ "glMultiTexCoord3fv", (void**)&glad_glMultiTexCoord3fv, (void*)glad_ctx_glMultiTexCoord3fv, (void*)glad_lazy_glMultiTexCoord3fv, 13 },
+	{ "glGetPixelMapuiv", (void**)&glad_glGetPixelMapuiv, (void*)glad_ctx_glGetPixelMapuiv, (void*)glad_lazy_glGetPixelMapuiv, 10 },
+	{ "glGenTextures", (void**)&glad_glGenTextures, (void*)glad_ctx_glGenTextures, (void*)glad_lazy_glGenTextures, 11 },
+	{ "glTexCoord4iv", (void**)&glad_glTexCoord4iv, (void*)glad_ctx_glTexCoord4iv, (void*)glad_lazy_glTexCoord4iv, 10 },
+	{ "glDrawTransformFeedback", (void**)&glad_glDrawTransformFeedback, (void*)glad_ctx_glDrawTransformFeedback, (void*)glad_lazy_glDrawTransformFeedback, 40 },
+	{ "glUniform1dv", (void**)&glad_glUniform1dv, (void*)glad_ctx_glUniform1dv, (void*)glad_lazy_glUniform1dv, 40 },
+	{ "glGetTexParameterIuiv", (void**)&glad_glGetTexParameterIuiv, (void*)glad_ctx_glGetTexParameterIuiv, (void*)glad_lazy_glGetTexParameterIuiv, 30 },
+	{ "glGetTransformFeedbacki_v", (void**)&glad_glGetTransformFeedbacki_v, (void*)glad_ctx_glGetTransformFeedbacki_v, (void*)glad_lazy_glGetTransformFeedbacki_v, 45 },
+	{ "glIndexPointer", (void**)&glad_glIndexPointer, (void*)glad_ctx_glIndexPointer, (void*)glad_lazy_glIndexPointer, 11 },
+	{ "glGetnPolygonStipple", (void**)&glad_glGetnPolygonStipple, (void*)glad_ctx_glGetnPolygonStipple, (void*)glad_lazy_glGetnPolygonStipple, 45 },
+	{ "glVertexAttrib4Nbv", (void**)&glad_glVertexAttrib4Nbv, (void*)glad_ctx_glVertexAttrib4Nbv, (void*)glad_lazy_glVertexAttrib4Nbv, 20 },
+	{ "glClearNamedFramebufferuiv", (void**)&glad_glClearNamedFramebufferuiv, (void*)glad_ctx_glClearNamedFramebufferuiv, (void*)glad_lazy_glClearNamedFramebufferuiv, 45 },
+	{ "glGetVertexArrayIndexediv", (void**)&glad_glGetVertexArrayIndexediv, (void*)glad_ctx_glGetVertexArrayIndexediv, (void*)glad_lazy_glGetVertexArrayIndexediv, 45 },
+	{ "glIsSync", (void**)&glad_glIsSync, (void*)glad_ctx_glIsSync, (void*)glad_lazy_glIsSync, 32 },
+	{ "glVertex2f", (void**)&glad_glVertex2f, (void*)glad_ctx_glVertex2f, (void*)glad_lazy_glVertex2f, 10 },
+	{ "glVertex2d", (void**)&glad_glVertex2d, (void*)glad_ctx_glVertex2d, (void*)glad_lazy_glVertex2d, 10 },
+	{ "glDeleteRenderbuffers", (void**)&glad_glDeleteRenderbuffers, (void*)glad_ctx_glDeleteRenderbuffers, (void*)glad_lazy_glDeleteRenderbuffers, 30 },
+	{ "glUniform2i", (void**)&glad_glUniform2i, (void*)glad_ctx_glUniform2i, (void*)glad_lazy_glUniform2i, 20 },
+	{ "glMapGrid2d", (void**)&glad_glMapGrid2d, (void*)glad_ctx_glMapGrid2d, (void*)glad_lazy_glMapGrid2d, 10 },
+	{ "glMapGrid2f", (void**)&glad_glMapGrid2f, (void*)glad_ctx_glMapGrid2f, (void*)glad_lazy_glMapGrid2f, 10 },
+	{ "glTexCoordP4ui", (void**)&glad_glTexCoordP4ui, (void*)glad_ctx_glTexCoordP4ui, (void*)glad_lazy_glTexCoordP4ui, 33 },
+	{ "glVertex2i", (void**)&glad_glVertex2i, (void*)glad_ctx_glVertex2i, (void*)glad_lazy_glVertex2i, 10 },
+	{ "glVertexAttribPointer", (void**)&glad_glVertexAttribPointer, (void*)glad_ctx_glVertexAttribPointer, (void*)glad_lazy_glVertexAttribPointer, 20 },
+	{ "glProgramUniform1ui", (void**)&glad_glProgramUniform1ui, (void*)glad_ctx_glProgramUniform1ui, (void*)glad_lazy_glProgramUniform1ui, 41 },
+	{ "glFramebufferTextureLayer", (void**)&glad_glFramebufferTextureLayer, (void*)glad_ctx_glFramebufferTextureLayer, (void*)glad_lazy_glFramebufferTextureLayer, 30 },
+	{ "glVertex2s", (void**)&glad_glVertex2s, (void*)glad_ctx_glVertex2s, (void*)glad_lazy_glVertex2s, 10 },
+	{ "glGetObjectPtrLabel", (void**)&glad_glGetObjectPtrLabel, (void*)glad_ctx_glGetObjectPtrLabel, (void*)glad_lazy_glGetObjectPtrLabel, 43 },
+	{ "glTextureParameteri", (void**)&glad_glTextureParameteri, (void*)glad_ctx_glTextureParameteri, (void*)glad_lazy_glTextureParameteri, 45 },
+	{ "glNormal3bv", (void**)&glad_glNormal3bv, (void*)glad_ctx_glNormal3bv, (void*)glad_lazy_glNormal3bv, 10 },
+	{ "glVertexAttrib4Nuiv", (void**)&glad_glVertexAttrib4Nuiv, (void*)glad_ctx_glVertexAttrib4Nuiv, (void*)glad_lazy_glVertexAttrib4Nuiv, 20 },
+	{ "glFlushMappedBufferRange", (void**)&glad_glFlushMappedBufferRange, (void*)glad_ctx_glFlushMappedBufferRange, (void*)glad_lazy_glFlushMappedBufferRange, 30 },
+	{ "glProgramUniform2fv", (void**)&glad_glProgramUniform2fv, (void*)glad_ctx_glProgramUniform2fv, (void*)glad_lazy_glProgramUniform2fv, 41 },
+	{ "glUniformMatrix2x3dv", (void**)&glad_glUniformMatrix2x3dv, (void*)glad_ctx_glUniformMatrix2x3dv, (void*)glad_lazy_glUniformMatrix2x3dv, 40 },
+	{ "glProgramUniformMatrix4dv", (void**)&glad_glProgramUniformMatrix4dv, (void*)glad_ctx_glProgramUniformMatrix4dv, (void*)glad_lazy_glProgramUniformMatrix4dv, 41 },
+	{ "glSecondaryColor3sv", (void**)&glad_glSecondaryColor3sv, (void*)glad_ctx_glSecondaryColor3sv, (void*)glad_lazy_glSecondaryColor3sv, 14 },
+	{ "glProgramUniformMatrix2x4dv", (void**)&glad_glProgramUniformMatrix2x4dv, (void*)glad_ctx_glProgramUniformMatrix2x4dv, (void*)glad_lazy_glProgramUniformMatrix2x4dv, 41 },
+	{ "glDispatchCompute", (void**)&glad_glDispatchCompute, (void*)glad_ctx_glDispatchCompute, (void*)glad_lazy_glDispatchCompute, 43 },
+	{ "glVertex3sv", (void**)&glad_glVertex3sv, (void*)glad_ctx_glVertex3sv, (void*)glad_lazy_glVertex3sv, 10 },
+	{ "glGenQueries", (void**)&glad_glGenQueries, (void*)glad_ctx_glGenQueries, (void*)glad_lazy_glGenQueries, 15 },
+	{ "glGetPixelMapfv", (void**)&glad_glGetPixelMapfv, (void*)glad_ctx_glGetPixelMapfv, (void*)glad_lazy_glGetPixelMapfv, 10 },
+	{ "glTexEnvf", (void**)&glad_glTexEnvf, (void*)glad_ctx_glTexEnvf, (void*)glad_lazy_glTexEnvf, 10 },
+	{ "glVertexAttribP1ui", (void**)&glad_glVertexAttribP1ui, (void*)glad_ctx_glVertexAttribP1ui, (void*)glad_lazy_glVertexAttribP1ui, 33 },
+	{ "glTexSubImage3D", (void**)&glad_glTexSubImage3D, (void*)glad_ctx_glTexSubImage3D, (void*)glad_lazy_glTexSubImage3D, 12 },
+	{ "glGetInteger64i_v", (void**)&glad_glGetInteger64i_v, (void*)glad_ctx_glGetInteger64i_v, (void*)glad_lazy_glGetInteger64i_v, 32 },
+	{ "glFogCoordd", (void**)&glad_glFogCoordd, (void*)glad_ctx_glFogCoordd, (void*)glad_lazy_glFogCoordd, 14 },
+	{ "glFogCoordf", (void**)&glad_glFogCoordf, (void*)glad_ctx_glFogCoordf, (void*)glad_lazy_glFogCoordf, 14 },
+	{ "glCopyTexImage2D", (void**)&glad_glCopyTexImage2D, (void*)glad_ctx_glCopyTexImage2D, (void*)glad_lazy_glCopyTexImage2D, 11 },
+	{ "glTexEnvi", (void**)&glad_glTexEnvi, (void*)glad_ctx_glTexEnvi, (void*)glad_lazy_glTexEnvi, 10 },
+	{ "glMultiTexCoord1iv", (void**)&glad_glMultiTexCoord1iv, (void*)glad_ctx_glMultiTexCoord1iv, (void*)glad_lazy_glMultiTexCoord1iv, 13 },
+	{ "glIsEnabledi", (void**)&glad_glIsEnabledi, (void*)glad_ctx_glIsEnabledi, (void*)glad_lazy_glIsEnabledi, 30 },
+	{ "glBindBuffersRange", (void**)&glad_glBindBuffersRange, (void*)glad_ctx_glBindBuffersRange, (void*)glad_lazy_glBindBuffersRange, 44 },
+	{ "glSecondaryColorP3ui", (void**)&glad_glSecondaryColorP3ui, (void*)glad_ctx_glSecondaryColorP3ui, (void*)glad_lazy_glSecondaryColorP3ui, 33 },
+	{ "glVertexAttribI2i", (void**)&glad_glVertexAttribI2i, (void*)glad_ctx_glVertexAttribI2i, (void*)glad_lazy_glVertexAttribI2i, 30 },
+	{ "glBindFragDataLocationIndexed", (void**)&glad_glBindFragDataLocationIndexed, (void*)glad_ctx_glBindFragDataLocationIndexed, (void*)glad_lazy_glBindFragDataLocationIndexed, 33 },
+	{ "glCopyImageSubData", (void**)&glad_glCopyImageSubData, (void*)glad_ctx_glCopyImageSubData, (void*)glad_lazy_glCopyImageSubData, 43 },
+	{ "glMultiTexCoord2dv", (void**)&glad_glMultiTexCoord2dv, (void*)glad_ctx_glMultiTexCoord2dv, (void*)glad_lazy_glMultiTexCoord2dv, 13 },
+	{ "glUniform2iv", (void**)&glad_glUniform2iv, (void*)glad_ctx_glUniform2iv, (void*)glad_lazy_glUniform2iv, 20 },
+	{ "glVertexAttrib1fv", (void**)&glad_glVertexAttrib1fv, (void*)glad_ctx_glVertexAttrib1fv, (void*)glad_lazy_glVertexAttrib1fv, 20 },
+	{ "glGetInternalformativ", (void**)&glad_glGetInternalformativ, (void*)glad_ctx_glGetInternalformativ, (void*)glad_lazy_glGetInternalformativ, 42 },
+	{ "glUniform4uiv", (void**)&glad_glUniform4uiv, (void*)glad_ctx_glUniform4uiv, (void*)glad_lazy_glUniform4uiv, 30 },
+	{ "glMatrixMode", (void**)&glad_glMatrixMode, (void*)glad_ctx_glMatrixMode, (void*)glad_lazy_glMatrixMode, 10 },
+	{ "glGetTextureImage", (void**)&glad_glGetTextureImage, (void*)glad_ctx_glGetTextureImage, (void*)glad_lazy_glGetTextureImage, 45 },
+	{ "glFeedbackBuffer", (void**)&glad_glFeedbackBuffer, (void*)glad_ctx_glFeedbackBuffer, (void*)glad_lazy_glFeedbackBuffer, 10 },
+	{ "glProgramUniform2dv", (void**)&glad_glProgramUniform2dv, (void*)glad_ctx_glProgramUniform2dv, (void*)glad_lazy_glProgramUniform2dv, 41 },
+	{ "glEndQueryIndexed", (void**)&glad_glEndQueryIndexed, (void*)glad_ctx_glEndQueryIndexed, (void*)glad_lazy_glEndQueryIndexed, 40 },
+	{ "glGetMapiv", (void**)&glad_glGetMapiv, (void*)glad_ctx_glGetMapiv, (void*)glad_lazy_glGetMapiv, 10 },
+	{ "glTextureSubImage3D", (void**)&glad_glTextureSubImage3D, (void*)glad_ctx_glTextureSubImage3D, (void*)glad_lazy_glTextureSubImage3D, 45 },
+	{ "glFramebufferTexture1D", (void**)&glad_glFramebufferTexture1D, (void*)glad_ctx_glFramebufferTexture1D, (void*)glad_lazy_glFramebufferTexture1D, 30 },
+	{ "glUniform4d", (void**)&glad_glUniform4d, (void*)glad_ctx_glUniform4d, (void*)glad_lazy_glUniform4d, 40 },
+	{ "glGetShaderiv", (void**)&glad_glGetShaderiv, (void*)glad_ctx_glGetShaderiv, (void*)glad_lazy_glGetShaderiv, 20 },
+	{ "glMultiTexCoord2d", (void**)&glad_glMultiTexCoord2d, (void*)glad_ctx_glMultiTexCoord2d, (void*)glad_lazy_glMultiTexCoord2d, 13 },
+	{ "glMultiTexCoord2f", (void**)&glad_glMultiTexCoord2f, (void*)glad_ctx_glMultiTexCoord2f, (void*)glad_lazy_glMultiTexCoord2f, 13 },
+	{ "glProgramUniformMatrix3fv", (void**)&glad_glProgramUniformMatrix3fv, (void*)glad_ctx_glProgramUniformMatrix3fv, (void*)glad_lazy_glProgramUniformMatrix3fv, 41 },
+	{ "glObjectPtrLabel", (void**)&glad_glObjectPtrLabel, (void*)glad_ctx_glObjectPtrLabel, (void*)glad_lazy_glObjectPtrLabel, 43 },
+	{ "glInvalidateFramebuffer", (void**)&glad_glInvalidateFramebuffer, (void*)glad_ctx_glInvalidateFramebuffer, (void*)glad_lazy_glInvalidateFramebuffer, 43 },
+	{ "glBindTextures", (void**)&glad_glBindTextures, (void*)glad_ctx_glBindTextures, (void*)glad_lazy_glBindTextures, 44 },
+	{ "glBindFragDataLocation", (void**)&glad_glBindFragDataLocation, (void*)glad_ctx_glBindFragDataLocation, (void*)glad_lazy_glBindFragDataLocation, 30 },
+	{ "glNamedBufferStorage", (void**)&glad_glNamedBufferStorage, (void*)glad_ctx_glNamedBufferStorage, (void*)glad_lazy_glNamedBufferStorage, 45 },
+	{ "glScissorArrayv", (void**)&glad_glScissorArrayv, (void*)glad_ctx_glScissorArrayv, (void*)glad_lazy_glScissorArrayv, 41 },
+	{ "glPrioritizeTextures", (void**)&glad_glPrioritizeTextures, (void*)glad_ctx_glPrioritizeTextures, (void*)glad_lazy_glPrioritizeTextures, 11 },
+	{ "glCallList", (void**)&glad_glCallList, (void*)glad_ctx_glCallList, (void*)glad_lazy_glCallList, 10 },
+	{ "glPatchParameterfv", (void**)&glad_glPatchParameterfv, (void*)glad_ctx_glPatchParameterfv, (void*)glad_lazy_glPatchParameterfv, 40 },
+	{ "glSecondaryColor3ubv", (void**)&glad_glSecondaryColor3ubv, (void*)glad_ctx_glSecondaryColor3ubv, (void*)glad_lazy_glSecondaryColor3ubv, 14 },
+	{ "glGetDoublev", (void**)&glad_glGetDoublev, (void*)glad_ctx_glGetDoublev, (void*)glad_lazy_glGetDoublev, 10 },
+	{ "glMultiTexCoord3iv", (void**)&glad_glMultiTexCoord3iv, (void*)glad_ctx_glMultiTexCoord3iv, (void*)glad_lazy_glMultiTexCoord3iv, 13 },
+	{ "glVertexAttrib1d", (void**)&glad_glVertexAttrib1d, (void*)glad_ctx_glVertexAttrib1d, (void*)glad_lazy_glVertexAttrib1d, 20 },
+	{ "glUniform4dv", (void**)&glad_glUniform4dv, (void*)glad_ctx_glUniform4dv, (void*)glad_lazy_glUniform4dv, 40 },
+	{ "glLightModelf", (void**)&glad_glLightModelf, (void*)glad_ctx_glLightModelf, (void*)glad_lazy_glLightModelf, 10 },
+	{ "glGetUniformiv", (void**)&glad_glGetUniformiv, (void*)glad_ctx_glGetUniformiv, (void*)glad_lazy_glGetUniformiv, 20 },
+	{ "glInvalidateBufferData", (void**)&glad_glInvalidateBufferData, (void*)glad_ctx_glInvalidateBufferData, (void*)glad_lazy_glInvalidateBufferData, 43 },
+	{ "glVertex2sv", (void**)&glad_glVertex2sv, (void*)glad_ctx_glVertex2sv, (void*)glad_lazy_glVertex2sv, 10 },
+	{ "glVertexArrayVertexBuffers", (void**)&glad_glVertexArrayVertexBuffers, (void*)glad_ctx_glVertexArrayVertexBuffers, (void*)glad_lazy_glVertexArrayVertexBuffers, 45 },
+	{ "glCompressedTextureSubImage1D", (void**)&glad_glCompressedTextureSubImage1D, (void*)glad_ctx_glCompressedTextureSubImage1D, (void*)glad_lazy_glCompressedTextureSubImage1D, 45 },
+	{ "glLightModeli", (void**)&glad_glLightModeli, (void*)glad_ctx_glLightModeli, (void*)glad_lazy_glLightModeli, 10 },
+	{ "glWindowPos3iv", (void**)&glad_glWindowPos3iv, (void*)glad_ctx_glWindowPos3iv, (void*)glad_lazy_glWindowPos3iv, 14 },
+	{ "glMultiTexCoordP1uiv", (void**)&glad_glMultiTexCoordP1uiv, (void*)glad_ctx_glMultiTexCoordP1uiv, (void*)glad_lazy_glMultiTexCoordP1uiv, 33 },
+	{ "glUniform3fv", (void**)&glad_glUniform3fv, (void*)glad_ctx_glUniform3fv, (void*)glad_lazy_glUniform3fv, 20 },
+	{ "glPixelStorei", (void**)&glad_glPixelStorei, (void*)glad_ctx_glPixelStorei, (void*)glad_lazy_glPixelStorei, 10 },
+	{ "glGetProgramPipelineInfoLog", (void**)&glad_glGetProgramPipelineInfoLog, (void*)glad_ctx_glGetProgramPipelineInfoLog, (void*)glad_lazy_glGetProgramPipelineInfoLog, 41 },
+	{ "glCallLists", (void**)&glad_glCallLists, (void*)glad_ctx_glCallLists, (void*)glad_lazy_glCallLists, 10 },
+	{ "glProgramUniformMatrix3x4fv", (void**)&glad_glProgramUniformMatrix3x4fv, (void*)glad_ctx_glProgramUniformMatrix3x4fv, (void*)glad_lazy_glProgramUniformMatrix3x4fv, 41 },
+	{ "glInvalidateSubFramebuffer", (void**)&glad_glInvalidateSubFramebuffer, (void*)glad_ctx_glInvalidateSubFramebuffer, (void*)glad_lazy_glInvalidateSubFramebuffer, 43 },
+	{ "glMapBuffer", (void**)&glad_glMapBuffer, (void*)glad_ctx_glMapBuffer, (void*)glad_lazy_glMapBuffer, 15 },
+	{ "glSecondaryColor3d", (void**)&glad_glSecondaryColor3d, (void*)glad_ctx_glSecondaryColor3d, (void*)glad_lazy_glSecondaryColor3d, 14 },
+	{ "glTexCoord3i", (void**)&glad_glTexCoord3i, (void*)glad_ctx_glTexCoord3i, (void*)glad_lazy_glTexCoord3i, 10 },
+	{ "glMultiTexCoord4fv", (void**)&glad_glMultiTexCoord4fv, (void*)glad_ctx_glMultiTexCoord4fv, (void*)glad_lazy_glMultiTexCoord4fv, 13 },
+	{ "glRasterPos3i", (void**)&glad_glRasterPos3i, (void*)glad_ctx_glRasterPos3i, (void*)glad_lazy_glRasterPos3i, 10 },
+	{ "glSecondaryColor3b", (void**)&glad_glSecondaryColor3b, (void*)glad_ctx_glSecondaryColor3b, (void*)glad_lazy_glSecondaryColor3b, 14 },
+	{ "glRasterPos3d", (void**)&glad_glRasterPos3d, (void*)glad_ctx_glRasterPos3d, (void*)glad_lazy_glRasterPos3d, 10 },
+	{ "glRasterPos3f", (void**)&glad_glRasterPos3f, (void*)glad_ctx_glRasterPos3f, (void*)glad_lazy_glRasterPos3f, 10 },
+	{ "glCompressedTexImage3D", (void**)&glad_glCompressedTexImage3D, (void*)glad_ctx_glCompressedTexImage3D, (void*)glad_lazy_glCompressedTexImage3D, 13 },
+	{ "glTexCoord3f", (void**)&glad_glTexCoord3f, (void*)glad_ctx_glTexCoord3f, (void*)glad_lazy_glTexCoord3f, 10 },
+	{ "glDeleteSync", (void**)&glad_glDeleteSync, (void*)glad_ctx_glDeleteSync, (void*)glad_lazy_glDeleteSync, 32 },
+	{ "glTexCoord3d", (void**)&glad_glTexCoord3d, (void*)glad_ctx_glTexCoord3d, (void*)glad_lazy_glTexCoord3d, 10 },
+	{ "glGetTransformFeedbacki64_v", (void**)&glad_glGetTransformFeedbacki64_v, (void*)glad_ctx_glGetTransformFeedbacki64_v, (void*)glad_lazy_glGetTransformFeedbacki64_v, 45 },
+	{ "glUniformMatrix4dv", (void**)&glad_glUniformMatrix4dv, (void*)glad_ctx_glUniformMatrix4dv, (void*)glad_lazy_glUniformMatrix4dv, 40 },
+	{ "glTexImage2DMultisample", (void**)&glad_glTexImage2DMultisample, (void*)glad_ctx_glTexImage2DMultisample, (void*)glad_lazy_glTexImage2DMultisample, 32 },
+	{ "glGetVertexAttribiv", (void**)&glad_glGetVertexAttribiv, (void*)glad_ctx_glGetVertexAttribiv, (void*)glad_lazy_glGetVertexAttribiv, 20 },
+	{ "glUniformMatrix4x2dv", (void**)&glad_glUniformMatrix4x2dv, (void*)glad_ctx_glUniformMatrix4x2dv, (void*)glad_lazy_glUniformMatrix4x2dv, 40 },
+	{ "glMultiDrawElements", (void**)&glad_glMultiDrawElements, (void*)glad_ctx_glMultiDrawElements, (void*)glad_lazy_glMultiDrawElements, 14 },
+	{ "glVertexAttrib3fv", (void**)&glad_glVertexAttrib3fv, (void*)glad_ctx_glVertexAttrib3fv, (void*)glad_lazy_glVertexAttrib3fv, 20 },
+	{ "glTexCoord3s", (void**)&glad_glTexCoord3s, (void*)glad_ctx_glTexCoord3s, (void*)glad_lazy_glTexCoord3s, 10 },
+	{ "glUniform3iv", (void**)&glad_glUniform3iv, (void*)glad_ctx_glUniform3iv, (void*)glad_lazy_glUniform3iv, 20 },
+	{ "glRasterPos3s", (void**)&glad_glRasterPos3s, (void*)glad_ctx_glRasterPos3s, (void*)glad_lazy_glRasterPos3s, 10 },
+	{ "glPolygonMode", (void**)&glad_glPolygonMode, (void*)glad_ctx_glPolygonMode, (void*)glad_lazy_glPolygonMode, 10 },
+	{ "glDrawBuffers", (void**)&glad_glDrawBuffers, (void*)glad_ctx_glDrawBuffers, (void*)glad_lazy_glDrawBuffers, 20 },
+	{ "glGetnHistogram", (void**)&glad_glGetnHistogram, (void*)glad_ctx_glGetnHistogram, (void*)glad_lazy_glGetnHistogram, 45 },
+	{ "glGetActiveUniformBlockiv", (void**)&glad_glGetActiveUniformBlockiv, (void*)glad_ctx_glGetActiveUniformBlockiv, (void*)glad_lazy_glGetActiveUniformBlockiv, 31 },
+	{ "glAreTexturesResident", (void**)&glad_glAreTexturesResident, (void*)glad_ctx_glAreTexturesResident, (void*)glad_lazy_glAreTexturesResident, 11 },
+	{ "glProgramUniform2d", (void**)&glad_glProgramUniform2d, (void*)glad_ctx_glProgramUniform2d, (void*)glad_lazy_glProgramUniform2d, 41 },
+	{ "glProgramUniformMatrix4x3dv", (void**)&glad_glProgramUniformMatrix4x3dv, (void*)glad_ctx_glProgramUniformMatrix4x3dv, (void*)glad_lazy_glProgramUniformMatrix4x3dv, 41 },
+	{ "glIsList", (void**)&glad_glIsList, (void*)glad_ctx_glIsList, (void*)glad_lazy_glIsList, 10 },
+	{ "glProgramUniform4iv", (void**)&glad_glProgramUniform4iv, (void*)glad_ctx_glProgramUniform4iv, (void*)glad_lazy_glProgramUniform4iv, 41 },
+	{ "glRasterPos2sv", (void**)&glad_glRasterPos2sv, (void*)glad_ctx_glRasterPos2sv, (void*)glad_lazy_glRasterPos2sv, 10 },
+	{ "glRasterPos4sv", (void**)&glad_glRasterPos4sv, (void*)glad_ctx_glRasterPos4sv, (void*)glad_lazy_glRasterPos4sv, 10 },
+	{ "glColor4s", (void**)&glad_glColor4s, (void*)glad_ctx_glColor4s, (void*)glad_lazy_glColor4s, 10 },
+	{ "glGetProgramBinary", (void**)&glad_glGetProgramBinary, (void*)glad_ctx_glGetProgramBinary, (void*)glad_lazy_glGetProgramBinary, 41 },
+	{ "glUseProgram", (void**)&glad_glUseProgram, (void*)glad_ctx_glUseProgram, (void*)glad_lazy_glUseProgram, 20 },
+	{ "glLineStipple", (void**)&glad_glLineStipple, (void*)glad_ctx_glLineStipple, (void*)glad_lazy_glLineStipple, 10 },
+	{ "glMultiTexCoord1sv", (void**)&glad_glMultiTexCoord1sv, (void*)glad_ctx_glMultiTexCoord1sv, (void*)glad_lazy_glMultiTexCoord1sv, 13 },
+	{ "glGetProgramInfoLog", (void**)&glad_glGetProgramInfoLog, (void*)glad_ctx_glGetProgramInfoLog, (void*)glad_lazy_glGetProgramInfoLog, 20 },
+	{ "glClearTexImage", (void**)&glad_glClearTexImage, (void*)glad_ctx_glClearTexImage, (void*)glad_lazy_glClearTexImage, 44 },
+	{ "glGetBufferParameteriv", (void**)&glad_glGetBufferParameteriv, (void*)glad_ctx_glGetBufferParameteriv, (void*)glad_lazy_glGetBufferParameteriv, 15 },
+	{ "glMultiTexCoord2iv", (void**)&glad_glMultiTexCoord2iv, (void*)glad_ctx_glMultiTexCoord2iv, (void*)glad_lazy_glMultiTexCoord2iv, 13 },
+	{ "glUniformMatrix2x4fv", (void**)&glad_glUniformMatrix2x4fv, (void*)glad_ctx_glUniformMatrix2x4fv, (void*)glad_lazy_glUniformMatrix2x4fv, 21 },
+	{ "glBindVertexArray", (void**)&glad_glBindVertexArray, (void*)glad_ctx_glBindVertexArray, (void*)glad_lazy_glBindVertexArray, 30 },
+	{ "glColor4b", (void**)&glad_glColor4b, (void*)glad_ctx_glColor4b, (void*)glad_lazy_glColor4b, 10 },
+	{ "glSecondaryColor3f", (void**)&glad_glSecondaryColor3f, (void*)glad_ctx_glSecondaryColor3f, (void*)glad_lazy_glSecondaryColor3f, 14 },
+	{ "glColor4f", (void**)&glad_glColor4f, (void*)glad_ctx_glColor4f, (void*)glad_lazy_glColor4f, 10 },
+	{ "glColor4d", (void**)&glad_glColor4d, (void*)glad_ctx_glColor4d, (void*)glad_lazy_glColor4d, 10 },
+	{ "glColor4i", (void**)&glad_glColor4i, (void*)glad_ctx_glColor4i, (void*)glad_lazy_glColor4i, 10 },
+	{ "glSamplerParameterIiv", (void**)&glad_glSamplerParameterIiv, (void*)glad_ctx_glSamplerParameterIiv, (void*)glad_lazy_glSamplerParameterIiv, 33 },
+	{ "glMultiDrawElementsBaseVertex", (void**)&glad_glMultiDrawElementsBaseVertex, (void*)glad_ctx_glMultiDrawElementsBaseVertex, (void*)glad_lazy_glMultiDrawElementsBaseVertex, 32 },
+	{ "glVertexAttribLFormat", (void**)&glad_glVertexAttribLFormat, (void*)glad_ctx_glVertexAttribLFormat, (void*)glad_lazy_glVertexAttribLFormat, 43 },
+	{ "glRasterPos3iv", (void**)&glad_glRasterPos3iv, (void*)glad_ctx_glRasterPos3iv, (void*)glad_lazy_glRasterPos3iv, 10 },
+	{ "glTextureStorage2D", (void**)&glad_glTextureStorage2D, (void*)glad_ctx_glTextureStorage2D, (void*)glad_lazy_glTextureStorage2D, 45 },
+	{ "glGenerateTextureMipmap", (void**)&glad_glGenerateTextureMipmap, (void*)glad_ctx_glGenerateTextureMipmap, (void*)glad_lazy_glGenerateTextureMipmap, 45 },
+	{ "glVertex2dv", (void**)&glad_glVertex2dv, (void*)glad_ctx_glVertex2dv, (void*)glad_lazy_glVertex2dv, 10 },
+	{ "glTexCoord4sv", (void**)&glad_glTexCoord4sv, (void*)glad_ctx_glTexCoord4sv, (void*)glad_lazy_glTexCoord4sv, 10 },
+	{ "glUniform2uiv", (void**)&glad_glUniform2uiv, (void*)glad_ctx_glUniform2uiv, (void*)glad_lazy_glUniform2uiv, 30 },
+	{ "glCompressedTexSubImage1D", (void**)&glad_glCompressedTexSubImage1D, (void*)glad_ctx_glCompressedTexSubImage1D, (void*)glad_lazy_glCompressedTexSubImage1D, 13 },
+	{ "glFinish", (void**)&glad_glFinish, (void*)glad_ctx_glFinish, (void*)glad_lazy_glFinish, 10 },
+	{ "glDepthRangeIndexed", (void**)&glad_glDepthRangeIndexed, (void*)glad_ctx_glDepthRangeIndexed, (void*)glad_lazy_glDepthRangeIndexed, 41 },
+	{ "glGetBooleanv", (void**)&glad_glGetBooleanv, (void*)glad_ctx_glGetBooleanv, (void*)glad_lazy_glGetBooleanv, 10 },
+	{ "glDeleteShader", (void**)&glad_glDeleteShader, (void*)glad_ctx_glDeleteShader, (void*)glad_lazy_glDeleteShader, 20 },
+	{ "glDrawElements", (void**)&glad_glDrawElements, (void*)glad_ctx_glDrawElements, (void*)glad_lazy_glDrawElements, 11 },
+	{ "glGetInternalformati64v", (void**)&glad_glGetInternalformati64v, (void*)glad_ctx_glGetInternalformati64v, (void*)glad_lazy_glGetInternalformati64v, 43 },
+	{ "glRasterPos2s", (void**)&glad_glRasterPos2s, (void*)glad_ctx_glRasterPos2s, (void*)glad_lazy_glRasterPos2s, 10 },
+	{ "glCopyTextureSubImage1D", (void**)&glad_glCopyTextureSubImage1D, (void*)glad_ctx_glCopyTextureSubImage1D, (void*)glad_lazy_glCopyTextureSubImage1D, 45 },
+	{ "glGetMapdv", (void**)&glad_glGetMapdv, (void*)glad_ctx_glGetMapdv, (void*)glad_lazy_glGetMapdv, 10 },
+	{ "glVertexAttrib4Nsv", (void**)&glad_glVertexAttrib4Nsv, (void*)glad_ctx_glVertexAttrib4Nsv, (void*)glad_lazy_glVertexAttrib4Nsv, 20 },
+	{ "glMaterialfv", (void**)&glad_glMaterialfv, (void*)glad_ctx_glMaterialfv, (void*)glad_lazy_glMaterialfv, 10 },
+	{ "glTextureParameterIuiv", (void**)&glad_glTextureParameterIuiv, (void*)glad_ctx_glTextureParameterIuiv, (void*)glad_lazy_glTextureParameterIuiv, 45 },
+	{ "glViewport", (void**)&glad_glViewport, (void*)glad_ctx_glViewport, (void*)glad_lazy_glViewport, 10 },
+	{ "glUniform1uiv", (void**)&glad_glUniform1uiv, (void*)glad_ctx_glUniform1uiv, (void*)glad_lazy_glUniform1uiv, 30 },
+	{ "glTransformFeedbackVaryings", (void**)&glad_glTransformFeedbackVaryings, (void*)glad_ctx_glTransformFeedbackVaryings, (void*)glad_lazy_glTransformFeedbackVaryings, 30 },
+	{ "glIndexdv", (void**)&glad_glIndexdv, (void*)glad_ctx_glIndexdv, (void*)glad_lazy_glIndexdv, 10 },
+	{ "glCopyTexSubImage3D", (void**)&glad_glCopyTexSubImage3D, (void*)glad_ctx_glCopyTexSubImage3D, (void*)glad_lazy_glCopyTexSubImage3D, 12 },
+	{ "glTexCoord3iv", (void**)&glad_glTexCoord3iv, (void*)glad_ctx_glTexCoord3iv, (void*)glad_lazy_glTexCoord3iv, 10 },
+	{ "glDebugMessageCallback", (void**)&glad_glDebugMessageCallback, (void*)glad_ctx_glDebugMessageCallback, (void*)glad_lazy_glDebugMessageCallback, 43 },
+	{ "glVertexAttribI3i", (void**)&glad_glVertexAttribI3i, (void*)glad_ctx_glVertexAttribI3i, (void*)glad_lazy_glVertexAttribI3i, 30 },
+	{ "glInvalidateTexImage", (void**)&glad_glInvalidateTexImage, (void*)glad_ctx_glInvalidateTexImage, (void*)glad_lazy_glInvalidateTexImage, 43 },
+	{ "glVertexAttribFormat", (void**)&glad_glVertexAttribFormat, (void*)glad_ctx_glVertexAttribFormat, (void*)glad_lazy_glVertexAttribFormat, 43 },
+	{ "glClearDepth", (void**)&glad_glClearDepth, (void*)glad_ctx_glClearDepth, (void*)glad_lazy_glClearDepth, 10 },
+	{ "glVertexAttribI4usv", (void**)&glad_glVertexAttribI4usv, (void*)glad_ctx_glVertexAttribI4usv, (void*)glad_lazy_glVertexAttribI4usv, 30 },
+	{ "glTexParameterf", (void**)&glad_glTexParameterf, (void*)glad_ctx_glTexParameterf, (void*)glad_lazy_glTexParameterf, 10 },
+	{ "glVertexAttribBinding", (void**)&glad_glVertexAttribBinding, (void*)glad_ctx_glVertexAttribBinding, (void*)glad_lazy_glVertexAttribBinding, 43 },
+	{ "glTexParameteri", (void**)&glad_glTexParameteri, (void*)glad_ctx_glTexParameteri, (void*)glad_lazy_glTexParameteri, 10 },
+	{ "glGetActiveSubroutineUniformiv", (void**)&glad_glGetActiveSubroutineUniformiv, (void*)glad_ctx_glGetActiveSubroutineUniformiv, (void*)glad_lazy_glGetActiveSubroutineUniformiv, 40 },
+	{ "glGetShaderSource", (void**)&glad_glGetShaderSource, (void*)glad_ctx_glGetShaderSource, (void*)glad_lazy_glGetShaderSource, 20 },
+	{ "glCreateTransformFeedbacks", (void**)&glad_glCreateTransformFeedbacks, (void*)glad_ctx_glCreateTransformFeedbacks, (void*)glad_lazy_glCreateTransformFeedbacks, 45 },
+	{ "glGetnTexImage", (void**)&glad_glGetnTexImage, (void*)glad_ctx_glGetnTexImage, (void*)glad_lazy_glGetnTexImage, 45 },
+	{ "glTexBuffer", (void**)&glad_glTexBuffer, (void*)glad_ctx_glTexBuffer, (void*)glad_lazy_glTexBuffer, 31 },
+	{ "glPopName", (void**)&glad_glPopName, (void*)glad_ctx_glPopName, (void*)glad_lazy_glPopName, 10 },
+	{ "glValidateProgram", (void**)&glad_glValidateProgram, (void*)glad_ctx_glValidateProgram, (void*)glad_lazy_glValidateProgram, 20 },
+	{ "glPixelStoref", (void**)&glad_glPixelStoref, (void*)glad_ctx_glPixelStoref, (void*)glad_lazy_glPixelStoref, 10 },
+	{ "glUniform3uiv", (void**)&glad_glUniform3uiv, (void*)glad_ctx_glUniform3uiv, (void*)glad_lazy_glUniform3uiv, 30 },
+	{ "glViewportIndexedf", (void**)&glad_glViewportIndexedf, (void*)glad_ctx_glViewportIndexedf, (void*)glad_lazy_glViewportIndexedf, 41 },
+	{ "glRasterPos4fv", (void**)&glad_glRasterPos4fv, (void*)glad_ctx_glRasterPos4fv, (void*)glad_lazy_glRasterPos4fv, 10 },
+	{ "glEvalCoord1dv", (void**)&glad_glEvalCoord1dv, (void*)glad_ctx_glEvalCoord1dv, (void*)glad_lazy_glEvalCoord1dv, 10 },
+	{ "glMultiTexCoordP2uiv", (void**)&glad_glMultiTexCoordP2uiv, (void*)glad_ctx_glMultiTexCoordP2uiv, (void*)glad_lazy_glMultiTexCoordP2uiv, 33 },
+	{ "glGenProgramPipelines", (void**)&glad_glGenProgramPipelines, (void*)glad_ctx_glGenProgramPipelines, (void*)glad_lazy_glGenProgramPipelines, 41 },
+	{ "glRecti", (void**)&glad_glRecti, (void*)glad_ctx_glRecti, (void*)glad_lazy_glRecti, 10 },
+	{ "glColor4ub", (void**)&glad_glColor4ub, (void*)glad_ctx_glColor4ub, (void*)glad_lazy_glColor4ub, 10 },
+	{ "glMultTransposeMatrixf", (void**)&glad_glMultTransposeMatrixf, (void*)glad_ctx_glMultTransposeMatrixf, (void*)glad_lazy_glMultTransposeMatrixf, 13 },
+	{ "glRectf", (void**)&glad_glRectf, (void*)glad_ctx_glRectf, (void*)glad_lazy_glRectf, 10 },
+	{ "glRectd", (void**)&glad_glRectd, (void*)glad_ctx_glRectd, (void*)glad_lazy_glRectd, 10 },
+	{ "glNormal3sv", (void**)&glad_glNormal3sv, (void*)glad_ctx_glNormal3sv, (void*)glad_lazy_glNormal3sv, 10 },
+	{ "glNewList", (void**)&glad_glNewList, (void*)glad_ctx_glNewList, (void*)glad_lazy_glNewList, 10 },
+	{ "glProgramUniformMatrix2x3dv", (void**)&glad_glProgramUniformMatrix2x3dv, (void*)glad_ctx_glProgramUniformMatrix2x3dv, (void*)glad_lazy_glProgramUniformMatrix2x3dv, 41 },
+	{ "glColor4us", (void**)&glad_glColor4us, (void*)glad_ctx_glColor4us, (void*)glad_lazy_glColor4us, 10 },
+	{ "glVertexAttribP1uiv", (void**)&glad_glVertexAttribP1uiv, (void*)glad_ctx_glVertexAttribP1uiv, (void*)glad_lazy_glVertexAttribP1uiv, 33 },
+	{ "glLinkProgram", (void**)&glad_glLinkProgram, (void*)glad_ctx_glLinkProgram, (void*)glad_lazy_glLinkProgram, 20 },
+	{ "glHint", (void**)&glad_glHint, (void*)glad_ctx_glHint, (void*)glad_lazy_glHint, 10 },
+	{ "glRects", (void**)&glad_glRects, (void*)glad_ctx_glRects, (void*)glad_lazy_glRects, 10 },
+	{ "glTexCoord2dv", (void**)&glad_glTexCoord2dv, (void*)glad_ctx_glTexCoord2dv, (void*)glad_lazy_glTexCoord2dv, 10 },
+	{ "glRasterPos4iv", (void**)&glad_glRasterPos4iv, (void*)glad_ctx_glRasterPos4iv, (void*)glad_lazy_glRasterPos4iv, 10 },
+	{ "glGetObjectLabel", (void**)&glad_glGetObjectLabel, (void*)glad_ctx_glGetObjectLabel, (void*)glad_lazy_glGetObjectLabel, 43 },
+	{ "glProgramUniform2f", (void**)&glad_glProgramUniform2f, (void*)glad_ctx_glProgramUniform2f, (void*)glad_lazy_glProgramUniform2f, 41 },
+	{ "glGetString", (void**)&glad_glGetString, (void*)glad_ctx_glGetString, NULL, 10 },
+	{ "glVertexAttribP2uiv", (void**)&glad_glVertexAttribP2uiv, (void*)glad_ctx_glVertexAttribP2uiv, (void*)glad_lazy_glVertexAttribP2uiv, 33 },
+	{ "glEdgeFlagv", (void**)&glad_glEdgeFlagv, (void*)glad_ctx_glEdgeFlagv, (void*)glad_lazy_glEdgeFlagv, 10 },
+	{ "glDetachShader", (void**)&glad_glDetachShader, (void*)glad_ctx_glDetachShader, (void*)glad_lazy_glDetachShader, 20 },
+	{ "glProgramUniform3i", (void**)&glad_glProgramUniform3i, (void*)glad_ctx_glProgramUniform3i, (void*)glad_lazy_glProgramUniform3i, 41 },
+	{ "glScalef", (void**)&glad_glScalef, (void*)glad_ctx_glScalef, (void*)glad_lazy_glScalef, 10 },
+	{ "glEndQuery", (void**)&glad_glEndQuery, (void*)glad_ctx_glEndQuery, (void*)glad_lazy_glEndQuery, 15 },
+	{ "glScaled", (void**)&glad_glScaled, (void*)glad_ctx_glScaled, (void*)glad_lazy_glScaled, 10 },
+	{ "glEdgeFlagPointer", (void**)&glad_glEdgeFlagPointer, (void*)glad_ctx_glEdgeFlagPointer, (void*)glad_lazy_glEdgeFlagPointer, 11 },
+	{ "glFramebufferParameteri", (void**)&glad_glFramebufferParameteri, (void*)glad_ctx_glFramebufferParameteri, (void*)glad_lazy_glFramebufferParameteri, 43 },
+	{ "glGetProgramResourceName", (void**)&glad_glGetProgramResourceName, (void*)glad_ctx_glGetProgramResourceName, (void*)glad_lazy_glGetProgramResourceName, 43 },
+	{ "glUniformMatrix4x3dv", (void**)&glad_glUniformMatrix4x3dv, (void*)glad_ctx_glUniformMatrix4x3dv, (void*)glad_lazy_glUniformMatrix4x3dv, 40 },
+	{ "glDepthRangeArrayv", (void**)&glad_glDepthRangeArrayv, (void*)glad_ctx_glDepthRangeArrayv, (void*)glad_lazy_glDepthRangeArrayv, 41 },
+	{ "glCopyPixels", (void**)&glad_glCopyPixels, (void*)glad_ctx_glCopyPixels, (void*)glad_lazy_glCopyPixels, 10 },
+	{ "glVertexAttribI2ui", (void**)&glad_glVertexAttribI2ui, (void*)glad_ctx_glVertexAttribI2ui, (void*)glad_lazy_glVertexAttribI2ui, 30 },
+	{ "glGetProgramResourceLocation", (void**)&glad_glGetProgramResourceLocation, (void*)glad_ctx_glGetProgramResourceLocation, (void*)glad_lazy_glGetProgramResourceLocation, 43 },
+	{ "glPopAttrib", (void**)&glad_glPopAttrib, (void*)glad_ctx_glPopAttrib, (void*)glad_lazy_glPopAttrib, 10 },
+	{ "glDeleteTextures", (void**)&glad_glDeleteTextures, (void*)glad_ctx_glDeleteTextures, (void*)glad_lazy_glDeleteTextures, 11 },
+	{ "glGetActiveAtomicCounterBufferiv", (void**)&glad_glGetActiveAtomicCounterBufferiv, (void*)glad_ctx_glGetActiveAtomicCounterBufferiv, (void*)glad_lazy_glGetActiveAtomicCounterBufferiv, 42 },
+	{ "glStencilOpSeparate", (void**)&glad_glStencilOpSeparate, (void*)glad_ctx_glStencilOpSeparate, (void*)glad_lazy_glStencilOpSeparate, 20 },
+	{ "glGetTextureParameteriv", (void**)&glad_glGetTextureParameteriv, (void*)glad_ctx_glGetTextureParameteriv, (void*)glad_lazy_glGetTextureParameteriv, 45 },
+	{ "glDeleteQueries", (void**)&glad_glDeleteQueries, (void*)glad_ctx_glDeleteQueries, (void*)glad_lazy_glDeleteQueries, 15 },
+	{ "glNormalP3uiv", (void**)&glad_glNormalP3uiv, (void*)glad_ctx_glNormalP3uiv, (void*)glad_lazy_glNormalP3uiv, 33 },
+	{ "glVertexAttrib4f", (void**)&glad_glVertexAttrib4f, (void*)glad_ctx_glVertexAttrib4f, (void*)glad_lazy_glVertexAttrib4f, 20 },
+	{ "glVertexAttrib4d", (void**)&glad_glVertexAttrib4d, (void*)glad_ctx_glVertexAttrib4d, (void*)glad_lazy_glVertexAttrib4d, 20 },
+	{ "glViewportIndexedfv", (void**)&glad_glViewportIndexedfv, (void*)glad_ctx_glViewportIndexedfv, (void*)glad_lazy_glViewportIndexedfv, 41 },
+	{ "glInitNames", (void**)&glad_glInitNames, (void*)glad_ctx_glInitNames, (void*)glad_lazy_glInitNames, 10 },
+	{ "glGetBufferParameteri64v", (void**)&glad_glGetBufferParameteri64v, (void*)glad_ctx_glGetBufferParameteri64v, (void*)glad_lazy_glGetBufferParameteri64v, 32 },
+	{ "glColor3dv", (void**)&glad_glColor3dv, (void*)glad_ctx_glColor3dv, (void*)glad_lazy_glColor3dv, 10 },
+	{ "glVertexAttribI1i", (void**)&glad_glVertexAttribI1i, (void*)glad_ctx_glVertexAttribI1i, (void*)glad_lazy_glVertexAttribI1i, 30 },
+	{ "glGetTexParameteriv", (void**)&glad_glGetTexParameteriv, (void*)glad_ctx_glGetTexParameteriv, (void*)glad_lazy_glGetTexParameteriv, 10 },
+	{ "glWaitSync", (void**)&glad_glWaitSync, (void*)glad_ctx_glWaitSync, (void*)glad_lazy_glWaitSync, 32 },
+	{ "glCreateVertexArrays", (void**)&glad_glCreateVertexArrays, (void*)glad_ctx_glCreateVertexArrays, (void*)glad_lazy_glCreateVertexArrays, 45 },
+	{ "glProgramUniform1dv", (void**)&glad_glProgramUniform1dv, (void*)glad_ctx_glProgramUniform1dv, (void*)glad_lazy_glProgramUniform1dv, 41 },
+	{ "glVertexAttrib4s", (void**)&glad_glVertexAttrib4s, (void*)glad_ctx_glVertexAttrib4s, (void*)glad_lazy_glVertexAttrib4s, 20 },
+	{ "glColorMaterial", (void**)&glad_glColorMaterial, (void*)glad_ctx_glColorMaterial, (void*)glad_lazy_glColorMaterial, 10 },
+	{ "glSampleCoverage", (void**)&glad_glSampleCoverage, (void*)glad_ctx_glSampleCoverage, (void*)glad_lazy_glSampleCoverage, 13 },
+	{ "glSamplerParameteri", (void**)&glad_glSamplerParameteri, (void*)glad_ctx_glSamplerParameteri, (void*)glad_lazy_glSamplerParameteri, 33 },
+	{ "glClearBufferSubData", (void**)&glad_glClearBufferSubData, (void*)glad_ctx_glClearBufferSubData, (void*)glad_lazy_glClearBufferSubData, 43 },
+	{ "glSamplerParameterf", (void**)&glad_glSamplerParameterf, (void*)glad_ctx_glSamplerParameterf, (void*)glad_lazy_glSamplerParameterf, 33 },
+	{ "glTexStorage1D", (void**)&glad_glTexStorage1D, (void*)glad_ctx_glTexStorage1D, (void*)glad_lazy_glTexStorage1D, 42 },
+	{ "glUniform1f", (void**)&glad_glUniform1f, (void*)glad_ctx_glUniform1f, (void*)glad_lazy_glUniform1f, 20 },
+	{ "glGetVertexAttribfv", (void**)&glad_glGetVertexAttribfv, (void*)glad_ctx_glGetVertexAttribfv, (void*)glad_lazy_glGetVertexAttribfv, 20 },
+	{ "glUniform1d", (void**)&glad_glUniform1d, (void*)glad_ctx_glUniform1d, (void*)glad_lazy_glUniform1d, 40 },
+	{ "glRenderMode", (void**)&glad_glRenderMode, (void*)glad_ctx_glRenderMode, (void*)glad_lazy_glRenderMode, 10 },
+	{ "glGetCompressedTexImage", (void**)&glad_glGetCompressedTexImage, (void*)glad_ctx_glGetCompressedTexImage, (void*)glad_lazy_glGetCompressedTexImage, 13 },
+	{ "glGetnCompressedTexImage", (void**)&glad_glGetnCompressedTexImage, (void*)glad_ctx_glGetnCompressedTexImage, (void*)glad_lazy_glGetnCompressedTexImage, 45 },
+	{ "glWindowPos2dv", (void**)&glad_glWindowPos2dv, (void*)glad_ctx_glWindowPos2dv, (void*)glad_lazy_glWindowPos2dv, 14 },
+	{ "glUniform1i", (void**)&glad_glUniform1i, (void*)glad_ctx_glUniform1i, (void*)glad_lazy_glUniform1i, 20 },
+	{ "glGetActiveAttrib", (void**)&glad_glGetActiveAttrib, (void*)glad_ctx_glGetActiveAttrib, (void*)glad_lazy_glGetActiveAttrib, 20 },
+	{ "glUniform3i", (void**)&glad_glUniform3i, (void*)glad_ctx_glUniform3i, (void*)glad_lazy_glUniform3i, 20 },
+	{ "glPixelTransferi", (void**)&glad_glPixelTransferi, (void*)glad_ctx_glPixelTransferi, (void*)glad_lazy_glPixelTransferi, 10 },
+	{ "glTexSubImage2D", (void**)&glad_glTexSubImage2D, (void*)glad_ctx_glTexSubImage2D, (void*)glad_lazy_glTexSubImage2D, 11 },
+	{ "glDisable", (void**)&glad_glDisable, (void*)glad_ctx_glDisable, (void*)glad_lazy_glDisable, 10 },
+	{ "glLogicOp", (void**)&glad_glLogicOp, (void*)glad_ctx_glLogicOp, (void*)glad_lazy_glLogicOp, 10 },
+	{ "glEvalPoint2", (void**)&glad_glEvalPoint2, (void*)glad_ctx_glEvalPoint2, (void*)glad_lazy_glEvalPoint2, 10 },
+	{ "glPixelTransferf", (void**)&glad_glPixelTransferf, (void*)glad_ctx_glPixelTransferf, (void*)glad_lazy_glPixelTransferf, 10 },
+	{ "glMultiDrawArraysIndirectCount", (void**)&glad_glMultiDrawArraysIndirectCount, (void*)glad_ctx_glMultiDrawArraysIndirectCount, (void*)glad_lazy_glMultiDrawArraysIndirectCount, 46 },
+	{ "glSecondaryColor3i", (void**)&glad_glSecondaryColor3i, (void*)glad_ctx_glSecondaryColor3i, (void*)glad_lazy_glSecondaryColor3i, 14 },
+	{ "glProgramUniform4uiv", (void**)&glad_glProgramUniform4uiv, (void*)glad_ctx_glProgramUniform4uiv, (void*)glad_lazy_glProgramUniform4uiv, 41 },
+	{ "glUniform4ui", (void**)&glad_glUniform4ui, (void*)glad_ctx_glUniform4ui, (void*)glad_lazy_glUniform4ui, 30 },
+	{ "glColor3f", (void**)&glad_glColor3f, (void*)glad_ctx_glColor3f, (void*)glad_lazy_glColor3f, 10 },
+	{ "glNamedFramebufferReadBuffer", (void**)&glad_glNamedFramebufferReadBuffer, (void*)glad_ctx_glNamedFramebufferReadBuffer, (void*)glad_lazy_glNamedFramebufferReadBuffer, 45 },
+	{ "glBindFramebuffer", (void**)&glad_glBindFramebuffer, (void*)glad_ctx_glBindFramebuffer, (void*)glad_lazy_glBindFramebuffer, 30 },
+	{ "glGetTexEnvfv", (void**)&glad_glGetTexEnvfv, (void*)glad_ctx_glGetTexEnvfv, (void*)glad_lazy_glGetTexEnvfv, 10 },
+	{ "glRectfv", (void**)&glad_glRectfv, (void*)glad_ctx_glRectfv, (void*)glad_lazy_glRectfv, 10 },
+	{ "glCullFace", (void**)&glad_glCullFace, (void*)glad_ctx_glCullFace, (void*)glad_lazy_glCullFace, 10 },
+	{ "glGetLightfv", (void**)&glad_glGetLightfv, (void*)glad_ctx_glGetLightfv, (void*)glad_lazy_glGetLightfv, 10 },
+	{ "glGetnUniformiv", (void**)&glad_glGetnUniformiv, (void*)glad_ctx_glGetnUniformiv, (void*)glad_lazy_glGetnUniformiv, 45 },
+	{ "glColor3d", (void**)&glad_glColor3d, (void*)glad_ctx_glColor3d, (void*)glad_lazy_glColor3d, 10 },
+	{ "glProgramUniform4i", (void**)&glad_glProgramUniform4i, (void*)glad_ctx_glProgramUniform4i, (void*)glad_lazy_glProgramUniform4i, 41 },
+	{ "glTexGend", (void**)&glad_glTexGend, (void*)glad_ctx_glTexGend, (void*)glad_lazy_glTexGend, 10 },
+	{ "glProgramUniform4f", (void**)&glad_glProgramUniform4f, (void*)glad_ctx_glProgramUniform4f, (void*)glad_lazy_glProgramUniform4f, 41 },
+	{ "glTexGeni", (void**)&glad_glTexGeni, (void*)glad_ctx_glTexGeni, (void*)glad_lazy_glTexGeni, 10 },
+	{ "glProgramUniform4d", (void**)&glad_glProgramUniform4d, (void*)glad_ctx_glProgramUniform4d, (void*)glad_lazy_glProgramUniform4d, 41 },
+	{ "glTextureParameterIiv", (void**)&glad_glTextureParameterIiv, (void*)glad_ctx_glTextureParameterIiv, (void*)glad_lazy_glTextureParameterIiv, 45 },
+	{ "glMultiTexCoord3s", (void**)&glad_glMultiTexCoord3s, (void*)glad_ctx_glMultiTexCoord3s, (void*)glad_lazy_glMultiTexCoord3s, 13 },
+	{ "glGetStringi", (void**)&glad_glGetStringi, (void*)glad_ctx_glGetStringi, (void*)glad_lazy_glGetStringi, 30 },
+	{ "glGetTextureParameterfv", (void**)&glad_glGetTextureParameterfv, (void*)glad_ctx_glGetTextureParameterfv, (void*)glad_lazy_glGetTextureParameterfv, 45 },
+	{ "glTextureSubImage2D", (void**)&glad_glTextureSubImage2D, (void*)glad_ctx_glTextureSubImage2D, (void*)glad_lazy_glTextureSubImage2D, 45 },
+	{ "glMultiTexCoord3i", (void**)&glad_glMultiTexCoord3i, (void*)glad_ctx_glMultiTexCoord3i, (void*)glad_lazy_glMultiTexCoord3i, 13 },
+	{ "glMultiTexCoord3f", (void**)&glad_glMultiTexCoord3f, (void*)glad_ctx_glMultiTexCoord3f, (void*)glad_lazy_glMultiTexCoord3f, 13 },
+	{ "glDrawTransformFeedbackStream", (void**)&glad_glDrawTransformFeedbackStream, (void*)glad_ctx_glDrawTransformFeedbackStream, (void*)glad_lazy_glDrawTransformFeedbackStream, 40 },
+	{ "glMultiTexCoord3d", (void**)&glad_glMultiTexCoord3d, (void*)glad_ctx_glMultiTexCoord3d, (void*)glad_lazy_glMultiTexCoord3d, 13 },
+	{ "glAttachShader", (void**)&glad_glAttachShader, (void*)glad_ctx_glAttachShader, (void*)glad_lazy_glAttachShader, 20 },
+	{ "glFogCoorddv", (void**)&glad_glFogCoorddv, (void*)glad_ctx_glFogCoorddv, (void*)glad_lazy_glFogCoorddv, 14 },
+	{ "glUniformMatrix2x3fv", (void**)&glad_glUniformMatrix2x3fv, (void*)glad_ctx_glUniformMatrix2x3fv, (void*)glad_lazy_glUniformMatrix2x3fv, 21 },
+	{ "glGetTexGenfv", (void**)&glad_glGetTexGenfv, (void*)glad_ctx_glGetTexGenfv, (void*)glad_lazy_glGetTexGenfv, 10 },
+	{ "glQueryCounter", (void**)&glad_glQueryCounter, (void*)glad_ctx_glQueryCounter, (void*)glad_lazy_glQueryCounter, 33 },
+	{ "glFogCoordPointer", (void**)&glad_glFogCoordPointer, (void*)glad_ctx_glFogCoordPointer, (void*)glad_lazy_glFogCoordPointer, 14 },
+	{ "glProgramUniformMatrix3dv", (void**)&glad_glProgramUniformMatrix3dv, (void*)glad_ctx_glProgramUniformMatrix3dv, (void*)glad_lazy_glProgramUniformMatrix3dv, 41 },
+	{ "glProvokingVertex", (void**)&glad_glProvokingVertex, (void*)glad_ctx_glProvokingVertex, (void*)glad_lazy_glProvokingVertex, 32 },
+	{ "glShaderBinary", (void**)&glad_glShaderBinary, (void*)glad_ctx_glShaderBinary, (void*)glad_lazy_glShaderBinary, 41 },
+	{ "glUnmapNamedBuffer", (void**)&glad_glUnmapNamedBuffer, (void*)glad_ctx_glUnmapNamedBuffer, (void*)glad_lazy_glUnmapNamedBuffer, 45 },
+	{ "glGetnColorTable", (void**)&glad_glGetnColorTable, (void*)glad_ctx_glGetnColorTable, (void*)glad_lazy_glGetnColorTable, 45 },
+	{ "glFramebufferTexture3D", (void**)&glad_glFramebufferTexture3D, (void*)glad_ctx_glFramebufferTexture3D, (void*)glad_lazy_glFramebufferTexture3D, 30 },
+	{ "glTexGeniv", (void**)&glad_glTexGeniv, (void*)glad_ctx_glTexGeniv, (void*)glad_lazy_glTexGeniv, 10 },
+	{ "glRasterPos2dv", (void**)&glad_glRasterPos2dv, (void*)glad_ctx_glRasterPos2dv, (void*)glad_lazy_glRasterPos2dv, 10 },
+	{ "glSecondaryColor3dv", (void**)&glad_glSecondaryColor3dv, (void*)glad_ctx_glSecondaryColor3dv, (void*)glad_lazy_glSecondaryColor3dv, 14 },
+	{ "glClientActiveTexture", (void**)&glad_glClientActiveTexture, (void*)glad_ctx_glClientActiveTexture, (void*)glad_lazy_glClientActiveTexture, 13 },
+	{ "glNamedRenderbufferStorageMultisample", (void**)&glad_glNamedRenderbufferStorageMultisample, (void*)glad_ctx_glNamedRenderbufferStorageMultisample, (void*)glad_lazy_glNamedRenderbufferStorageMultisample, 45 },
+	{ "glVertexAttribI4sv", (void**)&glad_glVertexAttribI4sv, (void*)glad_ctx_glVertexAttribI4sv, (void*)glad_lazy_glVertexAttribI4sv, 30 },
+	{ "glClearNamedBufferData", (void**)&glad_glClearNamedBufferData, (void*)glad_ctx_glClearNamedBufferData, (void*)glad_lazy_glClearNamedBufferData, 45 },
+	{ "glSecondaryColor3us", (void**)&glad_glSecondaryColor3us, (void*)glad_ctx_glSecondaryColor3us, (void*)glad_lazy_glSecondaryColor3us, 14 },
+	{ "glNormalP3ui", (void**)&glad_glNormalP3ui, (void*)glad_ctx_glNormalP3ui, (void*)glad_lazy_glNormalP3ui, 33 },
+	{ "glTexEnvfv", (void**)&glad_glTexEnvfv, (void*)glad_ctx_glTexEnvfv, (void*)glad_lazy_glTexEnvfv, 10 },
+	{ "glReadBuffer", (void**)&glad_glReadBuffer, (void*)glad_ctx_glReadBuffer, (void*)glad_lazy_glReadBuffer, 10 },
+	{ "glViewportArrayv", (void**)&glad_glViewportArrayv, (void*)glad_ctx_glViewportArrayv, (void*)glad_lazy_glViewportArrayv, 41 },
+	{ "glTexParameterIuiv", (void**)&glad_glTexParameterIuiv, (void*)glad_ctx_glTexParameterIuiv, (void*)glad_lazy_glTexParameterIuiv, 30 },
+	{ "glDrawArraysInstanced", (void**)&glad_glDrawArraysInstanced, (void*)glad_ctx_glDrawArraysInstanced, (void*)glad_lazy_glDrawArraysInstanced, 31 },
+	{ "glGenerateMipmap", (void**)&glad_glGenerateMipmap, (void*)glad_ctx_glGenerateMipmap, (void*)glad_lazy_glGenerateMipmap, 30 },
+	{ "glCompressedTextureSubImage2D", (void**)&glad_glCompressedTextureSubImage2D, (void*)glad_ctx_glCompressedTextureSubImage2D, (void*)glad_lazy_glCompressedTextureSubImage2D, 45 },
+	{ "glProgramUniformMatrix2fv", (void**)&glad_glProgramUniformMatrix2fv, (void*)glad_ctx_glProgramUniformMatrix2fv, (void*)glad_lazy_glProgramUniformMatrix2fv, 41 },
+	{ "glWindowPos3fv", (void**)&glad_glWindowPos3fv, (void*)glad_ctx_glWindowPos3fv, (void*)glad_lazy_glWindowPos3fv, 14 },
+	{ "glUniformMatrix3x4dv", (void**)&glad_glUniformMatrix3x4dv, (void*)glad_ctx_glUniformMatrix3x4dv, (void*)glad_lazy_glUniformMatrix3x4dv, 40 },
+	{ "glLightModelfv", (void**)&glad_glLightModelfv, (void*)glad_ctx_glLightModelfv, (void*)glad_lazy_glLightModelfv, 10 },
+	{ "glSamplerParameteriv", (void**)&glad_glSamplerParameteriv, (void*)glad_ctx_glSamplerParameteriv, (void*)glad_lazy_glSamplerParameteriv, 33 },
+	{ "glDeleteLists", (void**)&glad_glDeleteLists, (void*)glad_ctx_glDeleteLists, (void*)glad_lazy_glDeleteLists, 10 },
+	{ "glGetClipPlane", (void**)&glad_glGetClipPlane, (void*)glad_ctx_glGetClipPlane, (void*)glad_lazy_glGetClipPlane, 10 },
+	{ "glVertex4dv", (void**)&glad_glVertex4dv, (void*)glad_ctx_glVertex4dv, (void*)glad_lazy_glVertex4dv, 10 },
+	{ "glTexCoord2d", (void**)&glad_glTexCoord2d, (void*)glad_ctx_glTexCoord2d, (void*)glad_lazy_glTexCoord2d, 10 },
+	{ "glPopMatrix", (void**)&glad_glPopMatrix, (void*)glad_ctx_glPopMatrix, (void*)glad_lazy_glPopMatrix, 10 },
+	{ "glTexCoord2f", (void**)&glad_glTexCoord2f, (void*)glad_ctx_glTexCoord2f, (void*)glad_lazy_glTexCoord2f, 10 },
+	{ "glColor4iv", (void**)&glad_glColor4iv, (void*)glad_ctx_glColor4iv, (void*)glad_lazy_glColor4iv, 10 },
+	{ "glIndexubv", (void**)&glad_glIndexubv, (void*)glad_ctx_glIndexubv, (void*)glad_lazy_glIndexubv, 11 },
+	{ "glCheckNamedFramebufferStatus", (void**)&glad_glCheckNamedFramebufferStatus, (void*)glad_ctx_glCheckNamedFramebufferStatus, (void*)glad_lazy_glCheckNamedFramebufferStatus, 45 },
+	{ "glUnmapBuffer", (void**)&glad_glUnmapBuffer, (void*)glad_ctx_glUnmapBuffer, (void*)glad_lazy_glUnmapBuffer, 15 },
+	{ "glTexCoord2i", (void**)&glad_glTexCoord2i, (void*)glad_ctx_glTexCoord2i, (void*)glad_lazy_glTexCoord2i, 10 },
+	{ "glRasterPos4d", (void**)&glad_glRasterPos4d, (void*)glad_ctx_glRasterPos4d, (void*)glad_lazy_glRasterPos4d, 10 },
+	{ "glRasterPos4f", (void**)&glad_glRasterPos4f, (void*)glad_ctx_glRasterPos4f, (void*)glad_lazy_glRasterPos4f, 10 },
+	{ "glProgramUniform1iv", (void**)&glad_glProgramUniform1iv, (void*)glad_ctx_glProgramUniform1iv, (void*)glad_lazy_glProgramUniform1iv, 41 },
+	{ "glGetVertexArrayiv", (void**)&glad_glGetVertexArrayiv, (void*)glad_ctx_glGetVertexArrayiv, (void*)glad_lazy_glGetVertexArrayiv, 45 },
+	{ "glCopyTextureSubImage2D", (void**)&glad_glCopyTextureSubImage2D, (void*)glad_ctx_glCopyTextureSubImage2D, (void*)glad_lazy_glCopyTextureSubImage2D, 45 },
+	{ "glVertexAttrib3s", (void**)&glad_glVertexAttrib3s, (void*)glad_ctx_glVertexAttrib3s, (void*)glad_lazy_glVertexAttrib3s, 20 },
+	{ "glTexCoord2s", (void**)&glad_glTexCoord2s, (void*)glad_ctx_glTexCoord2s, (void*)glad_lazy_glTexCoord2s, 10 },
+	{ "glBindRenderbuffer", (void**)&glad_glBindRenderbuffer, (void*)glad_ctx_glBindRenderbuffer, (void*)glad_lazy_glBindRenderbuffer, 30 },
+	{ "glVertex3fv", (void**)&glad_glVertex3fv, (void*)glad_ctx_glVertex3fv, (void*)glad_lazy_glVertex3fv, 10 },
+	{ "glTexCoord4dv", (void**)&glad_glTexCoord4dv, (void*)glad_ctx_glTexCoord4dv, (void*)glad_lazy_glTexCoord4dv, 10 },
+	{ "glMaterialiv", (void**)&glad_glMaterialiv, (void*)glad_ctx_glMaterialiv, (void*)glad_lazy_glMaterialiv, 10 },
+	{ "glVertexAttribP4uiv", (void**)&glad_glVertexAttribP4uiv, (void*)glad_ctx_glVertexAttribP4uiv, (void*)glad_lazy_glVertexAttribP4uiv, 33 },
+	{ "glGetProgramStageiv", (void**)&glad_glGetProgramStageiv, (void*)glad_ctx_glGetProgramStageiv, (void*)glad_lazy_glGetProgramStageiv, 40 },
+	{ "glIsProgram", (void**)&glad_glIsProgram, (void*)glad_ctx_glIsProgram, (void*)glad_lazy_glIsProgram, 20 },
+	{ "glVertexAttrib4bv", (void**)&glad_glVertexAttrib4bv, (void*)glad_ctx_glVertexAttrib4bv, (void*)glad_lazy_glVertexAttrib4bv, 20 },
+	{ "glVertex4s", (void**)&glad_glVertex4s, (void*)glad_ctx_glVertex4s, (void*)glad_lazy_glVertex4s, 10 },
+	{ "glUniformMatrix3x2dv", (void**)&glad_glUniformMatrix3x2dv, (void*)glad_ctx_glUniformMatrix3x2dv, (void*)glad_lazy_glUniformMatrix3x2dv, 40 },
+	{ "glVertexAttrib4fv", (void**)&glad_glVertexAttrib4fv, (void*)glad_ctx_glVertexAttrib4fv, (void*)glad_lazy_glVertexAttrib4fv, 20 },
+	{ "glNormal3dv", (void**)&glad_glNormal3dv, (void*)glad_ctx_glNormal3dv, (void*)glad_lazy_glNormal3dv, 10 },
+	{ "glIsTransformFeedback", (void**)&glad_glIsTransformFeedback, (void*)glad_ctx_glIsTransformFeedback, (void*)glad_lazy_glIsTransformFeedback, 40 },
+	{ "glUniform4i", (void**)&glad_glUniform4i, (void*)glad_ctx_glUniform4i, (void*)glad_lazy_glUniform4i, 20 },
+	{ "glActiveTexture", (void**)&glad_glActiveTexture, (void*)glad_ctx_glActiveTexture, (void*)glad_lazy_glActiveTexture, 13 },
+	{ "glEnableVertexAttribArray", (void**)&glad_glEnableVertexAttribArray, (void*)glad_ctx_glEnableVertexAttribArray, (void*)glad_lazy_glEnableVertexAttribArray, 20 },
+	{ "glRotated", (void**)&glad_glRotated, (void*)glad_ctx_glRotated, (void*)glad_lazy_glRotated, 10 },
+	{ "glIsProgramPipeline", (void**)&glad_glIsProgramPipeline, (void*)glad_ctx_glIsProgramPipeline, (void*)glad_lazy_glIsProgramPipeline, 41 },
+	{ "glRotatef", (void**)&glad_glRotatef, (void*)glad_ctx_glRotatef, (void*)glad_lazy_glRotatef, 10 },
+	{ "glVertex4i", (void**)&glad_glVertex4i, (void*)glad_ctx_glVertex4i, (void*)glad_lazy_glVertex4i, 10 },
+	{ "glReadPixels", (void**)&glad_glReadPixels, (void*)glad_ctx_glReadPixels, (void*)glad_lazy_glReadPixels, 10 },
+	{ "glVertexAttribI3iv", (void**)&glad_glVertexAttribI3iv, (void*)glad_ctx_glVertexAttribI3iv, (void*)glad_lazy_glVertexAttribI3iv, 30 },
+	{ "glLoadName", (void**)&glad_glLoadName, (void*)glad_ctx_glLoadName, (void*)glad_lazy_glLoadName, 10 },
+	{ "glUniform4f", (void**)&glad_glUniform4f, (void*)glad_ctx_glUniform4f, (void*)glad_lazy_glUniform4f, 20 },
+	{ "glRenderbufferStorageMultisample", (void**)&glad_glRenderbufferStorageMultisample, (void*)glad_ctx_glRenderbufferStorageMultisample, (void*)glad_lazy_glRenderbufferStorageMultisample, 30 },
+	{ "glCreateProgramPipelines", (void**)&glad_glCreateProgramPipelines, (void*)glad_ctx_glCreateProgramPipelines, (void*)glad_lazy_glCreateProgramPipelines, 45 },
+	{ "glGenVertexArrays", (void**)&glad_glGenVertexArrays, (void*)glad_ctx_glGenVertexArrays, (void*)glad_lazy_glGenVertexArrays, 30 },
+	{ "glShadeModel", (void**)&glad_glShadeModel, (void*)glad_ctx_glShadeModel, (void*)glad_lazy_glShadeModel, 10 },
+	{ "glMapGrid1d", (void**)&glad_glMapGrid1d, (void*)glad_ctx_glMapGrid1d, (void*)glad_lazy_glMapGrid1d, 10 },
+	{ "glGetUniformfv", (void**)&glad_glGetUniformfv, (void*)glad_ctx_glGetUniformfv, (void*)glad_lazy_glGetUniformfv, 20 },
+	{ "glMapGrid1f", (void**)&glad_glMapGrid1f, (void*)glad_ctx_glMapGrid1f, (void*)glad_lazy_glMapGrid1f, 10 },
+	{ "glSamplerParameterfv", (void**)&glad_glSamplerParameterfv, (void*)glad_ctx_glSamplerParameterfv, (void*)glad_lazy_glSamplerParameterfv, 33 },
+	{ "glVertexAttribLPointer", (void**)&glad_glVertexAttribLPointer, (void*)glad_ctx_glVertexAttribLPointer, (void*)glad_lazy_glVertexAttribLPointer, 41 },
+	{ "glDisableClientState", (void**)&glad_glDisableClientState, (void*)glad_ctx_glDisableClientState, (void*)glad_lazy_glDisableClientState, 11 },
+	{ "glMultiTexCoord3sv", (void**)&glad_glMultiTexCoord3sv, (void*)glad_ctx_glMultiTexCoord3sv, (void*)glad_lazy_glMultiTexCoord3sv, 13 },
+	{ "glGetnUniformfv", (void**)&glad_glGetnUniformfv, (void*)glad_ctx_glGetnUniformfv, (void*)glad_lazy_glGetnUniformfv, 45 },
+	{ "glDrawElementsInstancedBaseVertex", (void**)&glad_glDrawElementsInstancedBaseVertex, (void*)glad_ctx_glDrawElementsInstancedBaseVertex, (void*)glad_lazy_glDrawElementsInstancedBaseVertex, 32 },
+	{ "glVertexAttribL2dv", (void**)&glad_glVertexAttribL2dv, (void*)glad_ctx_glVertexAttribL2dv, (void*)glad_lazy_glVertexAttribL2dv, 41 },
+	{ "glMultiDrawElementsIndirect", (void**)&glad_glMultiDrawElementsIndirect, (void*)glad_ctx_glMultiDrawElementsIndirect, (void*)glad_lazy_glMultiDrawElementsIndirect, 43 },
+	{ "glEnableVertexArrayAttrib", (void**)&glad_glEnableVertexArrayAttrib, (void*)glad_ctx_glEnableVertexArrayAttrib, (void*)glad_lazy_glEnableVertexArrayAttrib, 45 },
+	{ "glSecondaryColorPointer", (void**)&glad_glSecondaryColorPointer, (void*)glad_ctx_glSecondaryColorPointer, (void*)glad_lazy_glSecondaryColorPointer, 14 },
+	{ "glAlphaFunc", (void**)&glad_glAlphaFunc, (void*)glad_ctx_glAlphaFunc, (void*)glad_lazy_glAlphaFunc, 10 },
+	{ "glUniform1iv", (void**)&glad_glUniform1iv, (void*)glad_ctx_glUniform1iv, (void*)glad_lazy_glUniform1iv, 20 },
+	{ "glCreateShaderProgramv", (void**)&glad_glCreateShaderProgramv, (void*)glad_ctx_glCreateShaderProgramv, (void*)glad_lazy_glCreateShaderProgramv, 41 },
+	{ "glGetActiveSubroutineName", (void**)&glad_glGetActiveSubroutineName, (void*)glad_ctx_glGetActiveSubroutineName, (void*)glad_lazy_glGetActiveSubroutineName, 40 },
+	{ "glMultiTexCoord4iv", (void**)&glad_glMultiTexCoord4iv, (void*)glad_ctx_glMultiTexCoord4iv, (void*)glad_lazy_glMultiTexCoord4iv, 13 },
+	{ "glVertexAttribL2d", (void**)&glad_glVertexAttribL2d, (void*)glad_ctx_glVertexAttribL2d, (void*)glad_lazy_glVertexAttribL2d, 41 },
+	{ "glGetQueryObjectiv", (void**)&glad_glGetQueryObjectiv, (void*)glad_ctx_glGetQueryObjectiv, (void*)glad_lazy_glGetQueryObjectiv, 15 },
+	{ "glStencilFunc", (void**)&glad_glStencilFunc, (void*)glad_ctx_glStencilFunc, (void*)glad_lazy_glStencilFunc, 10 },
+	{ "glInvalidateNamedFramebufferData", (void**)&glad_glInvalidateNamedFramebufferData, (void*)glad_ctx_glInvalidateNamedFramebufferData, (void*)glad_lazy_glInvalidateNamedFramebufferData, 45 },
+	{ "glMultiTexCoord1fv", (void**)&glad_glMultiTexCoord1fv, (void*)glad_ctx_glMultiTexCoord1fv, (void*)glad_lazy_glMultiTexCoord1fv, 13 },
+	{ "glUniformBlockBinding", (void**)&glad_glUniformBlockBinding, (void*)glad_ctx_glUniformBlockBinding, (void*)glad_lazy_glUniformBlockBinding, 31 },
+	{ "glColor4uiv", (void**)&glad_glColor4uiv, (void*)glad_ctx_glColor4uiv, (void*)glad_lazy_glColor4uiv, 10 },
+	{ "glRectiv", (void**)&glad_glRectiv, (void*)glad_ctx_glRectiv, (void*)glad_lazy_glRectiv, 10 },
+	{ "glColorP4ui", (void**)&glad_glColorP4ui, (void*)glad_ctx_glColorP4ui, (void*)glad_lazy_glColorP4ui, 33 },
+	{ "glUseProgramStages", (void**)&glad_glUseProgramStages, (void*)glad_ctx_glUseProgramStages, (void*)glad_lazy_glUseProgramStages, 41 },
+	{ "glRasterPos3dv", (void**)&glad_glRasterPos3dv, (void*)glad_ctx_glRasterPos3dv, (void*)glad_lazy_glRasterPos3dv, 10 },
+	{ "glEvalMesh2", (void**)&glad_glEvalMesh2, (void*)glad_ctx_glEvalMesh2, (void*)glad_lazy_glEvalMesh2, 10 },
+	{ "glEvalMesh1", (void**)&glad_glEvalMesh1, (void*)glad_ctx_glEvalMesh1, (void*)glad_lazy_glEvalMesh1, 10 },
+	{ "glTexCoordPointer", (void**)&glad_glTexCoordPointer, (void*)glad_ctx_glTexCoordPointer, (void*)glad_lazy_glTexCoordPointer, 11 },
+	{ "glProgramUniform3f", (void**)&glad_glProgramUniform3f, (void*)glad_ctx_glProgramUniform3f, (void*)glad_lazy_glProgramUniform3f, 41 },
+	{ "glProgramUniform3d", (void**)&glad_glProgramUniform3d, (void*)glad_ctx_glProgramUniform3d, (void*)glad_lazy_glProgramUniform3d, 41 },
+	{ "glVertexAttrib4Nubv", (void**)&glad_glVertexAttrib4Nubv, (void*)glad_ctx_glVertexAttrib4Nubv, (void*)glad_lazy_glVertexAttrib4Nubv, 20 },
+	{ "glVertexAttribI4iv", (void**)&glad_glVertexAttribI4iv, (void*)glad_ctx_glVertexAttribI4iv, (void*)glad_lazy_glVertexAttribI4iv, 30 },
+	{ "glGetProgramPipelineiv", (void**)&glad_glGetProgramPipelineiv, (void*)glad_ctx_glGetProgramPipelineiv, (void*)glad_lazy_glGetProgramPipelineiv, 41 },
+	{ "glTexStorage3D", (void**)&glad_glTexStorage3D, (void*)glad_ctx_glTexStorage3D, (void*)glad_lazy_glTexStorage3D, 42 },
+	{ "glEvalCoord2fv", (void**)&glad_glEvalCoord2fv, (void*)glad_ctx_glEvalCoord2fv, (void*)glad_lazy_glEvalCoord2fv, 10 },
+	{ "glNamedFramebufferDrawBuffer", (void**)&glad_glNamedFramebufferDrawBuffer, (void*)glad_ctx_glNamedFramebufferDrawBuffer, (void*)glad_lazy_glNamedFramebufferDrawBuffer, 45 },
+	{ "glGetQueryIndexediv", (void**)&glad_glGetQueryIndexediv, (void*)glad_ctx_glGetQueryIndexediv, (void*)glad_lazy_glGetQueryIndexediv, 40 },
+	{ "glColor4ubv", (void**)&glad_glColor4ubv, (void*)glad_ctx_glColor4ubv, (void*)glad_lazy_glColor4ubv, 10 },
+	{ "glLoadTransposeMatrixd", (void**)&glad_glLoadTransposeMatrixd, (void*)glad_ctx_glLoadTransposeMatrixd, (void*)glad_lazy_glLoadTransposeMatrixd, 13 },
+	{ "glLoadTransposeMatrixf", (void**)&glad_glLoadTransposeMatrixf, (void*)glad_ctx_glLoadTransposeMatrixf, (void*)glad_lazy_glLoadTransposeMatrixf, 13 },
+	{ "glTextureParameteriv", (void**)&glad_glTextureParameteriv, (void*)glad_ctx_glTextureParameteriv, (void*)glad_lazy_glTextureParameteriv, 45 },
+	{ "glObjectLabel", (void**)&glad_glObjectLabel, (void*)glad_ctx_glObjectLabel, (void*)glad_lazy_glObjectLabel, 43 },
+	{ "glVertexAttribI4i", (void**)&glad_glVertexAttribI4i, (void*)glad_ctx_glVertexAttribI4i, (void*)glad_lazy_glVertexAttribI4i, 30 },
+	{ "glRasterPos2iv", (void**)&glad_glRasterPos2iv, (void*)glad_ctx_glRasterPos2iv, (void*)glad_lazy_glRasterPos2iv, 10 },
+	{ "glGetBufferSubData", (void**)&glad_glGetBufferSubData, (void*)glad_ctx_glGetBufferSubData, (void*)glad_lazy_glGetBufferSubData, 15 },
+	{ "glGetVertexAttribLdv", (void**)&glad_glGetVertexAttribLdv, (void*)glad_ctx_glGetVertexAttribLdv, (void*)glad_lazy_glGetVertexAttribLdv, 41 },
+	{ "glGetnUniformuiv", (void**)&glad_glGetnUniformuiv, (void*)glad_ctx_glGetnUniformuiv, (void*)glad_lazy_glGetnUniformuiv, 45 },
+	{ "glGetQueryBufferObjectiv", (void**)&glad_glGetQueryBufferObjectiv, (void*)glad_ctx_glGetQueryBufferObjectiv, (void*)glad_lazy_glGetQueryBufferObjectiv, 45 },
+	{ "glTexEnviv", (void**)&glad_glTexEnviv, (void*)glad_ctx_glTexEnviv, (void*)glad_lazy_glTexEnviv, 10 },
+	{ "glBlendEquationSeparate", (void**)&glad_glBlendEquationSeparate, (void*)glad_ctx_glBlendEquationSeparate, (void*)glad_lazy_glBlendEquationSeparate, 20 },
+	{ "glVertexAttribI1ui", (void**)&glad_glVertexAttribI1ui, (void*)glad_ctx_glVertexAttribI1ui, (void*)glad_lazy_glVertexAttribI1ui, 30 },
+	{ "glGenBuffers", (void**)&glad_glGenBuffers, (void*)glad_ctx_glGenBuffers, (void*)glad_lazy_glGenBuffers, 15 },
+	{ "glSelectBuffer", (void**)&glad_glSelectBuffer, (void*)glad_ctx_glSelectBuffer, (void*)glad_lazy_glSelectBuffer, 10 },
+	{ "glGetSubroutineIndex", (void**)&glad_glGetSubroutineIndex, (void*)glad_ctx_glGetSubroutineIndex, (void*)glad_lazy_glGetSubroutineIndex, 40 },
+	{ "glVertexAttrib2sv", (void**)&glad_glVertexAttrib2sv, (void*)glad_ctx_glVertexAttrib2sv, (void*)glad_lazy_glVertexAttrib2sv, 20 },
+	{ "glScissorIndexedv", (void**)&glad_glScissorIndexedv, (void*)glad_ctx_glScissorIndexedv, (void*)glad_lazy_glScissorIndexedv, 41 },
+	{ "glPushAttrib", (void**)&glad_glPushAttrib, (void*)glad_ctx_glPushAttrib, (void*)glad_lazy_glPushAttrib, 10 },
+	{ "glVertexAttribIPointer", (void**)&glad_glVertexAttribIPointer, (void*)glad_ctx_glVertexAttribIPointer, (void*)glad_lazy_glVertexAttribIPointer, 30 },
+	{ "glBlendFunc", (void**)&glad_glBlendFunc, (void*)glad_ctx_glBlendFunc, (void*)glad_lazy_glBlendFunc, 10 },
+	{ "glCreateProgram", (void**)&glad_glCreateProgram, (void*)glad_ctx_glCreateProgram, (void*)glad_lazy_glCreateProgram, 20 },
+	{ "glNamedBufferSubData", (void**)&glad_glNamedBufferSubData, (void*)glad_ctx_glNamedBufferSubData, (void*)glad_lazy_glNamedBufferSubData, 45 },
+	{ "glTexImage3D", (void**)&glad_glTexImage3D, (void*)glad_ctx_glTexImage3D, (void*)glad_lazy_glTexImage3D, 12 },
+	{ "glIsFramebuffer", (void**)&glad_glIsFramebuffer, (void*)glad_ctx_glIsFramebuffer, (void*)glad_lazy_glIsFramebuffer, 30 },
+	{ "glClearNamedFramebufferfv", (void**)&glad_glClearNamedFramebufferfv, (void*)glad_ctx_glClearNamedFramebufferfv, (void*)glad_lazy_glClearNamedFramebufferfv, 45 },
+	{ "glLightiv", (void**)&glad_glLightiv, (void*)glad_ctx_glLightiv, (void*)glad_lazy_glLightiv, 10 },
+	{ "glGetNamedBufferSubData", (void**)&glad_glGetNamedBufferSubData, (void*)glad_ctx_glGetNamedBufferSubData, (void*)glad_lazy_glGetNamedBufferSubData, 45 },
+	{ "glCompressedTextureSubImage3D", (void**)&glad_glCompressedTextureSubImage3D, (void*)glad_ctx_glCompressedTextureSubImage3D, (void*)glad_lazy_glCompressedTextureSubImage3D, 45 },
+	{ "glPrimitiveRestartIndex", (void**)&glad_glPrimitiveRestartIndex, (void*)glad_ctx_glPrimitiveRestartIndex, (void*)glad_lazy_glPrimitiveRestartIndex, 31 },
+	{ "glFlushMappedNamedBufferRange", (void**)&glad_glFlushMappedNamedBufferRange, (void*)glad_ctx_glFlushMappedNamedBufferRange, (void*)glad_lazy_glFlushMappedNamedBufferRange, 45 },
+	{ "glInvalidateTexSubImage", (void**)&glad_glInvalidateTexSubImage, (void*)glad_ctx_glInvalidateTexSubImage, (void*)glad_lazy_glInvalidateTexSubImage, 43 },
+	{ "glTexGenfv", (void**)&glad_glTexGenfv, (void*)glad_ctx_glTexGenfv, (void*)glad_lazy_glTexGenfv, 10 },
+	{ "glGetTextureParameterIuiv", (void**)&glad_glGetTextureParameterIuiv, (void*)glad_ctx_glGetTextureParameterIuiv, (void*)glad_lazy_glGetTextureParameterIuiv, 45 },
+	{ "glGetnConvolutionFilter", (void**)&glad_glGetnConvolutionFilter, (void*)glad_ctx_glGetnConvolutionFilter, (void*)glad_lazy_glGetnConvolutionFilter, 45 },
+	{ "glBindImageTextures", (void**)&glad_glBindImageTextures, (void*)glad_ctx_glBindImageTextures, (void*)glad_lazy_glBindImageTextures, 44 },
+	{ "glEnd", (void**)&glad_glEnd, (void*)glad_ctx_glEnd, (void*)glad_lazy_glEnd, 10 },
+	{ "glDeleteBuffers", (void**)&glad_glDeleteBuffers, (void*)glad_ctx_glDeleteBuffers, (void*)glad_lazy_glDeleteBuffers, 15 },
+	{ "glBindProgramPipeline", (void**)&glad_glBindProgramPipeline, (void*)glad_ctx_glBindProgramPipeline, (void*)glad_lazy_glBindProgramPipeline, 41 },
+	{ "glScissor", (void**)&glad_glScissor, (void*)glad_ctx_glScissor, (void*)glad_lazy_glScissor, 10 },
+	{ "glTexCoordP4uiv", (void**)&glad_glTexCoordP4uiv, (void*)glad_ctx_glTexCoordP4uiv, (void*)glad_lazy_glTexCoordP4uiv, 33 },
+	{ "glClipPlane", (void**)&glad_glClipPlane, (void*)glad_ctx_glClipPlane, (void*)glad_lazy_glClipPlane, 10 },
+	{ "glPushName", (void**)&glad_glPushName, (void*)glad_ctx_glPushName, (void*)glad_lazy_glPushName, 10 },
+	{ "glTexGendv", (void**)&glad_glTexGendv, (void*)glad_ctx_glTexGendv, (void*)glad_lazy_glTexGendv, 10 },
+	{ "glIndexub", (void**)&glad_glIndexub, (void*)glad_ctx_glIndexub, (void*)glad_lazy_glIndexub, 11 },
+	{ "glGetNamedFramebufferAttachmentParameteriv", (void**)&glad_glGetNamedFramebufferAttachmentParameteriv, (void*)glad_ctx_glGetNamedFramebufferAttachmentParameteriv, (void*)glad_lazy_glGetNamedFramebufferAttachmentParameteriv, 45 },
+	{ "glNamedFramebufferRenderbuffer", (void**)&glad_glNamedFramebufferRenderbuffer, (void*)glad_ctx_glNamedFramebufferRenderbuffer, (void*)glad_lazy_glNamedFramebufferRenderbuffer, 45 },
+	{ "glVertexP2uiv", (void**)&glad_glVertexP2uiv, (void*)glad_ctx_glVertexP2uiv, (void*)glad_lazy_glVertexP2uiv, 33 },
+	{ "glSecondaryColor3iv", (void**)&glad_glSecondaryColor3iv, (void*)glad_ctx_glSecondaryColor3iv, (void*)glad_lazy_glSecondaryColor3iv, 14 },
+	{ "glRasterPos4i", (void**)&glad_glRasterPos4i, (void*)glad_ctx_glRasterPos4i, (void*)glad_lazy_glRasterPos4i, 10 },
+	{ "glMultTransposeMatrixd", (void**)&glad_glMultTransposeMatrixd, (void*)glad_ctx_glMultTransposeMatrixd, (void*)glad_lazy_glMultTransposeMatrixd, 13 },
+	{ "glClearColor", (void**)&glad_glClearColor, (void*)glad_ctx_glClearColor, (void*)glad_lazy_glClearColor, 10 },
+	{ "glVertexAttrib4uiv", (void**)&glad_glVertexAttrib4uiv, (void*)glad_ctx_glVertexAttrib4uiv, (void*)glad_lazy_glVertexAttrib4uiv, 20 },
+	{ "glNormal3s", (void**)&glad_glNormal3s, (void*)glad_ctx_glNormal3s, (void*)glad_lazy_glNormal3s, 10 },
+	{ "glVertexAttrib4Niv", (void**)&glad_glVertexAttrib4Niv, (void*)glad_ctx_glVertexAttrib4Niv, (void*)glad_lazy_glVertexAttrib4Niv, 20 },
+	{ "glProgramUniformMatrix2x3fv", (void**)&glad_glProgramUniformMatrix2x3fv, (void*)glad_ctx_glProgramUniformMatrix2x3fv, (void*)glad_lazy_glProgramUniformMatrix2x3fv, 41 },
+	{ "glClearBufferiv", (void**)&glad_glClearBufferiv, (void*)glad_ctx_glClearBufferiv, (void*)glad_lazy_glClearBufferiv, 30 },
+	{ "glPointParameteri", (void**)&glad_glPointParameteri, (void*)glad_ctx_glPointParameteri, (void*)glad_lazy_glPointParameteri, 14 },
+	{ "glProgramUniform4dv", (void**)&glad_glProgramUniform4dv, (void*)glad_ctx_glProgramUniform4dv, (void*)glad_lazy_glProgramUniform4dv, 41 },
+	{ "glColorP4uiv", (void**)&glad_glColorP4uiv, (void*)glad_ctx_glColorP4uiv, (void*)glad_lazy_glColorP4uiv, 33 },
+	{ "glBlendColor", (void**)&glad_glBlendColor, (void*)glad_ctx_glBlendColor, (void*)glad_lazy_glBlendColor, 14 },
+	{ "glGetnPixelMapuiv", (void**)&glad_glGetnPixelMapuiv, (void*)glad_ctx_glGetnPixelMapuiv, (void*)glad_lazy_glGetnPixelMapuiv, 45 },
+	{ "glGetTextureLevelParameteriv", (void**)&glad_glGetTextureLevelParameteriv, (void*)glad_ctx_glGetTextureLevelParameteriv, (void*)glad_lazy_glGetTextureLevelParameteriv, 45 },
+	{ "glWindowPos3d", (void**)&glad_glWindowPos3d, (void*)glad_ctx_glWindowPos3d, (void*)glad_lazy_glWindowPos3d, 14 },
+	{ "glProgramUniform3fv", (void**)&glad_glProgramUniform3fv, (void*)glad_ctx_glProgramUniform3fv, (void*)glad_lazy_glProgramUniform3fv, 41 },
+	{ "glVertexAttribI2uiv", (void**)&glad_glVertexAttribI2uiv, (void*)glad_ctx_glVertexAttribI2uiv, (void*)glad_lazy_glVertexAttribI2uiv, 30 },
+	{ "glGetNamedFramebufferParameteriv", (void**)&glad_glGetNamedFramebufferParameteriv, (void*)glad_ctx_glGetNamedFramebufferParameteriv, (void*)glad_lazy_glGetNamedFramebufferParameteriv, 45 },
+	{ "glSamplerParameterIuiv", (void**)&glad_glSamplerParameterIuiv, (void*)glad_ctx_glSamplerParameterIuiv, (void*)glad_lazy_glSamplerParameterIuiv, 33 },
+	{ "glUniform3ui", (void**)&glad_glUniform3ui, (void*)glad_ctx_glUniform3ui, (void*)glad_lazy_glUniform3ui, 30 },
+	{ "glProgramUniform3uiv", (void**)&glad_glProgramUniform3uiv, (void*)glad_ctx_glProgramUniform3uiv, (void*)glad_lazy_glProgramUniform3uiv, 41 },
+	{ "glColor4dv", (void**)&glad_glColor4dv, (void*)glad_ctx_glColor4dv, (void*)glad_lazy_glColor4dv, 10 },
+	{ "glVertexAttribI4uiv", (void**)&glad_glVertexAttribI4uiv, (void*)glad_ctx_glVertexAttribI4uiv, (void*)glad_lazy_glVertexAttribI4uiv, 30 },
+	{ "glPointParameterfv", (void**)&glad_glPointParameterfv, (void*)glad_ctx_glPointParameterfv, (void*)glad_lazy_glPointParameterfv, 14 },
+	{ "glResumeTransformFeedback", (void**)&glad_glResumeTransformFeedback, (void*)glad_ctx_glResumeTransformFeedback, (void*)glad_lazy_glResumeTransformFeedback, 40 },
+	{ "glUniform2fv", (void**)&glad_glUniform2fv, (void*)glad_ctx_glUniform2fv, (void*)glad_lazy_glUniform2fv, 20 },
+	{ "glGetActiveSubroutineUniformName", (void**)&glad_glGetActiveSubroutineUniformName, (void*)glad_ctx_glGetActiveSubroutineUniformName, (void*)glad_lazy_glGetActiveSubroutineUniformName, 40 },
+	{ "glGetProgramResourceIndex", (void**)&glad_glGetProgramResourceIndex, (void*)glad_ctx_glGetProgramResourceIndex, (void*)glad_lazy_glGetProgramResourceIndex, 43 },
+	{ "glSecondaryColor3ub", (void**)&glad_glSecondaryColor3ub, (void*)glad_ctx_glSecondaryColor3ub, (void*)glad_lazy_glSecondaryColor3ub, 14 },
+	{ "glDrawElementsIndirect", (void**)&glad_glDrawElementsIndirect, (void*)glad_ctx_glDrawElementsIndirect, (void*)glad_lazy_glDrawElementsIndirect, 40 },
+	{ "glGetTextureLevelParameterfv", (void**)&glad_glGetTextureLevelParameterfv, (void*)glad_ctx_glGetTextureLevelParameterfv, (void*)glad_lazy_glGetTextureLevelParameterfv, 45 },
+	{ "glSecondaryColor3ui", (void**)&glad_glSecondaryColor3ui, (void*)glad_ctx_glSecondaryColor3ui, (void*)glad_lazy_glSecondaryColor3ui, 14 },
+	{ "glTexCoord3dv", (void**)&glad_glTexCoord3dv, (void*)glad_ctx_glTexCoord3dv, (void*)glad_lazy_glTexCoord3dv, 10 },
+	{ "glGetNamedBufferPointerv", (void**)&glad_glGetNamedBufferPointerv, (void*)glad_ctx_glGetNamedBufferPointerv, (void*)glad_lazy_glGetNamedBufferPointerv, 45 },
+	{ "glDispatchComputeIndirect", (void**)&glad_glDispatchComputeIndirect, (void*)glad_ctx_glDispatchComputeIndirect, (void*)glad_lazy_glDispatchComputeIndirect, 43 },
+	{ "glInvalidateNamedFramebufferSubData", (void**)&glad_glInvalidateNamedFramebufferSubData, (void*)glad_ctx_glInvalidateNamedFramebufferSubData, (void*)glad_lazy_glInvalidateNamedFramebufferSubData, 45 },
+	{ "glGetSamplerParameterIuiv", (void**)&glad_glGetSamplerParameterIuiv, (void*)glad_ctx_glGetSamplerParameterIuiv, (void*)glad_lazy_glGetSamplerParameterIuiv, 33 },
+	{ "glBindBufferRange", (void**)&glad_glBindBufferRange, (void*)glad_ctx_glBindBufferRange, (void*)glad_lazy_glBindBufferRange, 30 },
+	{ "glNormal3iv", (void**)&glad_glNormal3iv, (void*)glad_ctx_glNormal3iv, (void*)glad_lazy_glNormal3iv, 10 },
+	{ "glTextureSubImage1D", (void**)&glad_glTextureSubImage1D, (void*)glad_ctx_glTextureSubImage1D, (void*)glad_lazy_glTextureSubImage1D, 45 },
+	{ "glVertexAttribL3dv", (void**)&glad_glVertexAttribL3dv, (void*)glad_ctx_glVertexAttribL3dv, (void*)glad_lazy_glVertexAttribL3dv, 41 },
+	{ "glGetUniformdv", (void**)&glad_glGetUniformdv, (void*)glad_ctx_glGetUniformdv, (void*)glad_lazy_glGetUniformdv, 40 },
+	{ "glWindowPos3s", (void**)&glad_glWindowPos3s, (void*)glad_ctx_glWindowPos3s, (void*)glad_lazy_glWindowPos3s, 14 },
+	{ "glPointParameterf", (void**)&glad_glPointParameterf, (void*)glad_ctx_glPointParameterf, (void*)glad_lazy_glPointParameterf, 14 },
+	{ "glClearDepthf", (void**)&glad_glClearDepthf, (void*)glad_ctx_glClearDepthf, (void*)glad_lazy_glClearDepthf, 41 },
+	{ "glGetVertexAttribIuiv", (void**)&glad_glGetVertexAttribIuiv, (void*)glad_ctx_glGetVertexAttribIuiv, (void*)glad_lazy_glGetVertexAttribIuiv, 30 },
+	{ "glWindowPos3i", (void**)&glad_glWindowPos3i, (void*)glad_ctx_glWindowPos3i, (void*)glad_lazy_glWindowPos3i, 14 },
+	{ "glMultiTexCoord4s", (void**)&glad_glMultiTexCoord4s, (void*)glad_ctx_glMultiTexCoord4s, (void*)glad_lazy_glMultiTexCoord4s, 13 },
+	{ "glGetTextureSubImage", (void**)&glad_glGetTextureSubImage, (void*)glad_ctx_glGetTextureSubImage, (void*)glad_lazy_glGetTextureSubImage, 45 },
+	{ "glWindowPos3f", (void**)&glad_glWindowPos3f, (void*)glad_ctx_glWindowPos3f, (void*)glad_lazy_glWindowPos3f, 14 },
+	{ "glGenTransformFeedbacks", (void**)&glad_glGenTransformFeedbacks, (void*)glad_ctx_glGenTransformFeedbacks, (void*)glad_lazy_glGenTransformFeedbacks, 40 },
+	{ "glColor3us", (void**)&glad_glColor3us, (void*)glad_ctx_glColor3us, (void*)glad_lazy_glColor3us, 10 },
+	{ "glColor3uiv", (void**)&glad_glColor3uiv, (void*)glad_ctx_glColor3uiv, (void*)glad_lazy_glColor3uiv, 10 },
+	{ "glVertexAttrib4Nusv", (void**)&glad_glVertexAttrib4Nusv, (void*)glad_ctx_glVertexAttrib4Nusv, (void*)glad_lazy_glVertexAttrib4Nusv, 20 },
+	{ "glGetLightiv", (void**)&glad_glGetLightiv, (void*)glad_ctx_glGetLightiv, (void*)glad_lazy_glGetLightiv, 10 },
+	{ "glDepthFunc", (void**)&glad_glDepthFunc, (void*)glad_ctx_glDepthFunc, (void*)glad_lazy_glDepthFunc, 10 },
+	{ "glCompressedTexSubImage2D", (void**)&glad_glCompressedTexSubImage2D, (void*)glad_ctx_glCompressedTexSubImage2D, (void*)glad_lazy_glCompressedTexSubImage2D, 13 },
+	{ "glListBase", (void**)&glad_glListBase, (void*)glad_ctx_glListBase, (void*)glad_lazy_glListBase, 10 },
+	{ "glMultiTexCoord4f", (void**)&glad_glMultiTexCoord4f, (void*)glad_ctx_glMultiTexCoord4f, (void*)glad_lazy_glMultiTexCoord4f, 13 },
+	{ "glColor3ub", (void**)&glad_glColor3ub, (void*)glad_ctx_glColor3ub, (void*)glad_lazy_glColor3ub, 10 },
+	{ "glMultiTexCoord4d", (void**)&glad_glMultiTexCoord4d, (void*)glad_ctx_glMultiTexCoord4d, (void*)glad_lazy_glMultiTexCoord4d, 13 },
+	{ "glVertexAttribI4bv", (void**)&glad_glVertexAttribI4bv, (void*)glad_ctx_glVertexAttribI4bv, (void*)glad_lazy_glVertexAttribI4bv, 30 },
+	{ "glBlendEquationSeparatei", (void**)&glad_glBlendEquationSeparatei, (void*)glad_ctx_glBlendEquationSeparatei, (void*)glad_lazy_glBlendEquationSeparatei, 40 },
+	{ "glGetTexParameterfv", (void**)&glad_glGetTexParameterfv, (void*)glad_ctx_glGetTexParameterfv, (void*)glad_lazy_glGetTexParameterfv, 10 },
+	{ "glColor3ui", (void**)&glad_glColor3ui, (void*)glad_ctx_glColor3ui, (void*)glad_lazy_glColor3ui, 10 },
+	{ "glGetProgramResourceLocationIndex", (void**)&glad_glGetProgramResourceLocationIndex, (void*)glad_ctx_glGetProgramResourceLocationIndex, (void*)glad_lazy_glGetProgramResourceLocationIndex, 43 },
+	{ "glMultiTexCoord4i", (void**)&glad_glMultiTexCoord4i, (void*)glad_ctx_glMultiTexCoord4i, (void*)glad_lazy_glMultiTexCoord4i, 13 },
+	{ "glBufferStorage", (void**)&glad_glBufferStorage, (void*)glad_ctx_glBufferStorage, (void*)glad_lazy_glBufferStorage, 44 },
+	{ "glGetPolygonStipple", (void**)&glad_glGetPolygonStipple, (void*)glad_ctx_glGetPolygonStipple, (void*)glad_lazy_glGetPolygonStipple, 10 },
+	{ "glClientWaitSync", (void**)&glad_glClientWaitSync, (void*)glad_ctx_glClientWaitSync, (void*)glad_lazy_glClientWaitSync, 32 },
+	{ "glVertexAttribI4ui", (void**)&glad_glVertexAttribI4ui, (void*)glad_ctx_glVertexAttribI4ui, (void*)glad_lazy_glVertexAttribI4ui, 30 },
+	{ "glGetFloati_v", (void**)&glad_glGetFloati_v, (void*)glad_ctx_glGetFloati_v, (void*)glad_lazy_glGetFloati_v, 41 },
+	{ "glMultiTexCoord4dv", (void**)&glad_glMultiTexCoord4dv, (void*)glad_ctx_glMultiTexCoord4dv, (void*)glad_lazy_glMultiTexCoord4dv, 13 },
+	{ "glColorMask", (void**)&glad_glColorMask, (void*)glad_ctx_glColorMask, (void*)glad_lazy_glColorMask, 10 },
+	{ "glTextureBuffer", (void**)&glad_glTextureBuffer, (void*)glad_ctx_glTextureBuffer, (void*)glad_lazy_glTextureBuffer, 45 },
+	{ "glTexParameterIiv", (void**)&glad_glTexParameterIiv, (void*)glad_ctx_glTexParameterIiv, (void*)glad_lazy_glTexParameterIiv, 30 },
+	{ "glBlendEquation", (void**)&glad_glBlendEquation, (void*)glad_ctx_glBlendEquation, (void*)glad_lazy_glBlendEquation, 14 },
+	{ "glGetUniformLocation", (void**)&glad_glGetUniformLocation, (void*)glad_ctx_glGetUniformLocation, (void*)glad_lazy_glGetUniformLocation, 20 },
+	{ "glGetSamplerParameteriv", (void**)&glad_glGetSamplerParameteriv, (void*)glad_ctx_glGetSamplerParameteriv, (void*)glad_lazy_glGetSamplerParameteriv, 33 },
+	{ "glVertexArrayAttribFormat", (void**)&glad_glVertexArrayAttribFormat, (void*)glad_ctx_glVertexArrayAttribFormat, (void*)glad_lazy_glVertexArrayAttribFormat, 45 },
+	{ "glReadnPixels", (void**)&glad_glReadnPixels, (void*)glad_ctx_glReadnPixels, (void*)glad_lazy_glReadnPixels, 45 },
+	{ "glRasterPos4s", (void**)&glad_glRasterPos4s, (void*)glad_ctx_glRasterPos4s, (void*)glad_lazy_glRasterPos4s, 10 },
+	{ "glEndTransformFeedback", (void**)&glad_glEndTransformFeedback, (void*)glad_ctx_glEndTransformFeedback, (void*)glad_lazy_glEndTransformFeedback, 30 },
+	{ "glVertexAttrib4usv", (void**)&glad_glVertexAttrib4usv, (void*)glad_ctx_glVertexAttrib4usv, (void*)glad_lazy_glVertexAttrib4usv, 20 },
+	{ "glGetUniformSubroutineuiv", (void**)&glad_glGetUniformSubroutineuiv, (void*)glad_ctx_glGetUniformSubroutineuiv, (void*)glad_lazy_glGetUniformSubroutineuiv, 40 },
+	{ "glMultiTexCoord3dv", (void**)&glad_glMultiTexCoord3dv, (void*)glad_ctx_glMultiTexCoord3dv, (void*)glad_lazy_glMultiTexCoord3dv, 13 },
+	{ "glBindVertexBuffer", (void**)&glad_glBindVertexBuffer, (void*)glad_ctx_glBindVertexBuffer, (void*)glad_lazy_glBindVertexBuffer, 43 },
+	{ "glColor4sv", (void**)&glad_glColor4sv, (void*)glad_ctx_glColor4sv, (void*)glad_lazy_glColor4sv, 10 },
+	{ "glDebugMessageInsert", (void**)&glad_glDebugMessageInsert, (void*)glad_ctx_glDebugMessageInsert, (void*)glad_lazy_glDebugMessageInsert, 43 },
+	{ "glCreateSamplers", (void**)&glad_glCreateSamplers, (void*)glad_ctx_glCreateSamplers, (void*)glad_lazy_glCreateSamplers, 45 },
+	{ "glPopClientAttrib", (void**)&glad_glPopClientAttrib, (void*)glad_ctx_glPopClientAttrib, (void*)glad_lazy_glPopClientAttrib, 11 },
+	{ "glClearBufferData", (void**)&glad_glClearBufferData, (void*)glad_ctx_glClearBufferData, (void*)glad_lazy_glClearBufferData, 43 },
+	{ "glBeginTransformFeedback", (void**)&glad_glBeginTransformFeedback, (void*)glad_ctx_glBeginTransformFeedback, (void*)glad_lazy_glBeginTransformFeedback, 30 },
+	{ "glFogf", (void**)&glad_glFogf, (void*)glad_ctx_glFogf, (void*)glad_lazy_glFogf, 10 },
+	{ "glVertexAttribI1iv", (void**)&glad_glVertexAttribI1iv, (void*)glad_ctx_glVertexAttribI1iv, (void*)glad_lazy_glVertexAttribI1iv, 30 },
+	{ "glProgramBinary", (void**)&glad_glProgramBinary, (void*)glad_ctx_glProgramBinary, (void*)glad_lazy_glProgramBinary, 41 },
+	{ "glIsSampler", (void**)&glad_glIsSampler, (void*)glad_ctx_glIsSampler, (void*)glad_lazy_glIsSampler, 33 },
+	{ "glVertexP3ui", (void**)&glad_glVertexP3ui, (void*)glad_ctx_glVertexP3ui, (void*)glad_lazy_glVertexP3ui, 33 },
+	{ "glVertexAttribDivisor", (void**)&glad_glVertexAttribDivisor, (void*)glad_ctx_glVertexAttribDivisor, (void*)glad_lazy_glVertexAttribDivisor, 33 },
+	{ "glBindSamplers", (void**)&glad_glBindSamplers, (void*)glad_ctx_glBindSamplers, (void*)glad_lazy_glBindSamplers, 44 },
+	{ "glColor3iv", (void**)&glad_glColor3iv, (void*)glad_ctx_glColor3iv, (void*)glad_lazy_glColor3iv, 10 },
+	{ "glCompressedTexImage1D", (void**)&glad_glCompressedTexImage1D, (void*)glad_ctx_glCompressedTexImage1D, (void*)glad_lazy_glCompressedTexImage1D, 13 },
+	{ "glDeleteTransformFeedbacks", (void**)&glad_glDeleteTransformFeedbacks, (void*)glad_ctx_glDeleteTransformFeedbacks, (void*)glad_lazy_glDeleteTransformFeedbacks, 40 },
+	{ "glCopyTexSubImage1D", (void**)&glad_glCopyTexSubImage1D, (void*)glad_ctx_glCopyTexSubImage1D, (void*)glad_lazy_glCopyTexSubImage1D, 11 },
+	{ "glTexCoord1i", (void**)&glad_glTexCoord1i, (void*)glad_ctx_glTexCoord1i, (void*)glad_lazy_glTexCoord1i, 10 },
+	{ "glCheckFramebufferStatus", (void**)&glad_glCheckFramebufferStatus, (void*)glad_ctx_glCheckFramebufferStatus, (void*)glad_lazy_glCheckFramebufferStatus, 30 },
+	{ "glTexCoord1d", (void**)&glad_glTexCoord1d, (void*)glad_ctx_glTexCoord1d, (void*)glad_lazy_glTexCoord1d, 10 },
+	{ "glTexCoord1f", (void**)&glad_glTexCoord1f, (void*)glad_ctx_glTexCoord1f, (void*)glad_lazy_glTexCoord1f, 10 },
+	{ "glTextureStorage3D", (void**)&glad_glTextureStorage3D, (void*)glad_ctx_glTextureStorage3D, (void*)glad_lazy_glTextureStorage3D, 45 },
+	{ "glEndConditionalRender", (void**)&glad_glEndConditionalRender, (void*)glad_ctx_glEndConditionalRender, (void*)glad_lazy_glEndConditionalRender, 30 },
+	{ "glEnableClientState", (void**)&glad_glEnableClientState, (void*)glad_ctx_glEnableClientState, (void*)glad_lazy_glEnableClientState, 11 },
+	{ "glBindAttribLocation", (void**)&glad_glBindAttribLocation, (void*)glad_ctx_glBindAttribLocation, (void*)glad_lazy_glBindAttribLocation, 20 },
+	{ "glUniformMatrix4x2fv", (void**)&glad_glUniformMatrix4x2fv, (void*)glad_ctx_glUniformMatrix4x2fv, (void*)glad_lazy_glUniformMatrix4x2fv, 21 },
+	{ "glUniformMatrix2dv", (void**)&glad_glUniformMatrix2dv, (void*)glad_ctx_glUniformMatrix2dv, (void*)glad_lazy_glUniformMatrix2dv, 40 },
+	{ "glBlendFunci", (void**)&glad_glBlendFunci, (void*)glad_ctx_glBlendFunci, (void*)glad_lazy_glBlendFunci, 40 },
+	{ "glMultiTexCoord2sv", (void**)&glad_glMultiTexCoord2sv, (void*)glad_ctx_glMultiTexCoord2sv, (void*)glad_lazy_glMultiTexCoord2sv, 13 },
+	{ "glVertexAttrib1dv", (void**)&glad_glVertexAttrib1dv, (void*)glad_ctx_glVertexAttrib1dv, (void*)glad_lazy_glVertexAttrib1dv, 20 },
+	{ "glDrawRangeElements", (void**)&glad_glDrawRangeElements, (void*)glad_ctx_glDrawRangeElements, (void*)glad_lazy_glDrawRangeElements, 12 },
+	{ "glTexCoord1s", (void**)&glad_glTexCoord1s, (void*)glad_ctx_glTexCoord1s, (void*)glad_lazy_glTexCoord1s, 10 },
+	{ "glBindBufferBase", (void**)&glad_glBindBufferBase, (void*)glad_ctx_glBindBufferBase, (void*)glad_lazy_glBindBufferBase, 30 },
+	{ "glBufferSubData", (void**)&glad_glBufferSubData, (void*)glad_ctx_glBufferSubData, (void*)glad_lazy_glBufferSubData, 15 },
+	{ "glVertexAttrib4iv", (void**)&glad_glVertexAttrib4iv, (void*)glad_ctx_glVertexAttrib4iv, (void*)glad_lazy_glVertexAttrib4iv, 20 },
+	{ "glGenLists", (void**)&glad_glGenLists, (void*)glad_ctx_glGenLists, (void*)glad_lazy_glGenLists, 10 },
+	{ "glColor3bv", (void**)&glad_glColor3bv, (void*)glad_ctx_glColor3bv, (void*)glad_lazy_glColor3bv, 10 },
+	{ "glMapBufferRange", (void**)&glad_glMapBufferRange, (void*)glad_ctx_glMapBufferRange, (void*)glad_lazy_glMapBufferRange, 30 },
+	{ "glFramebufferTexture", (void**)&glad_glFramebufferTexture, (void*)glad_ctx_glFramebufferTexture, (void*)glad_lazy_glFramebufferTexture, 32 },
+	{ "glBlendFuncSeparatei", (void**)&glad_glBlendFuncSeparatei, (void*)glad_ctx_glBlendFuncSeparatei, (void*)glad_lazy_glBlendFuncSeparatei, 40 },
+	{ "glProgramUniformMatrix4x2fv", (void**)&glad_glProgramUniformMatrix4x2fv, (void*)glad_ctx_glProgramUniformMatrix4x2fv, (void*)glad_lazy_glProgramUniformMatrix4x2fv, 41 },
+	{ "glVertexAttribL1d", (void**)&glad_glVertexAttribL1d, (void*)glad_ctx_glVertexAttribL1d, (void*)glad_lazy_glVertexAttribL1d, 41 },
+	{ "glGetTexGendv", (void**)&glad_glGetTexGendv, (void*)glad_ctx_glGetTexGendv, (void*)glad_lazy_glGetTexGendv, 10 },
+	{ "glClearNamedFramebufferiv", (void**)&glad_glClearNamedFramebufferiv, (void*)glad_ctx_glClearNamedFramebufferiv, (void*)glad_lazy_glClearNamedFramebufferiv, 45 },
+	{ "glMultiDrawArrays", (void**)&glad_glMultiDrawArrays, (void*)glad_ctx_glMultiDrawArrays, (void*)glad_lazy_glMultiDrawArrays, 14 },
+	{ "glEndList", (void**)&glad_glEndList, (void*)glad_ctx_glEndList, (void*)glad_lazy_glEndList, 10 },
+	{ "glScissorIndexed", (void**)&glad_glScissorIndexed, (void*)glad_ctx_glScissorIndexed, (void*)glad_lazy_glScissorIndexed, 41 },
+	{ "glVertexP4uiv", (void**)&glad_glVertexP4uiv, (void*)glad_ctx_glVertexP4uiv, (void*)glad_lazy_glVertexP4uiv, 33 },
+	{ "glUniform2ui", (void**)&glad_glUniform2ui, (void*)glad_ctx_glUniform2ui, (void*)glad_lazy_glUniform2ui, 30 },
+	{ "glVertexAttribI2iv", (void**)&glad_glVertexAttribI2iv, (void*)glad_ctx_glVertexAttribI2iv, (void*)glad_lazy_glVertexAttribI2iv, 30 },
+	{ "glGetnMapdv", (void**)&glad_glGetnMapdv, (void*)glad_ctx_glGetnMapdv, (void*)glad_lazy_glGetnMapdv, 45 },
+	{ "glColor3usv", (void**)&glad_glColor3usv, (void*)glad_ctx_glColor3usv, (void*)glad_lazy_glColor3usv, 10 },
+	{ "glWindowPos2fv", (void**)&glad_glWindowPos2fv, (void*)glad_ctx_glWindowPos2fv, (void*)glad_lazy_glWindowPos2fv, 14 },
+	{ "glTextureView", (void**)&glad_glTextureView, (void*)glad_ctx_glTextureView, (void*)glad_lazy_glTextureView, 43 },
+	{ "glDisablei", (void**)&glad_glDisablei, (void*)glad_ctx_glDisablei, (void*)glad_lazy_glDisablei, 30 },
+	{ "glProgramUniformMatrix2x4fv", (void**)&glad_glProgramUniformMatrix2x4fv, (void*)glad_ctx_glProgramUniformMatrix2x4fv, (void*)glad_lazy_glProgramUniformMatrix2x4fv, 41 },
+	{ "glCreateRenderbuffers", (void**)&glad_glCreateRenderbuffers, (void*)glad_ctx_glCreateRenderbuffers, (void*)glad_lazy_glCreateRenderbuffers, 45 },
+	{ "glIndexMask", (void**)&glad_glIndexMask, (void*)glad_ctx_glIndexMask, (void*)glad_lazy_glIndexMask, 10 },
+	{ "glPushClientAttrib", (void**)&glad_glPushClientAttrib, (void*)glad_ctx_glPushClientAttrib, (void*)glad_lazy_glPushClientAttrib, 11 },
+	{ "glShaderSource", (void**)&glad_glShaderSource, (void*)glad_ctx_glShaderSource, (void*)glad_lazy_glShaderSource, 20 },
+	{ "glGetnSeparableFilter", (void**)&glad_glGetnSeparableFilter, (void*)glad_ctx_glGetnSeparableFilter, (void*)glad_lazy_glGetnSeparableFilter, 45 },
+	{ "glGetActiveUniformBlockName", (void**)&glad_glGetActiveUniformBlockName, (void*)glad_ctx_glGetActiveUniformBlockName, (void*)glad_lazy_glGetActiveUniformBlockName, 31 },
+	{ "glVertexAttribI3uiv", (void**)&glad_glVertexAttribI3uiv, (void*)glad_ctx_glVertexAttribI3uiv, (void*)glad_lazy_glVertexAttribI3uiv, 30 },
+	{ "glReleaseShaderCompiler", (void**)&glad_glReleaseShaderCompiler, (void*)glad_ctx_glReleaseShaderCompiler, (void*)glad_lazy_glReleaseShaderCompiler, 41 },
+	{ "glVertexAttribIFormat", (void**)&glad_glVertexAttribIFormat, (void*)glad_ctx_glVertexAttribIFormat, (void*)glad_lazy_glVertexAttribIFormat, 43 },
+	{ "glCreateFramebuffers", (void**)&glad_glCreateFramebuffers, (void*)glad_ctx_glCreateFramebuffers, (void*)glad_lazy_glCreateFramebuffers, 45 },
+	{ "glClearAccum", (void**)&glad_glClearAccum, (void*)glad_ctx_glClearAccum, (void*)glad_lazy_glClearAccum, 10 },
+	{ "glGetSynciv", (void**)&glad_glGetSynciv, (void*)glad_ctx_glGetSynciv, (void*)glad_lazy_glGetSynciv, 32 },
+	{ "glProgramUniform2uiv", (void**)&glad_glProgramUniform2uiv, (void*)glad_ctx_glProgramUniform2uiv, (void*)glad_lazy_glProgramUniform2uiv, 41 },
+	{ "glGetnPixelMapfv", (void**)&glad_glGetnPixelMapfv, (void*)glad_ctx_glGetnPixelMapfv, (void*)glad_lazy_glGetnPixelMapfv, 45 },
+	{ "glTexCoordP2uiv", (void**)&glad_glTexCoordP2uiv, (void*)glad_ctx_glTexCoordP2uiv, (void*)glad_lazy_glTexCoordP2uiv, 33 },
+	{ "glPatchParameteri", (void**)&glad_glPatchParameteri, (void*)glad_ctx_glPatchParameteri, (void*)glad_lazy_glPatchParameteri, 40 },
+	{ "glProgramUniform2i", (void**)&glad_glProgramUniform2i, (void*)glad_ctx_glProgramUniform2i, (void*)glad_lazy_glProgramUniform2i, 41 },
+	{ "glUniform2f", (void**)&glad_glUniform2f, (void*)glad_ctx_glUniform2f, (void*)glad_lazy_glUniform2f, 20 },
+	{ "glGetNamedBufferParameteri64v", (void**)&glad_glGetNamedBufferParameteri64v, (void*)glad_ctx_glGetNamedBufferParameteri64v, (void*)glad_lazy_glGetNamedBufferParameteri64v, 45 },
+	{ "glBeginQuery", (void**)&glad_glBeginQuery, (void*)glad_ctx_glBeginQuery, (void*)glad_lazy_glBeginQuery, 15 },
+	{ "glGetUniformBlockIndex", (void**)&glad_glGetUniformBlockIndex, (void*)glad_ctx_glGetUniformBlockIndex, (void*)glad_lazy_glGetUniformBlockIndex, 31 },
+	{ "glBindBuffer", (void**)&glad_glBindBuffer, (void*)glad_ctx_glBindBuffer, (void*)glad_lazy_glBindBuffer, 15 },
+	{ "glMap2d", (void**)&glad_glMap2d, (void*)glad_ctx_glMap2d, (void*)glad_lazy_glMap2d, 10 },
+	{ "glMap2f", (void**)&glad_glMap2f, (void*)glad_ctx_glMap2f, (void*)glad_lazy_glMap2f, 10 },
+	{ "glTexStorage2DMultisample", (void**)&glad_glTexStorage2DMultisample, (void*)glad_ctx_glTexStorage2DMultisample, (void*)glad_lazy_glTexStorage2DMultisample, 43 },
+	{ "glUniform2d", (void**)&glad_glUniform2d, (void*)glad_ctx_glUniform2d, (void*)glad_lazy_glUniform2d, 40 },
+	{ "glVertex4d", (void**)&glad_glVertex4d, (void*)glad_ctx_glVertex4d, (void*)glad_lazy_glVertex4d, 10 },
+	{ "glUniformMatrix2fv", (void**)&glad_glUniformMatrix2fv, (void*)glad_ctx_glUniformMatrix2fv, (void*)glad_lazy_glUniformMatrix2fv, 20 },
+	{ "glTexCoord1sv", (void**)&glad_glTexCoord1sv, (void*)glad_ctx_glTexCoord1sv, (void*)glad_lazy_glTexCoord1sv, 10 },
+	{ "glBufferData", (void**)&glad_glBufferData, (void*)glad_ctx_glBufferData, (void*)glad_lazy_glBufferData, 15 },
+	{ "glEvalPoint1", (void**)&glad_glEvalPoint1, (void*)glad_ctx_glEvalPoint1, (void*)glad_lazy_glEvalPoint1, 10 },
+	{ "glGetTexParameterIiv", (void**)&glad_glGetTexParameterIiv, (void*)glad_ctx_glGetTexParameterIiv, (void*)glad_lazy_glGetTexParameterIiv, 30 },
+	{ "glGetQueryBufferObjectui64v", (void**)&glad_glGetQueryBufferObjectui64v, (void*)glad_ctx_glGetQueryBufferObjectui64v, (void*)glad_lazy_glGetQueryBufferObjectui64v, 45 },
+	{ "glTexCoord1dv", (void**)&glad_glTexCoord1dv, (void*)glad_ctx_glTexCoord1dv, (void*)glad_lazy_glTexCoord1dv, 10 },
+	{ "glTexCoordP1ui", (void**)&glad_glTexCoordP1ui, (void*)glad_ctx_glTexCoordP1ui, (void*)glad_lazy_glTexCoordP1ui, 33 },
+	{ "glGetError", (void**)&glad_glGetError, (void*)glad_ctx_glGetError, (void*)glad_lazy_glGetError, 10 },
+	{ "glGetTexEnviv", (void**)&glad_glGetTexEnviv, (void*)glad_ctx_glGetTexEnviv, (void*)glad_lazy_glGetTexEnviv, 10 },
+	{ "glGetProgramiv", (void**)&glad_glGetProgramiv, (void*)glad_ctx_glGetProgramiv, (void*)glad_lazy_glGetProgramiv, 20 },
+	{ "glVertexAttribP2ui", (void**)&glad_glVertexAttribP2ui, (void*)glad_ctx_glVertexAttribP2ui, (void*)glad_lazy_glVertexAttribP2ui, 33 },
+	{ "glGetFloatv", (void**)&glad_glGetFloatv, (void*)glad_ctx_glGetFloatv, (void*)glad_lazy_glGetFloatv, 10 },
+	{ "glTexSubImage1D", (void**)&glad_glTexSubImage1D, (void*)glad_ctx_glTexSubImage1D, (void*)glad_lazy_glTexSubImage1D, 11 },
+	{ "glMultiTexCoord2fv", (void**)&glad_glMultiTexCoord2fv, (void*)glad_ctx_glMultiTexCoord2fv, (void*)glad_lazy_glMultiTexCoord2fv, 13 },
+	{ "glUniformMatrix2x4dv", (void**)&glad_glUniformMatrix2x4dv, (void*)glad_ctx_glUniformMatrix2x4dv, (void*)glad_lazy_glUniformMatrix2x4dv, 40 },
+	{ "glVertexAttrib2fv", (void**)&glad_glVertexAttrib2fv, (void*)glad_ctx_glVertexAttrib2fv, (void*)glad_lazy_glVertexAttrib2fv, 20 },
+	{ "glEvalCoord1d", (void**)&glad_glEvalCoord1d, (void*)glad_ctx_glEvalCoord1d, (void*)glad_lazy_glEvalCoord1d, 10 },
+	{ "glGetTexLevelParameterfv", (void**)&glad_glGetTexLevelParameterfv, (void*)glad_ctx_glGetTexLevelParameterfv, (void*)glad_lazy_glGetTexLevelParameterfv, 10 },
+	{ "glEvalCoord1f", (void**)&glad_glEvalCoord1f, (void*)glad_ctx_glEvalCoord1f, (void*)glad_lazy_glEvalCoord1f, 10 },
+	{ "glPixelMapfv", (void**)&glad_glPixelMapfv, (void*)glad_ctx_glPixelMapfv, (void*)glad_lazy_glPixelMapfv, 10 },
+	{ "glVertexAttribP3uiv", (void**)&glad_glVertexAttribP3uiv, (void*)glad_ctx_glVertexAttribP3uiv, (void*)glad_lazy_glVertexAttribP3uiv, 33 },
+	{ "glGetPixelMapusv", (void**)&glad_glGetPixelMapusv, (void*)glad_ctx_glGetPixelMapusv, (void*)glad_lazy_glGetPixelMapusv, 10 },
+	{ "glSecondaryColorP3uiv", (void**)&glad_glSecondaryColorP3uiv, (void*)glad_ctx_glSecondaryColorP3uiv, (void*)glad_lazy_glSecondaryColorP3uiv, 33 },
+	{ "glGetIntegerv", (void**)&glad_glGetIntegerv, (void*)glad_ctx_glGetIntegerv, (void*)glad_lazy_glGetIntegerv, 10 },
+	{ "glAccum", (void**)&glad_glAccum, (void*)glad_ctx_glAccum, (void*)glad_lazy_glAccum, 10 },
+	{ "glGetVertexArrayIndexed64iv", (void**)&glad_glGetVertexArrayIndexed64iv, (void*)glad_ctx_glGetVertexArrayIndexed64iv, (void*)glad_lazy_glGetVertexArrayIndexed64iv, 45 },
+	{ "glGetBufferPointerv", (void**)&glad_glGetBufferPointerv, (void*)glad_ctx_glGetBufferPointerv, (void*)glad_lazy_glGetBufferPointerv, 15 },
+	{ "glGetVertexAttribIiv", (void**)&glad_glGetVertexAttribIiv, (void*)glad_ctx_glGetVertexAttribIiv, (void*)glad_lazy_glGetVertexAttribIiv, 30 },
+	{ "glRasterPos4dv", (void**)&glad_glRasterPos4dv, (void*)glad_ctx_glRasterPos4dv, (void*)glad_lazy_glRasterPos4dv, 10 },
+	{ "glProgramUniform4fv", (void**)&glad_glProgramUniform4fv, (void*)glad_ctx_glProgramUniform4fv, (void*)glad_lazy_glProgramUniform4fv, 41 },
+	{ "glTexCoord2iv", (void**)&glad_glTexCoord2iv, (void*)glad_ctx_glTexCoord2iv, (void*)glad_lazy_glTexCoord2iv, 10 },
+	{ "glTextureBarrier", (void**)&glad_glTextureBarrier, (void*)glad_ctx_glTextureBarrier, (void*)glad_lazy_glTextureBarrier, 45 },
+	{ "glIsQuery", (void**)&glad_glIsQuery, (void*)glad_ctx_glIsQuery, (void*)glad_lazy_glIsQuery, 15 },
+	{ "glProgramUniform2ui", (void**)&glad_glProgramUniform2ui, (void*)glad_ctx_glProgramUniform2ui, (void*)glad_lazy_glProgramUniform2ui, 41 },
+	{ "glProgramUniform4ui", (void**)&glad_glProgramUniform4ui, (void*)glad_ctx_glProgramUniform4ui, (void*)glad_lazy_glProgramUniform4ui, 41 },
+	{ "glVertexAttrib4sv", (void**)&glad_glVertexAttrib4sv, (void*)glad_ctx_glVertexAttrib4sv, (void*)glad_lazy_glVertexAttrib4sv, 20 },
+	{ "glWindowPos3dv", (void**)&glad_glWindowPos3dv, (void*)glad_ctx_glWindowPos3dv, (void*)glad_lazy_glWindowPos3dv, 14 },
+	{ "glTexImage2D", (void**)&glad_glTexImage2D, (void*)glad_ctx_glTexImage2D, (void*)glad_lazy_glTexImage2D, 10 },
+	{ "glStencilMask", (void**)&glad_glStencilMask, (void*)glad_ctx_glStencilMask, (void*)glad_lazy_glStencilMask, 10 },
+	{ "glDrawPixels", (void**)&glad_glDrawPixels, (void*)glad_ctx_glDrawPixels, (void*)glad_lazy_glDrawPixels, 10 },
+	{ "glMultMatrixd", (void**)&glad_glMultMatrixd, (void*)glad_ctx_glMultMatrixd, (void*)glad_lazy_glMultMatrixd, 10 },
+	{ "glMultMatrixf", (void**)&glad_glMultMatrixf, (void*)glad_ctx_glMultMatrixf, (void*)glad_lazy_glMultMatrixf, 10 },
+	{ "glIsTexture", (void**)&glad_glIsTexture, (void*)glad_ctx_glIsTexture, (void*)glad_lazy_glIsTexture, 11 },
+	{ "glGetMaterialiv", (void**)&glad_glGetMaterialiv, (void*)glad_ctx_glGetMaterialiv, (void*)glad_lazy_glGetMaterialiv, 10 },
+	{ "glNamedBufferData", (void**)&glad_glNamedBufferData, (void*)glad_ctx_glNamedBufferData, (void*)glad_lazy_glNamedBufferData, 45 },
+	{ "glUniform1fv", (void**)&glad_glUniform1fv, (void*)glad_ctx_glUniform1fv, (void*)glad_lazy_glUniform1fv, 20 },
+	{ "glLoadMatrixf", (void**)&glad_glLoadMatrixf, (void*)glad_ctx_glLoadMatrixf, (void*)glad_lazy_glLoadMatrixf, 10 },
+	{ "glTexStorage2D", (void**)&glad_glTexStorage2D, (void*)glad_ctx_glTexStorage2D, (void*)glad_lazy_glTexStorage2D, 42 },
+	{ "glLoadMatrixd", (void**)&glad_glLoadMatrixd, (void*)glad_ctx_glLoadMatrixd, (void*)glad_lazy_glLoadMatrixd, 10 },
+	{ "glClearNamedBufferSubData", (void**)&glad_glClearNamedBufferSubData, (void*)glad_ctx_glClearNamedBufferSubData, (void*)glad_lazy_glClearNamedBufferSubData, 45 },
+	{ "glMapNamedBufferRange", (void**)&glad_glMapNamedBufferRange, (void*)glad_ctx_glMapNamedBufferRange, (void*)glad_lazy_glMapNamedBufferRange, 45 },
+	{ "glNamedFramebufferTextureLayer", (void**)&glad_glNamedFramebufferTextureLayer, (void*)glad_ctx_glNamedFramebufferTextureLayer, (void*)glad_lazy_glNamedFramebufferTextureLayer, 45 },
+	{ "glTexParameterfv", (void**)&glad_glTexParameterfv, (void*)glad_ctx_glTexParameterfv, (void*)glad_lazy_glTexParameterfv, 10 },
+	{ "glUniformMatrix3fv", (void**)&glad_glUniformMatrix3fv, (void*)glad_ctx_glUniformMatrix3fv, (void*)glad_lazy_glUniformMatrix3fv, 20 },
+	{ "glVertex4f", (void**)&glad_glVertex4f, (void*)glad_ctx_glVertex4f, (void*)glad_lazy_glVertex4f, 10 },
+	{ "glRectsv", (void**)&glad_glRectsv, (void*)glad_ctx_glRectsv, (void*)glad_lazy_glRectsv, 10 },
+	{ "glColor4usv", (void**)&glad_glColor4usv, (void*)glad_ctx_glColor4usv, (void*)glad_lazy_glColor4usv, 10 },
+	{ "glUniform3dv", (void**)&glad_glUniform3dv, (void*)glad_ctx_glUniform3dv, (void*)glad_lazy_glUniform3dv, 40 },
+	{ "glProgramUniformMatrix4x3fv", (void**)&glad_glProgramUniformMatrix4x3fv, (void*)glad_ctx_glProgramUniformMatrix4x3fv, (void*)glad_lazy_glProgramUniformMatrix4x3fv, 41 },
+	{ "glPolygonStipple", (void**)&glad_glPolygonStipple, (void*)glad_ctx_glPolygonStipple, (void*)glad_lazy_glPolygonStipple, 10 },
+	{ "glBindBuffersBase", (void**)&glad_glBindBuffersBase, (void*)glad_ctx_glBindBuffersBase, (void*)glad_lazy_glBindBuffersBase, 44 },
+	{ "glInterleavedArrays", (void**)&glad_glInterleavedArrays, (void*)glad_ctx_glInterleavedArrays, (void*)glad_lazy_glInterleavedArrays, 11 },
+	{ "glGetSubroutineUniformLocation", (void**)&glad_glGetSubroutineUniformLocation, (void*)glad_ctx_glGetSubroutineUniformLocation, (void*)glad_lazy_glGetSubroutineUniformLocation, 40 },
+	{ "glNormal3i", (void**)&glad_glNormal3i, (void*)glad_ctx_glNormal3i, (void*)glad_lazy_glNormal3i, 10 },
+	{ "glNormal3f", (void**)&glad_glNormal3f, (void*)glad_ctx_glNormal3f, (void*)glad_lazy_glNormal3f, 10 },
+	{ "glNormal3d", (void**)&glad_glNormal3d, (void*)glad_ctx_glNormal3d, (void*)glad_lazy_glNormal3d, 10 },
+	{ "glNormal3b", (void**)&glad_glNormal3b, (void*)glad_ctx_glNormal3b, (void*)glad_lazy_glNormal3b, 10 },
+	{ "glGetFramebufferParameteriv", (void**)&glad_glGetFramebufferParameteriv, (void*)glad_ctx_glGetFramebufferParameteriv, (void*)glad_lazy_glGetFramebufferParameteriv, 43 },
+	{ "glPixelMapusv", (void**)&glad_glPixelMapusv, (void*)glad_ctx_glPixelMapusv, (void*)glad_lazy_glPixelMapusv, 10 },
+	{ "glGetTexGeniv", (void**)&glad_glGetTexGeniv, (void*)glad_ctx_glGetTexGeniv, (void*)glad_lazy_glGetTexGeniv, 10 },
+	{ "glArrayElement", (void**)&glad_glArrayElement, (void*)glad_ctx_glArrayElement, (void*)glad_lazy_glArrayElement, 11 },
+	{ "glGetCompressedTextureSubImage", (void**)&glad_glGetCompressedTextureSubImage, (void*)glad_ctx_glGetCompressedTextureSubImage, (void*)glad_lazy_glGetCompressedTextureSubImage, 45 },
+	{ "glCopyBufferSubData", (void**)&glad_glCopyBufferSubData, (void*)glad_ctx_glCopyBufferSubData, (void*)glad_lazy_glCopyBufferSubData, 31 },
+	{ "glVertexAttribI1uiv", (void**)&glad_glVertexAttribI1uiv, (void*)glad_ctx_glVertexAttribI1uiv, (void*)glad_lazy_glVertexAttribI1uiv, 30 },
+	{ "glVertexAttrib2d", (void**)&glad_glVertexAttrib2d, (void*)glad_ctx_glVertexAttrib2d, (void*)glad_lazy_glVertexAttrib2d, 20 },
+	{ "glBindTransformFeedback", (void**)&glad_glBindTransformFeedback, (void*)glad_ctx_glBindTransformFeedback, (void*)glad_lazy_glBindTransformFeedback, 40 },
+	{ "glVertexAttrib2f", (void**)&glad_glVertexAttrib2f, (void*)glad_ctx_glVertexAttrib2f, (void*)glad_lazy_glVertexAttrib2f, 20 },
+	{ "glVertexAttrib3dv", (void**)&glad_glVertexAttrib3dv, (void*)glad_ctx_glVertexAttrib3dv, (void*)glad_lazy_glVertexAttrib3dv, 20 },
+	{ "glGetQueryObjectui64v", (void**)&glad_glGetQueryObjectui64v, (void*)glad_ctx_glGetQueryObjectui64v, (void*)glad_lazy_glGetQueryObjectui64v, 33 },
+	{ "glDepthMask", (void**)&glad_glDepthMask, (void*)glad_ctx_glDepthMask, (void*)glad_lazy_glDepthMask, 10 },
+	{ "glVertexAttrib2s", (void**)&glad_glVertexAttrib2s, (void*)glad_ctx_glVertexAttrib2s, (void*)glad_lazy_glVertexAttrib2s, 20 },
+	{ "glColor3fv", (void**)&glad_glColor3fv, (void*)glad_ctx_glColor3fv, (void*)glad_lazy_glColor3fv, 10 },
+	{ "glTexImage3DMultisample", (void**)&glad_glTexImage3DMultisample, (void*)glad_ctx_glTexImage3DMultisample, (void*)glad_lazy_glTexImage3DMultisample, 32 },
+	{ "glProgramUniform1fv", (void**)&glad_glProgramUniform1fv, (void*)glad_ctx_glProgramUniform1fv, (void*)glad_lazy_glProgramUniform1fv, 41 },
+	{ "glUniformMatrix4fv", (void**)&glad_glUniformMatrix4fv, (void*)glad_ctx_glUniformMatrix4fv, (void*)glad_lazy_glUniformMatrix4fv, 20 },
+	{ "glUniform4fv", (void**)&glad_glUniform4fv, (void*)glad_ctx_glUniform4fv, (void*)glad_lazy_glUniform4fv, 20 },
+	{ "glGetActiveUniform", (void**)&glad_glGetActiveUniform, (void*)glad_ctx_glGetActiveUniform, (void*)glad_lazy_glGetActiveUniform, 20 },
+	{ "glColorPointer", (void**)&glad_glColorPointer, (void*)glad_ctx_glColorPointer, (void*)glad_lazy_glColorPointer, 11 },
+	{ "glFrontFace", (void**)&glad_glFrontFace, (void*)glad_ctx_glFrontFace, (void*)glad_lazy_glFrontFace, 10 },
+	{ "glTexBufferRange", (void**)&glad_glTexBufferRange, (void*)glad_ctx_glTexBufferRange, (void*)glad_lazy_glTexBufferRange, 43 },
+	{ "glCreateBuffers", (void**)&glad_glCreateBuffers, (void*)glad_ctx_glCreateBuffers, (void*)glad_lazy_glCreateBuffers, 45 },
+	{ "glNamedFramebufferParameteri", (void**)&glad_glNamedFramebufferParameteri, (void*)glad_ctx_glNamedFramebufferParameteri, (void*)glad_lazy_glNamedFramebufferParameteri, 45 },
+	{ "glDrawArraysInstancedBaseInstance", (void**)&glad_glDrawArraysInstancedBaseInstance, (void*)glad_ctx_glDrawArraysInstancedBaseInstance, (void*)glad_lazy_glDrawArraysInstancedBaseInstance, 42 },
+	{ "glGetBooleani_v", (void**)&glad_glGetBooleani_v, (void*)glad_ctx_glGetBooleani_v, (void*)glad_lazy_glGetBooleani_v, 30 },
+	{ "glVertexAttribL3d", (void**)&glad_glVertexAttribL3d, (void*)glad_ctx_glVertexAttribL3d, (void*)glad_lazy_glVertexAttribL3d, 41 },
+	{ "glDeleteProgramPipelines", (void**)&glad_glDeleteProgramPipelines, (void*)glad_ctx_glDeleteProgramPipelines, (void*)glad_lazy_glDeleteProgramPipelines, 41 },
+	{ "glClearBufferuiv", (void**)&glad_glClearBufferuiv, (void*)glad_ctx_glClearBufferuiv, (void*)glad_lazy_glClearBufferuiv, 30 },
+	{ "glClipControl", (void**)&glad_glClipControl, (void*)glad_ctx_glClipControl, (void*)glad_lazy_glClipControl, 45 },
+	{ "glGetProgramResourceiv", (void**)&glad_glGetProgramResourceiv, (void*)glad_ctx_glGetProgramResourceiv, (void*)glad_lazy_glGetProgramResourceiv, 43 },
+};
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -2398,48 +9905,1127 @@ static void load_GL_VERSION_4_6(GLADloadproc load) {
 	glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)load("glMultiDrawElementsIndirectCount");
 	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)load("glPolygonOffsetClamp");
 }
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = glad_lazy_glCullFace;
+	glad_glFrontFace = glad_lazy_glFrontFace;
+	glad_glHint = glad_lazy_glHint;
+	glad_glLineWidth = glad_lazy_glLineWidth;
+	glad_glPointSize = glad_lazy_glPointSize;
+	glad_glPolygonMode = glad_lazy_glPolygonMode;
+	glad_glScissor = glad_lazy_glScissor;
+	glad_glTexParameterf = glad_lazy_glTexParameterf;
+	glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+	glad_glTexParameteri = glad_lazy_glTexParameteri;
+	glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+	glad_glTexImage1D = glad_lazy_glTexImage1D;
+	glad_glTexImage2D = glad_lazy_glTexImage2D;
+	glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+	glad_glClear = glad_lazy_glClear;
+	glad_glClearColor = glad_lazy_glClearColor;
+	glad_glClearStencil = glad_lazy_glClearStencil;
+	glad_glClearDepth = glad_lazy_glClearDepth;
+	glad_glStencilMask = glad_lazy_glStencilMask;
+	glad_glColorMask = glad_lazy_glColorMask;
+	glad_glDepthMask = glad_lazy_glDepthMask;
+	glad_glDisable = glad_lazy_glDisable;
+	glad_glEnable = glad_lazy_glEnable;
+	glad_glFinish = glad_lazy_glFinish;
+	glad_glFlush = glad_lazy_glFlush;
+	glad_glBlendFunc = glad_lazy_glBlendFunc;
+	glad_glLogicOp = glad_lazy_glLogicOp;
+	glad_glStencilFunc = glad_lazy_glStencilFunc;
+	glad_glStencilOp = glad_lazy_glStencilOp;
+	glad_glDepthFunc = glad_lazy_glDepthFunc;
+	glad_glPixelStoref = glad_lazy_glPixelStoref;
+	glad_glPixelStorei = glad_lazy_glPixelStorei;
+	glad_glReadBuffer = glad_lazy_glReadBuffer;
+	glad_glReadPixels = glad_lazy_glReadPixels;
+	glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+	glad_glGetDoublev = glad_lazy_glGetDoublev;
+	glad_glGetError = glad_lazy_glGetError;
+	glad_glGetFloatv = glad_lazy_glGetFloatv;
+	glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+	glad_glGetTexImage = glad_lazy_glGetTexImage;
+	glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = glad_lazy_glIsEnabled;
+	glad_glDepthRange = glad_lazy_glDepthRange;
+	glad_glViewport = glad_lazy_glViewport;
+	glad_glNewList = glad_lazy_glNewList;
+	glad_glEndList = glad_lazy_glEndList;
+	glad_glCallList = glad_lazy_glCallList;
+	glad_glCallLists = glad_lazy_glCallLists;
+	glad_glDeleteLists = glad_lazy_glDeleteLists;
+	glad_glGenLists = glad_lazy_glGenLists;
+	glad_glListBase = glad_lazy_glListBase;
+	glad_glBegin = glad_lazy_glBegin;
+	glad_glBitmap = glad_lazy_glBitmap;
+	glad_glColor3b = glad_lazy_glColor3b;
+	glad_glColor3bv = glad_lazy_glColor3bv;
+	glad_glColor3d = glad_lazy_glColor3d;
+	glad_glColor3dv = glad_lazy_glColor3dv;
+	glad_glColor3f = glad_lazy_glColor3f;
+	glad_glColor3fv = glad_lazy_glColor3fv;
+	glad_glColor3i = glad_lazy_glColor3i;
+	glad_glColor3iv = glad_lazy_glColor3iv;
+	glad_glColor3s = glad_lazy_glColor3s;
+	glad_glColor3sv = glad_lazy_glColor3sv;
+	glad_glColor3ub = glad_lazy_glColor3ub;
+	glad_glColor3ubv = glad_lazy_glColor3ubv;
+	glad_glColor3ui = glad_lazy_glColor3ui;
+	glad_glColor3uiv = glad_lazy_glColor3uiv;
+	glad_glColor3us = glad_lazy_glColor3us;
+	glad_glColor3usv = glad_lazy_glColor3usv;
+	glad_glColor4b = glad_lazy_glColor4b;
+	glad_glColor4bv = glad_lazy_glColor4bv;
+	glad_glColor4d = glad_lazy_glColor4d;
+	glad_glColor4dv = glad_lazy_glColor4dv;
+	glad_glColor4f = glad_lazy_glColor4f;
+	glad_glColor4fv = glad_lazy_glColor4fv;
+	glad_glColor4i = glad_lazy_glColor4i;
+	glad_glColor4iv = glad_lazy_glColor4iv;
+	glad_glColor4s = glad_lazy_glColor4s;
+	glad_glColor4sv = glad_lazy_glColor4sv;
+	glad_glColor4ub = glad_lazy_glColor4ub;
+	glad_glColor4ubv = glad_lazy_glColor4ubv;
+	glad_glColor4ui = glad_lazy_glColor4ui;
+	glad_glColor4uiv = glad_lazy_glColor4uiv;
+	glad_glColor4us = glad_lazy_glColor4us;
+	glad_glColor4usv = glad_lazy_glColor4usv;
+	glad_glEdgeFlag = glad_lazy_glEdgeFlag;
+	glad_glEdgeFlagv = glad_lazy_glEdgeFlagv;
+	glad_glEnd = glad_lazy_glEnd;
+	glad_glIndexd = glad_lazy_glIndexd;
+	glad_glIndexdv = glad_lazy_glIndexdv;
+	glad_glIndexf = glad_lazy_glIndexf;
+	glad_glIndexfv = glad_lazy_glIndexfv;
+	glad_glIndexi = glad_lazy_glIndexi;
+	glad_glIndexiv = glad_lazy_glIndexiv;
+	glad_glIndexs = glad_lazy_glIndexs;
+	glad_glIndexsv = glad_lazy_glIndexsv;
+	glad_glNormal3b = glad_lazy_glNormal3b;
+	glad_glNormal3bv = glad_lazy_glNormal3bv;
+	glad_glNormal3d = glad_lazy_glNormal3d;
+	glad_glNormal3dv = glad_lazy_glNormal3dv;
+	glad_glNormal3f = glad_lazy_glNormal3f;
+	glad_glNormal3fv = glad_lazy_glNormal3fv;
+	glad_glNormal3i = glad_lazy_glNormal3i;
+	glad_glNormal3iv = glad_lazy_glNormal3iv;
+	glad_glNormal3s = glad_lazy_glNormal3s;
+	glad_glNormal3sv = glad_lazy_glNormal3sv;
+	glad_glRasterPos2d = glad_lazy_glRasterPos2d;
+	glad_glRasterPos2dv = glad_lazy_glRasterPos2dv;
+	glad_glRasterPos2f = glad_lazy_glRasterPos2f;
+	glad_glRasterPos2fv = glad_lazy_glRasterPos2fv;
+	glad_glRasterPos2i = glad_lazy_glRasterPos2i;
+	glad_glRasterPos2iv = glad_lazy_glRasterPos2iv;
+	glad_glRasterPos2s = glad_lazy_glRasterPos2s;
+	glad_glRasterPos2sv = glad_lazy_glRasterPos2sv;
+	glad_glRasterPos3d = glad_lazy_glRasterPos3d;
+	glad_glRasterPos3dv = glad_lazy_glRasterPos3dv;
+	glad_glRasterPos3f = glad_lazy_glRasterPos3f;
+	glad_glRasterPos3fv = glad_lazy_glRasterPos3fv;
+	glad_glRasterPos3i = glad_lazy_glRasterPos3i;
+	glad_glRasterPos3iv = glad_lazy_glRasterPos3iv;
+	glad_glRasterPos3s = glad_lazy_glRasterPos3s;
+	glad_glRasterPos3sv = glad_lazy_glRasterPos3sv;
+	glad_glRasterPos4d = glad_lazy_glRasterPos4d;
+	glad_glRasterPos4dv = glad_lazy_glRasterPos4dv;
+	glad_glRasterPos4f = glad_lazy_glRasterPos4f;
+	glad_glRasterPos4fv = glad_lazy_glRasterPos4fv;
+	glad_glRasterPos4i = glad_lazy_glRasterPos4i;
+	glad_glRasterPos4iv = glad_lazy_glRasterPos4iv;
+	glad_glRasterPos4s = glad_lazy_glRasterPos4s;
+	glad_glRasterPos4sv = glad_lazy_glRasterPos4sv;
+	glad_glRectd = glad_lazy_glRectd;
+	glad_glRectdv = glad_lazy_glRectdv;
+	glad_glRectf = glad_lazy_glRectf;
+	glad_glRectfv = glad_lazy_glRectfv;
+	glad_glRecti = glad_lazy_glRecti;
+	glad_glRectiv = glad_lazy_glRectiv;
+	glad_glRects = glad_lazy_glRects;
+	glad_glRectsv = glad_lazy_glRectsv;
+	glad_glTexCoord1d = glad_lazy_glTexCoord1d;
+	glad_glTexCoord1dv = glad_lazy_glTexCoord1dv;
+	glad_glTexCoord1f = glad_lazy_glTexCoord1f;
+	glad_glTexCoord1fv = glad_lazy_glTexCoord1fv;
+	glad_glTexCoord1i = glad_lazy_glTexCoord1i;
+	glad_glTexCoord1iv = glad_lazy_glTexCoord1iv;
+	glad_glTexCoord1s = glad_lazy_glTexCoord1s;
+	glad_glTexCoord1sv = glad_lazy_glTexCoord1sv;
+	glad_glTexCoord2d = glad_lazy_glTexCoord2d;
+	glad_glTexCoord2dv = glad_lazy_glTexCoord2dv;
+	glad_glTexCoord2f = glad_lazy_glTexCoord2f;
+	glad_glTexCoord2fv = glad_lazy_glTexCoord2fv;
+	glad_glTexCoord2i = glad_lazy_glTexCoord2i;
+	glad_glTexCoord2iv = glad_lazy_glTexCoord2iv;
+	glad_glTexCoord2s = glad_lazy_glTexCoord2s;
+	glad_glTexCoord2sv = glad_lazy_glTexCoord2sv;
+	glad_glTexCoord3d = glad_lazy_glTexCoord3d;
+	glad_glTexCoord3dv = glad_lazy_glTexCoord3dv;
+	glad_glTexCoord3f = glad_lazy_glTexCoord3f;
+	glad_glTexCoord3fv = glad_lazy_glTexCoord3fv;
+	glad_glTexCoord3i = glad_lazy_glTexCoord3i;
+	glad_glTexCoord3iv = glad_lazy_glTexCoord3iv;
+	glad_glTexCoord3s = glad_lazy_glTexCoord3s;
+	glad_glTexCoord3sv = glad_lazy_glTexCoord3sv;
+	glad_glTexCoord4d = glad_lazy_glTexCoord4d;
+	glad_glTexCoord4dv = glad_lazy_glTexCoord4dv;
+	glad_glTexCoord4f = glad_lazy_glTexCoord4f;
+	glad_glTexCoord4fv = glad_lazy_glTexCoord4fv;
+	glad_glTexCoord4i = glad_lazy_glTexCoord4i;
+	glad_glTexCoord4iv = glad_lazy_glTexCoord4iv;
+	glad_glTexCoord4s = glad_lazy_glTexCoord4s;
+	glad_glTexCoord4sv = glad_lazy_glTexCoord4sv;
+	glad_glVertex2d = glad_lazy_glVertex2d;
+	glad_glVertex2dv = glad_lazy_glVertex2dv;
+	glad_glVertex2f = glad_lazy_glVertex2f;
+	glad_glVertex2fv = glad_lazy_glVertex2fv;
+	glad_glVertex2i = glad_lazy_glVertex2i;
+	glad_glVertex2iv = glad_lazy_glVertex2iv;
+	glad_glVertex2s = glad_lazy_glVertex2s;
+	glad_glVertex2sv = glad_lazy_glVertex2sv;
+	glad_glVertex3d = glad_lazy_glVertex3d;
+	glad_glVertex3dv = glad_lazy_glVertex3dv;
+	glad_glVertex3f = glad_lazy_glVertex3f;
+	glad_glVertex3fv = glad_lazy_glVertex3fv;
+	glad_glVertex3i = glad_lazy_glVertex3i;
+	glad_glVertex3iv = glad_lazy_glVertex3iv;
+	glad_glVertex3s = glad_lazy_glVertex3s;
+	glad_glVertex3sv = glad_lazy_glVertex3sv;
+	glad_glVertex4d = glad_lazy_glVertex4d;
+	glad_glVertex4dv = glad_lazy_glVertex4dv;
+	glad_glVertex4f = glad_lazy_glVertex4f;
+	glad_glVertex4fv = glad_lazy_glVertex4fv;
+	glad_glVertex4i = glad_lazy_glVertex4i;
+	glad_glVertex4iv = glad_lazy_glVertex4iv;
+	glad_glVertex4s = glad_lazy_glVertex4s;
+	glad_glVertex4sv = glad_lazy_glVertex4sv;
+	glad_glClipPlane = glad_lazy_glClipPlane;
+	glad_glColorMaterial = glad_lazy_glColorMaterial;
+	glad_glFogf = glad_lazy_glFogf;
+	glad_glFogfv = glad_lazy_glFogfv;
+	glad_glFogi = glad_lazy_glFogi;
+	glad_glFogiv = glad_lazy_glFogiv;
+	glad_glLightf = glad_lazy_glLightf;
+	glad_glLightfv = glad_lazy_glLightfv;
+	glad_glLighti = glad_lazy_glLighti;
+	glad_glLightiv = glad_lazy_glLightiv;
+	glad_glLightModelf = glad_lazy_glLightModelf;
+	glad_glLightModelfv = glad_lazy_glLightModelfv;
+	glad_glLightModeli = glad_lazy_glLightModeli;
+	glad_glLightModeliv = glad_lazy_glLightModeliv;
+	glad_glLineStipple = glad_lazy_glLineStipple;
+	glad_glMaterialf = glad_lazy_glMaterialf;
+	glad_glMaterialfv = glad_lazy_glMaterialfv;
+	glad_glMateriali = glad_lazy_glMateriali;
+	glad_glMaterialiv = glad_lazy_glMaterialiv;
+	glad_glPolygonStipple = glad_lazy_glPolygonStipple;
+	glad_glShadeModel = glad_lazy_glShadeModel;
+	glad_glTexEnvf = glad_lazy_glTexEnvf;
+	glad_glTexEnvfv = glad_lazy_glTexEnvfv;
+	glad_glTexEnvi = glad_lazy_glTexEnvi;
+	glad_glTexEnviv = glad_lazy_glTexEnviv;
+	glad_glTexGend = glad_lazy_glTexGend;
+	glad_glTexGendv = glad_lazy_glTexGendv;
+	glad_glTexGenf = glad_lazy_glTexGenf;
+	glad_glTexGenfv = glad_lazy_glTexGenfv;
+	glad_glTexGeni = glad_lazy_glTexGeni;
+	glad_glTexGeniv = glad_lazy_glTexGeniv;
+	glad_glFeedbackBuffer = glad_lazy_glFeedbackBuffer;
+	glad_glSelectBuffer = glad_lazy_glSelectBuffer;
+	glad_glRenderMode = glad_lazy_glRenderMode;
+	glad_glInitNames = glad_lazy_glInitNames;
+	glad_glLoadName = glad_lazy_glLoadName;
+	glad_glPassThrough = glad_lazy_glPassThrough;
+	glad_glPopName = glad_lazy_glPopName;
+	glad_glPushName = glad_lazy_glPushName;
+	glad_glClearAccum = glad_lazy_glClearAccum;
+	glad_glClearIndex = glad_lazy_glClearIndex;
+	glad_glIndexMask = glad_lazy_glIndexMask;
+	glad_glAccum = glad_lazy_glAccum;
+	glad_glPopAttrib = glad_lazy_glPopAttrib;
+	glad_glPushAttrib = glad_lazy_glPushAttrib;
+	glad_glMap1d = glad_lazy_glMap1d;
+	glad_glMap1f = glad_lazy_glMap1f;
+	glad_glMap2d = glad_lazy_glMap2d;
+	glad_glMap2f = glad_lazy_glMap2f;
+	glad_glMapGrid1d = glad_lazy_glMapGrid1d;
+	glad_glMapGrid1f = glad_lazy_glMapGrid1f;
+	glad_glMapGrid2d = glad_lazy_glMapGrid2d;
+	glad_glMapGrid2f = glad_lazy_glMapGrid2f;
+	glad_glEvalCoord1d = glad_lazy_glEvalCoord1d;
+	glad_glEvalCoord1dv = glad_lazy_glEvalCoord1dv;
+	glad_glEvalCoord1f = glad_lazy_glEvalCoord1f;
+	glad_glEvalCoord1fv = glad_lazy_glEvalCoord1fv;
+	glad_glEvalCoord2d = glad_lazy_glEvalCoord2d;
+	glad_glEvalCoord2dv = glad_lazy_glEvalCoord2dv;
+	glad_glEvalCoord2f = glad_lazy_glEvalCoord2f;
+	glad_glEvalCoord2fv = glad_lazy_glEvalCoord2fv;
+	glad_glEvalMesh1 = glad_lazy_glEvalMesh1;
+	glad_glEvalPoint1 = glad_lazy_glEvalPoint1;
+	glad_glEvalMesh2 = glad_lazy_glEvalMesh2;
+	glad_glEvalPoint2 = glad_lazy_glEvalPoint2;
+	glad_glAlphaFunc = glad_lazy_glAlphaFunc;
+	glad_glPixelZoom = glad_lazy_glPixelZoom;
+	glad_glPixelTransferf = glad_lazy_glPixelTransferf;
+	glad_glPixelTransferi = glad_lazy_glPixelTransferi;
+	glad_glPixelMapfv = glad_lazy_glPixelMapfv;
+	glad_glPixelMapuiv = glad_lazy_glPixelMapuiv;
+	glad_glPixelMapusv = glad_lazy_glPixelMapusv;
+	glad_glCopyPixels = glad_lazy_glCopyPixels;
+	glad_glDrawPixels = glad_lazy_glDrawPixels;
+	glad_glGetClipPlane = glad_lazy_glGetClipPlane;
+	glad_glGetLightfv = glad_lazy_glGetLightfv;
+	glad_glGetLightiv = glad_lazy_glGetLightiv;
+	glad_glGetMapdv = glad_lazy_glGetMapdv;
+	glad_glGetMapfv = glad_lazy_glGetMapfv;
+	glad_glGetMapiv = glad_lazy_glGetMapiv;
+	glad_glGetMaterialfv = glad_lazy_glGetMaterialfv;
+	glad_glGetMaterialiv = glad_lazy_glGetMaterialiv;
+	glad_glGetPixelMapfv = glad_lazy_glGetPixelMapfv;
+	glad_glGetPixelMapuiv = glad_lazy_glGetPixelMapuiv;
+	glad_glGetPixelMapusv = glad_lazy_glGetPixelMapusv;
+	glad_glGetPolygonStipple = glad_lazy_glGetPolygonStipple;
+	glad_glGetTexEnvfv = glad_lazy_glGetTexEnvfv;
+	glad_glGetTexEnviv = glad_lazy_glGetTexEnviv;
+	glad_glGetTexGendv = glad_lazy_glGetTexGendv;
+	glad_glGetTexGenfv = glad_lazy_glGetTexGenfv;
+	glad_glGetTexGeniv = glad_lazy_glGetTexGeniv;
+	glad_glIsList = glad_lazy_glIsList;
+	glad_glFrustum = glad_lazy_glFrustum;
+	glad_glLoadIdentity = glad_lazy_glLoadIdentity;
+	glad_glLoadMatrixf = glad_lazy_glLoadMatrixf;
+	glad_glLoadMatrixd = glad_lazy_glLoadMatrixd;
+	glad_glMatrixMode = glad_lazy_glMatrixMode;
+	glad_glMultMatrixf = glad_lazy_glMultMatrixf;
+	glad_glMultMatrixd = glad_lazy_glMultMatrixd;
+	glad_glOrtho = glad_lazy_glOrtho;
+	glad_glPopMatrix = glad_lazy_glPopMatrix;
+	glad_glPushMatrix = glad_lazy_glPushMatrix;
+	glad_glRotated = glad_lazy_glRotated;
+	glad_glRotatef = glad_lazy_glRotatef;
+	glad_glScaled = glad_lazy_glScaled;
+	glad_glScalef = glad_lazy_glScalef;
+	glad_glTranslated = glad_lazy_glTranslated;
+	glad_glTranslatef = glad_lazy_glTranslatef;
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = glad_lazy_glDrawArrays;
+	glad_glDrawElements = glad_lazy_glDrawElements;
+	glad_glGetPointerv = glad_lazy_glGetPointerv;
+	glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+	glad_glBindTexture = glad_lazy_glBindTexture;
+	glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+	glad_glGenTextures = glad_lazy_glGenTextures;
+	glad_glIsTexture = glad_lazy_glIsTexture;
+	glad_glArrayElement = glad_lazy_glArrayElement;
+	glad_glColorPointer = glad_lazy_glColorPointer;
+	glad_glDisableClientState = glad_lazy_glDisableClientState;
+	glad_glEdgeFlagPointer = glad_lazy_glEdgeFlagPointer;
+	glad_glEnableClientState = glad_lazy_glEnableClientState;
+	glad_glIndexPointer = glad_lazy_glIndexPointer;
+	glad_glInterleavedArrays = glad_lazy_glInterleavedArrays;
+	glad_glNormalPointer = glad_lazy_glNormalPointer;
+	glad_glTexCoordPointer = glad_lazy_glTexCoordPointer;
+	glad_glVertexPointer = glad_lazy_glVertexPointer;
+	glad_glAreTexturesResident = glad_lazy_glAreTexturesResident;
+	glad_glPrioritizeTextures = glad_lazy_glPrioritizeTextures;
+	glad_glIndexub = glad_lazy_glIndexub;
+	glad_glIndexubv = glad_lazy_glIndexubv;
+	glad_glPopClientAttrib = glad_lazy_glPopClientAttrib;
+	glad_glPushClientAttrib = glad_lazy_glPushClientAttrib;
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+	glad_glTexImage3D = glad_lazy_glTexImage3D;
+	glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = glad_lazy_glActiveTexture;
+	glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+	glad_glClientActiveTexture = glad_lazy_glClientActiveTexture;
+	glad_glMultiTexCoord1d = glad_lazy_glMultiTexCoord1d;
+	glad_glMultiTexCoord1dv = glad_lazy_glMultiTexCoord1dv;
+	glad_glMultiTexCoord1f = glad_lazy_glMultiTexCoord1f;
+	glad_glMultiTexCoord1fv = glad_lazy_glMultiTexCoord1fv;
+	glad_glMultiTexCoord1i = glad_lazy_glMultiTexCoord1i;
+	glad_glMultiTexCoord1iv = glad_lazy_glMultiTexCoord1iv;
+	glad_glMultiTexCoord1s = glad_lazy_glMultiTexCoord1s;
+	glad_glMultiTexCoord1sv = glad_lazy_glMultiTexCoord1sv;
+	glad_glMultiTexCoord2d = glad_lazy_glMultiTexCoord2d;
+	glad_glMultiTexCoord2dv = glad_lazy_glMultiTexCoord2dv;
+	glad_glMultiTexCoord2f = glad_lazy_glMultiTexCoord2f;
+	glad_glMultiTexCoord2fv = glad_lazy_glMultiTexCoord2fv;
+	glad_glMultiTexCoord2i = glad_lazy_glMultiTexCoord2i;
+	glad_glMultiTexCoord2iv = glad_lazy_glMultiTexCoord2iv;
+	glad_glMultiTexCoord2s = glad_lazy_glMultiTexCoord2s;
+	glad_glMultiTexCoord2sv = glad_lazy_glMultiTexCoord2sv;
+	glad_glMultiTexCoord3d = glad_lazy_glMultiTexCoord3d;
+	glad_glMultiTexCoord3dv = glad_lazy_glMultiTexCoord3dv;
+	glad_glMultiTexCoord3f = glad_lazy_glMultiTexCoord3f;
+	glad_glMultiTexCoord3fv = glad_lazy_glMultiTexCoord3fv;
+	glad_glMultiTexCoord3i = glad_lazy_glMultiTexCoord3i;
+	glad_glMultiTexCoord3iv = glad_lazy_glMultiTexCoord3iv;
+	glad_glMultiTexCoord3s = glad_lazy_glMultiTexCoord3s;
+	glad_glMultiTexCoord3sv = glad_lazy_glMultiTexCoord3sv;
+	glad_glMultiTexCoord4d = glad_lazy_glMultiTexCoord4d;
+	glad_glMultiTexCoord4dv = glad_lazy_glMultiTexCoord4dv;
+	glad_glMultiTexCoord4f = glad_lazy_glMultiTexCoord4f;
+	glad_glMultiTexCoord4fv = glad_lazy_glMultiTexCoord4fv;
+	glad_glMultiTexCoord4i = glad_lazy_glMultiTexCoord4i;
+	glad_glMultiTexCoord4iv = glad_lazy_glMultiTexCoord4iv;
+	glad_glMultiTexCoord4s = glad_lazy_glMultiTexCoord4s;
+	glad_glMultiTexCoord4sv = glad_lazy_glMultiTexCoord4sv;
+	glad_glLoadTransposeMatrixf = glad_lazy_glLoadTransposeMatrixf;
+	glad_glLoadTransposeMatrixd = glad_lazy_glLoadTransposeMatrixd;
+	glad_glMultTransposeMatrixf = glad_lazy_glMultTransposeMatrixf;
+	glad_glMultTransposeMatrixd = glad_lazy_glMultTransposeMatrixd;
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+	glad_glPointParameterf = glad_lazy_glPointParameterf;
+	glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+	glad_glPointParameteri = glad_lazy_glPointParameteri;
+	glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+	glad_glFogCoordf = glad_lazy_glFogCoordf;
+	glad_glFogCoordfv = glad_lazy_glFogCoordfv;
+	glad_glFogCoordd = glad_lazy_glFogCoordd;
+	glad_glFogCoorddv = glad_lazy_glFogCoorddv;
+	glad_glFogCoordPointer = glad_lazy_glFogCoordPointer;
+	glad_glSecondaryColor3b = glad_lazy_glSecondaryColor3b;
+	glad_glSecondaryColor3bv = glad_lazy_glSecondaryColor3bv;
+	glad_glSecondaryColor3d = glad_lazy_glSecondaryColor3d;
+	glad_glSecondaryColor3dv = glad_lazy_glSecondaryColor3dv;
+	glad_glSecondaryColor3f = glad_lazy_glSecondaryColor3f;
+	glad_glSecondaryColor3fv = glad_lazy_glSecondaryColor3fv;
+	glad_glSecondaryColor3i = glad_lazy_glSecondaryColor3i;
+	glad_glSecondaryColor3iv = glad_lazy_glSecondaryColor3iv;
+	glad_glSecondaryColor3s = glad_lazy_glSecondaryColor3s;
+	glad_glSecondaryColor3sv = glad_lazy_glSecondaryColor3sv;
+	glad_glSecondaryColor3ub = glad_lazy_glSecondaryColor3ub;
+	glad_glSecondaryColor3ubv = glad_lazy_glSecondaryColor3ubv;
+	glad_glSecondaryColor3ui = glad_lazy_glSecondaryColor3ui;
+	glad_glSecondaryColor3uiv = glad_lazy_glSecondaryColor3uiv;
+	glad_glSecondaryColor3us = glad_lazy_glSecondaryColor3us;
+	glad_glSecondaryColor3usv = glad_lazy_glSecondaryColor3usv;
+	glad_glSecondaryColorPointer = glad_lazy_glSecondaryColorPointer;
+	glad_glWindowPos2d = glad_lazy_glWindowPos2d;
+	glad_glWindowPos2dv = glad_lazy_glWindowPos2dv;
+	glad_glWindowPos2f = glad_lazy_glWindowPos2f;
+	glad_glWindowPos2fv = glad_lazy_glWindowPos2fv;
+	glad_glWindowPos2i = glad_lazy_glWindowPos2i;
+	glad_glWindowPos2iv = glad_lazy_glWindowPos2iv;
+	glad_glWindowPos2s = glad_lazy_glWindowPos2s;
+	glad_glWindowPos2sv = glad_lazy_glWindowPos2sv;
+	glad_glWindowPos3d = glad_lazy_glWindowPos3d;
+	glad_glWindowPos3dv = glad_lazy_glWindowPos3dv;
+	glad_glWindowPos3f = glad_lazy_glWindowPos3f;
+	glad_glWindowPos3fv = glad_lazy_glWindowPos3fv;
+	glad_glWindowPos3i = glad_lazy_glWindowPos3i;
+	glad_glWindowPos3iv = glad_lazy_glWindowPos3iv;
+	glad_glWindowPos3s = glad_lazy_glWindowPos3s;
+	glad_glWindowPos3sv = glad_lazy_glWindowPos3sv;
+	glad_glBlendColor = glad_lazy_glBlendColor;
+	glad_glBlendEquation = glad_lazy_glBlendEquation;
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = glad_lazy_glGenQueries;
+	glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+	glad_glIsQuery = glad_lazy_glIsQuery;
+	glad_glBeginQuery = glad_lazy_glBeginQuery;
+	glad_glEndQuery = glad_lazy_glEndQuery;
+	glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = glad_lazy_glBindBuffer;
+	glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+	glad_glGenBuffers = glad_lazy_glGenBuffers;
+	glad_glIsBuffer = glad_lazy_glIsBuffer;
+	glad_glBufferData = glad_lazy_glBufferData;
+	glad_glBufferSubData = glad_lazy_glBufferSubData;
+	glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+	glad_glMapBuffer = glad_lazy_glMapBuffer;
+	glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+	glad_glAttachShader = glad_lazy_glAttachShader;
+	glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+	glad_glCompileShader = glad_lazy_glCompileShader;
+	glad_glCreateProgram = glad_lazy_glCreateProgram;
+	glad_glCreateShader = glad_lazy_glCreateShader;
+	glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+	glad_glDeleteShader = glad_lazy_glDeleteShader;
+	glad_glDetachShader = glad_lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+	glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+	glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+	glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+	glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = glad_lazy_glIsProgram;
+	glad_glIsShader = glad_lazy_glIsShader;
+	glad_glLinkProgram = glad_lazy_glLinkProgram;
+	glad_glShaderSource = glad_lazy_glShaderSource;
+	glad_glUseProgram = glad_lazy_glUseProgram;
+	glad_glUniform1f = glad_lazy_glUniform1f;
+	glad_glUniform2f = glad_lazy_glUniform2f;
+	glad_glUniform3f = glad_lazy_glUniform3f;
+	glad_glUniform4f = glad_lazy_glUniform4f;
+	glad_glUniform1i = glad_lazy_glUniform1i;
+	glad_glUniform2i = glad_lazy_glUniform2i;
+	glad_glUniform3i = glad_lazy_glUniform3i;
+	glad_glUniform4i = glad_lazy_glUniform4i;
+	glad_glUniform1fv = glad_lazy_glUniform1fv;
+	glad_glUniform2fv = glad_lazy_glUniform2fv;
+	glad_glUniform3fv = glad_lazy_glUniform3fv;
+	glad_glUniform4fv = glad_lazy_glUniform4fv;
+	glad_glUniform1iv = glad_lazy_glUniform1iv;
+	glad_glUniform2iv = glad_lazy_glUniform2iv;
+	glad_glUniform3iv = glad_lazy_glUniform3iv;
+	glad_glUniform4iv = glad_lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = glad_lazy_glValidateProgram;
+	glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = glad_lazy_glColorMaski;
+	glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+	glad_glEnablei = glad_lazy_glEnablei;
+	glad_glDisablei = glad_lazy_glDisablei;
+	glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = glad_lazy_glClampColor;
+	glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+	glad_glUniform1ui = glad_lazy_glUniform1ui;
+	glad_glUniform2ui = glad_lazy_glUniform2ui;
+	glad_glUniform3ui = glad_lazy_glUniform3ui;
+	glad_glUniform4ui = glad_lazy_glUniform4ui;
+	glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+	glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+	glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+	glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+	glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+	glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+	glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+	glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+	glad_glGetStringi = glad_lazy_glGetStringi;
+	glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+	glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = glad_lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+	glad_glFenceSync = glad_lazy_glFenceSync;
+	glad_glIsSync = glad_lazy_glIsSync;
+	glad_glDeleteSync = glad_lazy_glDeleteSync;
+	glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+	glad_glWaitSync = glad_lazy_glWaitSync;
+	glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+	glad_glGetSynciv = glad_lazy_glGetSynciv;
+	glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+	glad_glSampleMaski = glad_lazy_glSampleMaski;
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+	glad_glGenSamplers = glad_lazy_glGenSamplers;
+	glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+	glad_glIsSampler = glad_lazy_glIsSampler;
+	glad_glBindSampler = glad_lazy_glBindSampler;
+	glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+	glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+	glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+	glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+	glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+	glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+	glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+	glad_glColorP3ui = glad_lazy_glColorP3ui;
+	glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+	glad_glColorP4ui = glad_lazy_glColorP4ui;
+	glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+}
+static void lazy_GL_VERSION_4_0(void) {
+	if(!GLAD_GL_VERSION_4_0) return;
+	glad_glMinSampleShading = glad_lazy_glMinSampleShading;
+	glad_glBlendEquationi = glad_lazy_glBlendEquationi;
+	glad_glBlendEquationSeparatei = glad_lazy_glBlendEquationSeparatei;
+	glad_glBlendFunci = glad_lazy_glBlendFunci;
+	glad_glBlendFuncSeparatei = glad_lazy_glBlendFuncSeparatei;
+	glad_glDrawArraysIndirect = glad_lazy_glDrawArraysIndirect;
+	glad_glDrawElementsIndirect = glad_lazy_glDrawElementsIndirect;
+	glad_glUniform1d = glad_lazy_glUniform1d;
+	glad_glUniform2d = glad_lazy_glUniform2d;
+	glad_glUniform3d = glad_lazy_glUniform3d;
+	glad_glUniform4d = glad_lazy_glUniform4d;
+	glad_glUniform1dv = glad_lazy_glUniform1dv;
+	glad_glUniform2dv = glad_lazy_glUniform2dv;
+	glad_glUniform3dv = glad_lazy_glUniform3dv;
+	glad_glUniform4dv = glad_lazy_glUniform4dv;
+	glad_glUniformMatrix2dv = glad_lazy_glUniformMatrix2dv;
+	glad_glUniformMatrix3dv = glad_lazy_glUniformMatrix3dv;
+	glad_glUniformMatrix4dv = glad_lazy_glUniformMatrix4dv;
+	glad_glUniformMatrix2x3dv = glad_lazy_glUniformMatrix2x3dv;
+	glad_glUniformMatrix2x4dv = glad_lazy_glUniformMatrix2x4dv;
+	glad_glUniformMatrix3x2dv = glad_lazy_glUniformMatrix3x2dv;
+	glad_glUniformMatrix3x4dv = glad_lazy_glUniformMatrix3x4dv;
+	glad_glUniformMatrix4x2dv = glad_lazy_glUniformMatrix4x2dv;
+	glad_glUniformMatrix4x3dv = glad_lazy_glUniformMatrix4x3dv;
+	glad_glGetUniformdv = glad_lazy_glGetUniformdv;
+	glad_glGetSubroutineUniformLocation = glad_lazy_glGetSubroutineUniformLocation;
+	glad_glGetSubroutineIndex = glad_lazy_glGetSubroutineIndex;
+	glad_glGetActiveSubroutineUniformiv = glad_lazy_glGetActiveSubroutineUniformiv;
+	glad_glGetActiveSubroutineUniformName = glad_lazy_glGetActiveSubroutineUniformName;
+	glad_glGetActiveSubroutineName = glad_lazy_glGetActiveSubroutineName;
+	glad_glUniformSubroutinesuiv = glad_lazy_glUniformSubroutinesuiv;
+	glad_glGetUniformSubroutineuiv = glad_lazy_glGetUniformSubroutineuiv;
+	glad_glGetProgramStageiv = glad_lazy_glGetProgramStageiv;
+	glad_glPatchParameteri = glad_lazy_glPatchParameteri;
+	glad_glPatchParameterfv = glad_lazy_glPatchParameterfv;
+	glad_glBindTransformFeedback = glad_lazy_glBindTransformFeedback;
+	glad_glDeleteTransformFeedbacks = glad_lazy_glDeleteTransformFeedbacks;
+	glad_glGenTransformFeedbacks = glad_lazy_glGenTransformFeedbacks;
+	glad_glIsTransformFeedback = glad_lazy_glIsTransformFeedback;
+	glad_glPauseTransformFeedback = glad_lazy_glPauseTransformFeedback;
+	glad_glResumeTransformFeedback = glad_lazy_glResumeTransformFeedback;
+	glad_glDrawTransformFeedback = glad_lazy_glDrawTransformFeedback;
+	glad_glDrawTransformFeedbackStream = glad_lazy_glDrawTransformFeedbackStream;
+	glad_glBeginQueryIndexed = glad_lazy_glBeginQueryIndexed;
+	glad_glEndQueryIndexed = glad_lazy_glEndQueryIndexed;
+	glad_glGetQueryIndexediv = glad_lazy_glGetQueryIndexediv;
+}
+static void lazy_GL_VERSION_4_1(void) {
+	if(!GLAD_GL_VERSION_4_1) return;
+	glad_glReleaseShaderCompiler = glad_lazy_glReleaseShaderCompiler;
+	glad_glShaderBinary = glad_lazy_glShaderBinary;
+	glad_glGetShaderPrecisionFormat = glad_lazy_glGetShaderPrecisionFormat;
+	glad_glDepthRangef = glad_lazy_glDepthRangef;
+	glad_glClearDepthf = glad_lazy_glClearDepthf;
+	glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+	glad_glProgramBinary = glad_lazy_glProgramBinary;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+	glad_glUseProgramStages = glad_lazy_glUseProgramStages;
+	glad_glActiveShaderProgram = glad_lazy_glActiveShaderProgram;
+	glad_glCreateShaderProgramv = glad_lazy_glCreateShaderProgramv;
+	glad_glBindProgramPipeline = glad_lazy_glBindProgramPipeline;
+	glad_glDeleteProgramPipelines = glad_lazy_glDeleteProgramPipelines;
+	glad_glGenProgramPipelines = glad_lazy_glGenProgramPipelines;
+	glad_glIsProgramPipeline = glad_lazy_glIsProgramPipeline;
+	glad_glGetProgramPipelineiv = glad_lazy_glGetProgramPipelineiv;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+	glad_glProgramUniform1i = glad_lazy_glProgramUniform1i;
+	glad_glProgramUniform1iv = glad_lazy_glProgramUniform1iv;
+	glad_glProgramUniform1f = glad_lazy_glProgramUniform1f;
+	glad_glProgramUniform1fv = glad_lazy_glProgramUniform1fv;
+	glad_glProgramUniform1d = glad_lazy_glProgramUniform1d;
+	glad_glProgramUniform1dv = glad_lazy_glProgramUniform1dv;
+	glad_glProgramUniform1ui = glad_lazy_glProgramUniform1ui;
+	glad_glProgramUniform1uiv = glad_lazy_glProgramUniform1uiv;
+	glad_glProgramUniform2i = glad_lazy_glProgramUniform2i;
+	glad_glProgramUniform2iv = glad_lazy_glProgramUniform2iv;
+	glad_glProgramUniform2f = glad_lazy_glProgramUniform2f;
+	glad_glProgramUniform2fv = glad_lazy_glProgramUniform2fv;
+	glad_glProgramUniform2d = glad_lazy_glProgramUniform2d;
+	glad_glProgramUniform2dv = glad_lazy_glProgramUniform2dv;
+	glad_glProgramUniform2ui = glad_lazy_glProgramUniform2ui;
+	glad_glProgramUniform2uiv = glad_lazy_glProgramUniform2uiv;
+	glad_glProgramUniform3i = glad_lazy_glProgramUniform3i;
+	glad_glProgramUniform3iv = glad_lazy_glProgramUniform3iv;
+	glad_glProgramUniform3f = glad_lazy_glProgramUniform3f;
+	glad_glProgramUniform3fv = glad_lazy_glProgramUniform3fv;
+	glad_glProgramUniform3d = glad_lazy_glProgramUniform3d;
+	glad_glProgramUniform3dv = glad_lazy_glProgramUniform3dv;
+	glad_glProgramUniform3ui = glad_lazy_glProgramUniform3ui;
+	glad_glProgramUniform3uiv = glad_lazy_glProgramUniform3uiv;
+	glad_glProgramUniform4i = glad_lazy_glProgramUniform4i;
+	glad_glProgramUniform4iv = glad_lazy_glProgramUniform4iv;
+	glad_glProgramUniform4f = glad_lazy_glProgramUniform4f;
+	glad_glProgramUniform4fv = glad_lazy_glProgramUniform4fv;
+	glad_glProgramUniform4d = glad_lazy_glProgramUniform4d;
+	glad_glProgramUniform4dv = glad_lazy_glProgramUniform4dv;
+	glad_glProgramUniform4ui = glad_lazy_glProgramUniform4ui;
+	glad_glProgramUniform4uiv = glad_lazy_glProgramUniform4uiv;
+	glad_glProgramUniformMatrix2fv = glad_lazy_glProgramUniformMatrix2fv;
+	glad_glProgramUniformMatrix3fv = glad_lazy_glProgramUniformMatrix3fv;
+	glad_glProgramUniformMatrix4fv = glad_lazy_glProgramUniformMatrix4fv;
+	glad_glProgramUniformMatrix2dv = glad_lazy_glProgramUniformMatrix2dv;
+	glad_glProgramUniformMatrix3dv = glad_lazy_glProgramUniformMatrix3dv;
+	glad_glProgramUniformMatrix4dv = glad_lazy_glProgramUniformMatrix4dv;
+	glad_glProgramUniformMatrix2x3fv = glad_lazy_glProgramUniformMatrix2x3fv;
+	glad_glProgramUniformMatrix3x2fv = glad_lazy_glProgramUniformMatrix3x2fv;
+	glad_glProgramUniformMatrix2x4fv = glad_lazy_glProgramUniformMatrix2x4fv;
+	glad_glProgramUniformMatrix4x2fv = glad_lazy_glProgramUniformMatrix4x2fv;
+	glad_glProgramUniformMatrix3x4fv = glad_lazy_glProgramUniformMatrix3x4fv;
+	glad_glProgramUniformMatrix4x3fv = glad_lazy_glProgramUniformMatrix4x3fv;
+	glad_glProgramUniformMatrix2x3dv = glad_lazy_glProgramUniformMatrix2x3dv;
+	glad_glProgramUniformMatrix3x2dv = glad_lazy_glProgramUniformMatrix3x2dv;
+	glad_glProgramUniformMatrix2x4dv = glad_lazy_glProgramUniformMatrix2x4dv;
+	glad_glProgramUniformMatrix4x2dv = glad_lazy_glProgramUniformMatrix4x2dv;
+	glad_glProgramUniformMatrix3x4dv = glad_lazy_glProgramUniformMatrix3x4dv;
+	glad_glProgramUniformMatrix4x3dv = glad_lazy_glProgramUniformMatrix4x3dv;
+	glad_glValidateProgramPipeline = glad_lazy_glValidateProgramPipeline;
+	glad_glGetProgramPipelineInfoLog = glad_lazy_glGetProgramPipelineInfoLog;
+	glad_glVertexAttribL1d = glad_lazy_glVertexAttribL1d;
+	glad_glVertexAttribL2d = glad_lazy_glVertexAttribL2d;
+	glad_glVertexAttribL3d = glad_lazy_glVertexAttribL3d;
+	glad_glVertexAttribL4d = glad_lazy_glVertexAttribL4d;
+	glad_glVertexAttribL1dv = glad_lazy_glVertexAttribL1dv;
+	glad_glVertexAttribL2dv = glad_lazy_glVertexAttribL2dv;
+	glad_glVertexAttribL3dv = glad_lazy_glVertexAttribL3dv;
+	glad_glVertexAttribL4dv = glad_lazy_glVertexAttribL4dv;
+	glad_glVertexAttribLPointer = glad_lazy_glVertexAttribLPointer;
+	glad_glGetVertexAttribLdv = glad_lazy_glGetVertexAttribLdv;
+	glad_glViewportArrayv = glad_lazy_glViewportArrayv;
+	glad_glViewportIndexedf = glad_lazy_glViewportIndexedf;
+	glad_glViewportIndexedfv = glad_lazy_glViewportIndexedfv;
+	glad_glScissorArrayv = glad_lazy_glScissorArrayv;
+	glad_glScissorIndexed = glad_lazy_glScissorIndexed;
+	glad_glScissorIndexedv = glad_lazy_glScissorIndexedv;
+	glad_glDepthRangeArrayv = glad_lazy_glDepthRangeArrayv;
+	glad_glDepthRangeIndexed = glad_lazy_glDepthRangeIndexed;
+	glad_glGetFloati_v = glad_lazy_glGetFloati_v;
+	glad_glGetDoublei_v = glad_lazy_glGetDoublei_v;
+}
+static void lazy_GL_VERSION_4_2(void) {
+	if(!GLAD_GL_VERSION_4_2) return;
+	glad_glDrawArraysInstancedBaseInstance = glad_lazy_glDrawArraysInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseInstance = glad_lazy_glDrawElementsInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance;
+	glad_glGetInternalformativ = glad_lazy_glGetInternalformativ;
+	glad_glGetActiveAtomicCounterBufferiv = glad_lazy_glGetActiveAtomicCounterBufferiv;
+	glad_glBindImageTexture = glad_lazy_glBindImageTexture;
+	glad_glMemoryBarrier = glad_lazy_glMemoryBarrier;
+	glad_glTexStorage1D = glad_lazy_glTexStorage1D;
+	glad_glTexStorage2D = glad_lazy_glTexStorage2D;
+	glad_glTexStorage3D = glad_lazy_glTexStorage3D;
+	glad_glDrawTransformFeedbackInstanced = glad_lazy_glDrawTransformFeedbackInstanced;
+	glad_glDrawTransformFeedbackStreamInstanced = glad_lazy_glDrawTransformFeedbackStreamInstanced;
+}
+static void lazy_GL_VERSION_4_3(void) {
+	if(!GLAD_GL_VERSION_4_3) return;
+	glad_glClearBufferData = glad_lazy_glClearBufferData;
+	glad_glClearBufferSubData = glad_lazy_glClearBufferSubData;
+	glad_glDispatchCompute = glad_lazy_glDispatchCompute;
+	glad_glDispatchComputeIndirect = glad_lazy_glDispatchComputeIndirect;
+	glad_glCopyImageSubData = glad_lazy_glCopyImageSubData;
+	glad_glFramebufferParameteri = glad_lazy_glFramebufferParameteri;
+	glad_glGetFramebufferParameteriv = glad_lazy_glGetFramebufferParameteriv;
+	glad_glGetInternalformati64v = glad_lazy_glGetInternalformati64v;
+	glad_glInvalidateTexSubImage = glad_lazy_glInvalidateTexSubImage;
+	glad_glInvalidateTexImage = glad_lazy_glInvalidateTexImage;
+	glad_glInvalidateBufferSubData = glad_lazy_glInvalidateBufferSubData;
+	glad_glInvalidateBufferData = glad_lazy_glInvalidateBufferData;
+	glad_glInvalidateFramebuffer = glad_lazy_glInvalidateFramebuffer;
+	glad_glInvalidateSubFramebuffer = glad_lazy_glInvalidateSubFramebuffer;
+	glad_glMultiDrawArraysIndirect = glad_lazy_glMultiDrawArraysIndirect;
+	glad_glMultiDrawElementsIndirect = glad_lazy_glMultiDrawElementsIndirect;
+	glad_glGetProgramInterfaceiv = glad_lazy_glGetProgramInterfaceiv;
+	glad_glGetProgramResourceIndex = glad_lazy_glGetProgramResourceIndex;
+	glad_glGetProgramResourceName = glad_lazy_glGetProgramResourceName;
+	glad_glGetProgramResourceiv = glad_lazy_glGetProgramResourceiv;
+	glad_glGetProgramResourceLocation = glad_lazy_glGetProgramResourceLocation;
+	glad_glGetProgramResourceLocationIndex = glad_lazy_glGetProgramResourceLocationIndex;
+	glad_glShaderStorageBlockBinding = glad_lazy_glShaderStorageBlockBinding;
+	glad_glTexBufferRange = glad_lazy_glTexBufferRange;
+	glad_glTexStorage2DMultisample = glad_lazy_glTexStorage2DMultisample;
+	glad_glTexStorage3DMultisample = glad_lazy_glTexStorage3DMultisample;
+	glad_glTextureView = glad_lazy_glTextureView;
+	glad_glBindVertexBuffer = glad_lazy_glBindVertexBuffer;
+	glad_glVertexAttribFormat = glad_lazy_glVertexAttribFormat;
+	glad_glVertexAttribIFormat = glad_lazy_glVertexAttribIFormat;
+	glad_glVertexAttribLFormat = glad_lazy_glVertexAttribLFormat;
+	glad_glVertexAttribBinding = glad_lazy_glVertexAttribBinding;
+	glad_glVertexBindingDivisor = glad_lazy_glVertexBindingDivisor;
+	glad_glDebugMessageControl = glad_lazy_glDebugMessageControl;
+	glad_glDebugMessageInsert = glad_lazy_glDebugMessageInsert;
+	glad_glDebugMessageCallback = glad_lazy_glDebugMessageCallback;
+	glad_glGetDebugMessageLog = glad_lazy_glGetDebugMessageLog;
+	glad_glPushDebugGroup = glad_lazy_glPushDebugGroup;
+	glad_glPopDebugGroup = glad_lazy_glPopDebugGroup;
+	glad_glObjectLabel = glad_lazy_glObjectLabel;
+	glad_glGetObjectLabel = glad_lazy_glGetObjectLabel;
+	glad_glObjectPtrLabel = glad_lazy_glObjectPtrLabel;
+	glad_glGetObjectPtrLabel = glad_lazy_glGetObjectPtrLabel;
+	glad_glGetPointerv = glad_lazy_glGetPointerv;
+	glad_glGetPointerv = glad_lazy_glGetPointerv;
+}
+static void lazy_GL_VERSION_4_4(void) {
+	if(!GLAD_GL_VERSION_4_4) return;
+	glad_glBufferStorage = glad_lazy_glBufferStorage;
+	glad_glClearTexImage = glad_lazy_glClearTexImage;
+	glad_glClearTexSubImage = glad_lazy_glClearTexSubImage;
+	glad_glBindBuffersBase = glad_lazy_glBindBuffersBase;
+	glad_glBindBuffersRange = glad_lazy_glBindBuffersRange;
+	glad_glBindTextures = glad_lazy_glBindTextures;
+	glad_glBindSamplers = glad_lazy_glBindSamplers;
+	glad_glBindImageTextures = glad_lazy_glBindImageTextures;
+	glad_glBindVertexBuffers = glad_lazy_glBindVertexBuffers;
+}
+static void lazy_GL_VERSION_4_5(void) {
+	if(!GLAD_GL_VERSION_4_5) return;
+	glad_glClipControl = glad_lazy_glClipControl;
+	glad_glCreateTransformFeedbacks = glad_lazy_glCreateTransformFeedbacks;
+	glad_glTransformFeedbackBufferBase = glad_lazy_glTransformFeedbackBufferBase;
+	glad_glTransformFeedbackBufferRange = glad_lazy_glTransformFeedbackBufferRange;
+	glad_glGetTransformFeedbackiv = glad_lazy_glGetTransformFeedbackiv;
+	glad_glGetTransformFeedbacki_v = glad_lazy_glGetTransformFeedbacki_v;
+	glad_glGetTransformFeedbacki64_v = glad_lazy_glGetTransformFeedbacki64_v;
+	glad_glCreateBuffers = glad_lazy_glCreateBuffers;
+	glad_glNamedBufferStorage = glad_lazy_glNamedBufferStorage;
+	glad_glNamedBufferData = glad_lazy_glNamedBufferData;
+	glad_glNamedBufferSubData = glad_lazy_glNamedBufferSubData;
+	glad_glCopyNamedBufferSubData = glad_lazy_glCopyNamedBufferSubData;
+	glad_glClearNamedBufferData = glad_lazy_glClearNamedBufferData;
+	glad_glClearNamedBufferSubData = glad_lazy_glClearNamedBufferSubData;
+	glad_glMapNamedBuffer = glad_lazy_glMapNamedBuffer;
+	glad_glMapNamedBufferRange = glad_lazy_glMapNamedBufferRange;
+	glad_glUnmapNamedBuffer = glad_lazy_glUnmapNamedBuffer;
+	glad_glFlushMappedNamedBufferRange = glad_lazy_glFlushMappedNamedBufferRange;
+	glad_glGetNamedBufferParameteriv = glad_lazy_glGetNamedBufferParameteriv;
+	glad_glGetNamedBufferParameteri64v = glad_lazy_glGetNamedBufferParameteri64v;
+	glad_glGetNamedBufferPointerv = glad_lazy_glGetNamedBufferPointerv;
+	glad_glGetNamedBufferSubData = glad_lazy_glGetNamedBufferSubData;
+	glad_glCreateFramebuffers = glad_lazy_glCreateFramebuffers;
+	glad_glNamedFramebufferRenderbuffer = glad_lazy_glNamedFramebufferRenderbuffer;
+	glad_glNamedFramebufferParameteri = glad_lazy_glNamedFramebufferParameteri;
+	glad_glNamedFramebufferTexture = glad_lazy_glNamedFramebufferTexture;
+	glad_glNamedFramebufferTextureLayer = glad_lazy_glNamedFramebufferTextureLayer;
+	glad_glNamedFramebufferDrawBuffer = glad_lazy_glNamedFramebufferDrawBuffer;
+	glad_glNamedFramebufferDrawBuffers = glad_lazy_glNamedFramebufferDrawBuffers;
+	glad_glNamedFramebufferReadBuffer = glad_lazy_glNamedFramebufferReadBuffer;
+	glad_glInvalidateNamedFramebufferData = glad_lazy_glInvalidateNamedFramebufferData;
+	glad_glInvalidateNamedFramebufferSubData = glad_lazy_glInvalidateNamedFramebufferSubData;
+	glad_glClearNamedFramebufferiv = glad_lazy_glClearNamedFramebufferiv;
+	glad_glClearNamedFramebufferuiv = glad_lazy_glClearNamedFramebufferuiv;
+	glad_glClearNamedFramebufferfv = glad_lazy_glClearNamedFramebufferfv;
+	glad_glClearNamedFramebufferfi = glad_lazy_glClearNamedFramebufferfi;
+	glad_glBlitNamedFramebuffer = glad_lazy_glBlitNamedFramebuffer;
+	glad_glCheckNamedFramebufferStatus = glad_lazy_glCheckNamedFramebufferStatus;
+	glad_glGetNamedFramebufferParameteriv = glad_lazy_glGetNamedFramebufferParameteriv;
+	glad_glGetNamedFramebufferAttachmentParameteriv = glad_lazy_glGetNamedFramebufferAttachmentParameteriv;
+	glad_glCreateRenderbuffers = glad_lazy_glCreateRenderbuffers;
+	glad_glNamedRenderbufferStorage = glad_lazy_glNamedRenderbufferStorage;
+	glad_glNamedRenderbufferStorageMultisample = glad_lazy_glNamedRenderbufferStorageMultisample;
+	glad_glGetNamedRenderbufferParameteriv = glad_lazy_glGetNamedRenderbufferParameteriv;
+	glad_glCreateTextures = glad_lazy_glCreateTextures;
+	glad_glTextureBuffer = glad_lazy_glTextureBuffer;
+	glad_glTextureBufferRange = glad_lazy_glTextureBufferRange;
+	glad_glTextureStorage1D = glad_lazy_glTextureStorage1D;
+	glad_glTextureStorage2D = glad_lazy_glTextureStorage2D;
+	glad_glTextureStorage3D = glad_lazy_glTextureStorage3D;
+	glad_glTextureStorage2DMultisample = glad_lazy_glTextureStorage2DMultisample;
+	glad_glTextureStorage3DMultisample = glad_lazy_glTextureStorage3DMultisample;
+	glad_glTextureSubImage1D = glad_lazy_glTextureSubImage1D;
+	glad_glTextureSubImage2D = glad_lazy_glTextureSubImage2D;
+	glad_glTextureSubImage3D = glad_lazy_glTextureSubImage3D;
+	glad_glCompressedTextureSubImage1D = glad_lazy_glCompressedTextureSubImage1D;
+	glad_glCompressedTextureSubImage2D = glad_lazy_glCompressedTextureSubImage2D;
+	glad_glCompressedTextureSubImage3D = glad_lazy_glCompressedTextureSubImage3D;
+	glad_glCopyTextureSubImage1D = glad_lazy_glCopyTextureSubImage1D;
+	glad_glCopyTextureSubImage2D = glad_lazy_glCopyTextureSubImage2D;
+	glad_glCopyTextureSubImage3D = glad_lazy_glCopyTextureSubImage3D;
+	glad_glTextureParameterf = glad_lazy_glTextureParameterf;
+	glad_glTextureParameterfv = glad_lazy_glTextureParameterfv;
+	glad_glTextureParameteri = glad_lazy_glTextureParameteri;
+	glad_glTextureParameterIiv = glad_lazy_glTextureParameterIiv;
+	glad_glTextureParameterIuiv = glad_lazy_glTextureParameterIuiv;
+	glad_glTextureParameteriv = glad_lazy_glTextureParameteriv;
+	glad_glGenerateTextureMipmap = glad_lazy_glGenerateTextureMipmap;
+	glad_glBindTextureUnit = glad_lazy_glBindTextureUnit;
+	glad_glGetTextureImage = glad_lazy_glGetTextureImage;
+	glad_glGetCompressedTextureImage = glad_lazy_glGetCompressedTextureImage;
+	glad_glGetTextureLevelParameterfv = glad_lazy_glGetTextureLevelParameterfv;
+	glad_glGetTextureLevelParameteriv = glad_lazy_glGetTextureLevelParameteriv;
+	glad_glGetTextureParameterfv = glad_lazy_glGetTextureParameterfv;
+	glad_glGetTextureParameterIiv = glad_lazy_glGetTextureParameterIiv;
+	glad_glGetTextureParameterIuiv = glad_lazy_glGetTextureParameterIuiv;
+	glad_glGetTextureParameteriv = glad_lazy_glGetTextureParameteriv;
+	glad_glCreateVertexArrays = glad_lazy_glCreateVertexArrays;
+	glad_glDisableVertexArrayAttrib = glad_lazy_glDisableVertexArrayAttrib;
+	glad_glEnableVertexArrayAttrib = glad_lazy_glEnableVertexArrayAttrib;
+	glad_glVertexArrayElementBuffer = glad_lazy_glVertexArrayElementBuffer;
+	glad_glVertexArrayVertexBuffer = glad_lazy_glVertexArrayVertexBuffer;
+	glad_glVertexArrayVertexBuffers = glad_lazy_glVertexArrayVertexBuffers;
+	glad_glVertexArrayAttribBinding = glad_lazy_glVertexArrayAttribBinding;
+	glad_glVertexArrayAttribFormat = glad_lazy_glVertexArrayAttribFormat;
+	glad_glVertexArrayAttribIFormat = glad_lazy_glVertexArrayAttribIFormat;
+	glad_glVertexArrayAttribLFormat = glad_lazy_glVertexArrayAttribLFormat;
+	glad_glVertexArrayBindingDivisor = glad_lazy_glVertexArrayBindingDivisor;
+	glad_glGetVertexArrayiv = glad_lazy_glGetVertexArrayiv;
+	glad_glGetVertexArrayIndexediv = glad_lazy_glGetVertexArrayIndexediv;
+	glad_glGetVertexArrayIndexed64iv = glad_lazy_glGetVertexArrayIndexed64iv;
+	glad_glCreateSamplers = glad_lazy_glCreateSamplers;
+	glad_glCreateProgramPipelines = glad_lazy_glCreateProgramPipelines;
+	glad_glCreateQueries = glad_lazy_glCreateQueries;
+	glad_glGetQueryBufferObjecti64v = glad_lazy_glGetQueryBufferObjecti64v;
+	glad_glGetQueryBufferObjectiv = glad_lazy_glGetQueryBufferObjectiv;
+	glad_glGetQueryBufferObjectui64v = glad_lazy_glGetQueryBufferObjectui64v;
+	glad_glGetQueryBufferObjectuiv = glad_lazy_glGetQueryBufferObjectuiv;
+	glad_glMemoryBarrierByRegion = glad_lazy_glMemoryBarrierByRegion;
+	glad_glGetTextureSubImage = glad_lazy_glGetTextureSubImage;
+	glad_glGetCompressedTextureSubImage = glad_lazy_glGetCompressedTextureSubImage;
+	glad_glGetGraphicsResetStatus = glad_lazy_glGetGraphicsResetStatus;
+	glad_glGetnCompressedTexImage = glad_lazy_glGetnCompressedTexImage;
+	glad_glGetnTexImage = glad_lazy_glGetnTexImage;
+	glad_glGetnUniformdv = glad_lazy_glGetnUniformdv;
+	glad_glGetnUniformfv = glad_lazy_glGetnUniformfv;
+	glad_glGetnUniformiv = glad_lazy_glGetnUniformiv;
+	glad_glGetnUniformuiv = glad_lazy_glGetnUniformuiv;
+	glad_glReadnPixels = glad_lazy_glReadnPixels;
+	glad_glGetnMapdv = glad_lazy_glGetnMapdv;
+	glad_glGetnMapfv = glad_lazy_glGetnMapfv;
+	glad_glGetnMapiv = glad_lazy_glGetnMapiv;
+	glad_glGetnPixelMapfv = glad_lazy_glGetnPixelMapfv;
+	glad_glGetnPixelMapuiv = glad_lazy_glGetnPixelMapuiv;
+	glad_glGetnPixelMapusv = glad_lazy_glGetnPixelMapusv;
+	glad_glGetnPolygonStipple = glad_lazy_glGetnPolygonStipple;
+	glad_glGetnColorTable = glad_lazy_glGetnColorTable;
+	glad_glGetnConvolutionFilter = glad_lazy_glGetnConvolutionFilter;
+	glad_glGetnSeparableFilter = glad_lazy_glGetnSeparableFilter;
+	glad_glGetnHistogram = glad_lazy_glGetnHistogram;
+	glad_glGetnMinmax = glad_lazy_glGetnMinmax;
+	glad_glTextureBarrier = glad_lazy_glTextureBarrier;
+}
+static void lazy_GL_VERSION_4_6(void) {
+	if(!GLAD_GL_VERSION_4_6) return;
+	glad_glSpecializeShader = glad_lazy_glSpecializeShader;
+	glad_glMultiDrawArraysIndirectCount = glad_lazy_glMultiDrawArraysIndirectCount;
+	glad_glMultiDrawElementsIndirectCount = glad_lazy_glMultiDrawElementsIndirectCount;
+	glad_glPolygonOffsetClamp = glad_lazy_glPolygonOffsetClamp;
+}
 static int find_extensionsGL(void) {
-	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
+	if (!get_exts(&glad_default_context.exts, max_loaded_major, glad_glGetString, glad_glGetIntegerv, glad_glGetStringi)) return 0;
+	/* The set is kept alive for gladHasExtension() until the next load */
 	return 1;
 }
 
-static void find_coreGL(void) {
-
-    /* Thank you @elmindreda
-     * https://github.com/elmindreda/greg/blob/master/templates/greg.c.in#L176
-     * https://github.com/glfw/glfw/blob/master/src/context.c#L36
-     */
-    int i, major, minor;
-
-    const char* version;
-    const char* prefixes[] = {
-        "OpenGL ES-CM ",
-        "OpenGL ES-CL ",
-        "OpenGL ES ",
-        NULL
-    };
-
-    version = (const char*) glGetString(GL_VERSION);
-    if (!version) return;
-
-    for (i = 0;  prefixes[i];  i++) {
-        const size_t length = strlen(prefixes[i]);
-        if (strncmp(version, prefixes[i], length) == 0) {
-            version += length;
-            break;
-        }
-    }
-
-/* PR #18 */
-#ifdef _MSC_VER
-    sscanf_s(version, "%d.%d", &major, &minor);
-#else
-    sscanf(version, "%d.%d", &major, &minor);
-#endif
-
+/* Publishes the version of the global load (or the default context) through GLVersion and the GLAD_GL_VERSION_* flags */
+static void set_coreGL(int major, int minor) {
     GLVersion.major = major; GLVersion.minor = minor;
+    glad_default_context.version = GLVersion;
+    glad_default_context.id = next_context_id();
     max_loaded_major = major; max_loaded_minor = minor;
 	GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
 	GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
@@ -2466,8 +11052,64 @@ static void find_coreGL(void) {
 	}
 }
 
+static void find_coreGL(void) {
+
+    /* Thank you @elmindreda
+     * https://github.com/elmindreda/greg/blob/master/templates/greg.c.in#L176
+     * https://github.com/glfw/glfw/blob/master/src/context.c#L36
+     */
+    int major, minor;
+
+    const char* version;
+
+    version = (const char*) glGetString(GL_VERSION);
+    if (!version) return;
+
+    parse_version(version, &major, &minor);
+    set_coreGL(major, minor);
+}
+
+/* Fills 'context' for the GL context current on the calling thread: every entry point its version provides,
+ * the version itself and the extension set. Only goes through 'load' and the table, never the globals. */
+static int load_context(struct GladGLContext *context, GLADloadproc load) {
+    PFNGLGETSTRINGPROC get_string;
+    const char *version;
+    int version_number;
+    int i;
+
+    get_string = (PFNGLGETSTRINGPROC)load("glGetString");
+    version = get_string != NULL ? (const char *)get_string(GL_VERSION) : NULL;
+    if (version == NULL) {
+        return 0;
+    }
+    parse_version(version, &context->version.major, &context->version.minor);
+    context->id = next_context_id();
+    version_number = context->version.major * 10 + context->version.minor;
+
+    for (i = 0; i < GLAD_GL_NUM_PROCS; i++) {
+        context->procs[i] = glad_gl_procs[i].version <= version_number ? load(glad_gl_procs[i].name) : NULL;
+    }
+
+    if (!get_exts(&context->exts, context->version.major, get_string,
+                  (PFNGLGETINTEGERVPROC)load("glGetIntegerv"), (PFNGLGETSTRINGIPROC)load("glGetStringi"))) {
+        return 0;
+    }
+    return context->version.major != 0 || context->version.minor != 0;
+}
+
+/* gladLoadGLLoader(Lazy) once dispatch is on: the globals have to stay on the stubs, so the load goes into
+ * the default context and only the version globals are updated. Always eager, there are no lazy tables. */
+static int load_default_context(GLADloadproc load) {
+    GLVersion.major = 0; GLVersion.minor = 0;
+    if (!load_context(&glad_default_context, load)) return 0;
+    set_coreGL(glad_default_context.version.major, glad_default_context.version.minor);
+    return 1;
+}
+
 int gladLoadGLLoader(GLADloadproc load) {
+	if (glad_context_dispatch) return load_default_context(load);
 	GLVersion.major = 0; GLVersion.minor = 0;
+	glad_lazy_loader = NULL;
 	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
 	if(glGetString == NULL) return 0;
 	if(glGetString(GL_VERSION) == NULL) return 0;
@@ -2496,3 +11138,148 @@ int gladLoadGLLoader(GLADloadproc load) {
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	if (glad_context_dispatch) return load_default_context(load);
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glad_lazy_loader = load;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	lazy_GL_VERSION_1_0();
+	lazy_GL_VERSION_1_1();
+	lazy_GL_VERSION_1_2();
+	lazy_GL_VERSION_1_3();
+	lazy_GL_VERSION_1_4();
+	lazy_GL_VERSION_1_5();
+	lazy_GL_VERSION_2_0();
+	lazy_GL_VERSION_2_1();
+	lazy_GL_VERSION_3_0();
+	lazy_GL_VERSION_3_1();
+	lazy_GL_VERSION_3_2();
+	lazy_GL_VERSION_3_3();
+	lazy_GL_VERSION_4_0();
+	lazy_GL_VERSION_4_1();
+	lazy_GL_VERSION_4_2();
+	lazy_GL_VERSION_4_3();
+	lazy_GL_VERSION_4_4();
+	lazy_GL_VERSION_4_5();
+	lazy_GL_VERSION_4_6();
+
+	if (!find_extensionsGL()) return 0;
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+/* Runs once: moves what the globals point at into the default context, then points the globals at the stubs.
+ * Lazily loaded slots still hold trampolines that would write back into the globals, so those are resolved here. */
+static void enable_context_dispatch(void) {
+    int i;
+
+    for (i = 0; i < GLAD_GL_NUM_PROCS; i++) {
+        void *proc = *glad_gl_procs[i].slot;
+        if (proc != NULL && proc == glad_gl_procs[i].lazy) {
+            proc = glad_lazy_loader != NULL ? glad_lazy_loader(glad_gl_procs[i].name) : NULL;
+        }
+        glad_default_context.procs[i] = proc;
+    }
+    glad_lazy_loader = NULL;
+
+    for (i = 0; i < GLAD_GL_NUM_PROCS; i++) {
+        *glad_gl_procs[i].slot = glad_gl_procs[i].dispatch;
+    }
+    glad_context_dispatch = 1;
+}
+
+#ifdef _WIN32
+static INIT_ONCE glad_dispatch_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK enable_context_dispatch_once(PINIT_ONCE once, PVOID parameter, PVOID *context) {
+    (void)once; (void)parameter; (void)context;
+    enable_context_dispatch();
+    return TRUE;
+}
+
+void gladEnableGLContextDispatch(void) {
+    InitOnceExecuteOnce(&glad_dispatch_once, enable_context_dispatch_once, NULL, NULL);
+}
+#else
+static pthread_once_t glad_dispatch_once = PTHREAD_ONCE_INIT;
+
+void gladEnableGLContextDispatch(void) {
+    pthread_once(&glad_dispatch_once, enable_context_dispatch);
+}
+#endif
+
+struct GladGLContext *gladCreateGLContext(GLADloadproc load) {
+    struct GladGLContext *context;
+
+    context = (struct GladGLContext *)calloc(1, sizeof *context);
+    if (context == NULL) {
+        return NULL;
+    }
+
+    if (!load_context(context, load)) {
+        free_exts(&context->exts);
+        free((void *)context);
+        return NULL;
+    }
+    return context;
+}
+
+void gladDestroyGLContext(struct GladGLContext *context) {
+    if (context == NULL) {
+        return;
+    }
+    if (glad_current_context == context) {
+        glad_current_context = &glad_default_context;
+    }
+    free_exts(&context->exts);
+    free((void *)context);
+}
+
+void gladMakeGLContextCurrent(struct GladGLContext *context) {
+    glad_current_context = context != NULL ? context : &glad_default_context;
+}
+
+struct GladGLContext *gladGetCurrentGLContext(void) {
+    return glad_current_context != &glad_default_context ? glad_current_context : NULL;
+}
+
+struct gladGLversionStruct gladGetGLContextVersion(const struct GladGLContext *context) {
+    return context->version;
+}
+
+int gladHasExtension(const char *ext) {
+    return has_ext(&glad_current_context->exts, ext);
+}
+
+int gladGetExtensionCount(void) {
+    return glad_current_context->exts.count;
+}
+
+unsigned int gladGetGLContextId(void) {
+    return glad_current_context->id;
+}
+
+int gladIsGLVersionAtLeast(int major, int minor) {
+    const struct gladGLversionStruct *version = &glad_current_context->version;
+    return version->major > major || (version->major == major && version->minor >= minor);
+}
+
+int gladHasGLFunction(const char *name) {
+    int i;
+
+    for (i = 0; i < GLAD_GL_NUM_PROCS; i++) {
+        if (strcmp(glad_gl_procs[i].name, name) == 0) {
+            if (glad_context_dispatch) {
+                return glad_current_context->procs[i] != NULL;
+            }
+            /* A lazy trampoline is never NULL: resolve it now, the same way its first call would */
+            if (*glad_gl_procs[i].slot == glad_gl_procs[i].lazy) {
+                *glad_gl_procs[i].slot = glad_lazy_loader != NULL ? glad_lazy_loader(name) : NULL;
+            }
+            return *glad_gl_procs[i].slot != NULL;
+        }
+    }
+    return 0;
+}
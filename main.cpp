@@ -1,35 +1,149 @@
-#include <glad/glad.h>
-#include <GLFW\glfw3.h>
+#include "my_glad.h"
+#include <GLFW/glfw3.h>
 
 #include "my_stb_image.h"
 
 #include "Shader.h"
+#include "ShaderLibrary.h"
+#include "ShaderHotReload.h"
+#include "ShaderArchive.h"
+#include "UniformBuffers.h"
+#include "VertexLayout.h"
+#include "MeshOptimizer.h"
+#include "BufferArena.h"
+#include "GLStateCache.h"
+#include "ShaderWarmup.h"
+#include "HeadlessContext.h"
+#include "Framebuffer.h"
+#include "RenderFarm.h"
+#include "FrameStats.h"
+#include "Timeline.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
+#include <string>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <vector>
 #define WIREFRAME 0
+#define SHADER_HOT_RELOAD 1							// Windowed mode rebuilds shaders when files under Shaders/ change
+#define SHADER_ARCHIVE "Shaders.pak"				// Benchmarks/ShaderPack.cpp output, mapped at start-up; loose files when it is missing
+#define COMPRESSED_VERTICES 1						// Quad vertices as half-float positions, RGBA8 colors and unorm16 UVs (16 instead of 32 bytes)
+#define SHADER_WARMUP 1								// Draw each new program once offscreen before the first frame that uses it
+#define QUAD_INSTANCES 1							// Copies of the quad on a grid, drawn with one glDrawElementsInstanced (1 looks like the plain quad); 0 draws it with glDrawElements
 
-// All of the information and code is coming from https://learnopengl.com/ (might be paraphrased for author's learning purposes) 
+// All of the information and code is coming from https://learnopengl.com/ (might be paraphrased for author's learning purposes)
+
+// Decoded texture pixels, owned by stb_image
+struct Image
+{
+	int width = 0, height = 0;
+	unsigned char* data = nullptr;
+};
+
+struct SceneImages
+{
+	Image image[2];
+};
+
+// The scene's meshes after MeshOptimizer: welded, reordered and with the narrowest index type that fits
+struct SceneMeshes
+{
+	MeshOptimizer<ColorVertex>::Result triangles;			// VAO[0]
+	MeshOptimizer<TexturedVertex>::Result quad;				// VAO[1]
+};
+
+// GL objects the render loop needs. Created by SetupScene() on whatever context is current
+struct Scene
+{
+	unsigned int VAO[2];									// One per vertex format, shared by every mesh in that format
+	ArenaDraw mesh[2];										// Triangles (VAO[0]) and quad (VAO[1]): ranges in the arenas below
+	unsigned int texture[2];
+	std::shared_ptr<UniformRing> uniforms;					// Frame, material and object blocks (shared by copies of the Scene)
+	std::shared_ptr<GLStateCache> state;					// Binds go through this so unchanged state isn't set again every frame
+	std::shared_ptr<BufferArena> vertices, indices;			// Every mesh's vertex and index data, suballocated from one buffer each
+};
+
+// Command line options. Passing --frames or --headless switches to headless mode (no window, renders into a Framebuffer)
+struct Options
+{
+	bool headless = false;
+	int frames = 0;
+	const char* outDir = nullptr;					// Where headless frames are written as PPM (nothing is written when not set)
+	int farmThreads = 0;							// --farm N: render the frames as jobs on 1..N worker threads and report the scaling
+	int benchmarkFrames = 0;						// --benchmark N: fixed workload of warm-up + N measured frames, vsync off
+	int warmupFrames = 60;
+	const char* jsonPath = nullptr;					// Benchmark report destination (stdout between BEGIN/END_FRAME_REPORT lines when not set)
+	const char* baselinePath = nullptr;				// Saved report to compare against; regressions make the run fail
+	double tolerance = 0.10;						// Allowed regression against the baseline (0.10 = 10%)
+	const char* tracePath = nullptr;				// --trace file: start-up phases as Chrome trace JSON, written after the first frame
+};
 
 // Function Prototypes
 void Framebuffer_size_callback(GLFWwindow* pWindow, int width, int height);
 void ProcessInput(GLFWwindow* pWindow);
+bool ParseOptions(int argc, char** argv, Options& options);
+SceneImages LoadSceneImages();
+void FreeSceneImages(SceneImages& images);
+SceneMeshes OptimizeSceneMeshes();
+std::vector<QuadInstance> LayoutQuadInstances(int count);
+Scene SetupScene(const SceneImages& images);
+void SetupProgram(Shader& shader);
+void WarmupScene(const Scene& scene, Shader& shader);
+void ClearScene();
+void RenderScene(const Scene& scene, Shader& shader);
+void CleanupScene(Scene& scene);
+int RunHeadless(const Options& options);
+int RunRenderFarm(const Options& options);
+int RunBenchmark(const Options& options, const Scene& scene, Shader& shader, GLFWwindow* pWindow);
+void MountShaderArchive(bool checkStale);
 
 // Resolution
 const unsigned int WIN_WIDTH = 800;
 const unsigned int WIN_HEIGHT = 600;
 
-int main()
+// Variant of Shaders/Quad.vs/.fs the scene is drawn with. The mix weight is compiled in rather than set as a uniform
+const ShaderDefines TEXTURED_QUAD = { { "TEXTURED", "" }, { "MIX_WEIGHT", "0.6" }, { "UNIFORM_BLOCKS", "" },
+#if QUAD_INSTANCES
+										{ "INSTANCED", "" },
+#endif
+									  };
+
+int main(int argc, char** argv)
 {
+	Timeline::Get();																// Start-up timeline starts counting here
+	UniformBuffers::RegisterBlocks();												// Shaders include the GLSL generated from the C++ block declarations
+	Options options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		printf("Usage: %s [--trace file] [--frames N [--out dir] [--farm threads]]\n"
+			   "       %s --benchmark N [--warmup N] [--json file] [--baseline file] [--tolerance fraction] [--headless]\n", argv[0], argv[0]);
+		return -1;
+	}
+	// Before anything reads a shader. Only the windowed session, where shaders are edited and hot reloaded, pays for
+	// checking the archive against the loose files; headless runs and benchmarks trust it (ShaderPack --check)
+	MountShaderArchive(SHADER_HOT_RELOAD && !options.headless && options.benchmarkFrames == 0);
+	if (options.farmThreads > 0)
+		return RunRenderFarm(options);
+	if (options.headless)
+		return RunHeadless(options);
+
 	// ---------- Initialize and configure GLFW ----------
+	TimelineScope initPhase("glfwInit");
 	glfwInit();																	// Initializes GLFW
+	initPhase.End();
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);								// Configures GLFW. First parameter tells an option we want to configure and then comes selection
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);								// from enum of possible options prefixed with 'GLFW_'. Second argument is an int that sets the value of our option
 	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);				// In this case, its specified that GLFW should use 3.3 version of OpenGL and that it should use core-profile
 
 	// ---------- GLFW window creation ----------
 	// Create window object that holds all the windowing data and used by other GLFW functions
-	GLFWwindow* pWindow = glfwCreateWindow(WIN_WIDTH, WIN_HEIGHT, "Test Window", nullptr, nullptr);		// Create window of specified width and height 
+	TimelineScope windowPhase("glfwCreateWindow");
+	GLFWwindow* pWindow = glfwCreateWindow(WIN_WIDTH, WIN_HEIGHT, "Test Window", nullptr, nullptr);		// Create window of specified width and height
+	windowPhase.End();
 	if (pWindow == nullptr)																				// Check if creation was successful
 	{
 		printf("Failed to create GLFW window \n");														// If not, clear used resources, display error message and stop the program
@@ -40,78 +154,549 @@ int main()
 
 	// ---------- GLAD: Load all OpenGL function pointers ----------
 	// Since GLAD manages function pointers for OpenGL, initialize GLAD before calling any OpenGL functions
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))											// Pass GLAD the function to load address of the OpenGL function pointers
+	// Lazy variant only resolves a function the first time it is called, so start-up doesn't pay for the ~1000 entry points we never use
+	TimelineScope gladPhase("gladLoadGLLoader");
+	if (!gladLoadGLLoaderLazy((GLADloadproc)glfwGetProcAddress))										// Pass GLAD the function to load address of the OpenGL function pointers
 	{																									// glfwGetProtAddress() defines the correct function based on which OS the program is compiled
 		printf("Failed to initialize GLAD\n");
 		return -1;
 	}
+	gladPhase.End();
 
-	// ---------- Build and Compile shader program ----------
-	
-	Shader ourShader("Shaders/TextureVertexShaderSource.vs", "Shaders/FragmentShaderSource.fs");
+	// ---------- Build and Compile shader programs ----------
+	// Submitted as one batch; the driver compiles them while the textures are loaded below
+	ShaderLibrary shaders((GLADloadproc)glfwGetProcAddress);
+	shaders.Add("Texture", "Shaders/Quad.vs", "Shaders/Quad.fs", TEXTURED_QUAD);
+	shaders.Submit();
 
-	// ---------- Set up vertex data (and buffers) and configure vertex attributes ----------
-	// Specify three vertices
-	float vertices[] = {	// Triangle 1		 // Colors 1
-							0.6f,  -0.4f, 0.0f,  0.0f, 0.0f, 1.0f,
-							0.3f, 0.2f, 0.0f,  	 0.0f, 1.0f, 0.0f,
-							0.0f, -0.4f, 0.0f,	 1.0f,  0.0f, 0.0f,
+	SceneImages images = LoadSceneImages();
+	Scene scene = SetupScene(images);
+	FreeSceneImages(images);
+
+	if (options.benchmarkFrames > 0)
+	{
+		Shader& ourShader = *shaders.Wait("Texture");							// Measured frames need the real program from the start
+		SetupProgram(ourShader);
+		WarmupScene(scene, ourShader);
+		ProgramCache::Get().PrintStats();
+		glfwSwapInterval(0);													// Don't let vsync cap the measured frame rate
+		int result = RunBenchmark(options, scene, ourShader, pWindow);
+		CleanupScene(scene);
+		glfwTerminate();
+		return result;
+	}
+
+	// ---------- Render Loop ----------
+	bool firstFrame = true;
+	bool samplersSet = false;
+#if SHADER_HOT_RELOAD
+	ShaderHotReload hotReload;
+	hotReload.Start("Shaders");
+#endif
+	while (!glfwWindowShouldClose(pWindow))
+	{
+		TimelineScope framePhase(firstFrame ? "First frame" : nullptr);
+
+		// Input
+		ProcessInput(pWindow);
+
+		// Render, with whatever is ready: until the driver has finished the program only the background is drawn
+		shaders.Poll();
+		Shader* pShader = shaders.Get("Texture");
+		if (pShader && !samplersSet)
+		{
+			SetupProgram(*pShader);
+			WarmupScene(scene, *pShader);														// The frame below is the first one to draw with it
+			ProgramCache::Get().PrintStats();
+			samplersSet = true;
+#if SHADER_HOT_RELOAD
+			// Sampler units and block bindings belong to the program, so set them again after every reload.
+			// SetupProgram() binds the new program directly, so the state cache has to forget the old one
+			hotReload.Watch(*pShader, "Shaders/Quad.vs", "Shaders/Quad.fs", TEXTURED_QUAD, [&scene](Shader& shader)
+			{
+				SetupProgram(shader);
+				scene.state->Invalidate();
+				WarmupScene(scene, shader);
+			});
+#endif
+		}
+#if SHADER_HOT_RELOAD
+		hotReload.Update();																	// Never waits on the compiler; swaps a rebuilt program in between frames
+#endif
+		if (pShader)
+			RenderScene(scene, *pShader);
+		else
+			ClearScene();
+
+		// GLFW: Swap buffers and poll IO events (keys pressed/released, mouse movement,	 etc)
+		glfwSwapBuffers(pWindow);															// Swaps the color buffer (large buffer that contains color values for each pixel in GLFW's
+																							// window) that has been used to draw in during this iteration and outputs to screen
+		glfwPollEvents();																	// Checks if any events are triggered (i.e keyboard input or mouse movement),
+																							// updates window state and calls appropriate callback methods
+		if (firstFrame)
+		{
+			framePhase.End();
+			if (options.tracePath)
+				Timeline::Get().WriteChromeTrace(options.tracePath);
+			firstFrame = false;
+		}
+	}
+
+	// ---------- Clean up ----------
+	CleanupScene(scene);
+	shaders.Release();																		// A program still compiling when the window closed
+	glfwTerminate();
+
+	return 0;
+}
+
+// Same pipeline as the windowed path, but on a surfaceless EGL context rendering into an FBO for a fixed number of frames
+int RunHeadless(const Options& options)
+{
+	TimelineScope contextPhase("Create headless context");
+	HeadlessContext context;
+	if (!context.Init())
+		return -1;
+	contextPhase.End();
+
+	TimelineScope gladPhase("gladLoadGLLoader");
+	if (!gladLoadGLLoaderLazy(HeadlessContext::GetProcAddress()))
+	{
+		printf("Failed to initialize GLAD\n");
+		return -1;
+	}
+	gladPhase.End();
+	printf("Headless renderer: %s\n", (const char*)glGetString(GL_RENDERER));
+
+	if (options.outDir)
+		std::filesystem::create_directories(options.outDir);
+
+	Shader ourShader("Shaders/Quad.vs", "Shaders/Quad.fs", TEXTURED_QUAD);
+	ProgramCache::Get().PrintStats();
+	SceneImages images = LoadSceneImages();
+	Scene scene = SetupScene(images);
+	FreeSceneImages(images);
+	SetupProgram(ourShader);
+	WarmupScene(scene, ourShader);
+
+	Framebuffer framebuffer;
+	if (!framebuffer.Create(WIN_WIDTH, WIN_HEIGHT))
+		return -1;
+	framebuffer.Bind();
+
+	if (options.benchmarkFrames > 0)
+	{
+		int result = RunBenchmark(options, scene, ourShader, nullptr);
+		CleanupScene(scene);
+		return result;
+	}
+
+	double renderMs = 0.0;
+	for (int frame = 0; frame < options.frames; frame++)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		TimelineScope framePhase(frame == 0 ? "First frame" : nullptr);
+		RenderScene(scene, ourShader);
+		glFinish();																			// No swap to wait on, so make the frame actually complete before timing it
+		framePhase.End();
+		renderMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		if (frame == 0 && options.tracePath)
+			Timeline::Get().WriteChromeTrace(options.tracePath);
+
+		if (options.outDir)
+		{
+			char path[1024];
+			snprintf(path, sizeof(path), "%s/frame_%04d.ppm", options.outDir, frame);
+			framebuffer.SavePPM(path);
+		}
+	}
+	printf("Rendered %d frames in %.2f ms (%.1f frames/sec)\n", options.frames, renderMs, renderMs > 0.0 ? options.frames * 1000.0 / renderMs : 0.0);
+	scene.state->BeginFrame();																// Closes the last frame's counters
+	scene.state->PrintStats();
+	scene.vertices->PrintStats("vertices");
+	scene.indices->PrintStats("indices");
+	scene.uniforms->PrintStats();
+
+	CleanupScene(scene);
+	return 0;
+}
+
+// Renders --frames jobs on a pool of headless contexts, once for every thread count from 1 up to --farm,
+// and reports aggregate frames/sec. Textures are decoded once here and shared by all workers
+int RunRenderFarm(const Options& options)
+{
+	SceneImages images = LoadSceneImages();
+	if (options.outDir)
+		std::filesystem::create_directories(options.outDir);
+
+	// Per-worker GL state, indexed by worker
+	struct Worker
+	{
+		std::unique_ptr<Shader> shader;
+		std::unique_ptr<Framebuffer> framebuffer;
+		Scene scene;
+	};
+	std::vector<Worker> workers(options.farmThreads);
+
+	RenderFarm farm;
+	farm.SetupWorker = [&](int worker)
+	{
+		Worker& w = workers[worker];
+		w.shader.reset(new Shader("Shaders/Quad.vs", "Shaders/Quad.fs", TEXTURED_QUAD));
+		w.scene = SetupScene(images);
+		SetupProgram(*w.shader);
+		WarmupScene(w.scene, *w.shader);
+		w.framebuffer.reset(new Framebuffer());
+		if (!w.framebuffer->Create(WIN_WIDTH, WIN_HEIGHT))
+			return false;
+		w.framebuffer->Bind();
+		return true;
+	};
+	farm.RenderJob = [&](int worker, int job)
+	{
+		Worker& w = workers[worker];
+		RenderScene(w.scene, *w.shader);
+		if (options.outDir)
+		{
+			char path[1024];
+			snprintf(path, sizeof(path), "%s/frame_%04d.ppm", options.outDir, job);
+			w.framebuffer->SavePPM(path);
+		}
+	};
+	farm.CleanupWorker = [&](int worker)
+	{
+		Worker& w = workers[worker];
+		CleanupScene(w.scene);
+		w.framebuffer.reset();
+		w.shader.reset();
+	};
+
+	// 1, 2, 4, ... and always the requested maximum last
+	printf("%8s %10s %12s %8s\n", "threads", "seconds", "frames/sec", "speedup");
+	double baseline = 0.0;
+	for (int threads = 1; ; threads = threads * 2 < options.farmThreads ? threads * 2 : options.farmThreads)
+	{
+		double seconds = farm.Run(threads, options.frames);
+		if (seconds < 0.0)
+		{
+			FreeSceneImages(images);
+			return -1;
+		}
+		double framesPerSec = seconds > 0.0 ? options.frames / seconds : 0.0;
+		if (threads == 1)
+			baseline = framesPerSec;
+		printf("%8d %10.3f %12.1f %7.2fx\n", threads, seconds, framesPerSec, baseline > 0.0 ? framesPerSec / baseline : 0.0);
+		if (threads >= options.farmThreads)
+			break;
+	}
+	ProgramCache::Get().PrintStats();
+
+	FreeSceneImages(images);
+	return 0;
+}
+
+// Renders the warm-up frames, then times the measured ones and reports frame/CPU/GPU percentiles as JSON.
+// Presents through the window when there is one, otherwise glFinish stands in for the swap
+int RunBenchmark(const Options& options, const Scene& scene, Shader& shader, GLFWwindow* pWindow)
+{
+	for (int frame = 0; frame < options.warmupFrames; frame++)
+	{
+		RenderScene(scene, shader);
+		if (pWindow)
+			glfwSwapBuffers(pWindow);
+		else
+			glFinish();
+	}
+
+	FrameTimer timer;
+	for (int frame = 0; frame < options.benchmarkFrames; frame++)
+	{
+		timer.BeginFrame();
+		RenderScene(scene, shader);
+		timer.EndSubmit();
+		if (pWindow)
+		{
+			glfwSwapBuffers(pWindow);
+			glfwPollEvents();
+		}
+		else
+		{
+			glFinish();
+		}
+		timer.EndFrame();
+	}
+	timer.Finish();
+
+	FrameReport report = FrameReport::Build(timer, options.warmupFrames);
+	std::string json = report.ToJSON();
+	if (options.jsonPath)
+	{
+		FILE* file = fopen(options.jsonPath, "wb");
+		if (!file)
+		{
+			printf("ERROR::BENCHMARK::CANNOT_WRITE %s\n", options.jsonPath);
+			return -1;
+		}
+		fputs(json.c_str(), file);
+		fclose(file);
+	}
+	else
+	{
+		// Stdout also carries the start-up diagnostics, so the report goes between marker lines of its own
+		// (sed -n '/^BEGIN_FRAME_REPORT$/,/^END_FRAME_REPORT$/{//!p}' pulls it out)
+		printf("\nBEGIN_FRAME_REPORT\n%sEND_FRAME_REPORT\n", json.c_str());
+		fflush(stdout);
+	}
+
+	if (options.baselinePath && !CompareToBaseline(report, options.baselinePath, options.tolerance))
+		return 1;
+	return 0;
+}
+
+// Maps SHADER_ARCHIVE and says where the sources come from. With 'checkStale' the loose files are used instead when a
+// shader in it was edited after it was packed (one stat per entry)
+void MountShaderArchive(bool checkStale)
+{
+	if (!ShaderArchive::Mount(SHADER_ARCHIVE))
+	{
+		printf("Shader sources: loose files (no %s)\n", SHADER_ARCHIVE);
+		return;
+	}
+	std::string stale = checkStale ? ShaderArchive::Mounted().FindStale() : std::string();
+	if (!stale.empty())
+	{
+		printf("Shader sources: loose files (%s changed after %s was packed, run ShaderPack to refresh it)\n", stale.c_str(), SHADER_ARCHIVE);
+		ShaderArchive::Mounted().Close();
+		return;
+	}
+	printf("Shader sources: %s (%u files)\n", SHADER_ARCHIVE, ShaderArchive::Mounted().Count());
+}
+
+bool ParseOptions(int argc, char** argv, Options& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+		{
+			options.headless = true;
+			options.frames = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+		{
+			options.outDir = argv[++i];
+		}
+		else if (strcmp(argv[i], "--farm") == 0 && i + 1 < argc)
+		{
+			options.farmThreads = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+		{
+			options.tracePath = argv[++i];
+		}
+		else if (strcmp(argv[i], "--headless") == 0)
+		{
+			options.headless = true;
+		}
+		else if (strcmp(argv[i], "--benchmark") == 0 && i + 1 < argc)
+		{
+			options.benchmarkFrames = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+		{
+			options.warmupFrames = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+		{
+			options.jsonPath = argv[++i];
+		}
+		else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc)
+		{
+			options.baselinePath = argv[++i];
+		}
+		else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc)
+		{
+			options.tolerance = atof(argv[++i]);
+		}
+		else
+		{
+			return false;
+		}
+	}
+	return (!options.outDir && options.farmThreads == 0) || options.headless;
+}
+
+void ProcessInput(GLFWwindow* pWindow)
+{
+	// Returns whether the key is currently being pressed
+	if (glfwGetKey(pWindow, GLFW_KEY_ESCAPE) == GLFW_PRESS)									// If ESC key is pressed, close the window
+	{
+		glfwSetWindowShouldClose(pWindow, true);
+	}
+}
+
+void Framebuffer_size_callback(GLFWwindow* pWindow, int width, int height)
+{
+	// Ensure that viewport matches the new window dimenstions.
+	glViewport(0, 0, width, height);
+}
+
+// Decoding is kept apart from uploading so the decoded pixels can be shared by several contexts (see RunRenderFarm)
+SceneImages LoadSceneImages()
+{
+	SceneImages images;
+																								// Load in and create textures (using stb_image.h library)
+	int nrChannels;
+	stbi_set_flip_vertically_on_load(true);														// Flips any loaded image vertically
+	TimelineScope decodePhase("stbi_load", "Textures/w33d.jpg");
+	images.image[0].data = stbi_load("Textures/w33d.jpg", &images.image[0].width, &images.image[0].height, &nrChannels, 0);	// [Parameters] First: location of an image file. Second+Third: image's width and height.
+																								// Fourth: number of color channels
+	if (!images.image[0].data)
+	{
+		printf("TEXTURE::LOAD_FAIL\n");
+	}
+	decodePhase.End();
+
+	TimelineScope decodePhase2("stbi_load", "Textures/SlepoyEvrei.png");
+	images.image[1].data = stbi_load("Textures/SlepoyEvrei.png", &images.image[1].width, &images.image[1].height, &nrChannels, 4);
+	decodePhase2.End();
+	if (!images.image[1].data)
+	{
+		printf("TEXTURE::LOAD_FAIL\n");
+	}
+	return images;
+}
+
+void FreeSceneImages(SceneImages& images)
+{
+	// Free the image memory
+	for (Image& image : images.image)
+	{
+		stbi_image_free(image.data);
+		image.data = nullptr;
+	}
+}
+
+// The scene's vertex data, optimized once at load time. Prints what the optimizer did to each mesh
+SceneMeshes OptimizeSceneMeshes()
+{
+	// Specify three vertices (formats are declared in VertexLayout.h)
+	ColorVertex vertices[] = {	// Triangle 1		 // Colors 1
+							{ { 0.6f, -0.4f, 0.0f },	{ 0.0f, 0.0f, 1.0f } },
+							{ { 0.3f, 0.2f, 0.0f },		{ 0.0f, 1.0f, 0.0f } },
+							{ { 0.0f, -0.4f, 0.0f },	{ 1.0f, 0.0f, 0.0f } },
 							// Triangle 2		 // Colors 2
-							-0.6f, -0.4f, 0.0f,	 0.0f, 0.0f, 1.0f,
-							-0.3f, 0.2f, 0.0f,	 0.0f, 1.0f, 0.0f,
-							0.0f, -0.4f, 0.0f,	 1.0f,  0.0f, 0.0f };
-
-	float vertices2[] = {	// Positions			// Colors				// Texture coords
-							 0.5f,  0.5f, 0.0f,		1.0f, 0.0f, 0.0f,		1.0f, 1.0f,			// Top right
-							 0.5f, -0.5f, 0.0f,		0.0f, 1.0f, 0.0f,		1.0f, 0.0f,			// Bottom right
-							-0.5f, -0.5f, 0.0f,		0.0f, 0.0f, 1.0f,		0.0f, 0.0f,			// Botoom left
-							-0.5f,  0.5f, 0.0f,		1.0f, 1.0f, 0.0f,		0.0f, 1.0f	};		// Top left
-	
+							{ { -0.6f, -0.4f, 0.0f },	{ 0.0f, 0.0f, 1.0f } },
+							{ { -0.3f, 0.2f, 0.0f },	{ 0.0f, 1.0f, 0.0f } },
+							{ { 0.0f, -0.4f, 0.0f },	{ 1.0f, 0.0f, 0.0f } } };
+
+	TexturedVertex vertices2[] = {	// Positions			// Colors				// Texture coords
+							{ {  0.5f,  0.5f, 0.0f },	{ 1.0f, 0.0f, 0.0f },	{ 1.0f, 1.0f } },		// Top right
+							{ {  0.5f, -0.5f, 0.0f },	{ 0.0f, 1.0f, 0.0f },	{ 1.0f, 0.0f } },		// Bottom right
+							{ { -0.5f, -0.5f, 0.0f },	{ 0.0f, 0.0f, 1.0f },	{ 0.0f, 0.0f } },		// Botoom left
+							{ { -0.5f,  0.5f, 0.0f },	{ 1.0f, 1.0f, 0.0f },	{ 0.0f, 1.0f } } };		// Top left
+
 	unsigned int indices[] = {	// First Triangle
 								0, 1, 3,
 								// Second Triangle
 								1, 2, 3	};
 
-	unsigned int VBO[2], VAO[2], EBO;
-	glGenVertexArrays(2, VAO);																// Generate Vertex Array Object and assing ID to it
-	glGenBuffers(2, VBO);																	// Generate Vertex Buffer Object and assing ID to it
-	glGenBuffers(1, &EBO);																	// Generate Element Buffer Object and assign ID to it
-
-	glBindVertexArray(VAO[0]);																// Bind the Vertex Array Object first, then bind and set vertex buffers and then configure vertex attributes
-	
-	glBindBuffer(GL_ARRAY_BUFFER, VBO[0]);													// Bind buffer object to the current buffer type target
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);				// Allocates memory and stores data within the initialized memory in the currently bound buffer object
-																							// [Parameters] First: Type of buffer we want to copy data into. Second: size of data (in bytes).
-																							// Third: data we want to send; Fourth: specifies how we want the graphics card to manage the given data
-	//glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);												// Bind EBO
-	//glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);		// Copy indices into the buffer via glBufferData(); 
-	
-																							// First Buffer
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);			// Specifies how OpenGL should interpret the vertex buffer data whenever a drawing call is made.
-																							// [Parameters] First: Specify which vertex attribute to configure. Second: Specify size of the vertex attribute
-																							// Third: Specify type of data. Fourth: Whether data should be normalized. Fifth: Specify stride (space b/w consecutive
-																							// vertex arrtibute sets. Sixth: Specify offset of the begin position data
-	glEnableVertexAttribArray(0);															// Enables generic vertex attribute, giving location as its argument (disabled by default)
-	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
-	glEnableVertexAttribArray(1);
-
-
-	// Second buffer
-	glBindVertexArray(VAO[1]);
-	glBindBuffer(GL_ARRAY_BUFFER, VBO[1]);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices2), vertices2, GL_STATIC_DRAW);
-
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);												// EBO binds to a CURRENTLY ACRIVE ARRAY BUFFER 
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);					// Update 0 layout (position attribute)
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3*sizeof(float)));	// Update 1 layout (color attribute)
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));	// Update 2 layout (texture coords attribute)
-	glEnableVertexAttribArray(2);
-
-	
+
+	SceneMeshes meshes;
+	MeshOptimizer<ColorVertex>::Stats trianglesStats;
+	MeshOptimizer<TexturedVertex>::Stats quadStats;
+	meshes.triangles = MeshOptimizer<ColorVertex>::Optimize(vertices, sizeof(vertices) / sizeof(vertices[0]), nullptr, 0, &trianglesStats);	// Drawn unindexed so far; welding shares (0.0, -0.4, 0.0)
+	meshes.quad = MeshOptimizer<TexturedVertex>::Optimize(vertices2, sizeof(vertices2) / sizeof(vertices2[0]), indices, sizeof(indices) / sizeof(indices[0]), &quadStats);
+	trianglesStats.Print("triangles");
+	quadStats.Print("quad");
+	return meshes;
+}
+
+// 'count' copies of the quad on a square grid over clip space, each centered in its cell at half its size (as the
+// single quad is in the window), showing its own cell of the textures and tinted towards the bottom right. A single
+// instance is the plain quad: no offset, unit scale, whole texture, white
+std::vector<QuadInstance> LayoutQuadInstances(int count)
+{
+	int side = (int)ceil(sqrt((double)count));
+	float cell = 2.0f / side;
+	float fade = side > 1 ? 0.5f / (side - 1) : 0.0f;
+	std::vector<QuadInstance> instances(count);
+	for (int i = 0; i < count; i++)
+	{
+		int column = i % side, row = i / side;
+		vertex::vec4 offsetScale = { -1.0f + cell * (column + 0.5f), 1.0f - cell * (row + 0.5f), cell * 0.5f, cell * 0.5f };		// The quad is 1 wide
+		vertex::vec4 uvRect = { (float)column / side, 1.0f - (float)(row + 1) / side, 1.0f / side, 1.0f / side };
+		vertex::vec4 tint = { 1.0f - fade * column, 1.0f, 1.0f - fade * row, 1.0f };
+		instances[i].aOffsetScale = offsetScale;
+		instances[i].aUVRect = uvRect;
+		vertex::Encode(tint, instances[i].aTint);
+	}
+	return instances;
+}
+
+Scene SetupScene(const SceneImages& images)
+{
+	Scene scene;
+	scene.state = std::make_shared<GLStateCache>();
+	GLStateCache& state = *scene.state;
+
+	// ---------- Set up vertex data (and buffers) and configure vertex attributes ----------
+	static const SceneMeshes meshes = OptimizeSceneMeshes();								// Once per process, however many contexts set the scene up
+
+	scene.vertices = std::make_shared<BufferArena>();										// One vertex and one index buffer for all meshes; each mesh gets a range
+	scene.indices = std::make_shared<BufferArena>();
+	scene.vertices->Create(64 * 1024);
+	scene.indices->Create(16 * 1024);
+	BufferArena& vertexArena = *scene.vertices;
+	BufferArena& indexArena = *scene.indices;
+
+	// First mesh. Vertex ranges are aligned to the vertex size, so offset / stride is the mesh's base vertex
+	int triangleVertices = vertexArena.Add(meshes.triangles.vertices.data(), (unsigned int)(meshes.triangles.vertices.size() * sizeof(ColorVertex)), sizeof(ColorVertex));
+	int triangleIndices = indexArena.Add(meshes.triangles.indexData.data(), (unsigned int)meshes.triangles.indexData.size());
+
+	// Second mesh
+#if COMPRESSED_VERTICES
+	std::vector<PackedTexturedVertex> packed;
+	bool compressed = VertexLayout::Compress(meshes.quad.vertices.data(), meshes.quad.vertices.size(), packed, 0.5f / 255.0f);			// Half a step of 8-bit color; the full format is kept if it's exceeded
+	unsigned int quadStride = compressed ? sizeof(PackedTexturedVertex) : sizeof(TexturedVertex);
+	int quadVertices = compressed ? vertexArena.Add(packed.data(), (unsigned int)(packed.size() * sizeof(PackedTexturedVertex)), quadStride)
+								  : vertexArena.Add(meshes.quad.vertices.data(), (unsigned int)(meshes.quad.vertices.size() * sizeof(TexturedVertex)), quadStride);
+#else
+	unsigned int quadStride = sizeof(TexturedVertex);
+	int quadVertices = vertexArena.Add(meshes.quad.vertices.data(), (unsigned int)(meshes.quad.vertices.size() * sizeof(TexturedVertex)), quadStride);
+#endif
+	int quadIndices = indexArena.Add(meshes.quad.indexData.data(), (unsigned int)meshes.quad.indexData.size());
+#if QUAD_INSTANCES
+	std::vector<QuadInstance> instances = LayoutQuadInstances(QUAD_INSTANCES);				// Per-instance stream, in the vertex arena next to the quad it copies
+	int quadInstances = vertexArena.Add(instances.data(), (unsigned int)(instances.size() * sizeof(QuadInstance)), sizeof(QuadInstance));
+#endif
+
+	// Draw parameters are read once everything is allocated (an arena that grows moves its ranges)
+	scene.mesh[0] = ArenaDraw(indexArena, triangleIndices, meshes.triangles.indexCount, meshes.triangles.indexType, vertexArena, triangleVertices, sizeof(ColorVertex));
+	scene.mesh[1] = ArenaDraw(indexArena, quadIndices, meshes.quad.indexCount, meshes.quad.indexType, vertexArena, quadVertices, quadStride);
+
+	// One VAO per vertex format. Both point at the start of the arenas; meshes pick their range with the draw's base vertex and index offset
+	glGenVertexArrays(2, scene.VAO);														// Generate Vertex Array Object and assing ID to it
+	state.BindVertexArray(scene.VAO[0]);													// Bind the Vertex Array Object first, then bind and set vertex buffers and then configure vertex attributes
+	state.BindBuffer(GL_ARRAY_BUFFER, vertexArena.ID());									// Bind buffer object to the current buffer type target
+	state.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexArena.ID());								// EBO binds to a CURRENTLY ACRIVE ARRAY BUFFER
+	VertexLayout::Apply<ColorVertex>();														// Specifies how OpenGL should interpret the vertex buffer data whenever a drawing call is made:
+																							// one glVertexAttribPointer + glEnableVertexAttribArray per attribute, with the
+																							// stride and offsets of the ColorVertex struct
+
+	state.BindVertexArray(scene.VAO[1]);
+	state.BindBuffer(GL_ARRAY_BUFFER, vertexArena.ID());
+	state.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexArena.ID());
+#if COMPRESSED_VERTICES
+	if (compressed)
+		VertexLayout::Apply<PackedTexturedVertex>();										// Same locations, packed component types
+	else
+#endif
+	VertexLayout::Apply<TexturedVertex>();													// Position, color and texture coords layouts
+#if QUAD_INSTANCES
+	VertexLayout::Apply<QuadInstance>(vertexArena.Get(quadInstances).offset, 1);			// Offset/scale, UV rect and tint, advancing once per instance instead of per vertex
+#endif
+
+
 
 	//glBindBuffer(GL_ARRAY_BUFFER, 0);														// Unbind buffer. Since glVertexAttribPointer call registered VBO as the vertex attribute's bound VBO, its safe to unbind
 
@@ -119,19 +704,17 @@ int main()
 
 
 #if WIREFRAME
-	glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);												// Draws in wireframe polygons
+	state.PolygonMode(GL_LINE);																// Draws in wireframe polygons
 #endif
 
 	// ---------- Set up and load Textures ----------
-	// Instanciate a texture ID
-	unsigned int texture[1];
-	glGenTextures(2, texture);																// [Parameters] First: how many textures to generate. Second: Where to store those generated textures 
-	glBindTexture(GL_TEXTURE_2D, texture[0]);
+	glGenTextures(2, scene.texture);														// [Parameters] First: how many textures to generate. Second: Where to store those generated textures
+	state.BindTextureUnit(0, GL_TEXTURE_2D, scene.texture[0]);
 
 	// Set texture wrap option																// Coordinate axis' for textures are 's, t, r' (equivalent to 'x, y, z')
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT);					// [Parameters] First: Specify the texture target (since 2D texture is used in this case the target is GL_TEXTURE2D)
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT);					// Second: Option to set for which texture axis. Third: Texture wrapping mode
-	
+
 	// GL_CLAMP_TO_BORDER option setup
 	float borderColor[] = { 1.0f, 1.0f, 0.0f, 1.0f };
 	glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, borderColor);
@@ -140,127 +723,141 @@ int main()
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);						// Use nearest neighbor filtering for minifying
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);						// Use linear filtering for magnifyig
 
-																								// Load in and create textures (using stb_image.h library)
-	int width, height, nrChannels;
-	stbi_set_flip_vertically_on_load(true);														// Flips any loaded image vertically
-	unsigned char* data = stbi_load("Textures/w33d.jpg", &width, &height, &nrChannels, 0);	// [Parameters] First: location of an image file. Second+Third: image's width and height. 
-																								// Fourth: number of color channels
-	if (!data)
-	{
-		printf("TEXTURE::LOAD_FAIL\n");
-	}
-	
-
 	// Generate texture using previously loaded image data
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);	// [Parameters] First: Specify the texture target: setting it to GL_TEXTURE_2D will generate a texture
-																								// on the currently bound texture object at the same target (so any textues bound to targets GL_TEXTURE_1D / 3D 
-																								// will not be affected). 
+	TimelineScope uploadPhase("glTexImage2D", "Textures/w33d.jpg");
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, images.image[0].width, images.image[0].height, 0, GL_RGB, GL_UNSIGNED_BYTE, images.image[0].data);
+																								// [Parameters] First: Specify the texture target: setting it to GL_TEXTURE_2D will generate a texture
+																								// on the currently bound texture object at the same target (so any textues bound to targets GL_TEXTURE_1D / 3D
+																								// will not be affected).
 																								// Second: Specify the mipmap level for which to create a texture (if want to set up each mipmap
 																								// level manually) or 0 for base level.
-																								// Third: Specify in what kind of format to store the texture (since in this case image has only RGB 
+																								// Third: Specify in what kind of format to store the texture (since in this case image has only RGB
 																								// values, store the texture with RGB values as well
 																								// Fourth + Fifth: set width and heigth
 																								// Sixth: should always be 0 (b/c legacy)
-																								// Seventh and Eight: Specify the format and datatype of the source image (since image was loaded with 
+																								// Seventh and Eight: Specify the format and datatype of the source image (since image was loaded with
 																								// RGB values and stored as char (bytes), pass in corresponding values)
 																								// Ninth: actual image data
+	uploadPhase.End();
+	TimelineScope mipmapPhase("glGenerateMipmap", "Textures/w33d.jpg");
 	glGenerateMipmap(GL_TEXTURE_2D);															// Generates texture mipmaps
-
-	// Free the image memory before new load
-	stbi_image_free(data);
+	mipmapPhase.End();
 
 	// Load another texture
-	glBindTexture(GL_TEXTURE_2D, texture[1]);
-	
+	state.BindTextureUnit(0, GL_TEXTURE_2D, scene.texture[1]);
+
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT);
-	
+
 	// Setup texture filtering for magnifying and minifying
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-	data = stbi_load("Textures/SlepoyEvrei.png", &width, &height, &nrChannels, 4);
-	if (!data)
-	{
-		printf("TEXTURE::LOAD_FAIL\n");
-	}
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	TimelineScope uploadPhase2("glTexImage2D", "Textures/SlepoyEvrei.png");
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, images.image[1].width, images.image[1].height, 0, GL_RGBA, GL_UNSIGNED_BYTE, images.image[1].data);
+	uploadPhase2.End();
+	TimelineScope mipmapPhase2("glGenerateMipmap", "Textures/SlepoyEvrei.png");
 	glGenerateMipmap(GL_TEXTURE_2D);
+	mipmapPhase2.End();
 
-	// Free the image memory
-	stbi_image_free(data);																		
+	// ---------- Uniform blocks ----------
+	scene.uniforms = std::make_shared<UniformRing>();
+	scene.uniforms->Create(64 * 1024);
 
+	return scene;
+}
 
-	// Set uniforms
-	ourShader.Use();															// Activate shader before setting uniforms
-	glUniform1i(glGetUniformLocation(ourShader.ID, "texture1"), 0);				// Setting it manually
-	ourShader.setInt("texture2", 1);											// SEtiing it with shader class
-
-	// ---------- Render Loop ----------
-	while (!glfwWindowShouldClose(pWindow))
-	{
-		// Input
-		ProcessInput(pWindow);
+// Points the two samplers at texture units 0 and 1 and the uniform blocks at their binding points, and checks the
+// program's vertex inputs against the format it is drawn with
+void SetupProgram(Shader& shader)
+{
+	shader.Use();																		// Activate shader before setting uniforms
+	glUniform1i(shader.GetUniformLocation("texture1"), 0);								// Setting it manually (location comes from the shader's uniform cache)
+	shader.setInt("texture2", 1);														// SEtiing it with shader class
+	UniformBuffers::BindBlocks(shader.ID);
+	UniformBuffers::ValidateBlocks(shader.ID);
+#if QUAD_INSTANCES
+	VertexLayout::Validate<TexturedVertex, QuadInstance>(shader.ID);					// The quad is drawn from TexturedVertex data, copied per QuadInstance
+#else
+	VertexLayout::Validate<TexturedVertex>(shader.ID);									// The quad is drawn from TexturedVertex data
+#endif
+}
 
-		// Render 
-		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);												// Clear color buffer and set specific color to it at the same time
-		glClear(GL_COLOR_BUFFER_BIT);														// Specify which buffer we want to clean
+// Draws the scene once into a tiny offscreen target, so the code generation drivers leave for the first draw with a
+// program (and these textures, vertex layout and uniform blocks) happens here and not in the first frame
+void WarmupScene(const Scene& scene, Shader& shader)
+{
+#if SHADER_WARMUP
+	ShaderWarmup warmup;
+	warmup.Add("Texture", [&scene, &shader]() { RenderScene(scene, shader); });
+	warmup.Run();
+#endif
+}
 
-		// Bind texture
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, texture[0]);
-		glActiveTexture(GL_TEXTURE1);
-		glBindTexture(GL_TEXTURE_2D, texture[1]);
+void ClearScene()
+{
+	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);												// Clear color buffer and set specific color to it at the same time
+	glClear(GL_COLOR_BUFFER_BIT);														// Specify which buffer we want to clean
+}
 
-		// Draw 
-		ourShader.Use();
-		
-		// Draw using data from first VAO
+void RenderScene(const Scene& scene, Shader& shader)
+{
+	GLStateCache& state = *scene.state;
+	state.BeginFrame();
+	ClearScene();
+
+	// Bind texture (after the first frame these are already bound and the cache drops them)
+	state.BindTextureUnit(0, GL_TEXTURE_2D, scene.texture[0]);
+	state.BindTextureUnit(1, GL_TEXTURE_2D, scene.texture[1]);
+
+	// Uniform blocks: everything for the frame is written straight into the mapped ring, the draw binds its ranges
+	UniformRing& uniforms = *scene.uniforms;
+	uniforms.BeginFrame();
+	FrameBlock frame = {};
+	frame.viewport = { 0.0f, 0.0f, (float)WIN_WIDTH, (float)WIN_HEIGHT };
+	static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();		// glfwGetTime() needs GLFW, headless runs don't have it
+	frame.time = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+	frame.frame = uniforms.FrameCount();
+	MaterialBlock material = {};
+	material.tint = { 1.0f, 1.0f, 1.0f, 1.0f };
+	ObjectBlock object = {};
+	object.offsetScale = { 0.0f, 0.0f, 1.0f, 1.0f };
+	UniformRange frameRange = uniforms.Push(frame);
+	UniformRange materialRange = uniforms.Push(material);
+	UniformRange objectRange = uniforms.Push(object);
+	uniforms.Upload();
+	uniforms.Bind<FrameBlock>(frameRange, &state);
+	uniforms.Bind<MaterialBlock>(materialRange, &state);
+	uniforms.Bind<ObjectBlock>(objectRange, &state);
+
+	// Draw
+	state.UseProgram(shader.ID);
+
+	// Draw using data from first VAO
 #if 0
-		glBindVertexArray(VAO[0]);
-		glDrawArrays(GL_TRIANGLES, 0, 6);
+	state.BindVertexArray(scene.VAO[0]);
+	scene.mesh[0].Draw();
 #endif
-		// Draw using data from second VAO
-		
-		glBindVertexArray(VAO[1]);
-		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+	// Draw using data from second VAO
 
-
-		//glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);								// [Parameters] First: specify mode to draw in. Second: count/number of elements to draw. 
-																							// Third: type of indices data. Fourth: offset in EBO
-		
-
-		// GLFW: Swap buffers and poll IO events (keys pressed/released, mouse movement,	 etc)
-		glfwSwapBuffers(pWindow);															// Swaps the color buffer (large buffer that contains color values for each pixel in GLFW's
-																							// window) that has been used to draw in during this iteration and outputs to screen
-		glfwPollEvents();																	// Checks if any events are triggered (i.e keyboard input or mouse movement), 
-																							// updates window state and calls appropriate callback methods
-	}
-	
-	// ---------- Clean up ----------
-	glDeleteVertexArrays(2, VAO);
-	glDeleteBuffers(2, VBO);
-	glDeleteBuffers(1, &EBO);
-	glfwTerminate();
-
-	return 0;
-}
+	state.BindVertexArray(scene.VAO[1]);
+#if QUAD_INSTANCES
+	scene.mesh[1].DrawInstanced(QUAD_INSTANCES);
+#else
+	scene.mesh[1].Draw();
+#endif
 
 
-void ProcessInput(GLFWwindow* pWindow)
-{
-	// Returns whether the key is currently being pressed
-	if (glfwGetKey(pWindow, GLFW_KEY_ESCAPE) == GLFW_PRESS)									// If ESC key is pressed, close the window
-	{
-		glfwSetWindowShouldClose(pWindow, true);
-	}
+	//glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);								// [Parameters] First: specify mode to draw in. Second: count/number of elements to draw.
+																						// Third: type of indices data. Fourth: offset in EBO
 }
 
-void Framebuffer_size_callback(GLFWwindow* pWindow, int width, int height)
+void CleanupScene(Scene& scene)
 {
-	// Ensure that viewport matches the new window dimenstions.
-	glViewport(0, 0, width, height);
+	scene.uniforms.reset();
+	scene.state.reset();
+	glDeleteTextures(2, scene.texture);
+	glDeleteVertexArrays(2, scene.VAO);
+	scene.vertices.reset();
+	scene.indices.reset();
 }
-
-
-
@@ -0,0 +1,48 @@
+#ifndef MY_GLAD_H
+#define MY_GLAD_H
+
+#include <glad/glad.h>
+
+// Additions to the generated loader that live in glad.c (glad/glad.h itself is left untouched)
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Same as gladLoadGLLoader(), but every function pointer starts as a trampoline that resolves itself on first call.
+// 'load' has to stay valid for as long as unresolved GL functions may be called (glfwGetProcAddress / eglGetProcAddress do)
+int gladLoadGLLoaderLazy(GLADloadproc load);
+
+// Capability queries for the GL context current on the calling thread: its own GladGLContext when one is current,
+// otherwise the last global load. Extensions are an O(1) hashed lookup into the set built when that table was loaded.
+// Use these instead of GLAD_GL_VERSION_* / glad_gl* != NULL, which only describe the global load and, once
+// context dispatch is on, point at forwarding stubs that are never NULL.
+int gladHasExtension(const char* ext);
+int gladGetExtensionCount(void);
+int gladIsGLVersionAtLeast(int major, int minor);
+int gladHasGLFunction(const char* name);
+// Changes whenever a different table is current or the current one is loaded again; never 0 once something was loaded.
+// Lets callers cache the answers above per context
+unsigned int gladGetGLContextId(void);
+
+// Optional per-context dispatch for driving several GL contexts from different threads.
+// gladEnableGLContextDispatch() selects this mode for the rest of the process; it is thread-safe and only the first
+// call does anything. From then on every gl* call goes through the calling thread's table (set with
+// gladMakeGLContextCurrent). Threads without a table use the default one, which holds whatever gladLoadGLLoader or
+// gladLoadGLLoaderLazy loaded before or after the switch (after it, loads are always eager and fill only that table).
+// gladCreateGLContext() loads a table, with its own version and extension set, for the GL context current on the
+// calling thread; it does not change the dispatch mode by itself.
+// Programs that never enable dispatch (like main.cpp) call straight into the driver with no extra indirection.
+typedef struct GladGLContext GladGLContext;
+
+void gladEnableGLContextDispatch(void);
+GladGLContext* gladCreateGLContext(GLADloadproc load);
+void gladDestroyGLContext(GladGLContext* context);
+void gladMakeGLContextCurrent(GladGLContext* context);
+GladGLContext* gladGetCurrentGLContext(void);
+struct gladGLversionStruct gladGetGLContextVersion(const GladGLContext* context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MY_GLAD_H